@@ -7,8 +7,11 @@
 #include "theme.hpp"
 #include "vicinae-ipc/client.hpp"
 #include "server.hpp"
+#include <cstring>
 #include <filesystem>
+#include <poll.h>
 #include <ranges>
+#include <unistd.h>
 
 constexpr const std::string_view HEADLINE = "A focused launcher for your desktop — native, fast, extensible";
 
@@ -261,9 +264,7 @@ class DMenuCommand : public AbstractCommandLineCommand {
   }
 
   bool run(CLI::App *app) override {
-    m_req.rawContent = vicinae::slurp(std::cin);
-
-    const auto res = ipc::CliClient::oneshot<ipc::DMenu>(m_req);
+    const auto res = stream();
 
     if (!res) {
       std::println(std::cerr, "Failed to invoke dmenu: {}", res.error());
@@ -276,6 +277,50 @@ class DMenuCommand : public AbstractCommandLineCommand {
   }
 
 private:
+  static constexpr size_t READ_BUFFER_SIZE = 64 * 1024;
+
+  /**
+   * Open the dmenu right away and forward stdin as it is read, so that the first entries of slow
+   * producers (`find /`, `rg --files`...) show up immediately.
+   */
+  std::expected<ipc::DMenu::Response, std::string> stream() {
+    auto client = ipc::CliClient::make();
+
+    if (!client) { return std::unexpected(client.error()); }
+    if (const auto result = client->connect(); !result) { return std::unexpected(result.error()); }
+
+    m_req.stream = true;
+
+    if (!client->sendRequest<ipc::DMenu>(m_req)) { return std::unexpected("Failed to send dmenu request"); }
+
+    std::string buf(READ_BUFFER_SIZE, 0);
+    pollfd fds[2] = {{.fd = client->handle(), .events = POLLIN}, {.fd = STDIN_FILENO, .events = POLLIN}};
+    bool eof = false;
+
+    // an entry can be selected before the end of the input, in which case we stop reading
+    while (!eof) {
+      if (poll(fds, 2, -1) == -1) {
+        if (errno == EINTR) continue;
+        return std::unexpected(std::format("Failed to poll: {}", strerror(errno)));
+      }
+
+      if (fds[0].revents) break;
+      if (!fds[1].revents) continue;
+
+      ssize_t n = read(STDIN_FILENO, buf.data(), buf.size());
+
+      if (n == -1) {
+        if (errno == EINTR) continue;
+        return std::unexpected(std::format("Failed to read stdin: {}", strerror(errno)));
+      }
+
+      eof = n == 0;
+      client->notify<ipc::DMenuAppend>({.data = buf.substr(0, n), .eof = eof});
+    }
+
+    return client->readResponse<ipc::DMenu>();
+  }
+
   ipc::DMenu::Request m_req;
 };
 
@@ -2,6 +2,7 @@
 #include <cstdint>
 #include <string_view>
 #include <span>
+#include <vector>
 #include "generated/db.hpp"
 
 namespace emoji {
@@ -24,6 +25,13 @@ std::string applySkinTone(std::string_view emoji, SkinTone tone);
 const EmojiData *findStaticEmoji(std::string_view emoji);
 std::span<const EmojiData> emojis();
 
+/**
+ * Indexes in `emojis()` of the emojis for which every word of `query` is the prefix of a word of their
+ * name, group or keywords, ignoring ASCII case. In ascending order, resolved from the prebuilt token
+ * index without looking at the emojis themselves.
+ */
+std::vector<std::uint16_t> searchCandidates(std::string_view query);
+
 bool isUtf8EncodedEmoji(std::string_view str);
 
 } // namespace emoji
@@ -1,7 +1,9 @@
 #pragma once
+#include <cstddef>
+#include <cstdint>
 #include <string_view>
 #include <array>
-#include <unordered_map>
+#include <span>
 #include <initializer_list>
 
 struct EmojiData {
@@ -14,8 +16,25 @@ struct EmojiData {
 
 class StaticEmojiDatabase {
 	public:
+		static constexpr std::size_t count = 1906;
+
 		StaticEmojiDatabase() = delete;
-		static const std::array<EmojiData, 1906>& orderedList();
-		static const std::unordered_map<std::string_view, const EmojiData*>& mapping();
+		static const std::array<EmojiData, count>& orderedList();
 		static const std::array<std::string_view, 9>& groups();
+
+		/**
+		 * Exact lookup, through a minimal perfect hash generated along with the list.
+		 * Returns nullptr if `emoji` is not part of the database.
+		 */
+		static const EmojiData* find(std::string_view emoji);
+
+		/**
+		 * Lowercased words of the names, groups and keywords of all emojis, sorted bytewise.
+		 */
+		static std::span<const std::string_view> tokens();
+
+		/**
+		 * Indexes in `orderedList()` of the emojis having the token at `tokenIdx`, in ascending order.
+		 */
+		static std::span<const std::uint16_t> tokenEmojis(std::size_t tokenIdx);
 };
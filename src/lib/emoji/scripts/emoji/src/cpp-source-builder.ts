@@ -11,12 +11,39 @@ type EmojiInfo = {
 
 const quoted = (s: string) => `"${s}"`;
 
+/**
+ * Words used by the search index: lowercased, split on anything that is neither an ASCII letter or digit
+ * nor part of a non-ASCII character. Must stay in sync with the query tokenizer of `emoji.cpp`.
+ */
+const tokenize = (s: string): string[] =>
+	s.replace(/[A-Z]/g, c => c.toLowerCase()).split(/[\x00-\x2f\x3a-\x60\x7b-\x7f]+/).filter(token => token.length > 0);
+
+/**
+ * 32 bit FNV-1a over the UTF-8 bytes of `s`, mirrors `mphHash` in the generated source.
+ */
+const mphHash = (s: string, seed: number): number => {
+	let hash = (2166136261 ^ seed) >>> 0;
+
+	for (const byte of Buffer.from(s, 'utf8')) {
+		hash = Math.imul(hash ^ byte, 16777619) >>> 0;
+	}
+
+	return hash;
+};
+
+const byteOrder = (a: string, b: string) => Buffer.compare(Buffer.from(a, 'utf8'), Buffer.from(b, 'utf8'));
+
 export class CppSourceBuilder {
 	private m_emojis: EmojiInfo[] = [];
 	private m_keywords: string[] = [];
 	private m_groups: string[] = [];
 	private m_keywordMap = new Map<string, number>();
 	private m_groupMap = new Map<string, number>();
+	private m_seeds: number[] = [];
+	private m_slots: number[] = [];
+	private m_tokens: string[] = [];
+	private m_tokenOffsets: number[] = [];
+	private m_tokenEmojis: number[] = [];
 
 	private buildItemStruct(info: EmojiInfo): string {
 		return `\tEmojiData{ .emoji = "${info.emoji}", .name = ${quoted(info.name)}, .group = GRP(${info.group}), .keywords = {${info.keywords.map(idx => `KW(${idx})`).join(',')}}, .skinToneSupport = ${info.skinToneSupport}}`;
@@ -24,9 +51,11 @@ export class CppSourceBuilder {
 
 	private buildHeader = (): string => {
 		const HEADER_BASE = `#pragma once
+#include <cstddef>
+#include <cstdint>
 #include <string_view>
 #include <array>
-#include <unordered_map>
+#include <span>
 #include <initializer_list>
 
 struct EmojiData {
@@ -39,10 +68,27 @@ struct EmojiData {
 
 class StaticEmojiDatabase {
 	public:
+		static constexpr std::size_t count = ${this.m_emojis.length};
+
 		StaticEmojiDatabase() = delete;
-		static const std::array<EmojiData, ${this.m_emojis.length}>& orderedList();
-		static const std::unordered_map<std::string_view, const EmojiData*>& mapping();
+		static const std::array<EmojiData, count>& orderedList();
 		static const std::array<std::string_view, ${this.m_groups.length}>& groups();
+
+		/**
+		 * Exact lookup, through a minimal perfect hash generated along with the list.
+		 * Returns nullptr if \`emoji\` is not part of the database.
+		 */
+		static const EmojiData* find(std::string_view emoji);
+
+		/**
+		 * Lowercased words of the names, groups and keywords of all emojis, sorted bytewise.
+		 */
+		static std::span<const std::string_view> tokens();
+
+		/**
+		 * Indexes in \`orderedList()\` of the emojis having the token at \`tokenIdx\`, in ascending order.
+		 */
+		static std::span<const std::uint16_t> tokenEmojis(std::size_t tokenIdx);
 };
 `
 
@@ -54,7 +100,7 @@ class StaticEmojiDatabase {
 	}
 
 	private buildSource() {
-		return `// clang-format off\n\n#include "generated/db.hpp"\n#include <string_view>\n#include <array>\n\n${this.buildCategories()}\n\n${this.buildKeywords()}\n\n${this.buildStaticArray()}\n\nconst std::array<EmojiData, ${this.m_emojis.length}>& StaticEmojiDatabase::orderedList() { return EMOJI_LIST; }\n${this.buildMap()} const std::unordered_map<std::string_view, const EmojiData*>& StaticEmojiDatabase::mapping() { return MAPPING; }\n\nconst std::array<std::string_view, ${this.m_groups.length}>& StaticEmojiDatabase::groups() { return GROUPS; }`;
+		return `// clang-format off\n\n#include "generated/db.hpp"\n#include <string_view>\n#include <array>\n\n${this.buildCategories()}\n\n${this.buildKeywords()}\n\n${this.buildStaticArray()}\n\n${this.buildPerfectHash()}\n\n${this.buildTokenIndex()}\n\nconst std::array<EmojiData, StaticEmojiDatabase::count>& StaticEmojiDatabase::orderedList() { return EMOJI_LIST; }\n\nconst std::array<std::string_view, ${this.m_groups.length}>& StaticEmojiDatabase::groups() { return GROUPS; }\n\n${this.buildFind()}\n\nstd::span<const std::string_view> StaticEmojiDatabase::tokens() { return TOKENS; }\n\nstd::span<const std::uint16_t> StaticEmojiDatabase::tokenEmojis(std::size_t tokenIdx) {\n\treturn std::span(TOKEN_EMOJIS).subspan(TOKEN_OFFSETS[tokenIdx], TOKEN_OFFSETS[tokenIdx + 1] - TOKEN_OFFSETS[tokenIdx]);\n}\n`;
 	}
 
 	private buildCategories() {
@@ -65,11 +111,117 @@ class StaticEmojiDatabase {
 		return `#define KW(idx) KEYWORDS[idx]\n\nstatic constexpr std::array<std::string_view, ${this.m_keywords.length}> KEYWORDS = {\n${this.m_keywords.map(quoted).join(',')}\n};`;
 	}
 
-	private buildMap() {
-		return `const std::unordered_map<std::string_view, const EmojiData*> MAPPING = {
-${this.m_emojis.map(({ emoji }, idx) => `{ ${quoted(emoji)}, &EMOJI_LIST[${idx}] }`).join(',\n')}
+	/**
+	 * Hash and displace: emojis are spread in buckets using a first hash, then the buckets with the most
+	 * emojis pick a seed for which the second hash sends all of their emojis to free slots. Buckets of a
+	 * single emoji store the (negated) slot directly.
+	 */
+	private computePerfectHash() {
+		const n = this.m_emojis.length;
+		const buckets: number[][] = Array.from({ length: n }, () => []);
+		const slots: number[] = new Array(n).fill(-1);
+
+		this.m_seeds = new Array(n).fill(0);
+		this.m_emojis.forEach(({ emoji }, idx) => buckets[mphHash(emoji, 0) % n].push(idx));
+
+		const order = buckets.map((_, idx) => idx).sort((a, b) => buckets[b].length - buckets[a].length || a - b);
+		let freeSlot = 0;
+
+		for (const bucketIdx of order) {
+			const bucket = buckets[bucketIdx];
+
+			if (bucket.length === 0) break;
+
+			if (bucket.length === 1) {
+				while (slots[freeSlot] !== -1) ++freeSlot;
+				slots[freeSlot] = bucket[0];
+				this.m_seeds[bucketIdx] = -freeSlot - 1;
+				continue;
+			}
+
+			for (let seed = 1; ; ++seed) {
+				const taken = bucket.map(idx => mphHash(this.m_emojis[idx].emoji, seed) % n);
+
+				if (new Set(taken).size !== taken.length || taken.some(slot => slots[slot] !== -1)) continue;
+
+				taken.forEach((slot, i) => slots[slot] = bucket[i]);
+				this.m_seeds[bucketIdx] = seed;
+				break;
+			}
+		}
+
+		this.m_slots = slots;
+	}
+
+	private computeTokenIndex() {
+		const index = new Map<string, Set<number>>();
+
+		this.m_emojis.forEach((info, idx) => {
+			const texts = [info.name, this.m_groups[info.group], ...info.keywords.map(kw => this.m_keywords[kw])];
+
+			for (const token of texts.flatMap(tokenize)) {
+				if (!index.has(token)) index.set(token, new Set());
+				index.get(token)!.add(idx);
+			}
+		});
+
+		this.m_tokens = [...index.keys()].sort(byteOrder);
+		this.m_tokenOffsets = [0];
+		this.m_tokenEmojis = [];
+
+		for (const token of this.m_tokens) {
+			this.m_tokenEmojis.push(...[...index.get(token)!].sort((a, b) => a - b));
+			this.m_tokenOffsets.push(this.m_tokenEmojis.length);
+		}
+	}
+
+	private buildPerfectHash() {
+		const first = this.m_emojis[0].emoji;
+		const last = this.m_emojis[this.m_emojis.length - 1].emoji;
+
+		return `static constexpr std::array<std::int32_t, ${this.m_seeds.length}> MPH_SEEDS = {
+${this.m_seeds.join(',')}
 };
-`
+
+static constexpr std::array<std::uint16_t, ${this.m_slots.length}> MPH_SLOTS = {
+${this.m_slots.join(',')}
+};
+
+static constexpr std::uint32_t mphHash(std::string_view str, std::uint32_t seed) {
+	std::uint32_t hash = 2166136261u ^ seed;
+	for (char c : str) { hash = (hash ^ static_cast<std::uint8_t>(c)) * 16777619u; }
+	return hash;
+}
+
+static constexpr std::uint16_t mphIndex(std::string_view emoji) {
+	std::int32_t seed = MPH_SEEDS[mphHash(emoji, 0) % MPH_SEEDS.size()];
+	if (seed < 0) return MPH_SLOTS[-seed - 1];
+	return MPH_SLOTS[mphHash(emoji, seed) % MPH_SLOTS.size()];
+}
+
+static_assert(mphIndex(${quoted(first)}) == 0);
+static_assert(mphIndex(${quoted(last)}) == ${this.m_emojis.length - 1});`;
+	}
+
+	private buildTokenIndex() {
+		return `static constexpr std::array<std::string_view, ${this.m_tokens.length}> TOKENS = {
+${this.m_tokens.map(quoted).join(',')}
+};
+
+static constexpr std::array<std::uint32_t, ${this.m_tokenOffsets.length}> TOKEN_OFFSETS = {
+${this.m_tokenOffsets.join(',')}
+};
+
+static constexpr std::array<std::uint16_t, ${this.m_tokenEmojis.length}> TOKEN_EMOJIS = {
+${this.m_tokenEmojis.join(',')}
+};`;
+	}
+
+	private buildFind() {
+		return `const EmojiData* StaticEmojiDatabase::find(std::string_view emoji) {
+	const EmojiData& data = EMOJI_LIST[mphIndex(emoji)];
+	return data.emoji == emoji ? &data : nullptr;
+}`;
 	}
 
 	constructor() {
@@ -107,6 +259,8 @@ ${this.m_emojis.map(({ emoji }, idx) => `{ ${quoted(emoji)}, &EMOJI_LIST[${idx}]
 		const headerDst = join(outDir, "db.hpp");
 
 		console.log(`Building source files for ${this.m_emojis.length} emojis...`);
+		this.computePerfectHash();
+		this.computeTokenIndex();
 		await mkdir(outDir, { recursive: true });
 
 		await writeFile(join(outDir, "emoji.cpp"), this.buildSource(), 'utf8');
@@ -1,6 +1,10 @@
 #include "emoji/emoji.hpp"
+#include <algorithm>
 #include <array>
+#include <bitset>
+#include <cctype>
 #include <cstdint>
+#include <optional>
 #include <string>
 #include <string_view>
 #include <unicode/uchar.h>
@@ -73,14 +77,60 @@ std::string applySkinTone(std::string_view emoji, SkinTone tone) {
   return result;
 }
 
-const EmojiData *findStaticEmoji(std::string_view emoji) {
-  auto &map = StaticEmojiDatabase::mapping();
-  if (auto it = map.find(emoji); it != map.end()) { return it->second; }
-  return nullptr;
-}
+const EmojiData *findStaticEmoji(std::string_view emoji) { return StaticEmojiDatabase::find(emoji); }
 
 std::span<const EmojiData> emojis() { return StaticEmojiDatabase::orderedList(); }
 
+// same rules as the tokenizer of the generator: only ASCII letters and digits are folded, and
+// everything else that is ASCII separates words
+static bool isTokenSeparator(char c) {
+  auto uc = static_cast<unsigned char>(c);
+  return uc < 0x80 && !std::isalnum(uc);
+}
+
+std::vector<std::uint16_t> searchCandidates(std::string_view query) {
+  using Candidates = std::bitset<StaticEmojiDatabase::count>;
+  const auto tokens = StaticEmojiDatabase::tokens();
+  std::optional<Candidates> candidates;
+  std::string word;
+
+  for (size_t i = 0; i <= query.size(); ++i) {
+    if (i < query.size() && !isTokenSeparator(query[i])) {
+      word.push_back(std::tolower(static_cast<unsigned char>(query[i])));
+      continue;
+    }
+
+    if (word.empty()) continue;
+
+    Candidates matches;
+
+    // tokens starting with `word` are contiguous
+    for (auto it = std::ranges::lower_bound(tokens, word); it != tokens.end() && it->starts_with(word);
+         ++it) {
+      for (auto idx : StaticEmojiDatabase::tokenEmojis(std::distance(tokens.begin(), it))) {
+        matches.set(idx);
+      }
+    }
+
+    candidates = candidates ? (*candidates & matches) : matches;
+    word.clear();
+
+    if (candidates->none()) return {};
+  }
+
+  if (!candidates) return {};
+
+  std::vector<std::uint16_t> indexes;
+
+  indexes.reserve(candidates->count());
+
+  for (size_t i = 0; i != candidates->size(); ++i) {
+    if (candidates->test(i)) indexes.emplace_back(i);
+  }
+
+  return indexes;
+}
+
 static constexpr char32_t kCombiningEnclosingKeycapCharacter = 0x20E3;
 static constexpr char32_t kCombiningEnclosingCircleBackslashCharacter = 0x20E0;
 static constexpr char32_t kZeroWidthJoinerCharacter = 0x200D;
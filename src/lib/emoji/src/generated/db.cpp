@@ -1925,1915 +1925,52 @@ static const std::array<EmojiData, 1906> EMOJI_LIST = {
 	EmojiData{ .emoji = "🏴󠁧󠁢󠁷󠁬󠁳󠁿", .name = "flag Wales", .group = GRP(8), .keywords = {KW(6244),KW(3575),KW(6245),KW(6246),KW(6247),KW(6248),KW(2193),KW(6249),KW(381),KW(6250)}, .skinToneSupport = false}
 };
 
-const std::array<EmojiData, 1906>& StaticEmojiDatabase::orderedList() { return EMOJI_LIST; }
-const std::unordered_map<std::string_view, const EmojiData*> MAPPING = {
-{ "😀", &EMOJI_LIST[0] },
-{ "😃", &EMOJI_LIST[1] },
-{ "😄", &EMOJI_LIST[2] },
-{ "😁", &EMOJI_LIST[3] },
-{ "😆", &EMOJI_LIST[4] },
-{ "😅", &EMOJI_LIST[5] },
-{ "🤣", &EMOJI_LIST[6] },
-{ "😂", &EMOJI_LIST[7] },
-{ "🙂", &EMOJI_LIST[8] },
-{ "🙃", &EMOJI_LIST[9] },
-{ "🫠", &EMOJI_LIST[10] },
-{ "😉", &EMOJI_LIST[11] },
-{ "😊", &EMOJI_LIST[12] },
-{ "😇", &EMOJI_LIST[13] },
-{ "🥰", &EMOJI_LIST[14] },
-{ "😍", &EMOJI_LIST[15] },
-{ "🤩", &EMOJI_LIST[16] },
-{ "😘", &EMOJI_LIST[17] },
-{ "😗", &EMOJI_LIST[18] },
-{ "☺️", &EMOJI_LIST[19] },
-{ "😚", &EMOJI_LIST[20] },
-{ "😙", &EMOJI_LIST[21] },
-{ "🥲", &EMOJI_LIST[22] },
-{ "😋", &EMOJI_LIST[23] },
-{ "😛", &EMOJI_LIST[24] },
-{ "😜", &EMOJI_LIST[25] },
-{ "🤪", &EMOJI_LIST[26] },
-{ "😝", &EMOJI_LIST[27] },
-{ "🤑", &EMOJI_LIST[28] },
-{ "🤗", &EMOJI_LIST[29] },
-{ "🤭", &EMOJI_LIST[30] },
-{ "🫢", &EMOJI_LIST[31] },
-{ "🫣", &EMOJI_LIST[32] },
-{ "🤫", &EMOJI_LIST[33] },
-{ "🤔", &EMOJI_LIST[34] },
-{ "🫡", &EMOJI_LIST[35] },
-{ "🤐", &EMOJI_LIST[36] },
-{ "🤨", &EMOJI_LIST[37] },
-{ "😐", &EMOJI_LIST[38] },
-{ "😑", &EMOJI_LIST[39] },
-{ "😶", &EMOJI_LIST[40] },
-{ "🫥", &EMOJI_LIST[41] },
-{ "😶‍🌫️", &EMOJI_LIST[42] },
-{ "😏", &EMOJI_LIST[43] },
-{ "😒", &EMOJI_LIST[44] },
-{ "🙄", &EMOJI_LIST[45] },
-{ "😬", &EMOJI_LIST[46] },
-{ "😮‍💨", &EMOJI_LIST[47] },
-{ "🤥", &EMOJI_LIST[48] },
-{ "🫨", &EMOJI_LIST[49] },
-{ "🙂‍↔️", &EMOJI_LIST[50] },
-{ "🙂‍↕️", &EMOJI_LIST[51] },
-{ "😌", &EMOJI_LIST[52] },
-{ "😔", &EMOJI_LIST[53] },
-{ "😪", &EMOJI_LIST[54] },
-{ "🤤", &EMOJI_LIST[55] },
-{ "😴", &EMOJI_LIST[56] },
-{ "🫩", &EMOJI_LIST[57] },
-{ "😷", &EMOJI_LIST[58] },
-{ "🤒", &EMOJI_LIST[59] },
-{ "🤕", &EMOJI_LIST[60] },
-{ "🤢", &EMOJI_LIST[61] },
-{ "🤮", &EMOJI_LIST[62] },
-{ "🤧", &EMOJI_LIST[63] },
-{ "🥵", &EMOJI_LIST[64] },
-{ "🥶", &EMOJI_LIST[65] },
-{ "🥴", &EMOJI_LIST[66] },
-{ "😵", &EMOJI_LIST[67] },
-{ "😵‍💫", &EMOJI_LIST[68] },
-{ "🤯", &EMOJI_LIST[69] },
-{ "🤠", &EMOJI_LIST[70] },
-{ "🥳", &EMOJI_LIST[71] },
-{ "🥸", &EMOJI_LIST[72] },
-{ "😎", &EMOJI_LIST[73] },
-{ "🤓", &EMOJI_LIST[74] },
-{ "🧐", &EMOJI_LIST[75] },
-{ "😕", &EMOJI_LIST[76] },
-{ "🫤", &EMOJI_LIST[77] },
-{ "😟", &EMOJI_LIST[78] },
-{ "🙁", &EMOJI_LIST[79] },
-{ "☹️", &EMOJI_LIST[80] },
-{ "😮", &EMOJI_LIST[81] },
-{ "😯", &EMOJI_LIST[82] },
-{ "😲", &EMOJI_LIST[83] },
-{ "😳", &EMOJI_LIST[84] },
-{ "🥺", &EMOJI_LIST[85] },
-{ "🥹", &EMOJI_LIST[86] },
-{ "😦", &EMOJI_LIST[87] },
-{ "😧", &EMOJI_LIST[88] },
-{ "😨", &EMOJI_LIST[89] },
-{ "😰", &EMOJI_LIST[90] },
-{ "😥", &EMOJI_LIST[91] },
-{ "😢", &EMOJI_LIST[92] },
-{ "😭", &EMOJI_LIST[93] },
-{ "😱", &EMOJI_LIST[94] },
-{ "😖", &EMOJI_LIST[95] },
-{ "😣", &EMOJI_LIST[96] },
-{ "😞", &EMOJI_LIST[97] },
-{ "😓", &EMOJI_LIST[98] },
-{ "😩", &EMOJI_LIST[99] },
-{ "😫", &EMOJI_LIST[100] },
-{ "🥱", &EMOJI_LIST[101] },
-{ "😤", &EMOJI_LIST[102] },
-{ "😡", &EMOJI_LIST[103] },
-{ "😠", &EMOJI_LIST[104] },
-{ "🤬", &EMOJI_LIST[105] },
-{ "😈", &EMOJI_LIST[106] },
-{ "👿", &EMOJI_LIST[107] },
-{ "💀", &EMOJI_LIST[108] },
-{ "☠️", &EMOJI_LIST[109] },
-{ "💩", &EMOJI_LIST[110] },
-{ "🤡", &EMOJI_LIST[111] },
-{ "👹", &EMOJI_LIST[112] },
-{ "👺", &EMOJI_LIST[113] },
-{ "👻", &EMOJI_LIST[114] },
-{ "👽", &EMOJI_LIST[115] },
-{ "👾", &EMOJI_LIST[116] },
-{ "🤖", &EMOJI_LIST[117] },
-{ "😺", &EMOJI_LIST[118] },
-{ "😸", &EMOJI_LIST[119] },
-{ "😹", &EMOJI_LIST[120] },
-{ "😻", &EMOJI_LIST[121] },
-{ "😼", &EMOJI_LIST[122] },
-{ "😽", &EMOJI_LIST[123] },
-{ "🙀", &EMOJI_LIST[124] },
-{ "😿", &EMOJI_LIST[125] },
-{ "😾", &EMOJI_LIST[126] },
-{ "🙈", &EMOJI_LIST[127] },
-{ "🙉", &EMOJI_LIST[128] },
-{ "🙊", &EMOJI_LIST[129] },
-{ "💌", &EMOJI_LIST[130] },
-{ "💘", &EMOJI_LIST[131] },
-{ "💝", &EMOJI_LIST[132] },
-{ "💖", &EMOJI_LIST[133] },
-{ "💗", &EMOJI_LIST[134] },
-{ "💓", &EMOJI_LIST[135] },
-{ "💞", &EMOJI_LIST[136] },
-{ "💕", &EMOJI_LIST[137] },
-{ "💟", &EMOJI_LIST[138] },
-{ "❣️", &EMOJI_LIST[139] },
-{ "💔", &EMOJI_LIST[140] },
-{ "❤️‍🔥", &EMOJI_LIST[141] },
-{ "❤️‍🩹", &EMOJI_LIST[142] },
-{ "❤️", &EMOJI_LIST[143] },
-{ "🩷", &EMOJI_LIST[144] },
-{ "🧡", &EMOJI_LIST[145] },
-{ "💛", &EMOJI_LIST[146] },
-{ "💚", &EMOJI_LIST[147] },
-{ "💙", &EMOJI_LIST[148] },
-{ "🩵", &EMOJI_LIST[149] },
-{ "💜", &EMOJI_LIST[150] },
-{ "🤎", &EMOJI_LIST[151] },
-{ "🖤", &EMOJI_LIST[152] },
-{ "🩶", &EMOJI_LIST[153] },
-{ "🤍", &EMOJI_LIST[154] },
-{ "💋", &EMOJI_LIST[155] },
-{ "💯", &EMOJI_LIST[156] },
-{ "💢", &EMOJI_LIST[157] },
-{ "💥", &EMOJI_LIST[158] },
-{ "💫", &EMOJI_LIST[159] },
-{ "💦", &EMOJI_LIST[160] },
-{ "💨", &EMOJI_LIST[161] },
-{ "🕳️", &EMOJI_LIST[162] },
-{ "💬", &EMOJI_LIST[163] },
-{ "👁️‍🗨️", &EMOJI_LIST[164] },
-{ "🗨️", &EMOJI_LIST[165] },
-{ "🗯️", &EMOJI_LIST[166] },
-{ "💭", &EMOJI_LIST[167] },
-{ "💤", &EMOJI_LIST[168] },
-{ "👋", &EMOJI_LIST[169] },
-{ "🤚", &EMOJI_LIST[170] },
-{ "🖐️", &EMOJI_LIST[171] },
-{ "✋", &EMOJI_LIST[172] },
-{ "🖖", &EMOJI_LIST[173] },
-{ "🫱", &EMOJI_LIST[174] },
-{ "🫲", &EMOJI_LIST[175] },
-{ "🫳", &EMOJI_LIST[176] },
-{ "🫴", &EMOJI_LIST[177] },
-{ "🫷", &EMOJI_LIST[178] },
-{ "🫸", &EMOJI_LIST[179] },
-{ "👌", &EMOJI_LIST[180] },
-{ "🤌", &EMOJI_LIST[181] },
-{ "🤏", &EMOJI_LIST[182] },
-{ "✌️", &EMOJI_LIST[183] },
-{ "🤞", &EMOJI_LIST[184] },
-{ "🫰", &EMOJI_LIST[185] },
-{ "🤟", &EMOJI_LIST[186] },
-{ "🤘", &EMOJI_LIST[187] },
-{ "🤙", &EMOJI_LIST[188] },
-{ "👈", &EMOJI_LIST[189] },
-{ "👉", &EMOJI_LIST[190] },
-{ "👆", &EMOJI_LIST[191] },
-{ "🖕", &EMOJI_LIST[192] },
-{ "👇", &EMOJI_LIST[193] },
-{ "☝️", &EMOJI_LIST[194] },
-{ "🫵", &EMOJI_LIST[195] },
-{ "👍", &EMOJI_LIST[196] },
-{ "👎", &EMOJI_LIST[197] },
-{ "✊", &EMOJI_LIST[198] },
-{ "👊", &EMOJI_LIST[199] },
-{ "🤛", &EMOJI_LIST[200] },
-{ "🤜", &EMOJI_LIST[201] },
-{ "👏", &EMOJI_LIST[202] },
-{ "🙌", &EMOJI_LIST[203] },
-{ "🫶", &EMOJI_LIST[204] },
-{ "👐", &EMOJI_LIST[205] },
-{ "🤲", &EMOJI_LIST[206] },
-{ "🤝", &EMOJI_LIST[207] },
-{ "🙏", &EMOJI_LIST[208] },
-{ "✍️", &EMOJI_LIST[209] },
-{ "💅", &EMOJI_LIST[210] },
-{ "🤳", &EMOJI_LIST[211] },
-{ "💪", &EMOJI_LIST[212] },
-{ "🦾", &EMOJI_LIST[213] },
-{ "🦿", &EMOJI_LIST[214] },
-{ "🦵", &EMOJI_LIST[215] },
-{ "🦶", &EMOJI_LIST[216] },
-{ "👂", &EMOJI_LIST[217] },
-{ "🦻", &EMOJI_LIST[218] },
-{ "👃", &EMOJI_LIST[219] },
-{ "🧠", &EMOJI_LIST[220] },
-{ "🫀", &EMOJI_LIST[221] },
-{ "🫁", &EMOJI_LIST[222] },
-{ "🦷", &EMOJI_LIST[223] },
-{ "🦴", &EMOJI_LIST[224] },
-{ "👀", &EMOJI_LIST[225] },
-{ "👁️", &EMOJI_LIST[226] },
-{ "👅", &EMOJI_LIST[227] },
-{ "👄", &EMOJI_LIST[228] },
-{ "🫦", &EMOJI_LIST[229] },
-{ "👶", &EMOJI_LIST[230] },
-{ "🧒", &EMOJI_LIST[231] },
-{ "👦", &EMOJI_LIST[232] },
-{ "👧", &EMOJI_LIST[233] },
-{ "🧑", &EMOJI_LIST[234] },
-{ "👱", &EMOJI_LIST[235] },
-{ "👨", &EMOJI_LIST[236] },
-{ "🧔", &EMOJI_LIST[237] },
-{ "🧔‍♂️", &EMOJI_LIST[238] },
-{ "🧔‍♀️", &EMOJI_LIST[239] },
-{ "👨‍🦰", &EMOJI_LIST[240] },
-{ "👨‍🦱", &EMOJI_LIST[241] },
-{ "👨‍🦳", &EMOJI_LIST[242] },
-{ "👨‍🦲", &EMOJI_LIST[243] },
-{ "👩", &EMOJI_LIST[244] },
-{ "👩‍🦰", &EMOJI_LIST[245] },
-{ "🧑‍🦰", &EMOJI_LIST[246] },
-{ "👩‍🦱", &EMOJI_LIST[247] },
-{ "🧑‍🦱", &EMOJI_LIST[248] },
-{ "👩‍🦳", &EMOJI_LIST[249] },
-{ "🧑‍🦳", &EMOJI_LIST[250] },
-{ "👩‍🦲", &EMOJI_LIST[251] },
-{ "🧑‍🦲", &EMOJI_LIST[252] },
-{ "👱‍♀️", &EMOJI_LIST[253] },
-{ "👱‍♂️", &EMOJI_LIST[254] },
-{ "🧓", &EMOJI_LIST[255] },
-{ "👴", &EMOJI_LIST[256] },
-{ "👵", &EMOJI_LIST[257] },
-{ "🙍", &EMOJI_LIST[258] },
-{ "🙍‍♂️", &EMOJI_LIST[259] },
-{ "🙍‍♀️", &EMOJI_LIST[260] },
-{ "🙎", &EMOJI_LIST[261] },
-{ "🙎‍♂️", &EMOJI_LIST[262] },
-{ "🙎‍♀️", &EMOJI_LIST[263] },
-{ "🙅", &EMOJI_LIST[264] },
-{ "🙅‍♂️", &EMOJI_LIST[265] },
-{ "🙅‍♀️", &EMOJI_LIST[266] },
-{ "🙆", &EMOJI_LIST[267] },
-{ "🙆‍♂️", &EMOJI_LIST[268] },
-{ "🙆‍♀️", &EMOJI_LIST[269] },
-{ "💁", &EMOJI_LIST[270] },
-{ "💁‍♂️", &EMOJI_LIST[271] },
-{ "💁‍♀️", &EMOJI_LIST[272] },
-{ "🙋", &EMOJI_LIST[273] },
-{ "🙋‍♂️", &EMOJI_LIST[274] },
-{ "🙋‍♀️", &EMOJI_LIST[275] },
-{ "🧏", &EMOJI_LIST[276] },
-{ "🧏‍♂️", &EMOJI_LIST[277] },
-{ "🧏‍♀️", &EMOJI_LIST[278] },
-{ "🙇", &EMOJI_LIST[279] },
-{ "🙇‍♂️", &EMOJI_LIST[280] },
-{ "🙇‍♀️", &EMOJI_LIST[281] },
-{ "🤦", &EMOJI_LIST[282] },
-{ "🤦‍♂️", &EMOJI_LIST[283] },
-{ "🤦‍♀️", &EMOJI_LIST[284] },
-{ "🤷", &EMOJI_LIST[285] },
-{ "🤷‍♂️", &EMOJI_LIST[286] },
-{ "🤷‍♀️", &EMOJI_LIST[287] },
-{ "🧑‍⚕️", &EMOJI_LIST[288] },
-{ "👨‍⚕️", &EMOJI_LIST[289] },
-{ "👩‍⚕️", &EMOJI_LIST[290] },
-{ "🧑‍🎓", &EMOJI_LIST[291] },
-{ "👨‍🎓", &EMOJI_LIST[292] },
-{ "👩‍🎓", &EMOJI_LIST[293] },
-{ "🧑‍🏫", &EMOJI_LIST[294] },
-{ "👨‍🏫", &EMOJI_LIST[295] },
-{ "👩‍🏫", &EMOJI_LIST[296] },
-{ "🧑‍⚖️", &EMOJI_LIST[297] },
-{ "👨‍⚖️", &EMOJI_LIST[298] },
-{ "👩‍⚖️", &EMOJI_LIST[299] },
-{ "🧑‍🌾", &EMOJI_LIST[300] },
-{ "👨‍🌾", &EMOJI_LIST[301] },
-{ "👩‍🌾", &EMOJI_LIST[302] },
-{ "🧑‍🍳", &EMOJI_LIST[303] },
-{ "👨‍🍳", &EMOJI_LIST[304] },
-{ "👩‍🍳", &EMOJI_LIST[305] },
-{ "🧑‍🔧", &EMOJI_LIST[306] },
-{ "👨‍🔧", &EMOJI_LIST[307] },
-{ "👩‍🔧", &EMOJI_LIST[308] },
-{ "🧑‍🏭", &EMOJI_LIST[309] },
-{ "👨‍🏭", &EMOJI_LIST[310] },
-{ "👩‍🏭", &EMOJI_LIST[311] },
-{ "🧑‍💼", &EMOJI_LIST[312] },
-{ "👨‍💼", &EMOJI_LIST[313] },
-{ "👩‍💼", &EMOJI_LIST[314] },
-{ "🧑‍🔬", &EMOJI_LIST[315] },
-{ "👨‍🔬", &EMOJI_LIST[316] },
-{ "👩‍🔬", &EMOJI_LIST[317] },
-{ "🧑‍💻", &EMOJI_LIST[318] },
-{ "👨‍💻", &EMOJI_LIST[319] },
-{ "👩‍💻", &EMOJI_LIST[320] },
-{ "🧑‍🎤", &EMOJI_LIST[321] },
-{ "👨‍🎤", &EMOJI_LIST[322] },
-{ "👩‍🎤", &EMOJI_LIST[323] },
-{ "🧑‍🎨", &EMOJI_LIST[324] },
-{ "👨‍🎨", &EMOJI_LIST[325] },
-{ "👩‍🎨", &EMOJI_LIST[326] },
-{ "🧑‍✈️", &EMOJI_LIST[327] },
-{ "👨‍✈️", &EMOJI_LIST[328] },
-{ "👩‍✈️", &EMOJI_LIST[329] },
-{ "🧑‍🚀", &EMOJI_LIST[330] },
-{ "👨‍🚀", &EMOJI_LIST[331] },
-{ "👩‍🚀", &EMOJI_LIST[332] },
-{ "🧑‍🚒", &EMOJI_LIST[333] },
-{ "👨‍🚒", &EMOJI_LIST[334] },
-{ "👩‍🚒", &EMOJI_LIST[335] },
-{ "👮", &EMOJI_LIST[336] },
-{ "👮‍♂️", &EMOJI_LIST[337] },
-{ "👮‍♀️", &EMOJI_LIST[338] },
-{ "🕵️", &EMOJI_LIST[339] },
-{ "🕵️‍♂️", &EMOJI_LIST[340] },
-{ "🕵️‍♀️", &EMOJI_LIST[341] },
-{ "💂", &EMOJI_LIST[342] },
-{ "💂‍♂️", &EMOJI_LIST[343] },
-{ "💂‍♀️", &EMOJI_LIST[344] },
-{ "🥷", &EMOJI_LIST[345] },
-{ "👷", &EMOJI_LIST[346] },
-{ "👷‍♂️", &EMOJI_LIST[347] },
-{ "👷‍♀️", &EMOJI_LIST[348] },
-{ "🫅", &EMOJI_LIST[349] },
-{ "🤴", &EMOJI_LIST[350] },
-{ "👸", &EMOJI_LIST[351] },
-{ "👳", &EMOJI_LIST[352] },
-{ "👳‍♂️", &EMOJI_LIST[353] },
-{ "👳‍♀️", &EMOJI_LIST[354] },
-{ "👲", &EMOJI_LIST[355] },
-{ "🧕", &EMOJI_LIST[356] },
-{ "🤵", &EMOJI_LIST[357] },
-{ "🤵‍♂️", &EMOJI_LIST[358] },
-{ "🤵‍♀️", &EMOJI_LIST[359] },
-{ "👰", &EMOJI_LIST[360] },
-{ "👰‍♂️", &EMOJI_LIST[361] },
-{ "👰‍♀️", &EMOJI_LIST[362] },
-{ "🤰", &EMOJI_LIST[363] },
-{ "🫃", &EMOJI_LIST[364] },
-{ "🫄", &EMOJI_LIST[365] },
-{ "🤱", &EMOJI_LIST[366] },
-{ "👩‍🍼", &EMOJI_LIST[367] },
-{ "👨‍🍼", &EMOJI_LIST[368] },
-{ "🧑‍🍼", &EMOJI_LIST[369] },
-{ "👼", &EMOJI_LIST[370] },
-{ "🎅", &EMOJI_LIST[371] },
-{ "🤶", &EMOJI_LIST[372] },
-{ "🧑‍🎄", &EMOJI_LIST[373] },
-{ "🦸", &EMOJI_LIST[374] },
-{ "🦸‍♂️", &EMOJI_LIST[375] },
-{ "🦸‍♀️", &EMOJI_LIST[376] },
-{ "🦹", &EMOJI_LIST[377] },
-{ "🦹‍♂️", &EMOJI_LIST[378] },
-{ "🦹‍♀️", &EMOJI_LIST[379] },
-{ "🧙", &EMOJI_LIST[380] },
-{ "🧙‍♂️", &EMOJI_LIST[381] },
-{ "🧙‍♀️", &EMOJI_LIST[382] },
-{ "🧚", &EMOJI_LIST[383] },
-{ "🧚‍♂️", &EMOJI_LIST[384] },
-{ "🧚‍♀️", &EMOJI_LIST[385] },
-{ "🧛", &EMOJI_LIST[386] },
-{ "🧛‍♂️", &EMOJI_LIST[387] },
-{ "🧛‍♀️", &EMOJI_LIST[388] },
-{ "🧜", &EMOJI_LIST[389] },
-{ "🧜‍♂️", &EMOJI_LIST[390] },
-{ "🧜‍♀️", &EMOJI_LIST[391] },
-{ "🧝", &EMOJI_LIST[392] },
-{ "🧝‍♂️", &EMOJI_LIST[393] },
-{ "🧝‍♀️", &EMOJI_LIST[394] },
-{ "🧞", &EMOJI_LIST[395] },
-{ "🧞‍♂️", &EMOJI_LIST[396] },
-{ "🧞‍♀️", &EMOJI_LIST[397] },
-{ "🧟", &EMOJI_LIST[398] },
-{ "🧟‍♂️", &EMOJI_LIST[399] },
-{ "🧟‍♀️", &EMOJI_LIST[400] },
-{ "🧌", &EMOJI_LIST[401] },
-{ "💆", &EMOJI_LIST[402] },
-{ "💆‍♂️", &EMOJI_LIST[403] },
-{ "💆‍♀️", &EMOJI_LIST[404] },
-{ "💇", &EMOJI_LIST[405] },
-{ "💇‍♂️", &EMOJI_LIST[406] },
-{ "💇‍♀️", &EMOJI_LIST[407] },
-{ "🚶", &EMOJI_LIST[408] },
-{ "🚶‍♂️", &EMOJI_LIST[409] },
-{ "🚶‍♀️", &EMOJI_LIST[410] },
-{ "🚶‍➡️", &EMOJI_LIST[411] },
-{ "🚶‍♀️‍➡️", &EMOJI_LIST[412] },
-{ "🚶‍♂️‍➡️", &EMOJI_LIST[413] },
-{ "🧍", &EMOJI_LIST[414] },
-{ "🧍‍♂️", &EMOJI_LIST[415] },
-{ "🧍‍♀️", &EMOJI_LIST[416] },
-{ "🧎", &EMOJI_LIST[417] },
-{ "🧎‍♂️", &EMOJI_LIST[418] },
-{ "🧎‍♀️", &EMOJI_LIST[419] },
-{ "🧎‍➡️", &EMOJI_LIST[420] },
-{ "🧎‍♀️‍➡️", &EMOJI_LIST[421] },
-{ "🧎‍♂️‍➡️", &EMOJI_LIST[422] },
-{ "🧑‍🦯", &EMOJI_LIST[423] },
-{ "🧑‍🦯‍➡️", &EMOJI_LIST[424] },
-{ "👨‍🦯", &EMOJI_LIST[425] },
-{ "👨‍🦯‍➡️", &EMOJI_LIST[426] },
-{ "👩‍🦯", &EMOJI_LIST[427] },
-{ "👩‍🦯‍➡️", &EMOJI_LIST[428] },
-{ "🧑‍🦼", &EMOJI_LIST[429] },
-{ "🧑‍🦼‍➡️", &EMOJI_LIST[430] },
-{ "👨‍🦼", &EMOJI_LIST[431] },
-{ "👨‍🦼‍➡️", &EMOJI_LIST[432] },
-{ "👩‍🦼", &EMOJI_LIST[433] },
-{ "👩‍🦼‍➡️", &EMOJI_LIST[434] },
-{ "🧑‍🦽", &EMOJI_LIST[435] },
-{ "🧑‍🦽‍➡️", &EMOJI_LIST[436] },
-{ "👨‍🦽", &EMOJI_LIST[437] },
-{ "👨‍🦽‍➡️", &EMOJI_LIST[438] },
-{ "👩‍🦽", &EMOJI_LIST[439] },
-{ "👩‍🦽‍➡️", &EMOJI_LIST[440] },
-{ "🏃", &EMOJI_LIST[441] },
-{ "🏃‍♂️", &EMOJI_LIST[442] },
-{ "🏃‍♀️", &EMOJI_LIST[443] },
-{ "🏃‍➡️", &EMOJI_LIST[444] },
-{ "🏃‍♀️‍➡️", &EMOJI_LIST[445] },
-{ "🏃‍♂️‍➡️", &EMOJI_LIST[446] },
-{ "💃", &EMOJI_LIST[447] },
-{ "🕺", &EMOJI_LIST[448] },
-{ "🕴️", &EMOJI_LIST[449] },
-{ "👯", &EMOJI_LIST[450] },
-{ "👯‍♂️", &EMOJI_LIST[451] },
-{ "👯‍♀️", &EMOJI_LIST[452] },
-{ "🧖", &EMOJI_LIST[453] },
-{ "🧖‍♂️", &EMOJI_LIST[454] },
-{ "🧖‍♀️", &EMOJI_LIST[455] },
-{ "🧗", &EMOJI_LIST[456] },
-{ "🧗‍♂️", &EMOJI_LIST[457] },
-{ "🧗‍♀️", &EMOJI_LIST[458] },
-{ "🤺", &EMOJI_LIST[459] },
-{ "🏇", &EMOJI_LIST[460] },
-{ "⛷️", &EMOJI_LIST[461] },
-{ "🏂", &EMOJI_LIST[462] },
-{ "🏌️", &EMOJI_LIST[463] },
-{ "🏌️‍♂️", &EMOJI_LIST[464] },
-{ "🏌️‍♀️", &EMOJI_LIST[465] },
-{ "🏄", &EMOJI_LIST[466] },
-{ "🏄‍♂️", &EMOJI_LIST[467] },
-{ "🏄‍♀️", &EMOJI_LIST[468] },
-{ "🚣", &EMOJI_LIST[469] },
-{ "🚣‍♂️", &EMOJI_LIST[470] },
-{ "🚣‍♀️", &EMOJI_LIST[471] },
-{ "🏊", &EMOJI_LIST[472] },
-{ "🏊‍♂️", &EMOJI_LIST[473] },
-{ "🏊‍♀️", &EMOJI_LIST[474] },
-{ "⛹️", &EMOJI_LIST[475] },
-{ "⛹️‍♂️", &EMOJI_LIST[476] },
-{ "⛹️‍♀️", &EMOJI_LIST[477] },
-{ "🏋️", &EMOJI_LIST[478] },
-{ "🏋️‍♂️", &EMOJI_LIST[479] },
-{ "🏋️‍♀️", &EMOJI_LIST[480] },
-{ "🚴", &EMOJI_LIST[481] },
-{ "🚴‍♂️", &EMOJI_LIST[482] },
-{ "🚴‍♀️", &EMOJI_LIST[483] },
-{ "🚵", &EMOJI_LIST[484] },
-{ "🚵‍♂️", &EMOJI_LIST[485] },
-{ "🚵‍♀️", &EMOJI_LIST[486] },
-{ "🤸", &EMOJI_LIST[487] },
-{ "🤸‍♂️", &EMOJI_LIST[488] },
-{ "🤸‍♀️", &EMOJI_LIST[489] },
-{ "🤼", &EMOJI_LIST[490] },
-{ "🤼‍♂️", &EMOJI_LIST[491] },
-{ "🤼‍♀️", &EMOJI_LIST[492] },
-{ "🤽", &EMOJI_LIST[493] },
-{ "🤽‍♂️", &EMOJI_LIST[494] },
-{ "🤽‍♀️", &EMOJI_LIST[495] },
-{ "🤾", &EMOJI_LIST[496] },
-{ "🤾‍♂️", &EMOJI_LIST[497] },
-{ "🤾‍♀️", &EMOJI_LIST[498] },
-{ "🤹", &EMOJI_LIST[499] },
-{ "🤹‍♂️", &EMOJI_LIST[500] },
-{ "🤹‍♀️", &EMOJI_LIST[501] },
-{ "🧘", &EMOJI_LIST[502] },
-{ "🧘‍♂️", &EMOJI_LIST[503] },
-{ "🧘‍♀️", &EMOJI_LIST[504] },
-{ "🛀", &EMOJI_LIST[505] },
-{ "🛌", &EMOJI_LIST[506] },
-{ "🧑‍🤝‍🧑", &EMOJI_LIST[507] },
-{ "👭", &EMOJI_LIST[508] },
-{ "👫", &EMOJI_LIST[509] },
-{ "👬", &EMOJI_LIST[510] },
-{ "💏", &EMOJI_LIST[511] },
-{ "👩‍❤️‍💋‍👨", &EMOJI_LIST[512] },
-{ "👨‍❤️‍💋‍👨", &EMOJI_LIST[513] },
-{ "👩‍❤️‍💋‍👩", &EMOJI_LIST[514] },
-{ "💑", &EMOJI_LIST[515] },
-{ "👩‍❤️‍👨", &EMOJI_LIST[516] },
-{ "👨‍❤️‍👨", &EMOJI_LIST[517] },
-{ "👩‍❤️‍👩", &EMOJI_LIST[518] },
-{ "👨‍👩‍👦", &EMOJI_LIST[519] },
-{ "👨‍👩‍👧", &EMOJI_LIST[520] },
-{ "👨‍👩‍👧‍👦", &EMOJI_LIST[521] },
-{ "👨‍👩‍👦‍👦", &EMOJI_LIST[522] },
-{ "👨‍👩‍👧‍👧", &EMOJI_LIST[523] },
-{ "👨‍👨‍👦", &EMOJI_LIST[524] },
-{ "👨‍👨‍👧", &EMOJI_LIST[525] },
-{ "👨‍👨‍👧‍👦", &EMOJI_LIST[526] },
-{ "👨‍👨‍👦‍👦", &EMOJI_LIST[527] },
-{ "👨‍👨‍👧‍👧", &EMOJI_LIST[528] },
-{ "👩‍👩‍👦", &EMOJI_LIST[529] },
-{ "👩‍👩‍👧", &EMOJI_LIST[530] },
-{ "👩‍👩‍👧‍👦", &EMOJI_LIST[531] },
-{ "👩‍👩‍👦‍👦", &EMOJI_LIST[532] },
-{ "👩‍👩‍👧‍👧", &EMOJI_LIST[533] },
-{ "👨‍👦", &EMOJI_LIST[534] },
-{ "👨‍👦‍👦", &EMOJI_LIST[535] },
-{ "👨‍👧", &EMOJI_LIST[536] },
-{ "👨‍👧‍👦", &EMOJI_LIST[537] },
-{ "👨‍👧‍👧", &EMOJI_LIST[538] },
-{ "👩‍👦", &EMOJI_LIST[539] },
-{ "👩‍👦‍👦", &EMOJI_LIST[540] },
-{ "👩‍👧", &EMOJI_LIST[541] },
-{ "👩‍👧‍👦", &EMOJI_LIST[542] },
-{ "👩‍👧‍👧", &EMOJI_LIST[543] },
-{ "🗣️", &EMOJI_LIST[544] },
-{ "👤", &EMOJI_LIST[545] },
-{ "👥", &EMOJI_LIST[546] },
-{ "🫂", &EMOJI_LIST[547] },
-{ "👪", &EMOJI_LIST[548] },
-{ "🧑‍🧑‍🧒", &EMOJI_LIST[549] },
-{ "🧑‍🧑‍🧒‍🧒", &EMOJI_LIST[550] },
-{ "🧑‍🧒", &EMOJI_LIST[551] },
-{ "🧑‍🧒‍🧒", &EMOJI_LIST[552] },
-{ "👣", &EMOJI_LIST[553] },
-{ "🫆", &EMOJI_LIST[554] },
-{ "🐵", &EMOJI_LIST[555] },
-{ "🐒", &EMOJI_LIST[556] },
-{ "🦍", &EMOJI_LIST[557] },
-{ "🦧", &EMOJI_LIST[558] },
-{ "🐶", &EMOJI_LIST[559] },
-{ "🐕", &EMOJI_LIST[560] },
-{ "🦮", &EMOJI_LIST[561] },
-{ "🐕‍🦺", &EMOJI_LIST[562] },
-{ "🐩", &EMOJI_LIST[563] },
-{ "🐺", &EMOJI_LIST[564] },
-{ "🦊", &EMOJI_LIST[565] },
-{ "🦝", &EMOJI_LIST[566] },
-{ "🐱", &EMOJI_LIST[567] },
-{ "🐈", &EMOJI_LIST[568] },
-{ "🐈‍⬛", &EMOJI_LIST[569] },
-{ "🦁", &EMOJI_LIST[570] },
-{ "🐯", &EMOJI_LIST[571] },
-{ "🐅", &EMOJI_LIST[572] },
-{ "🐆", &EMOJI_LIST[573] },
-{ "🐴", &EMOJI_LIST[574] },
-{ "🫎", &EMOJI_LIST[575] },
-{ "🫏", &EMOJI_LIST[576] },
-{ "🐎", &EMOJI_LIST[577] },
-{ "🦄", &EMOJI_LIST[578] },
-{ "🦓", &EMOJI_LIST[579] },
-{ "🦌", &EMOJI_LIST[580] },
-{ "🦬", &EMOJI_LIST[581] },
-{ "🐮", &EMOJI_LIST[582] },
-{ "🐂", &EMOJI_LIST[583] },
-{ "🐃", &EMOJI_LIST[584] },
-{ "🐄", &EMOJI_LIST[585] },
-{ "🐷", &EMOJI_LIST[586] },
-{ "🐖", &EMOJI_LIST[587] },
-{ "🐗", &EMOJI_LIST[588] },
-{ "🐽", &EMOJI_LIST[589] },
-{ "🐏", &EMOJI_LIST[590] },
-{ "🐑", &EMOJI_LIST[591] },
-{ "🐐", &EMOJI_LIST[592] },
-{ "🐪", &EMOJI_LIST[593] },
-{ "🐫", &EMOJI_LIST[594] },
-{ "🦙", &EMOJI_LIST[595] },
-{ "🦒", &EMOJI_LIST[596] },
-{ "🐘", &EMOJI_LIST[597] },
-{ "🦣", &EMOJI_LIST[598] },
-{ "🦏", &EMOJI_LIST[599] },
-{ "🦛", &EMOJI_LIST[600] },
-{ "🐭", &EMOJI_LIST[601] },
-{ "🐁", &EMOJI_LIST[602] },
-{ "🐀", &EMOJI_LIST[603] },
-{ "🐹", &EMOJI_LIST[604] },
-{ "🐰", &EMOJI_LIST[605] },
-{ "🐇", &EMOJI_LIST[606] },
-{ "🐿️", &EMOJI_LIST[607] },
-{ "🦫", &EMOJI_LIST[608] },
-{ "🦔", &EMOJI_LIST[609] },
-{ "🦇", &EMOJI_LIST[610] },
-{ "🐻", &EMOJI_LIST[611] },
-{ "🐻‍❄️", &EMOJI_LIST[612] },
-{ "🐨", &EMOJI_LIST[613] },
-{ "🐼", &EMOJI_LIST[614] },
-{ "🦥", &EMOJI_LIST[615] },
-{ "🦦", &EMOJI_LIST[616] },
-{ "🦨", &EMOJI_LIST[617] },
-{ "🦘", &EMOJI_LIST[618] },
-{ "🦡", &EMOJI_LIST[619] },
-{ "🐾", &EMOJI_LIST[620] },
-{ "🦃", &EMOJI_LIST[621] },
-{ "🐔", &EMOJI_LIST[622] },
-{ "🐓", &EMOJI_LIST[623] },
-{ "🐣", &EMOJI_LIST[624] },
-{ "🐤", &EMOJI_LIST[625] },
-{ "🐥", &EMOJI_LIST[626] },
-{ "🐦", &EMOJI_LIST[627] },
-{ "🐧", &EMOJI_LIST[628] },
-{ "🕊️", &EMOJI_LIST[629] },
-{ "🦅", &EMOJI_LIST[630] },
-{ "🦆", &EMOJI_LIST[631] },
-{ "🦢", &EMOJI_LIST[632] },
-{ "🦉", &EMOJI_LIST[633] },
-{ "🦤", &EMOJI_LIST[634] },
-{ "🪶", &EMOJI_LIST[635] },
-{ "🦩", &EMOJI_LIST[636] },
-{ "🦚", &EMOJI_LIST[637] },
-{ "🦜", &EMOJI_LIST[638] },
-{ "🪽", &EMOJI_LIST[639] },
-{ "🐦‍⬛", &EMOJI_LIST[640] },
-{ "🪿", &EMOJI_LIST[641] },
-{ "🐦‍🔥", &EMOJI_LIST[642] },
-{ "🐸", &EMOJI_LIST[643] },
-{ "🐊", &EMOJI_LIST[644] },
-{ "🐢", &EMOJI_LIST[645] },
-{ "🦎", &EMOJI_LIST[646] },
-{ "🐍", &EMOJI_LIST[647] },
-{ "🐲", &EMOJI_LIST[648] },
-{ "🐉", &EMOJI_LIST[649] },
-{ "🦕", &EMOJI_LIST[650] },
-{ "🦖", &EMOJI_LIST[651] },
-{ "🐳", &EMOJI_LIST[652] },
-{ "🐋", &EMOJI_LIST[653] },
-{ "🐬", &EMOJI_LIST[654] },
-{ "🦭", &EMOJI_LIST[655] },
-{ "🐟", &EMOJI_LIST[656] },
-{ "🐠", &EMOJI_LIST[657] },
-{ "🐡", &EMOJI_LIST[658] },
-{ "🦈", &EMOJI_LIST[659] },
-{ "🐙", &EMOJI_LIST[660] },
-{ "🐚", &EMOJI_LIST[661] },
-{ "🪸", &EMOJI_LIST[662] },
-{ "🪼", &EMOJI_LIST[663] },
-{ "🦀", &EMOJI_LIST[664] },
-{ "🦞", &EMOJI_LIST[665] },
-{ "🦐", &EMOJI_LIST[666] },
-{ "🦑", &EMOJI_LIST[667] },
-{ "🦪", &EMOJI_LIST[668] },
-{ "🐌", &EMOJI_LIST[669] },
-{ "🦋", &EMOJI_LIST[670] },
-{ "🐛", &EMOJI_LIST[671] },
-{ "🐜", &EMOJI_LIST[672] },
-{ "🐝", &EMOJI_LIST[673] },
-{ "🪲", &EMOJI_LIST[674] },
-{ "🐞", &EMOJI_LIST[675] },
-{ "🦗", &EMOJI_LIST[676] },
-{ "🪳", &EMOJI_LIST[677] },
-{ "🕷️", &EMOJI_LIST[678] },
-{ "🕸️", &EMOJI_LIST[679] },
-{ "🦂", &EMOJI_LIST[680] },
-{ "🦟", &EMOJI_LIST[681] },
-{ "🪰", &EMOJI_LIST[682] },
-{ "🪱", &EMOJI_LIST[683] },
-{ "🦠", &EMOJI_LIST[684] },
-{ "💐", &EMOJI_LIST[685] },
-{ "🌸", &EMOJI_LIST[686] },
-{ "💮", &EMOJI_LIST[687] },
-{ "🪷", &EMOJI_LIST[688] },
-{ "🏵️", &EMOJI_LIST[689] },
-{ "🌹", &EMOJI_LIST[690] },
-{ "🥀", &EMOJI_LIST[691] },
-{ "🌺", &EMOJI_LIST[692] },
-{ "🌻", &EMOJI_LIST[693] },
-{ "🌼", &EMOJI_LIST[694] },
-{ "🌷", &EMOJI_LIST[695] },
-{ "🪻", &EMOJI_LIST[696] },
-{ "🌱", &EMOJI_LIST[697] },
-{ "🪴", &EMOJI_LIST[698] },
-{ "🌲", &EMOJI_LIST[699] },
-{ "🌳", &EMOJI_LIST[700] },
-{ "🌴", &EMOJI_LIST[701] },
-{ "🌵", &EMOJI_LIST[702] },
-{ "🌾", &EMOJI_LIST[703] },
-{ "🌿", &EMOJI_LIST[704] },
-{ "☘️", &EMOJI_LIST[705] },
-{ "🍀", &EMOJI_LIST[706] },
-{ "🍁", &EMOJI_LIST[707] },
-{ "🍂", &EMOJI_LIST[708] },
-{ "🍃", &EMOJI_LIST[709] },
-{ "🪹", &EMOJI_LIST[710] },
-{ "🪺", &EMOJI_LIST[711] },
-{ "🍄", &EMOJI_LIST[712] },
-{ "🪾", &EMOJI_LIST[713] },
-{ "🍇", &EMOJI_LIST[714] },
-{ "🍈", &EMOJI_LIST[715] },
-{ "🍉", &EMOJI_LIST[716] },
-{ "🍊", &EMOJI_LIST[717] },
-{ "🍋", &EMOJI_LIST[718] },
-{ "🍋‍🟩", &EMOJI_LIST[719] },
-{ "🍌", &EMOJI_LIST[720] },
-{ "🍍", &EMOJI_LIST[721] },
-{ "🥭", &EMOJI_LIST[722] },
-{ "🍎", &EMOJI_LIST[723] },
-{ "🍏", &EMOJI_LIST[724] },
-{ "🍐", &EMOJI_LIST[725] },
-{ "🍑", &EMOJI_LIST[726] },
-{ "🍒", &EMOJI_LIST[727] },
-{ "🍓", &EMOJI_LIST[728] },
-{ "🫐", &EMOJI_LIST[729] },
-{ "🥝", &EMOJI_LIST[730] },
-{ "🍅", &EMOJI_LIST[731] },
-{ "🫒", &EMOJI_LIST[732] },
-{ "🥥", &EMOJI_LIST[733] },
-{ "🥑", &EMOJI_LIST[734] },
-{ "🍆", &EMOJI_LIST[735] },
-{ "🥔", &EMOJI_LIST[736] },
-{ "🥕", &EMOJI_LIST[737] },
-{ "🌽", &EMOJI_LIST[738] },
-{ "🌶️", &EMOJI_LIST[739] },
-{ "🫑", &EMOJI_LIST[740] },
-{ "🥒", &EMOJI_LIST[741] },
-{ "🥬", &EMOJI_LIST[742] },
-{ "🥦", &EMOJI_LIST[743] },
-{ "🧄", &EMOJI_LIST[744] },
-{ "🧅", &EMOJI_LIST[745] },
-{ "🥜", &EMOJI_LIST[746] },
-{ "🫘", &EMOJI_LIST[747] },
-{ "🌰", &EMOJI_LIST[748] },
-{ "🫚", &EMOJI_LIST[749] },
-{ "🫛", &EMOJI_LIST[750] },
-{ "🍄‍🟫", &EMOJI_LIST[751] },
-{ "🫜", &EMOJI_LIST[752] },
-{ "🍞", &EMOJI_LIST[753] },
-{ "🥐", &EMOJI_LIST[754] },
-{ "🥖", &EMOJI_LIST[755] },
-{ "🫓", &EMOJI_LIST[756] },
-{ "🥨", &EMOJI_LIST[757] },
-{ "🥯", &EMOJI_LIST[758] },
-{ "🥞", &EMOJI_LIST[759] },
-{ "🧇", &EMOJI_LIST[760] },
-{ "🧀", &EMOJI_LIST[761] },
-{ "🍖", &EMOJI_LIST[762] },
-{ "🍗", &EMOJI_LIST[763] },
-{ "🥩", &EMOJI_LIST[764] },
-{ "🥓", &EMOJI_LIST[765] },
-{ "🍔", &EMOJI_LIST[766] },
-{ "🍟", &EMOJI_LIST[767] },
-{ "🍕", &EMOJI_LIST[768] },
-{ "🌭", &EMOJI_LIST[769] },
-{ "🥪", &EMOJI_LIST[770] },
-{ "🌮", &EMOJI_LIST[771] },
-{ "🌯", &EMOJI_LIST[772] },
-{ "🫔", &EMOJI_LIST[773] },
-{ "🥙", &EMOJI_LIST[774] },
-{ "🧆", &EMOJI_LIST[775] },
-{ "🥚", &EMOJI_LIST[776] },
-{ "🍳", &EMOJI_LIST[777] },
-{ "🥘", &EMOJI_LIST[778] },
-{ "🍲", &EMOJI_LIST[779] },
-{ "🫕", &EMOJI_LIST[780] },
-{ "🥣", &EMOJI_LIST[781] },
-{ "🥗", &EMOJI_LIST[782] },
-{ "🍿", &EMOJI_LIST[783] },
-{ "🧈", &EMOJI_LIST[784] },
-{ "🧂", &EMOJI_LIST[785] },
-{ "🥫", &EMOJI_LIST[786] },
-{ "🍱", &EMOJI_LIST[787] },
-{ "🍘", &EMOJI_LIST[788] },
-{ "🍙", &EMOJI_LIST[789] },
-{ "🍚", &EMOJI_LIST[790] },
-{ "🍛", &EMOJI_LIST[791] },
-{ "🍜", &EMOJI_LIST[792] },
-{ "🍝", &EMOJI_LIST[793] },
-{ "🍠", &EMOJI_LIST[794] },
-{ "🍢", &EMOJI_LIST[795] },
-{ "🍣", &EMOJI_LIST[796] },
-{ "🍤", &EMOJI_LIST[797] },
-{ "🍥", &EMOJI_LIST[798] },
-{ "🥮", &EMOJI_LIST[799] },
-{ "🍡", &EMOJI_LIST[800] },
-{ "🥟", &EMOJI_LIST[801] },
-{ "🥠", &EMOJI_LIST[802] },
-{ "🥡", &EMOJI_LIST[803] },
-{ "🍦", &EMOJI_LIST[804] },
-{ "🍧", &EMOJI_LIST[805] },
-{ "🍨", &EMOJI_LIST[806] },
-{ "🍩", &EMOJI_LIST[807] },
-{ "🍪", &EMOJI_LIST[808] },
-{ "🎂", &EMOJI_LIST[809] },
-{ "🍰", &EMOJI_LIST[810] },
-{ "🧁", &EMOJI_LIST[811] },
-{ "🥧", &EMOJI_LIST[812] },
-{ "🍫", &EMOJI_LIST[813] },
-{ "🍬", &EMOJI_LIST[814] },
-{ "🍭", &EMOJI_LIST[815] },
-{ "🍮", &EMOJI_LIST[816] },
-{ "🍯", &EMOJI_LIST[817] },
-{ "🍼", &EMOJI_LIST[818] },
-{ "🥛", &EMOJI_LIST[819] },
-{ "☕", &EMOJI_LIST[820] },
-{ "🫖", &EMOJI_LIST[821] },
-{ "🍵", &EMOJI_LIST[822] },
-{ "🍶", &EMOJI_LIST[823] },
-{ "🍾", &EMOJI_LIST[824] },
-{ "🍷", &EMOJI_LIST[825] },
-{ "🍸", &EMOJI_LIST[826] },
-{ "🍹", &EMOJI_LIST[827] },
-{ "🍺", &EMOJI_LIST[828] },
-{ "🍻", &EMOJI_LIST[829] },
-{ "🥂", &EMOJI_LIST[830] },
-{ "🥃", &EMOJI_LIST[831] },
-{ "🫗", &EMOJI_LIST[832] },
-{ "🥤", &EMOJI_LIST[833] },
-{ "🧋", &EMOJI_LIST[834] },
-{ "🧃", &EMOJI_LIST[835] },
-{ "🧉", &EMOJI_LIST[836] },
-{ "🧊", &EMOJI_LIST[837] },
-{ "🥢", &EMOJI_LIST[838] },
-{ "🍽️", &EMOJI_LIST[839] },
-{ "🍴", &EMOJI_LIST[840] },
-{ "🥄", &EMOJI_LIST[841] },
-{ "🔪", &EMOJI_LIST[842] },
-{ "🫙", &EMOJI_LIST[843] },
-{ "🏺", &EMOJI_LIST[844] },
-{ "🌍", &EMOJI_LIST[845] },
-{ "🌎", &EMOJI_LIST[846] },
-{ "🌏", &EMOJI_LIST[847] },
-{ "🌐", &EMOJI_LIST[848] },
-{ "🗺️", &EMOJI_LIST[849] },
-{ "🗾", &EMOJI_LIST[850] },
-{ "🧭", &EMOJI_LIST[851] },
-{ "🏔️", &EMOJI_LIST[852] },
-{ "⛰️", &EMOJI_LIST[853] },
-{ "🌋", &EMOJI_LIST[854] },
-{ "🗻", &EMOJI_LIST[855] },
-{ "🏕️", &EMOJI_LIST[856] },
-{ "🏖️", &EMOJI_LIST[857] },
-{ "🏜️", &EMOJI_LIST[858] },
-{ "🏝️", &EMOJI_LIST[859] },
-{ "🏞️", &EMOJI_LIST[860] },
-{ "🏟️", &EMOJI_LIST[861] },
-{ "🏛️", &EMOJI_LIST[862] },
-{ "🏗️", &EMOJI_LIST[863] },
-{ "🧱", &EMOJI_LIST[864] },
-{ "🪨", &EMOJI_LIST[865] },
-{ "🪵", &EMOJI_LIST[866] },
-{ "🛖", &EMOJI_LIST[867] },
-{ "🏘️", &EMOJI_LIST[868] },
-{ "🏚️", &EMOJI_LIST[869] },
-{ "🏠", &EMOJI_LIST[870] },
-{ "🏡", &EMOJI_LIST[871] },
-{ "🏢", &EMOJI_LIST[872] },
-{ "🏣", &EMOJI_LIST[873] },
-{ "🏤", &EMOJI_LIST[874] },
-{ "🏥", &EMOJI_LIST[875] },
-{ "🏦", &EMOJI_LIST[876] },
-{ "🏨", &EMOJI_LIST[877] },
-{ "🏩", &EMOJI_LIST[878] },
-{ "🏪", &EMOJI_LIST[879] },
-{ "🏫", &EMOJI_LIST[880] },
-{ "🏬", &EMOJI_LIST[881] },
-{ "🏭", &EMOJI_LIST[882] },
-{ "🏯", &EMOJI_LIST[883] },
-{ "🏰", &EMOJI_LIST[884] },
-{ "💒", &EMOJI_LIST[885] },
-{ "🗼", &EMOJI_LIST[886] },
-{ "🗽", &EMOJI_LIST[887] },
-{ "⛪", &EMOJI_LIST[888] },
-{ "🕌", &EMOJI_LIST[889] },
-{ "🛕", &EMOJI_LIST[890] },
-{ "🕍", &EMOJI_LIST[891] },
-{ "⛩️", &EMOJI_LIST[892] },
-{ "🕋", &EMOJI_LIST[893] },
-{ "⛲", &EMOJI_LIST[894] },
-{ "⛺", &EMOJI_LIST[895] },
-{ "🌁", &EMOJI_LIST[896] },
-{ "🌃", &EMOJI_LIST[897] },
-{ "🏙️", &EMOJI_LIST[898] },
-{ "🌄", &EMOJI_LIST[899] },
-{ "🌅", &EMOJI_LIST[900] },
-{ "🌆", &EMOJI_LIST[901] },
-{ "🌇", &EMOJI_LIST[902] },
-{ "🌉", &EMOJI_LIST[903] },
-{ "♨️", &EMOJI_LIST[904] },
-{ "🎠", &EMOJI_LIST[905] },
-{ "🛝", &EMOJI_LIST[906] },
-{ "🎡", &EMOJI_LIST[907] },
-{ "🎢", &EMOJI_LIST[908] },
-{ "💈", &EMOJI_LIST[909] },
-{ "🎪", &EMOJI_LIST[910] },
-{ "🚂", &EMOJI_LIST[911] },
-{ "🚃", &EMOJI_LIST[912] },
-{ "🚄", &EMOJI_LIST[913] },
-{ "🚅", &EMOJI_LIST[914] },
-{ "🚆", &EMOJI_LIST[915] },
-{ "🚇", &EMOJI_LIST[916] },
-{ "🚈", &EMOJI_LIST[917] },
-{ "🚉", &EMOJI_LIST[918] },
-{ "🚊", &EMOJI_LIST[919] },
-{ "🚝", &EMOJI_LIST[920] },
-{ "🚞", &EMOJI_LIST[921] },
-{ "🚋", &EMOJI_LIST[922] },
-{ "🚌", &EMOJI_LIST[923] },
-{ "🚍", &EMOJI_LIST[924] },
-{ "🚎", &EMOJI_LIST[925] },
-{ "🚐", &EMOJI_LIST[926] },
-{ "🚑", &EMOJI_LIST[927] },
-{ "🚒", &EMOJI_LIST[928] },
-{ "🚓", &EMOJI_LIST[929] },
-{ "🚔", &EMOJI_LIST[930] },
-{ "🚕", &EMOJI_LIST[931] },
-{ "🚖", &EMOJI_LIST[932] },
-{ "🚗", &EMOJI_LIST[933] },
-{ "🚘", &EMOJI_LIST[934] },
-{ "🚙", &EMOJI_LIST[935] },
-{ "🛻", &EMOJI_LIST[936] },
-{ "🚚", &EMOJI_LIST[937] },
-{ "🚛", &EMOJI_LIST[938] },
-{ "🚜", &EMOJI_LIST[939] },
-{ "🏎️", &EMOJI_LIST[940] },
-{ "🏍️", &EMOJI_LIST[941] },
-{ "🛵", &EMOJI_LIST[942] },
-{ "🦽", &EMOJI_LIST[943] },
-{ "🦼", &EMOJI_LIST[944] },
-{ "🛺", &EMOJI_LIST[945] },
-{ "🚲", &EMOJI_LIST[946] },
-{ "🛴", &EMOJI_LIST[947] },
-{ "🛹", &EMOJI_LIST[948] },
-{ "🛼", &EMOJI_LIST[949] },
-{ "🚏", &EMOJI_LIST[950] },
-{ "🛣️", &EMOJI_LIST[951] },
-{ "🛤️", &EMOJI_LIST[952] },
-{ "🛢️", &EMOJI_LIST[953] },
-{ "⛽", &EMOJI_LIST[954] },
-{ "🛞", &EMOJI_LIST[955] },
-{ "🚨", &EMOJI_LIST[956] },
-{ "🚥", &EMOJI_LIST[957] },
-{ "🚦", &EMOJI_LIST[958] },
-{ "🛑", &EMOJI_LIST[959] },
-{ "🚧", &EMOJI_LIST[960] },
-{ "⚓", &EMOJI_LIST[961] },
-{ "🛟", &EMOJI_LIST[962] },
-{ "⛵", &EMOJI_LIST[963] },
-{ "🛶", &EMOJI_LIST[964] },
-{ "🚤", &EMOJI_LIST[965] },
-{ "🛳️", &EMOJI_LIST[966] },
-{ "⛴️", &EMOJI_LIST[967] },
-{ "🛥️", &EMOJI_LIST[968] },
-{ "🚢", &EMOJI_LIST[969] },
-{ "✈️", &EMOJI_LIST[970] },
-{ "🛩️", &EMOJI_LIST[971] },
-{ "🛫", &EMOJI_LIST[972] },
-{ "🛬", &EMOJI_LIST[973] },
-{ "🪂", &EMOJI_LIST[974] },
-{ "💺", &EMOJI_LIST[975] },
-{ "🚁", &EMOJI_LIST[976] },
-{ "🚟", &EMOJI_LIST[977] },
-{ "🚠", &EMOJI_LIST[978] },
-{ "🚡", &EMOJI_LIST[979] },
-{ "🛰️", &EMOJI_LIST[980] },
-{ "🚀", &EMOJI_LIST[981] },
-{ "🛸", &EMOJI_LIST[982] },
-{ "🛎️", &EMOJI_LIST[983] },
-{ "🧳", &EMOJI_LIST[984] },
-{ "⌛", &EMOJI_LIST[985] },
-{ "⏳", &EMOJI_LIST[986] },
-{ "⌚", &EMOJI_LIST[987] },
-{ "⏰", &EMOJI_LIST[988] },
-{ "⏱️", &EMOJI_LIST[989] },
-{ "⏲️", &EMOJI_LIST[990] },
-{ "🕰️", &EMOJI_LIST[991] },
-{ "🕛", &EMOJI_LIST[992] },
-{ "🕧", &EMOJI_LIST[993] },
-{ "🕐", &EMOJI_LIST[994] },
-{ "🕜", &EMOJI_LIST[995] },
-{ "🕑", &EMOJI_LIST[996] },
-{ "🕝", &EMOJI_LIST[997] },
-{ "🕒", &EMOJI_LIST[998] },
-{ "🕞", &EMOJI_LIST[999] },
-{ "🕓", &EMOJI_LIST[1000] },
-{ "🕟", &EMOJI_LIST[1001] },
-{ "🕔", &EMOJI_LIST[1002] },
-{ "🕠", &EMOJI_LIST[1003] },
-{ "🕕", &EMOJI_LIST[1004] },
-{ "🕡", &EMOJI_LIST[1005] },
-{ "🕖", &EMOJI_LIST[1006] },
-{ "🕢", &EMOJI_LIST[1007] },
-{ "🕗", &EMOJI_LIST[1008] },
-{ "🕣", &EMOJI_LIST[1009] },
-{ "🕘", &EMOJI_LIST[1010] },
-{ "🕤", &EMOJI_LIST[1011] },
-{ "🕙", &EMOJI_LIST[1012] },
-{ "🕥", &EMOJI_LIST[1013] },
-{ "🕚", &EMOJI_LIST[1014] },
-{ "🕦", &EMOJI_LIST[1015] },
-{ "🌑", &EMOJI_LIST[1016] },
-{ "🌒", &EMOJI_LIST[1017] },
-{ "🌓", &EMOJI_LIST[1018] },
-{ "🌔", &EMOJI_LIST[1019] },
-{ "🌕", &EMOJI_LIST[1020] },
-{ "🌖", &EMOJI_LIST[1021] },
-{ "🌗", &EMOJI_LIST[1022] },
-{ "🌘", &EMOJI_LIST[1023] },
-{ "🌙", &EMOJI_LIST[1024] },
-{ "🌚", &EMOJI_LIST[1025] },
-{ "🌛", &EMOJI_LIST[1026] },
-{ "🌜", &EMOJI_LIST[1027] },
-{ "🌡️", &EMOJI_LIST[1028] },
-{ "☀️", &EMOJI_LIST[1029] },
-{ "🌝", &EMOJI_LIST[1030] },
-{ "🌞", &EMOJI_LIST[1031] },
-{ "🪐", &EMOJI_LIST[1032] },
-{ "⭐", &EMOJI_LIST[1033] },
-{ "🌟", &EMOJI_LIST[1034] },
-{ "🌠", &EMOJI_LIST[1035] },
-{ "🌌", &EMOJI_LIST[1036] },
-{ "☁️", &EMOJI_LIST[1037] },
-{ "⛅", &EMOJI_LIST[1038] },
-{ "⛈️", &EMOJI_LIST[1039] },
-{ "🌤️", &EMOJI_LIST[1040] },
-{ "🌥️", &EMOJI_LIST[1041] },
-{ "🌦️", &EMOJI_LIST[1042] },
-{ "🌧️", &EMOJI_LIST[1043] },
-{ "🌨️", &EMOJI_LIST[1044] },
-{ "🌩️", &EMOJI_LIST[1045] },
-{ "🌪️", &EMOJI_LIST[1046] },
-{ "🌫️", &EMOJI_LIST[1047] },
-{ "🌬️", &EMOJI_LIST[1048] },
-{ "🌀", &EMOJI_LIST[1049] },
-{ "🌈", &EMOJI_LIST[1050] },
-{ "🌂", &EMOJI_LIST[1051] },
-{ "☂️", &EMOJI_LIST[1052] },
-{ "☔", &EMOJI_LIST[1053] },
-{ "⛱️", &EMOJI_LIST[1054] },
-{ "⚡", &EMOJI_LIST[1055] },
-{ "❄️", &EMOJI_LIST[1056] },
-{ "☃️", &EMOJI_LIST[1057] },
-{ "⛄", &EMOJI_LIST[1058] },
-{ "☄️", &EMOJI_LIST[1059] },
-{ "🔥", &EMOJI_LIST[1060] },
-{ "💧", &EMOJI_LIST[1061] },
-{ "🌊", &EMOJI_LIST[1062] },
-{ "🎃", &EMOJI_LIST[1063] },
-{ "🎄", &EMOJI_LIST[1064] },
-{ "🎆", &EMOJI_LIST[1065] },
-{ "🎇", &EMOJI_LIST[1066] },
-{ "🧨", &EMOJI_LIST[1067] },
-{ "✨", &EMOJI_LIST[1068] },
-{ "🎈", &EMOJI_LIST[1069] },
-{ "🎉", &EMOJI_LIST[1070] },
-{ "🎊", &EMOJI_LIST[1071] },
-{ "🎋", &EMOJI_LIST[1072] },
-{ "🎍", &EMOJI_LIST[1073] },
-{ "🎎", &EMOJI_LIST[1074] },
-{ "🎏", &EMOJI_LIST[1075] },
-{ "🎐", &EMOJI_LIST[1076] },
-{ "🎑", &EMOJI_LIST[1077] },
-{ "🧧", &EMOJI_LIST[1078] },
-{ "🎀", &EMOJI_LIST[1079] },
-{ "🎁", &EMOJI_LIST[1080] },
-{ "🎗️", &EMOJI_LIST[1081] },
-{ "🎟️", &EMOJI_LIST[1082] },
-{ "🎫", &EMOJI_LIST[1083] },
-{ "🎖️", &EMOJI_LIST[1084] },
-{ "🏆", &EMOJI_LIST[1085] },
-{ "🏅", &EMOJI_LIST[1086] },
-{ "🥇", &EMOJI_LIST[1087] },
-{ "🥈", &EMOJI_LIST[1088] },
-{ "🥉", &EMOJI_LIST[1089] },
-{ "⚽", &EMOJI_LIST[1090] },
-{ "⚾", &EMOJI_LIST[1091] },
-{ "🥎", &EMOJI_LIST[1092] },
-{ "🏀", &EMOJI_LIST[1093] },
-{ "🏐", &EMOJI_LIST[1094] },
-{ "🏈", &EMOJI_LIST[1095] },
-{ "🏉", &EMOJI_LIST[1096] },
-{ "🎾", &EMOJI_LIST[1097] },
-{ "🥏", &EMOJI_LIST[1098] },
-{ "🎳", &EMOJI_LIST[1099] },
-{ "🏏", &EMOJI_LIST[1100] },
-{ "🏑", &EMOJI_LIST[1101] },
-{ "🏒", &EMOJI_LIST[1102] },
-{ "🥍", &EMOJI_LIST[1103] },
-{ "🏓", &EMOJI_LIST[1104] },
-{ "🏸", &EMOJI_LIST[1105] },
-{ "🥊", &EMOJI_LIST[1106] },
-{ "🥋", &EMOJI_LIST[1107] },
-{ "🥅", &EMOJI_LIST[1108] },
-{ "⛳", &EMOJI_LIST[1109] },
-{ "⛸️", &EMOJI_LIST[1110] },
-{ "🎣", &EMOJI_LIST[1111] },
-{ "🤿", &EMOJI_LIST[1112] },
-{ "🎽", &EMOJI_LIST[1113] },
-{ "🎿", &EMOJI_LIST[1114] },
-{ "🛷", &EMOJI_LIST[1115] },
-{ "🥌", &EMOJI_LIST[1116] },
-{ "🎯", &EMOJI_LIST[1117] },
-{ "🪀", &EMOJI_LIST[1118] },
-{ "🪁", &EMOJI_LIST[1119] },
-{ "🔫", &EMOJI_LIST[1120] },
-{ "🎱", &EMOJI_LIST[1121] },
-{ "🔮", &EMOJI_LIST[1122] },
-{ "🪄", &EMOJI_LIST[1123] },
-{ "🎮", &EMOJI_LIST[1124] },
-{ "🕹️", &EMOJI_LIST[1125] },
-{ "🎰", &EMOJI_LIST[1126] },
-{ "🎲", &EMOJI_LIST[1127] },
-{ "🧩", &EMOJI_LIST[1128] },
-{ "🧸", &EMOJI_LIST[1129] },
-{ "🪅", &EMOJI_LIST[1130] },
-{ "🪩", &EMOJI_LIST[1131] },
-{ "🪆", &EMOJI_LIST[1132] },
-{ "♠️", &EMOJI_LIST[1133] },
-{ "♥️", &EMOJI_LIST[1134] },
-{ "♦️", &EMOJI_LIST[1135] },
-{ "♣️", &EMOJI_LIST[1136] },
-{ "♟️", &EMOJI_LIST[1137] },
-{ "🃏", &EMOJI_LIST[1138] },
-{ "🀄", &EMOJI_LIST[1139] },
-{ "🎴", &EMOJI_LIST[1140] },
-{ "🎭", &EMOJI_LIST[1141] },
-{ "🖼️", &EMOJI_LIST[1142] },
-{ "🎨", &EMOJI_LIST[1143] },
-{ "🧵", &EMOJI_LIST[1144] },
-{ "🪡", &EMOJI_LIST[1145] },
-{ "🧶", &EMOJI_LIST[1146] },
-{ "🪢", &EMOJI_LIST[1147] },
-{ "👓", &EMOJI_LIST[1148] },
-{ "🕶️", &EMOJI_LIST[1149] },
-{ "🥽", &EMOJI_LIST[1150] },
-{ "🥼", &EMOJI_LIST[1151] },
-{ "🦺", &EMOJI_LIST[1152] },
-{ "👔", &EMOJI_LIST[1153] },
-{ "👕", &EMOJI_LIST[1154] },
-{ "👖", &EMOJI_LIST[1155] },
-{ "🧣", &EMOJI_LIST[1156] },
-{ "🧤", &EMOJI_LIST[1157] },
-{ "🧥", &EMOJI_LIST[1158] },
-{ "🧦", &EMOJI_LIST[1159] },
-{ "👗", &EMOJI_LIST[1160] },
-{ "👘", &EMOJI_LIST[1161] },
-{ "🥻", &EMOJI_LIST[1162] },
-{ "🩱", &EMOJI_LIST[1163] },
-{ "🩲", &EMOJI_LIST[1164] },
-{ "🩳", &EMOJI_LIST[1165] },
-{ "👙", &EMOJI_LIST[1166] },
-{ "👚", &EMOJI_LIST[1167] },
-{ "🪭", &EMOJI_LIST[1168] },
-{ "👛", &EMOJI_LIST[1169] },
-{ "👜", &EMOJI_LIST[1170] },
-{ "👝", &EMOJI_LIST[1171] },
-{ "🛍️", &EMOJI_LIST[1172] },
-{ "🎒", &EMOJI_LIST[1173] },
-{ "🩴", &EMOJI_LIST[1174] },
-{ "👞", &EMOJI_LIST[1175] },
-{ "👟", &EMOJI_LIST[1176] },
-{ "🥾", &EMOJI_LIST[1177] },
-{ "🥿", &EMOJI_LIST[1178] },
-{ "👠", &EMOJI_LIST[1179] },
-{ "👡", &EMOJI_LIST[1180] },
-{ "🩰", &EMOJI_LIST[1181] },
-{ "👢", &EMOJI_LIST[1182] },
-{ "🪮", &EMOJI_LIST[1183] },
-{ "👑", &EMOJI_LIST[1184] },
-{ "👒", &EMOJI_LIST[1185] },
-{ "🎩", &EMOJI_LIST[1186] },
-{ "🎓", &EMOJI_LIST[1187] },
-{ "🧢", &EMOJI_LIST[1188] },
-{ "🪖", &EMOJI_LIST[1189] },
-{ "⛑️", &EMOJI_LIST[1190] },
-{ "📿", &EMOJI_LIST[1191] },
-{ "💄", &EMOJI_LIST[1192] },
-{ "💍", &EMOJI_LIST[1193] },
-{ "💎", &EMOJI_LIST[1194] },
-{ "🔇", &EMOJI_LIST[1195] },
-{ "🔈", &EMOJI_LIST[1196] },
-{ "🔉", &EMOJI_LIST[1197] },
-{ "🔊", &EMOJI_LIST[1198] },
-{ "📢", &EMOJI_LIST[1199] },
-{ "📣", &EMOJI_LIST[1200] },
-{ "📯", &EMOJI_LIST[1201] },
-{ "🔔", &EMOJI_LIST[1202] },
-{ "🔕", &EMOJI_LIST[1203] },
-{ "🎼", &EMOJI_LIST[1204] },
-{ "🎵", &EMOJI_LIST[1205] },
-{ "🎶", &EMOJI_LIST[1206] },
-{ "🎙️", &EMOJI_LIST[1207] },
-{ "🎚️", &EMOJI_LIST[1208] },
-{ "🎛️", &EMOJI_LIST[1209] },
-{ "🎤", &EMOJI_LIST[1210] },
-{ "🎧", &EMOJI_LIST[1211] },
-{ "📻", &EMOJI_LIST[1212] },
-{ "🎷", &EMOJI_LIST[1213] },
-{ "🪗", &EMOJI_LIST[1214] },
-{ "🎸", &EMOJI_LIST[1215] },
-{ "🎹", &EMOJI_LIST[1216] },
-{ "🎺", &EMOJI_LIST[1217] },
-{ "🎻", &EMOJI_LIST[1218] },
-{ "🪕", &EMOJI_LIST[1219] },
-{ "🥁", &EMOJI_LIST[1220] },
-{ "🪘", &EMOJI_LIST[1221] },
-{ "🪇", &EMOJI_LIST[1222] },
-{ "🪈", &EMOJI_LIST[1223] },
-{ "🪉", &EMOJI_LIST[1224] },
-{ "📱", &EMOJI_LIST[1225] },
-{ "📲", &EMOJI_LIST[1226] },
-{ "☎️", &EMOJI_LIST[1227] },
-{ "📞", &EMOJI_LIST[1228] },
-{ "📟", &EMOJI_LIST[1229] },
-{ "📠", &EMOJI_LIST[1230] },
-{ "🔋", &EMOJI_LIST[1231] },
-{ "🪫", &EMOJI_LIST[1232] },
-{ "🔌", &EMOJI_LIST[1233] },
-{ "💻", &EMOJI_LIST[1234] },
-{ "🖥️", &EMOJI_LIST[1235] },
-{ "🖨️", &EMOJI_LIST[1236] },
-{ "⌨️", &EMOJI_LIST[1237] },
-{ "🖱️", &EMOJI_LIST[1238] },
-{ "🖲️", &EMOJI_LIST[1239] },
-{ "💽", &EMOJI_LIST[1240] },
-{ "💾", &EMOJI_LIST[1241] },
-{ "💿", &EMOJI_LIST[1242] },
-{ "📀", &EMOJI_LIST[1243] },
-{ "🧮", &EMOJI_LIST[1244] },
-{ "🎥", &EMOJI_LIST[1245] },
-{ "🎞️", &EMOJI_LIST[1246] },
-{ "📽️", &EMOJI_LIST[1247] },
-{ "🎬", &EMOJI_LIST[1248] },
-{ "📺", &EMOJI_LIST[1249] },
-{ "📷", &EMOJI_LIST[1250] },
-{ "📸", &EMOJI_LIST[1251] },
-{ "📹", &EMOJI_LIST[1252] },
-{ "📼", &EMOJI_LIST[1253] },
-{ "🔍", &EMOJI_LIST[1254] },
-{ "🔎", &EMOJI_LIST[1255] },
-{ "🕯️", &EMOJI_LIST[1256] },
-{ "💡", &EMOJI_LIST[1257] },
-{ "🔦", &EMOJI_LIST[1258] },
-{ "🏮", &EMOJI_LIST[1259] },
-{ "🪔", &EMOJI_LIST[1260] },
-{ "📔", &EMOJI_LIST[1261] },
-{ "📕", &EMOJI_LIST[1262] },
-{ "📖", &EMOJI_LIST[1263] },
-{ "📗", &EMOJI_LIST[1264] },
-{ "📘", &EMOJI_LIST[1265] },
-{ "📙", &EMOJI_LIST[1266] },
-{ "📚", &EMOJI_LIST[1267] },
-{ "📓", &EMOJI_LIST[1268] },
-{ "📒", &EMOJI_LIST[1269] },
-{ "📃", &EMOJI_LIST[1270] },
-{ "📜", &EMOJI_LIST[1271] },
-{ "📄", &EMOJI_LIST[1272] },
-{ "📰", &EMOJI_LIST[1273] },
-{ "🗞️", &EMOJI_LIST[1274] },
-{ "📑", &EMOJI_LIST[1275] },
-{ "🔖", &EMOJI_LIST[1276] },
-{ "🏷️", &EMOJI_LIST[1277] },
-{ "💰", &EMOJI_LIST[1278] },
-{ "🪙", &EMOJI_LIST[1279] },
-{ "💴", &EMOJI_LIST[1280] },
-{ "💵", &EMOJI_LIST[1281] },
-{ "💶", &EMOJI_LIST[1282] },
-{ "💷", &EMOJI_LIST[1283] },
-{ "💸", &EMOJI_LIST[1284] },
-{ "💳", &EMOJI_LIST[1285] },
-{ "🧾", &EMOJI_LIST[1286] },
-{ "💹", &EMOJI_LIST[1287] },
-{ "✉️", &EMOJI_LIST[1288] },
-{ "📧", &EMOJI_LIST[1289] },
-{ "📨", &EMOJI_LIST[1290] },
-{ "📩", &EMOJI_LIST[1291] },
-{ "📤", &EMOJI_LIST[1292] },
-{ "📥", &EMOJI_LIST[1293] },
-{ "📦", &EMOJI_LIST[1294] },
-{ "📫", &EMOJI_LIST[1295] },
-{ "📪", &EMOJI_LIST[1296] },
-{ "📬", &EMOJI_LIST[1297] },
-{ "📭", &EMOJI_LIST[1298] },
-{ "📮", &EMOJI_LIST[1299] },
-{ "🗳️", &EMOJI_LIST[1300] },
-{ "✏️", &EMOJI_LIST[1301] },
-{ "✒️", &EMOJI_LIST[1302] },
-{ "🖋️", &EMOJI_LIST[1303] },
-{ "🖊️", &EMOJI_LIST[1304] },
-{ "🖌️", &EMOJI_LIST[1305] },
-{ "🖍️", &EMOJI_LIST[1306] },
-{ "📝", &EMOJI_LIST[1307] },
-{ "💼", &EMOJI_LIST[1308] },
-{ "📁", &EMOJI_LIST[1309] },
-{ "📂", &EMOJI_LIST[1310] },
-{ "🗂️", &EMOJI_LIST[1311] },
-{ "📅", &EMOJI_LIST[1312] },
-{ "📆", &EMOJI_LIST[1313] },
-{ "🗒️", &EMOJI_LIST[1314] },
-{ "🗓️", &EMOJI_LIST[1315] },
-{ "📇", &EMOJI_LIST[1316] },
-{ "📈", &EMOJI_LIST[1317] },
-{ "📉", &EMOJI_LIST[1318] },
-{ "📊", &EMOJI_LIST[1319] },
-{ "📋", &EMOJI_LIST[1320] },
-{ "📌", &EMOJI_LIST[1321] },
-{ "📍", &EMOJI_LIST[1322] },
-{ "📎", &EMOJI_LIST[1323] },
-{ "🖇️", &EMOJI_LIST[1324] },
-{ "📏", &EMOJI_LIST[1325] },
-{ "📐", &EMOJI_LIST[1326] },
-{ "✂️", &EMOJI_LIST[1327] },
-{ "🗃️", &EMOJI_LIST[1328] },
-{ "🗄️", &EMOJI_LIST[1329] },
-{ "🗑️", &EMOJI_LIST[1330] },
-{ "🔒", &EMOJI_LIST[1331] },
-{ "🔓", &EMOJI_LIST[1332] },
-{ "🔏", &EMOJI_LIST[1333] },
-{ "🔐", &EMOJI_LIST[1334] },
-{ "🔑", &EMOJI_LIST[1335] },
-{ "🗝️", &EMOJI_LIST[1336] },
-{ "🔨", &EMOJI_LIST[1337] },
-{ "🪓", &EMOJI_LIST[1338] },
-{ "⛏️", &EMOJI_LIST[1339] },
-{ "⚒️", &EMOJI_LIST[1340] },
-{ "🛠️", &EMOJI_LIST[1341] },
-{ "🗡️", &EMOJI_LIST[1342] },
-{ "⚔️", &EMOJI_LIST[1343] },
-{ "💣", &EMOJI_LIST[1344] },
-{ "🪃", &EMOJI_LIST[1345] },
-{ "🏹", &EMOJI_LIST[1346] },
-{ "🛡️", &EMOJI_LIST[1347] },
-{ "🪚", &EMOJI_LIST[1348] },
-{ "🔧", &EMOJI_LIST[1349] },
-{ "🪛", &EMOJI_LIST[1350] },
-{ "🔩", &EMOJI_LIST[1351] },
-{ "⚙️", &EMOJI_LIST[1352] },
-{ "🗜️", &EMOJI_LIST[1353] },
-{ "⚖️", &EMOJI_LIST[1354] },
-{ "🦯", &EMOJI_LIST[1355] },
-{ "🔗", &EMOJI_LIST[1356] },
-{ "⛓️‍💥", &EMOJI_LIST[1357] },
-{ "⛓️", &EMOJI_LIST[1358] },
-{ "🪝", &EMOJI_LIST[1359] },
-{ "🧰", &EMOJI_LIST[1360] },
-{ "🧲", &EMOJI_LIST[1361] },
-{ "🪜", &EMOJI_LIST[1362] },
-{ "🪏", &EMOJI_LIST[1363] },
-{ "⚗️", &EMOJI_LIST[1364] },
-{ "🧪", &EMOJI_LIST[1365] },
-{ "🧫", &EMOJI_LIST[1366] },
-{ "🧬", &EMOJI_LIST[1367] },
-{ "🔬", &EMOJI_LIST[1368] },
-{ "🔭", &EMOJI_LIST[1369] },
-{ "📡", &EMOJI_LIST[1370] },
-{ "💉", &EMOJI_LIST[1371] },
-{ "🩸", &EMOJI_LIST[1372] },
-{ "💊", &EMOJI_LIST[1373] },
-{ "🩹", &EMOJI_LIST[1374] },
-{ "🩼", &EMOJI_LIST[1375] },
-{ "🩺", &EMOJI_LIST[1376] },
-{ "🩻", &EMOJI_LIST[1377] },
-{ "🚪", &EMOJI_LIST[1378] },
-{ "🛗", &EMOJI_LIST[1379] },
-{ "🪞", &EMOJI_LIST[1380] },
-{ "🪟", &EMOJI_LIST[1381] },
-{ "🛏️", &EMOJI_LIST[1382] },
-{ "🛋️", &EMOJI_LIST[1383] },
-{ "🪑", &EMOJI_LIST[1384] },
-{ "🚽", &EMOJI_LIST[1385] },
-{ "🪠", &EMOJI_LIST[1386] },
-{ "🚿", &EMOJI_LIST[1387] },
-{ "🛁", &EMOJI_LIST[1388] },
-{ "🪤", &EMOJI_LIST[1389] },
-{ "🪒", &EMOJI_LIST[1390] },
-{ "🧴", &EMOJI_LIST[1391] },
-{ "🧷", &EMOJI_LIST[1392] },
-{ "🧹", &EMOJI_LIST[1393] },
-{ "🧺", &EMOJI_LIST[1394] },
-{ "🧻", &EMOJI_LIST[1395] },
-{ "🪣", &EMOJI_LIST[1396] },
-{ "🧼", &EMOJI_LIST[1397] },
-{ "🫧", &EMOJI_LIST[1398] },
-{ "🪥", &EMOJI_LIST[1399] },
-{ "🧽", &EMOJI_LIST[1400] },
-{ "🧯", &EMOJI_LIST[1401] },
-{ "🛒", &EMOJI_LIST[1402] },
-{ "🚬", &EMOJI_LIST[1403] },
-{ "⚰️", &EMOJI_LIST[1404] },
-{ "🪦", &EMOJI_LIST[1405] },
-{ "⚱️", &EMOJI_LIST[1406] },
-{ "🧿", &EMOJI_LIST[1407] },
-{ "🪬", &EMOJI_LIST[1408] },
-{ "🗿", &EMOJI_LIST[1409] },
-{ "🪧", &EMOJI_LIST[1410] },
-{ "🪪", &EMOJI_LIST[1411] },
-{ "🏧", &EMOJI_LIST[1412] },
-{ "🚮", &EMOJI_LIST[1413] },
-{ "🚰", &EMOJI_LIST[1414] },
-{ "♿", &EMOJI_LIST[1415] },
-{ "🚹", &EMOJI_LIST[1416] },
-{ "🚺", &EMOJI_LIST[1417] },
-{ "🚻", &EMOJI_LIST[1418] },
-{ "🚼", &EMOJI_LIST[1419] },
-{ "🚾", &EMOJI_LIST[1420] },
-{ "🛂", &EMOJI_LIST[1421] },
-{ "🛃", &EMOJI_LIST[1422] },
-{ "🛄", &EMOJI_LIST[1423] },
-{ "🛅", &EMOJI_LIST[1424] },
-{ "⚠️", &EMOJI_LIST[1425] },
-{ "🚸", &EMOJI_LIST[1426] },
-{ "⛔", &EMOJI_LIST[1427] },
-{ "🚫", &EMOJI_LIST[1428] },
-{ "🚳", &EMOJI_LIST[1429] },
-{ "🚭", &EMOJI_LIST[1430] },
-{ "🚯", &EMOJI_LIST[1431] },
-{ "🚱", &EMOJI_LIST[1432] },
-{ "🚷", &EMOJI_LIST[1433] },
-{ "📵", &EMOJI_LIST[1434] },
-{ "🔞", &EMOJI_LIST[1435] },
-{ "☢️", &EMOJI_LIST[1436] },
-{ "☣️", &EMOJI_LIST[1437] },
-{ "⬆️", &EMOJI_LIST[1438] },
-{ "↗️", &EMOJI_LIST[1439] },
-{ "➡️", &EMOJI_LIST[1440] },
-{ "↘️", &EMOJI_LIST[1441] },
-{ "⬇️", &EMOJI_LIST[1442] },
-{ "↙️", &EMOJI_LIST[1443] },
-{ "⬅️", &EMOJI_LIST[1444] },
-{ "↖️", &EMOJI_LIST[1445] },
-{ "↕️", &EMOJI_LIST[1446] },
-{ "↔️", &EMOJI_LIST[1447] },
-{ "↩️", &EMOJI_LIST[1448] },
-{ "↪️", &EMOJI_LIST[1449] },
-{ "⤴️", &EMOJI_LIST[1450] },
-{ "⤵️", &EMOJI_LIST[1451] },
-{ "🔃", &EMOJI_LIST[1452] },
-{ "🔄", &EMOJI_LIST[1453] },
-{ "🔙", &EMOJI_LIST[1454] },
-{ "🔚", &EMOJI_LIST[1455] },
-{ "🔛", &EMOJI_LIST[1456] },
-{ "🔜", &EMOJI_LIST[1457] },
-{ "🔝", &EMOJI_LIST[1458] },
-{ "🛐", &EMOJI_LIST[1459] },
-{ "⚛️", &EMOJI_LIST[1460] },
-{ "🕉️", &EMOJI_LIST[1461] },
-{ "✡️", &EMOJI_LIST[1462] },
-{ "☸️", &EMOJI_LIST[1463] },
-{ "☯️", &EMOJI_LIST[1464] },
-{ "✝️", &EMOJI_LIST[1465] },
-{ "☦️", &EMOJI_LIST[1466] },
-{ "☪️", &EMOJI_LIST[1467] },
-{ "☮️", &EMOJI_LIST[1468] },
-{ "🕎", &EMOJI_LIST[1469] },
-{ "🔯", &EMOJI_LIST[1470] },
-{ "🪯", &EMOJI_LIST[1471] },
-{ "♈", &EMOJI_LIST[1472] },
-{ "♉", &EMOJI_LIST[1473] },
-{ "♊", &EMOJI_LIST[1474] },
-{ "♋", &EMOJI_LIST[1475] },
-{ "♌", &EMOJI_LIST[1476] },
-{ "♍", &EMOJI_LIST[1477] },
-{ "♎", &EMOJI_LIST[1478] },
-{ "♏", &EMOJI_LIST[1479] },
-{ "♐", &EMOJI_LIST[1480] },
-{ "♑", &EMOJI_LIST[1481] },
-{ "♒", &EMOJI_LIST[1482] },
-{ "♓", &EMOJI_LIST[1483] },
-{ "⛎", &EMOJI_LIST[1484] },
-{ "🔀", &EMOJI_LIST[1485] },
-{ "🔁", &EMOJI_LIST[1486] },
-{ "🔂", &EMOJI_LIST[1487] },
-{ "▶️", &EMOJI_LIST[1488] },
-{ "⏩", &EMOJI_LIST[1489] },
-{ "⏭️", &EMOJI_LIST[1490] },
-{ "⏯️", &EMOJI_LIST[1491] },
-{ "◀️", &EMOJI_LIST[1492] },
-{ "⏪", &EMOJI_LIST[1493] },
-{ "⏮️", &EMOJI_LIST[1494] },
-{ "🔼", &EMOJI_LIST[1495] },
-{ "⏫", &EMOJI_LIST[1496] },
-{ "🔽", &EMOJI_LIST[1497] },
-{ "⏬", &EMOJI_LIST[1498] },
-{ "⏸️", &EMOJI_LIST[1499] },
-{ "⏹️", &EMOJI_LIST[1500] },
-{ "⏺️", &EMOJI_LIST[1501] },
-{ "⏏️", &EMOJI_LIST[1502] },
-{ "🎦", &EMOJI_LIST[1503] },
-{ "🔅", &EMOJI_LIST[1504] },
-{ "🔆", &EMOJI_LIST[1505] },
-{ "📶", &EMOJI_LIST[1506] },
-{ "🛜", &EMOJI_LIST[1507] },
-{ "📳", &EMOJI_LIST[1508] },
-{ "📴", &EMOJI_LIST[1509] },
-{ "♀️", &EMOJI_LIST[1510] },
-{ "♂️", &EMOJI_LIST[1511] },
-{ "⚧️", &EMOJI_LIST[1512] },
-{ "✖️", &EMOJI_LIST[1513] },
-{ "➕", &EMOJI_LIST[1514] },
-{ "➖", &EMOJI_LIST[1515] },
-{ "➗", &EMOJI_LIST[1516] },
-{ "🟰", &EMOJI_LIST[1517] },
-{ "♾️", &EMOJI_LIST[1518] },
-{ "‼️", &EMOJI_LIST[1519] },
-{ "⁉️", &EMOJI_LIST[1520] },
-{ "❓", &EMOJI_LIST[1521] },
-{ "❔", &EMOJI_LIST[1522] },
-{ "❕", &EMOJI_LIST[1523] },
-{ "❗", &EMOJI_LIST[1524] },
-{ "〰️", &EMOJI_LIST[1525] },
-{ "💱", &EMOJI_LIST[1526] },
-{ "💲", &EMOJI_LIST[1527] },
-{ "⚕️", &EMOJI_LIST[1528] },
-{ "♻️", &EMOJI_LIST[1529] },
-{ "⚜️", &EMOJI_LIST[1530] },
-{ "🔱", &EMOJI_LIST[1531] },
-{ "📛", &EMOJI_LIST[1532] },
-{ "🔰", &EMOJI_LIST[1533] },
-{ "⭕", &EMOJI_LIST[1534] },
-{ "✅", &EMOJI_LIST[1535] },
-{ "☑️", &EMOJI_LIST[1536] },
-{ "✔️", &EMOJI_LIST[1537] },
-{ "❌", &EMOJI_LIST[1538] },
-{ "❎", &EMOJI_LIST[1539] },
-{ "➰", &EMOJI_LIST[1540] },
-{ "➿", &EMOJI_LIST[1541] },
-{ "〽️", &EMOJI_LIST[1542] },
-{ "✳️", &EMOJI_LIST[1543] },
-{ "✴️", &EMOJI_LIST[1544] },
-{ "❇️", &EMOJI_LIST[1545] },
-{ "©️", &EMOJI_LIST[1546] },
-{ "®️", &EMOJI_LIST[1547] },
-{ "™️", &EMOJI_LIST[1548] },
-{ "🫟", &EMOJI_LIST[1549] },
-{ "#️⃣", &EMOJI_LIST[1550] },
-{ "*️⃣", &EMOJI_LIST[1551] },
-{ "0️⃣", &EMOJI_LIST[1552] },
-{ "1️⃣", &EMOJI_LIST[1553] },
-{ "2️⃣", &EMOJI_LIST[1554] },
-{ "3️⃣", &EMOJI_LIST[1555] },
-{ "4️⃣", &EMOJI_LIST[1556] },
-{ "5️⃣", &EMOJI_LIST[1557] },
-{ "6️⃣", &EMOJI_LIST[1558] },
-{ "7️⃣", &EMOJI_LIST[1559] },
-{ "8️⃣", &EMOJI_LIST[1560] },
-{ "9️⃣", &EMOJI_LIST[1561] },
-{ "🔟", &EMOJI_LIST[1562] },
-{ "🔠", &EMOJI_LIST[1563] },
-{ "🔡", &EMOJI_LIST[1564] },
-{ "🔢", &EMOJI_LIST[1565] },
-{ "🔣", &EMOJI_LIST[1566] },
-{ "🔤", &EMOJI_LIST[1567] },
-{ "🅰️", &EMOJI_LIST[1568] },
-{ "🆎", &EMOJI_LIST[1569] },
-{ "🅱️", &EMOJI_LIST[1570] },
-{ "🆑", &EMOJI_LIST[1571] },
-{ "🆒", &EMOJI_LIST[1572] },
-{ "🆓", &EMOJI_LIST[1573] },
-{ "ℹ️", &EMOJI_LIST[1574] },
-{ "🆔", &EMOJI_LIST[1575] },
-{ "Ⓜ️", &EMOJI_LIST[1576] },
-{ "🆕", &EMOJI_LIST[1577] },
-{ "🆖", &EMOJI_LIST[1578] },
-{ "🅾️", &EMOJI_LIST[1579] },
-{ "🆗", &EMOJI_LIST[1580] },
-{ "🅿️", &EMOJI_LIST[1581] },
-{ "🆘", &EMOJI_LIST[1582] },
-{ "🆙", &EMOJI_LIST[1583] },
-{ "🆚", &EMOJI_LIST[1584] },
-{ "🈁", &EMOJI_LIST[1585] },
-{ "🈂️", &EMOJI_LIST[1586] },
-{ "🈷️", &EMOJI_LIST[1587] },
-{ "🈶", &EMOJI_LIST[1588] },
-{ "🈯", &EMOJI_LIST[1589] },
-{ "🉐", &EMOJI_LIST[1590] },
-{ "🈹", &EMOJI_LIST[1591] },
-{ "🈚", &EMOJI_LIST[1592] },
-{ "🈲", &EMOJI_LIST[1593] },
-{ "🉑", &EMOJI_LIST[1594] },
-{ "🈸", &EMOJI_LIST[1595] },
-{ "🈴", &EMOJI_LIST[1596] },
-{ "🈳", &EMOJI_LIST[1597] },
-{ "㊗️", &EMOJI_LIST[1598] },
-{ "㊙️", &EMOJI_LIST[1599] },
-{ "🈺", &EMOJI_LIST[1600] },
-{ "🈵", &EMOJI_LIST[1601] },
-{ "🔴", &EMOJI_LIST[1602] },
-{ "🟠", &EMOJI_LIST[1603] },
-{ "🟡", &EMOJI_LIST[1604] },
-{ "🟢", &EMOJI_LIST[1605] },
-{ "🔵", &EMOJI_LIST[1606] },
-{ "🟣", &EMOJI_LIST[1607] },
-{ "🟤", &EMOJI_LIST[1608] },
-{ "⚫", &EMOJI_LIST[1609] },
-{ "⚪", &EMOJI_LIST[1610] },
-{ "🟥", &EMOJI_LIST[1611] },
-{ "🟧", &EMOJI_LIST[1612] },
-{ "🟨", &EMOJI_LIST[1613] },
-{ "🟩", &EMOJI_LIST[1614] },
-{ "🟦", &EMOJI_LIST[1615] },
-{ "🟪", &EMOJI_LIST[1616] },
-{ "🟫", &EMOJI_LIST[1617] },
-{ "⬛", &EMOJI_LIST[1618] },
-{ "⬜", &EMOJI_LIST[1619] },
-{ "◼️", &EMOJI_LIST[1620] },
-{ "◻️", &EMOJI_LIST[1621] },
-{ "◾", &EMOJI_LIST[1622] },
-{ "◽", &EMOJI_LIST[1623] },
-{ "▪️", &EMOJI_LIST[1624] },
-{ "▫️", &EMOJI_LIST[1625] },
-{ "🔶", &EMOJI_LIST[1626] },
-{ "🔷", &EMOJI_LIST[1627] },
-{ "🔸", &EMOJI_LIST[1628] },
-{ "🔹", &EMOJI_LIST[1629] },
-{ "🔺", &EMOJI_LIST[1630] },
-{ "🔻", &EMOJI_LIST[1631] },
-{ "💠", &EMOJI_LIST[1632] },
-{ "🔘", &EMOJI_LIST[1633] },
-{ "🔳", &EMOJI_LIST[1634] },
-{ "🔲", &EMOJI_LIST[1635] },
-{ "🏁", &EMOJI_LIST[1636] },
-{ "🚩", &EMOJI_LIST[1637] },
-{ "🎌", &EMOJI_LIST[1638] },
-{ "🏴", &EMOJI_LIST[1639] },
-{ "🏳️", &EMOJI_LIST[1640] },
-{ "🏳️‍🌈", &EMOJI_LIST[1641] },
-{ "🏳️‍⚧️", &EMOJI_LIST[1642] },
-{ "🏴‍☠️", &EMOJI_LIST[1643] },
-{ "🇦🇨", &EMOJI_LIST[1644] },
-{ "🇦🇩", &EMOJI_LIST[1645] },
-{ "🇦🇪", &EMOJI_LIST[1646] },
-{ "🇦🇫", &EMOJI_LIST[1647] },
-{ "🇦🇬", &EMOJI_LIST[1648] },
-{ "🇦🇮", &EMOJI_LIST[1649] },
-{ "🇦🇱", &EMOJI_LIST[1650] },
-{ "🇦🇲", &EMOJI_LIST[1651] },
-{ "🇦🇴", &EMOJI_LIST[1652] },
-{ "🇦🇶", &EMOJI_LIST[1653] },
-{ "🇦🇷", &EMOJI_LIST[1654] },
-{ "🇦🇸", &EMOJI_LIST[1655] },
-{ "🇦🇹", &EMOJI_LIST[1656] },
-{ "🇦🇺", &EMOJI_LIST[1657] },
-{ "🇦🇼", &EMOJI_LIST[1658] },
-{ "🇦🇽", &EMOJI_LIST[1659] },
-{ "🇦🇿", &EMOJI_LIST[1660] },
-{ "🇧🇦", &EMOJI_LIST[1661] },
-{ "🇧🇧", &EMOJI_LIST[1662] },
-{ "🇧🇩", &EMOJI_LIST[1663] },
-{ "🇧🇪", &EMOJI_LIST[1664] },
-{ "🇧🇫", &EMOJI_LIST[1665] },
-{ "🇧🇬", &EMOJI_LIST[1666] },
-{ "🇧🇭", &EMOJI_LIST[1667] },
-{ "🇧🇮", &EMOJI_LIST[1668] },
-{ "🇧🇯", &EMOJI_LIST[1669] },
-{ "🇧🇱", &EMOJI_LIST[1670] },
-{ "🇧🇲", &EMOJI_LIST[1671] },
-{ "🇧🇳", &EMOJI_LIST[1672] },
-{ "🇧🇴", &EMOJI_LIST[1673] },
-{ "🇧🇶", &EMOJI_LIST[1674] },
-{ "🇧🇷", &EMOJI_LIST[1675] },
-{ "🇧🇸", &EMOJI_LIST[1676] },
-{ "🇧🇹", &EMOJI_LIST[1677] },
-{ "🇧🇻", &EMOJI_LIST[1678] },
-{ "🇧🇼", &EMOJI_LIST[1679] },
-{ "🇧🇾", &EMOJI_LIST[1680] },
-{ "🇧🇿", &EMOJI_LIST[1681] },
-{ "🇨🇦", &EMOJI_LIST[1682] },
-{ "🇨🇨", &EMOJI_LIST[1683] },
-{ "🇨🇩", &EMOJI_LIST[1684] },
-{ "🇨🇫", &EMOJI_LIST[1685] },
-{ "🇨🇬", &EMOJI_LIST[1686] },
-{ "🇨🇭", &EMOJI_LIST[1687] },
-{ "🇨🇮", &EMOJI_LIST[1688] },
-{ "🇨🇰", &EMOJI_LIST[1689] },
-{ "🇨🇱", &EMOJI_LIST[1690] },
-{ "🇨🇲", &EMOJI_LIST[1691] },
-{ "🇨🇳", &EMOJI_LIST[1692] },
-{ "🇨🇴", &EMOJI_LIST[1693] },
-{ "🇨🇵", &EMOJI_LIST[1694] },
-{ "🇨🇶", &EMOJI_LIST[1695] },
-{ "🇨🇷", &EMOJI_LIST[1696] },
-{ "🇨🇺", &EMOJI_LIST[1697] },
-{ "🇨🇻", &EMOJI_LIST[1698] },
-{ "🇨🇼", &EMOJI_LIST[1699] },
-{ "🇨🇽", &EMOJI_LIST[1700] },
-{ "🇨🇾", &EMOJI_LIST[1701] },
-{ "🇨🇿", &EMOJI_LIST[1702] },
-{ "🇩🇪", &EMOJI_LIST[1703] },
-{ "🇩🇬", &EMOJI_LIST[1704] },
-{ "🇩🇯", &EMOJI_LIST[1705] },
-{ "🇩🇰", &EMOJI_LIST[1706] },
-{ "🇩🇲", &EMOJI_LIST[1707] },
-{ "🇩🇴", &EMOJI_LIST[1708] },
-{ "🇩🇿", &EMOJI_LIST[1709] },
-{ "🇪🇦", &EMOJI_LIST[1710] },
-{ "🇪🇨", &EMOJI_LIST[1711] },
-{ "🇪🇪", &EMOJI_LIST[1712] },
-{ "🇪🇬", &EMOJI_LIST[1713] },
-{ "🇪🇭", &EMOJI_LIST[1714] },
-{ "🇪🇷", &EMOJI_LIST[1715] },
-{ "🇪🇸", &EMOJI_LIST[1716] },
-{ "🇪🇹", &EMOJI_LIST[1717] },
-{ "🇪🇺", &EMOJI_LIST[1718] },
-{ "🇫🇮", &EMOJI_LIST[1719] },
-{ "🇫🇯", &EMOJI_LIST[1720] },
-{ "🇫🇰", &EMOJI_LIST[1721] },
-{ "🇫🇲", &EMOJI_LIST[1722] },
-{ "🇫🇴", &EMOJI_LIST[1723] },
-{ "🇫🇷", &EMOJI_LIST[1724] },
-{ "🇬🇦", &EMOJI_LIST[1725] },
-{ "🇬🇧", &EMOJI_LIST[1726] },
-{ "🇬🇩", &EMOJI_LIST[1727] },
-{ "🇬🇪", &EMOJI_LIST[1728] },
-{ "🇬🇫", &EMOJI_LIST[1729] },
-{ "🇬🇬", &EMOJI_LIST[1730] },
-{ "🇬🇭", &EMOJI_LIST[1731] },
-{ "🇬🇮", &EMOJI_LIST[1732] },
-{ "🇬🇱", &EMOJI_LIST[1733] },
-{ "🇬🇲", &EMOJI_LIST[1734] },
-{ "🇬🇳", &EMOJI_LIST[1735] },
-{ "🇬🇵", &EMOJI_LIST[1736] },
-{ "🇬🇶", &EMOJI_LIST[1737] },
-{ "🇬🇷", &EMOJI_LIST[1738] },
-{ "🇬🇸", &EMOJI_LIST[1739] },
-{ "🇬🇹", &EMOJI_LIST[1740] },
-{ "🇬🇺", &EMOJI_LIST[1741] },
-{ "🇬🇼", &EMOJI_LIST[1742] },
-{ "🇬🇾", &EMOJI_LIST[1743] },
-{ "🇭🇰", &EMOJI_LIST[1744] },
-{ "🇭🇲", &EMOJI_LIST[1745] },
-{ "🇭🇳", &EMOJI_LIST[1746] },
-{ "🇭🇷", &EMOJI_LIST[1747] },
-{ "🇭🇹", &EMOJI_LIST[1748] },
-{ "🇭🇺", &EMOJI_LIST[1749] },
-{ "🇮🇨", &EMOJI_LIST[1750] },
-{ "🇮🇩", &EMOJI_LIST[1751] },
-{ "🇮🇪", &EMOJI_LIST[1752] },
-{ "🇮🇱", &EMOJI_LIST[1753] },
-{ "🇮🇲", &EMOJI_LIST[1754] },
-{ "🇮🇳", &EMOJI_LIST[1755] },
-{ "🇮🇴", &EMOJI_LIST[1756] },
-{ "🇮🇶", &EMOJI_LIST[1757] },
-{ "🇮🇷", &EMOJI_LIST[1758] },
-{ "🇮🇸", &EMOJI_LIST[1759] },
-{ "🇮🇹", &EMOJI_LIST[1760] },
-{ "🇯🇪", &EMOJI_LIST[1761] },
-{ "🇯🇲", &EMOJI_LIST[1762] },
-{ "🇯🇴", &EMOJI_LIST[1763] },
-{ "🇯🇵", &EMOJI_LIST[1764] },
-{ "🇰🇪", &EMOJI_LIST[1765] },
-{ "🇰🇬", &EMOJI_LIST[1766] },
-{ "🇰🇭", &EMOJI_LIST[1767] },
-{ "🇰🇮", &EMOJI_LIST[1768] },
-{ "🇰🇲", &EMOJI_LIST[1769] },
-{ "🇰🇳", &EMOJI_LIST[1770] },
-{ "🇰🇵", &EMOJI_LIST[1771] },
-{ "🇰🇷", &EMOJI_LIST[1772] },
-{ "🇰🇼", &EMOJI_LIST[1773] },
-{ "🇰🇾", &EMOJI_LIST[1774] },
-{ "🇰🇿", &EMOJI_LIST[1775] },
-{ "🇱🇦", &EMOJI_LIST[1776] },
-{ "🇱🇧", &EMOJI_LIST[1777] },
-{ "🇱🇨", &EMOJI_LIST[1778] },
-{ "🇱🇮", &EMOJI_LIST[1779] },
-{ "🇱🇰", &EMOJI_LIST[1780] },
-{ "🇱🇷", &EMOJI_LIST[1781] },
-{ "🇱🇸", &EMOJI_LIST[1782] },
-{ "🇱🇹", &EMOJI_LIST[1783] },
-{ "🇱🇺", &EMOJI_LIST[1784] },
-{ "🇱🇻", &EMOJI_LIST[1785] },
-{ "🇱🇾", &EMOJI_LIST[1786] },
-{ "🇲🇦", &EMOJI_LIST[1787] },
-{ "🇲🇨", &EMOJI_LIST[1788] },
-{ "🇲🇩", &EMOJI_LIST[1789] },
-{ "🇲🇪", &EMOJI_LIST[1790] },
-{ "🇲🇫", &EMOJI_LIST[1791] },
-{ "🇲🇬", &EMOJI_LIST[1792] },
-{ "🇲🇭", &EMOJI_LIST[1793] },
-{ "🇲🇰", &EMOJI_LIST[1794] },
-{ "🇲🇱", &EMOJI_LIST[1795] },
-{ "🇲🇲", &EMOJI_LIST[1796] },
-{ "🇲🇳", &EMOJI_LIST[1797] },
-{ "🇲🇴", &EMOJI_LIST[1798] },
-{ "🇲🇵", &EMOJI_LIST[1799] },
-{ "🇲🇶", &EMOJI_LIST[1800] },
-{ "🇲🇷", &EMOJI_LIST[1801] },
-{ "🇲🇸", &EMOJI_LIST[1802] },
-{ "🇲🇹", &EMOJI_LIST[1803] },
-{ "🇲🇺", &EMOJI_LIST[1804] },
-{ "🇲🇻", &EMOJI_LIST[1805] },
-{ "🇲🇼", &EMOJI_LIST[1806] },
-{ "🇲🇽", &EMOJI_LIST[1807] },
-{ "🇲🇾", &EMOJI_LIST[1808] },
-{ "🇲🇿", &EMOJI_LIST[1809] },
-{ "🇳🇦", &EMOJI_LIST[1810] },
-{ "🇳🇨", &EMOJI_LIST[1811] },
-{ "🇳🇪", &EMOJI_LIST[1812] },
-{ "🇳🇫", &EMOJI_LIST[1813] },
-{ "🇳🇬", &EMOJI_LIST[1814] },
-{ "🇳🇮", &EMOJI_LIST[1815] },
-{ "🇳🇱", &EMOJI_LIST[1816] },
-{ "🇳🇴", &EMOJI_LIST[1817] },
-{ "🇳🇵", &EMOJI_LIST[1818] },
-{ "🇳🇷", &EMOJI_LIST[1819] },
-{ "🇳🇺", &EMOJI_LIST[1820] },
-{ "🇳🇿", &EMOJI_LIST[1821] },
-{ "🇴🇲", &EMOJI_LIST[1822] },
-{ "🇵🇦", &EMOJI_LIST[1823] },
-{ "🇵🇪", &EMOJI_LIST[1824] },
-{ "🇵🇫", &EMOJI_LIST[1825] },
-{ "🇵🇬", &EMOJI_LIST[1826] },
-{ "🇵🇭", &EMOJI_LIST[1827] },
-{ "🇵🇰", &EMOJI_LIST[1828] },
-{ "🇵🇱", &EMOJI_LIST[1829] },
-{ "🇵🇲", &EMOJI_LIST[1830] },
-{ "🇵🇳", &EMOJI_LIST[1831] },
-{ "🇵🇷", &EMOJI_LIST[1832] },
-{ "🇵🇸", &EMOJI_LIST[1833] },
-{ "🇵🇹", &EMOJI_LIST[1834] },
-{ "🇵🇼", &EMOJI_LIST[1835] },
-{ "🇵🇾", &EMOJI_LIST[1836] },
-{ "🇶🇦", &EMOJI_LIST[1837] },
-{ "🇷🇪", &EMOJI_LIST[1838] },
-{ "🇷🇴", &EMOJI_LIST[1839] },
-{ "🇷🇸", &EMOJI_LIST[1840] },
-{ "🇷🇺", &EMOJI_LIST[1841] },
-{ "🇷🇼", &EMOJI_LIST[1842] },
-{ "🇸🇦", &EMOJI_LIST[1843] },
-{ "🇸🇧", &EMOJI_LIST[1844] },
-{ "🇸🇨", &EMOJI_LIST[1845] },
-{ "🇸🇩", &EMOJI_LIST[1846] },
-{ "🇸🇪", &EMOJI_LIST[1847] },
-{ "🇸🇬", &EMOJI_LIST[1848] },
-{ "🇸🇭", &EMOJI_LIST[1849] },
-{ "🇸🇮", &EMOJI_LIST[1850] },
-{ "🇸🇯", &EMOJI_LIST[1851] },
-{ "🇸🇰", &EMOJI_LIST[1852] },
-{ "🇸🇱", &EMOJI_LIST[1853] },
-{ "🇸🇲", &EMOJI_LIST[1854] },
-{ "🇸🇳", &EMOJI_LIST[1855] },
-{ "🇸🇴", &EMOJI_LIST[1856] },
-{ "🇸🇷", &EMOJI_LIST[1857] },
-{ "🇸🇸", &EMOJI_LIST[1858] },
-{ "🇸🇹", &EMOJI_LIST[1859] },
-{ "🇸🇻", &EMOJI_LIST[1860] },
-{ "🇸🇽", &EMOJI_LIST[1861] },
-{ "🇸🇾", &EMOJI_LIST[1862] },
-{ "🇸🇿", &EMOJI_LIST[1863] },
-{ "🇹🇦", &EMOJI_LIST[1864] },
-{ "🇹🇨", &EMOJI_LIST[1865] },
-{ "🇹🇩", &EMOJI_LIST[1866] },
-{ "🇹🇫", &EMOJI_LIST[1867] },
-{ "🇹🇬", &EMOJI_LIST[1868] },
-{ "🇹🇭", &EMOJI_LIST[1869] },
-{ "🇹🇯", &EMOJI_LIST[1870] },
-{ "🇹🇰", &EMOJI_LIST[1871] },
-{ "🇹🇱", &EMOJI_LIST[1872] },
-{ "🇹🇲", &EMOJI_LIST[1873] },
-{ "🇹🇳", &EMOJI_LIST[1874] },
-{ "🇹🇴", &EMOJI_LIST[1875] },
-{ "🇹🇷", &EMOJI_LIST[1876] },
-{ "🇹🇹", &EMOJI_LIST[1877] },
-{ "🇹🇻", &EMOJI_LIST[1878] },
-{ "🇹🇼", &EMOJI_LIST[1879] },
-{ "🇹🇿", &EMOJI_LIST[1880] },
-{ "🇺🇦", &EMOJI_LIST[1881] },
-{ "🇺🇬", &EMOJI_LIST[1882] },
-{ "🇺🇲", &EMOJI_LIST[1883] },
-{ "🇺🇳", &EMOJI_LIST[1884] },
-{ "🇺🇸", &EMOJI_LIST[1885] },
-{ "🇺🇾", &EMOJI_LIST[1886] },
-{ "🇺🇿", &EMOJI_LIST[1887] },
-{ "🇻🇦", &EMOJI_LIST[1888] },
-{ "🇻🇨", &EMOJI_LIST[1889] },
-{ "🇻🇪", &EMOJI_LIST[1890] },
-{ "🇻🇬", &EMOJI_LIST[1891] },
-{ "🇻🇮", &EMOJI_LIST[1892] },
-{ "🇻🇳", &EMOJI_LIST[1893] },
-{ "🇻🇺", &EMOJI_LIST[1894] },
-{ "🇼🇫", &EMOJI_LIST[1895] },
-{ "🇼🇸", &EMOJI_LIST[1896] },
-{ "🇽🇰", &EMOJI_LIST[1897] },
-{ "🇾🇪", &EMOJI_LIST[1898] },
-{ "🇾🇹", &EMOJI_LIST[1899] },
-{ "🇿🇦", &EMOJI_LIST[1900] },
-{ "🇿🇲", &EMOJI_LIST[1901] },
-{ "🇿🇼", &EMOJI_LIST[1902] },
-{ "🏴󠁧󠁢󠁥󠁮󠁧󠁿", &EMOJI_LIST[1903] },
-{ "🏴󠁧󠁢󠁳󠁣󠁴󠁿", &EMOJI_LIST[1904] },
-{ "🏴󠁧󠁢󠁷󠁬󠁳󠁿", &EMOJI_LIST[1905] }
+static constexpr std::array<std::int32_t, 1906> MPH_SEEDS = {
+0,1,0,-3,-4,0,0,-5,0,-8,0,-10,0,2,0,1,-13,-14,-16,0,-22,0,-24,1,1,2,2,1,1,0,0,-27,-29,0,-32,0,1,1,0,9,-34,0,-37,0,0,-39,-42,1,2,0,-50,1,0,2,-51,0,-53,1,1,1,2,1,0,1,-57,-58,0,1,0,-61,3,1,0,-65,3,0,-67,0,0,0,0,0,0,-69,0,0,1,0,2,0,0,0,0,0,-75,-77,1,0,2,-83,2,-86,1,0,4,-87,0,-91,0,5,0,0,-95,-97,0,2,0,0,0,0,-98,2,0,-99,-102,0,-103,0,3,-105,1,1,-107,2,-109,1,1,-110,0,-111,-112,-113,-117,0,1,-118,-120,4,0,0,-121,1,-124,-131,3,-137,2,0,-140,2,0,2,0,0,-148,-150,3,-152,-153,1,-159,-161,0,-163,-165,1,-169,-171,-173,6,-177,0,5,0,0,0,0,-180,0,0,0,-185,0,0,1,-186,1,0,0,0,0,0,-187,-201,1,0,-202,1,5,0,-203,0,3,-205,0,-206,-215,2,-216,-218,0,0,0,1,0,-219,0,0,-220,2,0,1,0,0,-221,0,1,0,1,2,0,2,1,-222,1,-226,-233,2,-234,0,-236,0,1,0,0,-242,-243,0,-245,0,0,-249,-250,-251,3,0,1,13,-252,1,0,0,5,-255,1,-257,0,1,0,1,0,1,0,1,0,-260,-261,1,-262,0,6,-270,0,0,0,1,0,0,0,-271,0,0,1,0,1,0,0,-273,0,0,-274,-275,1,0,1,0,1,-277,1,0,-281,4,0,1,0,2,0,0,0,0,0,-283,0,-285,0,0,-290,2,-291,-294,-295,0,-304,-310,-312,0,1,1,0,2,-314,-315,-316,1,0,-318,7,-320,-323,0,2,0,0,0,0,0,0,0,0,-326,1,-328,2,0,-339,1,-340,2,0,0,5,1,1,2,-341,1,0,3,-357,1,0,9,0,-363,0,1,0,0,-364,0,0,-366,-367,0,5,0,1,-368,0,0,3,0,1,-371,0,0,0,0,6,-374,1,0,2,0,-388,0,3,0,3,0,0,1,0,2,0,0,0,0,0,0,0,1,0,0,0,1,-389,-392,0,0,-393,0,-394,0,2,1,0,-399,-402,2,-404,-409,0,2,-410,-411,-412,-413,2,0,0,0,0,0,0,0,0,0,-418,-419,2,0,1,-420,-424,-427,5,0,-431,-433,1,0,0,3,0,1,0,3,4,5,0,-434,0,3,-435,0,-437,0,-438,0,0,-441,-442,0,-446,-448,0,0,1,0,1,0,0,-454,-455,0,-459,-462,1,-465,4,0,-467,0,-469,-470,5,-471,-473,-476,0,1,0,0,0,0,0,-477,0,-479,0,0,0,5,0,-483,3,1,-485,-489,0,0,-493,1,0,-497,1,-506,0,0,-507,-508,-509,2,1,0,9,0,0,0,0,0,-517,0,0,0,-518,0,3,-520,-521,-523,-524,-527,0,0,-528,6,1,-529,-534,1,1,1,0,-538,-539,1,0,-541,0,2,-544,0,-546,0,0,0,0,0,8,-548,-550,5,-556,0,2,0,1,0,0,-559,-562,1,6,-564,1,0,3,0,5,0,1,0,2,-565,2,1,0,2,-566,-569,0,0,0,-572,0,1,0,0,0,2,0,6,0,0,-573,0,0,2,7,1,0,-574,-577,2,0,-579,1,-580,-585,-587,2,-590,6,0,-591,0,0,0,4,0,0,0,-592,0,2,4,0,-595,0,0,0,-598,-601,2,3,-603,3,2,0,1,0,0,1,3,0,-605,0,2,-607,0,-615,-617,0,0,-620,-625,-626,-629,-631,8,0,-633,5,0,2,0,0,-636,1,-637,1,5,3,1,1,0,-638,-644,2,0,3,-649,-651,-653,0,2,-661,0,0,-664,7,3,-670,1,-671,0,0,1,0,-672,-675,0,-678,0,0,-684,-685,1,-686,7,2,1,-692,-694,0,-697,1,-698,7,0,1,0,1,0,0,0,-712,-713,0,0,-718,0,5,0,-720,-723,0,0,0,-724,1,-725,1,0,4,2,0,4,0,0,-727,1,-731,-739,-744,5,1,0,2,0,0,5,0,0,-745,0,-751,1,0,-752,1,0,2,0,0,-755,-760,0,-763,-769,1,0,-771,-772,0,-775,1,0,-777,0,1,-779,0,2,0,0,6,0,0,1,0,-780,0,0,0,1,-782,1,0,-785,0,-788,1,-790,-796,2,0,-797,2,-800,-804,-814,4,1,2,0,12,0,4,0,0,0,0,0,-817,1,-819,-821,-828,1,1,0,-831,6,3,-838,0,-839,-840,-842,1,0,7,1,1,13,0,0,-845,2,1,-848,0,1,-849,0,-851,0,0,-852,0,0,-855,-858,-859,7,0,-862,5,-863,-865,0,0,-873,-875,0,4,4,1,-878,4,0,-880,0,4,0,-883,-885,2,0,0,1,-890,-891,0,0,2,9,-893,0,-900,0,0,2,-901,-903,-905,0,0,0,0,-909,-910,2,-912,-915,-917,-928,0,1,0,-930,-931,0,-932,0,1,-936,0,0,0,-939,-944,0,-946,0,0,-948,2,-951,-952,-956,0,-958,0,-959,0,-965,1,-974,3,8,7,8,0,-975,-978,-981,-990,-993,-1003,3,0,0,-1005,-1006,0,2,0,0,-1009,-1011,3,1,0,5,7,0,2,0,0,9,1,-1012,-1016,-1017,1,-1024,5,0,-1029,0,11,-1030,-1032,-1033,-1034,-1037,0,7,-1044,-1045,0,-1046,6,0,0,0,-1047,0,4,1,0,5,0,0,0,0,19,-1048,1,1,0,1,7,-1055,0,-1058,0,6,-1062,0,-1064,0,5,0,-1066,0,0,0,1,0,-1068,0,0,-1074,5,0,2,-1075,-1079,0,-1082,-1083,0,2,2,0,5,-1085,2,4,-1086,-1098,-1104,-1106,0,-1107,0,1,0,0,-1109,-1110,0,-1112,0,0,0,-1117,-1118,1,-1119,-1124,1,0,-1129,0,0,3,-1131,-1139,-1144,-1145,1,0,-1148,-1152,3,0,5,0,-1154,-1155,8,3,0,-1156,0,-1157,0,0,0,0,0,0,-1159,0,0,1,0,1,0,0,0,0,-1160,-1166,1,5,-1173,7,0,-1178,0,-1180,-1181,5,9,0,6,0,3,-1184,0,0,-1187,-1190,-1193,0,1,0,12,-1202,4,2,-1203,0,-1204,-1212,0,-1213,0,3,1,0,-1215,-1225,-1227,7,-1236,-1242,1,-1253,-1255,-1256,0,5,-1258,-1259,-1260,2,0,-1262,0,0,2,-1265,-1269,3,-1277,-1278,1,0,-1279,0,15,-1282,-1288,1,1,0,1,0,-1289,0,4,-1293,1,0,1,-1295,1,-1296,0,-1297,0,-1298,2,0,-1302,-1304,0,-1305,-1306,0,0,2,10,4,0,-1309,0,-1311,0,2,-1314,1,7,6,0,-1317,0,1,0,-1318,-1322,0,2,0,9,0,0,-1323,0,0,-1325,-1326,2,0,0,-1332,3,-1333,10,0,0,-1336,0,-1344,0,-1347,1,0,1,-1348,-1349,-1353,-1356,-1357,-1358,3,0,1,0,1,0,0,0,0,-1361,0,-1363,0,-1368,1,-1370,2,-1373,-1375,0,-1379,-1384,0,0,-1388,-1392,-1396,1,0,3,-1398,3,-1403,-1414,0,2,0,-1417,0,-1422,0,0,2,0,0,0,0,-1425,-1427,0,-1429,1,0,0,9,0,3,0,0,0,0,-1433,-1436,6,1,0,1,0,3,0,2,0,-1438,0,0,10,0,5,0,0,0,0,0,-1440,13,0,0,0,0,2,-1443,15,-1447,0,-1452,0,-1458,0,2,9,0,-1459,-1463,-1465,-1466,11,-1467,-1471,2,2,-1472,0,2,0,-1473,0,0,0,0,0,-1474,-1478,-1481,0,4,19,-1483,-1486,-1495,-1496,0,0,-1500,4,1,1,-1502,1,0,6,0,12,-1507,17,-1508,-1509,-1514,2,-1517,0,-1523,0,0,0,0,0,-1525,-1527,-1530,11,0,0,3,0,1,0,0,-1533,-1534,9,6,-1539,2,-1541,1,0,-1546,0,-1549,-1553,-1554,-1558,-1562,-1563,-1566,15,0,0,-1570,0,-1576,-1577,0,-1581,0,0,0,9,-1582,-1586,0,0,4,-1591,0,-1595,5,2,0,-1599,-1600,-1604,0,2,0,-1605,-1606,2,1,0,5,0,0,-1609,0,0,-1615,0,-1617,0,-1618,0,2,0,-1619,3,0,0,0,-1627,-1630,3,1,0,-1631,1,-1633,8,0,0,-1634,14,0,-1636,-1638,2,-1640,0,-1641,0,0,0,0,-1647,-1649,-1650,-1651,-1654,0,-1656,1,0,13,0,0,0,-1657,0,-1659,-1660,3,0,1,0,10,0,4,0,-1663,-1665,2,-1670,0,10,-1671,0,0,0,0,-1673,0,1,0,0,0,13,-1676,1,0,0,-1678,0,-1679,-1681,-1682,7,0,-1684,-1687,-1689,0,3,0,0,-1692,0,1,0,10,-1694,0,0,0,0,-1696,0,0,0,-1697,0,1,-1700,-1702,-1703,0,-1707,0,-1709,25,4,2,0,1,10,0,12,0,-1713,5,1,0,-1716,0,1,-1723,-1725,-1726,0,0,-1727,0,0,-1730,0,-1735,1,0,-1738,1,-1739,-1741,0,0,-1743,4,0,-1746,5,-1749,0,-1751,0,1,0,1,-1753,-1755,-1758,2,0,0,18,0,0,0,0,0,-1762,0,-1764,0,0,0,16,0,3,0,0,0,0,-1766,-1767,-1769,10,0,-1773,3,-1776,-1781,-1789,0,1,12,-1790,-1793,0,2,-1797,-1802,0,0,0,-1803,0,0,0,-1811,-1813,11,0,-1818,-1820,0,-1824,0,6,16,-1827,1,5,2,10,-1831,2,-1837,-1838,6,5,0,-1840,-1846,13,1,0,-1848,-1854,0,-1857,-1863,0,-1865,0,0,10,0,-1872,3,0,4,0,0,6,4,-1873,32,-1875,12,0,6,0,-1881,0,1,0,9,-1884,3,0,0,13,0,-1885,0,0,0,0,-1886,-1889,0,0,0,2,-1896,19,-1897,0,-1900,0,9,-1901,-1903,2,0,8,4,15,-1904,1,0,-1906,2,0,5
 };
- const std::unordered_map<std::string_view, const EmojiData*>& StaticEmojiDatabase::mapping() { return MAPPING; }
 
-const std::array<std::string_view, 9>& StaticEmojiDatabase::groups() { return GROUPS; }
\ No newline at end of file
+static constexpr std::array<std::uint16_t, 1906> MPH_SLOTS = {
+586,1442,239,326,177,1317,636,1737,1039,1583,1872,1745,1533,516,945,482,1718,1411,1207,15,1384,258,188,965,241,1823,1806,1472,721,321,833,108,992,209,1766,1150,41,813,747,517,1266,1165,1075,320,1611,673,294,676,531,1154,1461,836,187,809,1206,1548,373,697,476,1612,1285,65,1695,680,629,1107,1522,1716,602,331,1453,1477,828,497,350,859,929,77,1444,1152,1083,56,677,115,1507,1639,790,647,1684,1605,138,1840,104,344,739,246,432,1664,199,1779,10,1635,1860,1347,1149,968,1037,1437,1147,291,1808,718,1764,341,608,358,1194,949,1874,1640,1398,1366,982,348,410,1408,1336,198,1338,245,749,736,1655,1233,861,20,1677,319,743,1169,1723,424,1768,1228,1598,1191,387,170,883,484,1070,63,1042,754,1340,1038,1179,1658,961,1122,1286,1494,700,1118,1528,1715,1597,885,941,336,1526,289,1009,1428,308,425,887,1756,1356,1590,1574,913,1081,1030,584,1556,372,224,793,514,849,107,1389,1087,228,1558,1685,1603,683,1707,927,276,815,1043,788,132,557,1040,43,1435,351,493,1072,1203,275,194,489,396,1734,1666,1859,1016,1469,1217,1290,1827,1847,1894,1828,1128,1649,908,771,716,1724,130,1219,251,465,755,1662,88,47,368,57,281,802,1893,752,144,1678,1514,299,640,1429,370,111,50,654,1242,1005,1409,55,90,1129,448,895,1417,1834,1468,572,974,1599,363,950,1645,884,236,1697,719,687,1802,1601,540,243,4,560,394,1321,1668,1618,1263,588,197,1446,216,1743,1887,1135,1320,174,25,1497,1863,1687,1615,464,1842,84,535,427,279,112,713,1018,871,1600,1804,431,471,417,1332,1373,1464,40,520,259,421,632,1443,558,1731,3,1328,777,1134,1002,1401,1176,1516,1056,1386,335,1141,1214,433,1566,23,1271,551,607,97,1369,1550,1425,1903,254,901,1365,564,252,800,1240,89,547,523,312,606,461,605,436,874,14,924,853,731,1609,479,1204,1123,688,400,462,315,1434,1341,1699,846,266,101,399,180,1861,264,594,1776,810,1344,502,1024,1174,663,232,873,1739,1399,709,1652,538,768,1623,909,470,1608,1491,1019,1270,498,1681,238,1794,869,633,1641,691,1902,1850,542,882,1239,36,1127,1431,1234,855,541,54,862,324,723,322,740,1877,1749,653,1729,454,649,361,277,463,1117,1706,1537,1420,1544,1651,1487,105,782,1379,922,742,457,422,1481,1050,643,825,269,473,1793,1252,1630,529,505,1054,1864,1742,1355,1397,226,355,970,1855,807,1097,1132,420,441,1093,1322,937,397,483,637,383,71,1905,114,1006,1770,1335,934,779,1034,971,1787,728,1064,1298,1448,1741,1279,665,724,1595,1578,940,449,219,18,1629,340,554,1553,1848,59,1274,1791,670,255,830,1614,240,920,1073,693,1801,707,1287,171,1292,942,1388,46,1900,1376,62,1727,260,182,96,1198,1644,1288,173,1325,1436,121,847,1419,1048,918,313,444,1781,9,262,1392,799,221,1853,744,1816,620,662,1250,804,1496,919,784,325,492,726,1854,1483,619,506,705,1538,1575,154,1012,1631,1221,460,129,1085,163,181,507,1091,609,405,469,1115,1581,994,307,1136,1569,1268,362,81,1326,301,1065,1295,678,661,1529,1314,346,1720,780,1349,763,1372,1226,1671,133,1185,966,131,286,1773,701,1636,356,1116,1354,390,1882,655,1254,1474,1883,494,1760,1478,446,1423,1253,943,555,1257,599,756,143,1352,921,250,1500,1000,86,1061,1788,886,300,443,230,1653,1259,388,0,953,1857,757,213,1457,68,1821,1112,932,451,826,527,247,596,625,1346,963,797,1747,598,1489,1324,776,840,1829,798,347,1305,155,1342,122,1748,1904,429,39,176,468,1178,1100,117,1573,1584,951,193,1272,528,1606,127,1637,1758,1797,593,597,61,904,1785,1886,1539,237,404,179,1121,210,1839,1313,1277,1359,898,832,1690,610,518,1092,569,1673,205,601,1231,207,1140,1309,1163,1230,1426,1077,1249,26,1057,1199,954,1880,151,914,926,984,1339,1713,694,1621,125,1280,1183,1530,1725,1261,1084,1750,730,1441,1051,1197,1068,590,499,524,359,550,1449,938,930,761,581,1113,900,530,1868,1421,302,1146,1224,762,481,1879,644,1210,1362,1343,795,734,1885,195,1782,1738,666,485,1897,689,34,995,1815,1456,1582,991,1703,227,1625,1654,204,24,888,675,1843,261,1525,834,960,837,1139,1807,21,1547,447,936,912,92,31,64,1692,843,1691,384,1375,1674,366,1714,1155,327,1262,244,495,848,268,1187,582,377,1124,186,1213,408,959,406,1235,685,748,1551,711,1527,123,1015,618,1400,838,94,1546,1521,801,80,1055,1592,1762,477,986,1657,603,1541,1751,113,1772,1501,561,1114,381,1624,928,1746,412,1391,337,785,166,674,866,1455,1380,1096,988,1095,1196,1303,1370,76,902,290,158,791,136,999,1814,1454,973,808,1704,467,1267,172,1638,206,178,1281,1736,651,1663,1660,820,272,169,704,1205,1363,1531,1799,1041,203,79,881,1694,1470,1312,957,952,1367,891,544,1195,1476,827,877,892,1837,1845,1896,1809,218,1733,720,1818,735,1131,1216,996,851,1682,1711,1763,1026,1813,270,842,248,671,1458,1378,190,774,472,1236,532,33,102,852,192,559,750,1201,1164,621,589,617,263,282,976,1871,1156,786,1452,1648,1066,369,1168,1036,165,1032,699,1415,1534,1278,1011,1508,1475,1300,980,733,876,1499,1010,1767,147,1330,1523,318,583,357,1060,563,271,1067,556,83,896,1307,1659,816,783,1835,738,789,1119,150,1306,162,1646,1735,450,1696,566,333,1616,1665,1634,328,835,1504,1561,1275,1709,1510,8,1013,1396,1826,215,1759,512,1819,116,1232,1462,380,1186,442,1710,769,878,1008,613,1822,19,1803,1299,717,511,1046,87,501,1445,229,1202,42,51,1564,1181,296,1891,1795,1447,668,1218,1167,1810,1873,78,1832,508,948,946,1717,1560,1308,910,1390,249,751,570,1656,183,1786,1052,70,1517,812,145,1393,1014,1811,1594,500,1536,1241,1007,67,1524,571,585,1771,1790,1698,1440,1180,414,285,401,1836,1311,1,1345,452,303,1593,440,430,1162,897,681,814,305,664,1208,857,1774,1276,1643,822,916,338,139,1028,1596,1256,223,792,1130,478,164,395,1754,1667,202,393,1069,1438,1022,1633,906,1589,435,1858,124,580,398,1108,1405,1062,981,627,962,353,712,1607,1145,1407,1017,548,863,634,1215,7,905,894,698,1824,1333,274,1245,455,287,772,1248,1260,439,118,1102,1632,456,1780,1237,1465,715,803,1622,1193,1482,1586,109,323,794,49,1182,288,153,1071,98,1752,1679,37,416,553,1358,1383,1120,1833,1892,1161,1846,767,1712,60,1675,1775,509,292,595,1414,1395,1518,1153,1540,1881,1486,1003,850,58,1329,488,587,522,1721,1473,1082,1732,573,867,389,379,1495,858,1686,1001,923,1020,893,845,156,1144,770,120,1570,1585,52,1588,1552,543,316,12,141,1099,1669,1520,1058,539,1862,1225,616,1211,212,1820,1890,635,267,1485,360,977,641,1027,284,1789,1189,870,1188,1094,537,1554,1884,27,1172,142,552,376,343,1480,1817,604,309,365,1680,1792,1310,1889,624,1175,466,622,413,1515,1427,703,375,1351,1851,592,13,1222,29,475,1576,1045,1413,546,1700,600,630,22,1898,1502,1004,297,1331,1302,787,480,536,378,149,371,1318,1078,1740,184,686,256,231,975,339,1825,1688,95,1291,137,1101,1722,1875,575,1412,1730,659,1777,1220,1838,242,939,211,1255,167,706,1901,549,1289,334,1805,1451,614,1490,1563,989,856,765,1327,189,533,1702,978,690,45,386,1418,73,1617,639,1505,1031,872,367,1133,1610,722,1498,1371,391,1466,253,890,1506,1301,1549,1243,1571,1784,1170,265,1866,1628,684,233,486,638,1432,1876,702,5,1542,1849,983,1106,161,28,310,1137,650,1158,1151,1831,1798,1587,1284,1334,415,392,1110,1047,1109,352,1545,1297,1104,829,48,839,100,75,729,925,1377,1511,53,1728,134,99,1555,1387,1769,875,1294,565,917,831,1620,354,280,657,157,903,1265,1708,823,1293,985,257,1761,159,574,1676,503,1315,737,1079,220,1251,1422,969,1410,1353,314,1416,407,293,1138,1650,979,1683,741,428,222,758,214,1562,437,1029,1337,1357,1509,235,692,1323,579,628,1460,841,805,2,490,1166,1647,1143,745,696,1701,907,278,1023,1493,727,306,311,298,44,868,1021,1177,1244,1591,1642,304,1580,217,967,526,1406,152,672,1757,1296,273,766,519,74,1613,453,1467,1800,1865,402,1126,860,148,947,93,1258,1579,880,648,578,1719,1103,732,1374,1670,106,656,669,818,1148,1385,1200,69,915,1212,944,110,30,1753,330,1402,1899,1159,1424,419,458,364,160,1543,1619,1471,1852,474,1264,496,935,746,760,1394,764,710,568,1025,1503,652,725,196,409,1304,185,1577,626,1190,1888,1404,225,1602,864,1223,819,403,1878,128,1111,591,990,317,1086,1869,1192,1783,38,667,1090,72,646,964,1572,1557,82,35,817,1559,773,1049,423,1063,1316,1672,660,1689,1184,283,1381,545,1567,201,1074,17,16,146,1627,1350,91,1360,1364,1382,631,1283,1098,865,1755,1227,879,1229,349,824,1726,1142,1059,487,1076,933,1361,714,119,811,1535,1459,899,1157,445,504,1080,1105,434,998,426,1033,1604,781,1282,796,1895,759,1568,135,6,775,577,972,525,567,1246,1273,1053,175,1319,1450,611,11,854,1870,1744,1209,1171,1661,332,1433,1830,615,191,1403,1626,418,753,1867,1844,295,576,958,1519,85,438,1705,997,1765,645,1693,1247,1513,1035,1532,342,956,491,1238,806,345,562,510,103,1088,1565,200,1492,208,1044,658,1796,32,1348,513,66,642,1368,329,1089,821,385,889,234,623,1479,1269,1160,1778,1430,911,1173,515,374,521,1439,695,1484,955,993,382,612,708,534,1512,1841,1812,1125,140,987,1463,679,1488,682,778,1856,459,411,931,844,126,168
+};
+
+static constexpr std::uint32_t mphHash(std::string_view str, std::uint32_t seed) {
+	std::uint32_t hash = 2166136261u ^ seed;
+	for (char c : str) { hash = (hash ^ static_cast<std::uint8_t>(c)) * 16777619u; }
+	return hash;
+}
+
+static constexpr std::uint16_t mphIndex(std::string_view emoji) {
+	std::int32_t seed = MPH_SEEDS[mphHash(emoji, 0) % MPH_SEEDS.size()];
+	if (seed < 0) return MPH_SLOTS[-seed - 1];
+	return MPH_SLOTS[mphHash(emoji, seed) % MPH_SLOTS.size()];
+}
+
+static_assert(mphIndex("😀") == 0);
+static_assert(mphIndex("🏴󠁧󠁢󠁷󠁬󠁳󠁿") == 1905);
+
+static constexpr std::array<std::string_view, 5085> TOKENS = {
+"0","00","0000","0030","1","10","100","1000","101","1030","11","1100","1130","12","1200","1230","1234","13","130","1300","1330","14","1400","1430","15","1500","1530","16","1600","1630","17","1700","1730","18","1800","1830","19","1900","1930","1st","2","20","200","2000","2030","21","2100","2130","22","2200","2230","23","230","2300","2330","2nd","3","30","300","330","3rd","4","400","430","5","500","530","55b6","6","600","630","6e80","7","700","730","7a7a","8","800","80s","830","8ball","9","900","90s","911","930","a","aa","ab","abacus","abandon","abandoned","abc","abcd","above","absentminded","absorbing","ac","academic","accept","acceptable","access","accessibility","accessible","accessories","accessory","accommodation","accomodation","accordian","accordion","accountant","accounting","achoo","acidic","acorn","acoustic guitar","acquire","acting","activities","activity","actor","ad","adaptor","add","addition","address","adhesive","admiralty","admission","adore","adult","advantage","adviser","aerial","aeroplane","aesculapius","af","affection","afghan","afghanistan","africa","african","african flag","afro","afternoon","age","agree","agreement","agriculture","ai","aid","air","airing","airplane","airport","al","aladdin","aland","alarm","albania","albanian","alcohol","alembic","alert","algeria","algerian","alien","allergy","alligator","alone","alpaca","alphabet","alternation","am","amazed","amazement","ambulance","america","american","americas","amex","amoeba","amount","amount”","ampersand","amphora","amulet","amusement","an","analyst","analytics","anatomical","anchor","ancient","and","andorra","andorran","andrew","ang","angel","anger","angola","angolan","angry","anguilla","anguillan","anguished","animal","animals","animations","annelid","announcement","annoyed","answer","answering","ant","antarctic","antarctica","antenna","anticlockwise","antigua","antilles","anxious","ao","ape","apology","appetizer","applause","apple","application","apply","appreciate","appreciation","approve","aq","aquarius","ar","arab","arabia","arabian","arabian flag","arabs","arachnid","arcade","archer","archery","architect","architectural","arctic","arepa","argentina","argentinian","ariel","aries","arm","armenia","armenian","arms","army","arrest","arrival","arrivals","arriving","arrow","arrows","art","articulated","artificial","artist","arts","aruba","aruban","as","ascension","asclepius","ashes","asia","asian","ask","asklepios","assembly","assets","assist","assistance","asterisk","astonished","astrology","astronaut","astronomy","at","atheist","athlete","athletic","athletics","atm","atom","attack","attendant","attraction","au","aubergine","aumkara","aussie","australia","australian","austria","austrian","authorization","auto","automated","automobile","autumn","available","aviation","aviator","avocado","aw","award","awareness","away","awe","awesome","awkward","axe","az","azerbaijan","azerbaijani","b","baby","back","backhand","backpack","backpacking","backslash","backward","bacon","bacteria","bactrian","bad","badge","badger","badminton","bag","bagel","baggage","bags","baguette","bag with","bahamas","bahamian","bahrain","bahrainian","bahrani","bait","bajan","baked","bakery","bakkureru","balance","bald","ball","ballerina","ballet","balloon","ballot","ballpoint","balls","bamboo","ban","banana","band","bandage","bandaged","baner","bang","bangbang","bangladesh","bangladeshi","banjo","bank","banker","banknote","banknotes","banned","banner","banzai","bar","barbadian","barbados","barbecue","barber","barbuda","barf","bargain","barrell","barrier","bars","bart","barthelemy","barthélemy","baseball","basket","basketball","basotho","bass","bat","bath","bathers","bathing","bathroom","bathtub","batman","batswana","battery","bawling","bb","bbcall","bbq","bd","be","beach","beacon","bead","beads","beamed","beaming","beans","bear","beard","bearded","bearer","beat","beating","beauty","beaver","beckon","bed","bedroom","bedtime","bee","beef","beeper","beer","beers","bees","beetle","begging","beginner","behind","belarus","belarusian","belgian","belgium","belize","belizean","bell","bellhop","belly","bengal","benin","beninese","bento","bermuda","bermudan flag","berries","berry","best","bet","betting","between","beverage","bewhiskered","bf","bg","bh","bhutan","bhutanese","bi","bicep","biceps","bicycle","bicycles","bicyclist","big","bike","biker","bikes","biking","bikini","bilberry","bill","billed","billiard","billiards","bills","bin","binder","biohazard","biologist","biology","bird","birdie","birds","birth","birthday","biscuit","bisexual","bison","bisque","bissau","biting","bj","bk","black","blade","blank","bleed","bleeper","blind","bloated","block","blogger","blond","blonde","blood","blooper","blossom","blossoming flower","blouse","blow","blowfish","blowing","blown","blue","blueberries","blueberry","blues","bluetooth","blurry","blush","blushing","bm","bn","bo","boar","board","boarding","boat","boba","body","bodybuilder","boiled","bok","bolivarian","bolivia","bolivian","bolt","bomb","bombilla","bonaire","boncuğu","bone","bones","book","bookkeeping","bookmark","books","boom","boomerang","boot","boots","booze","border","bored","boring","born","bosnia","bot","both","botswana","bottle","bottom","boulder","bouldering","bouncing","bound","bouquet","bourbon","bouvet","bow","bowie","bowing","bowl","bowling","bowtie","box","boxing","boy","boys","br","brachiosaurus","brain","branch","branches","brand","brasil","brass","brazil","brazilian","brazzaville","bread","break","breakfast","breaking","breast","breastfeeding","breath","breathe","brick","bricks","bride","bridge","brief","briefcase","briefs","bright","brightness","britain","british","bro","broadcast","broccoli","brofist","broken","brokenhearted","bromance","brontosaurus","bronze","broom","brown","brows","brunch","brunei","bruneian","brush","bs","bt","bts","bubble","bubbles","bubbly","buck","bucket","buddhism","buddhist","buffalo","bug","bugle","build","builder","building","buildings","bulb","bulgaria","bulgarian","bull","bullet","bullettrain","bullhorn","bullock","bullseye","bumblebee","bump","bunny","buoy","bureau","burger","burkina","burkinabe","burma","burmese","burn","burp","burrito","burundi","burundian","bury","bus","business","businessman","businesswoman","business”","busstop","bust","busts","but","butchers","butt","butter","butterfly","button","buy","bvi","bw","by","bz","c","ca","cabbage","cabinet","cable","cableway","cabo","cactus","cafe","caffeine","caicos","cake","calculate","calculation","caledonia","caledonian","calendar","call","calling","calm","cambodia","cambodian","camcorder","camel","camera","cameroon","cameroonian","campervan","camping","campsite","can","canada","canadian","canary","cancel","cancellation","cancer","candelabrum","candle","candles","candlestick","candy","cane","canned","canoe","cantaloupe","cap","cape","capital","capped","capricorn","capsicum","capsule","caption","captivated","car","caramel","carbonation","card","cardboard","cardinal","cardiology","cards","care","career","caribbean","carnival","carousel","carp","carpenter","carpentry","carriage","carrot","cars","cart","cartwheel","cartwheeling","carving","car’s","cash","casino","cask","casket","casserole","cassette","castle","casual","cat","cat2","catch","caterpillar","cats","cause","caution","cayman","caymanian","cd","celebrate","celebration","cell","cellular","cemetery","center","central","century","ceo","cereal","ceremony","ceuta","ch","chad","chadder","chadian","chagos","chain","chains","chair","chamorro","champagne","championship","change","changing","chanukiah","chapel","characters","charge","charger","charge”","charm","chart","chat","chatting","che","check","checkbox","checkered","checkin","cheeky","cheering","cheers","cheese","cheeseburger","chef","chemist","chemistry","chequered","cherries","cherry","cherub","chess","chest","chestnut","chevron","chick","chicken","chickpea","child","childish","children","chile","chilean","chili","chill","chilli","chimarrão","chime","chin","china","chinese","chip","chipmunk","chips","chirp","chocolate","chocolates","chop","chopsticks","choy","christ","christian","christianity","christmas","church","ci","cigarette","cimarrón","cinema","circle","circled","circus","citric","citrus","city","cityscape","cjk","cl","claim","clairvoyant","clamp","clap","clapboard","clapper","clapping","classical","classroom","classy","claus","claw","claws","clay","clean","cleaning","clear","clef","clenched","clerk","click","climb","climber","climbing","clink","clinking","clipboard","clipperton","clippy","clock","clock1","clock10","clock1030","clock11","clock1130","clock12","clock1230","clock130","clock2","clock230","clock3","clock330","clock4","clock430","clock5","clock530","clock6","clock630","clock7","clock730","clock8","clock830","clock9","clock930","clockwise","closed","closet","cloth","clothes","clothing","cloud","clouds","cloudy","clover","clown","club","clubs","cluck","clue","clumsy","clutch","cm","cn","co","coast","coaster","coat","cob","cobweb","cock","cockerel","cockroach","cocktail","cocoanut","coconut","cocos","coder","coffee","coffin","cog","cogwheel","coin","coins","colada","colbert","cold","collapsed umbrella","college","collision","colombia","colombian","colors","comb","come","comedy","comet","comic","comment","communication","comoran","comoros","compact","compass","competition","compose","composition","compress","compression","computer","computing","concern","concerned face","concert","concertina","concierge","condiment","cone","confetti","confirm","confounded","confuse","confused","conga","congee","congo","congrats","congratulate","congratulation","congratulations","connection","consider","console","constellation","constraint","construction","contactless","container","content","contest","continue","contributors","control","controller","convenience","cook","cooked","cookie","cooking","cool","cop","copyright","coral","cork","corn","corner","cornwall","coronavirus","correct","cos","cosmetics","cosmonaut","costa","costume","cote","couch","count","countdown","counterclockwise","counting","country","couple","couplekiss","court","cover","covering","covid","cow","cow2","cowboy","cowgirl","cozy","cq","crab","cracker","crafts","crane","crap","crayon","crazy","cream","create","creativity","creature","credentials","credit","creepy","creme","crescent","cricket","crime","criminal","croak","croatia","croatian","croc","crochet","crocodile","croissant","crook","crop","crops","cross","crossbones","crossed","crossing","crow","crown","cruise","crush","crustacean","crutch","cry","crying","crystal","crêpe","crêpes","cu","cuba","cuban","cube","cucumber","cue","culinary","culture","cunha","cup","cupcake","cupertino","cupid","cupped","curacao","curaçao","curaçaoan","curious","curl","curled","curling","curly","curly page","currency","curry","cursing","curtain","curve","curved","curving","cussing","custard","custom","customs","cut","cute","cuteness","cutlery","cutting","cy","cycle","cyclist","cyclone","cygnet","cymru","cypriot","cyprus","cz","czech","czechia","côte","d","da","dad","dagger","dairy","daisy","dam","dance","dancer","dancing","danger","dango","danish","dark","dart","darts","darussalam","dash","dashing","data","database","date","dating","daughter","daughters","david","dawn","day","dazed","ddraig","de","dead","deadline","deadly","deadpan","deaf","deal","death","december","deciduous","deck","decline","decorated","decoration","decorative","decrease","decreasing","deeply","deer","degree","dejected","delete","deli","delicious","delivery","demand","democratic","demon","demonstration","denied","denim","denmark","dental","dentist","deny","department","departure","departures","deploy","depressed","depression","derby","derelict","desert","design","desk","desktop","despise","dessert","destination","detective","deutsch","developer","devil","dharma","dhikr","diagonal","dial","dialog","diamond","diamonds","diaper","dice","die","diego","diesel","dig","digit","digital","dim","diners","ding","dinghy","dining","dinner","dinosaur","diplodocus","direct","direction","director","directory","dirt","disability","disabled","disallow","disappear","disappointed","disapproval","disapprove","disaster","disbelief","disc","disco","discount","discouraged","disease","disguise","disguised","disgust","disgusted","dish","disk","dislike","dismiss","display","dissatisfied","dissolve","distilling","distraught","distress","distrust","dito","divide","dividers","diving","division","divoire","diy","diya","dizzy","dj","djembe","djibouti","djiboutian","djinn","djinni","dk","dm","dna","do","doctor","document","documentation","documents","dodo","dog","dog2","doge","dogeza","doggo","doily","doing","doll","dollar","dolls","dolphin","dom","domed","domestic","dominica","dominican","donation","done","doner","donkey","donut","door","doorway","dork","dormouse","dot","dotted","double","doubt","doubts","doughnut","dove","down","downcast","downgrade","downtown","downwards","down arrow","down pointing","dracula","dragon","drained","drama","draw","drawing","drc","dread","dream","dress","dressing","drink","drinking","drinks","drip","driving","drizzle","dromedary","drool","drooling","drooping","drop","droplet","droplets","dropped","drops","drug","drugs","drum","drumstick","drumsticks","drunk","drunk face","dua","dubious","duck","duckling","dumpling","dumplings","dung","dupe","dusk","dutch","dvd","dynamite","dz","d’ivoire","e","eagle","ear","earbud","early","earphone","earphones","ears","earth","earthquake","earthworm","east","easter","eat","ec","eclipse","economics","ecuador","ecuadorian","edge","education","educator","ee","eek","eeyore","eg","egg","eggplant","eggs","egypt","egyptian","eiffel","eight","eighteen","eighth","eject","el","elder","elderly","election","electric","electrician","electricity","electric bus","electronic","elementary","elephant","elevator","eleven","eleven®","elf","email","embarrass","embarrassed","embarrassing","emblem","embroidery","emergency","emergency light","emirates","emirati","emoji","emotion","empanada","empty","end","energy","enforcement","engaged","engagement","engine","engineer","england","english","enraged","ensnare","enter","enterprise","entertainer","entertainment","enthusiastic","entrance","entry","envelope","environment","equality","equals","equatoguinean","equatorial","equestrian","er","eritrea","eritrean","error","eruption","es","espresso","estonia","estonian","eswatini","et","ethiopia","ethiopian","eu","euro","europe","european","eustatius","evening","event","evergreen","evict","evidence","evil","evolution","ewe","exam","exasperation","exchange","excited","exclamation","exercise","exhalation","exhale","exhaling","exhausted","exist","exit","expendable","expenses","expensive","experience","experiment","expletive","explode","exploding","exploration","explosion","explosive","express","expressionless","extended","external","extinct","extinction","extinguish","extinguisher","extraterrestrial","eye","eyeballs","eyebrow","eyed","eyeglasses","eyeroll","eyes","eyesight","eyewear","f1","face","faced","facepalm","facepalming","facepunch","facial","facing","facsimile","factory","fail","failure","fairground","fairness","fairy","faithful","falafel","falfel","falkland","falklander","falklands","fall","fallen","falling","family","fan","fancy","fantasy","farewell","farm","farmer","farming","faroe","fart","fashion","faso","fast","father","fathers","fatima","faucet","favor","favorite","fax","fear","fearful","feather","feats","feature","fed","federated","federation","feeding","feet","feline","female","fencer","fencing","ferris","ferry","festival","festivus","fever","feverish","fi","field","fighter","fighting","fiji","fijian","file","filing","filling","film","films","find","fine","finger","fingerprint","fingers","finish","finishline","finland","finnish","fins","fir","fire","firecracker","firefighter","fireman","firetruck","firework","fireworks","first","fish","fishcake","fisherman","fishing","fist","fistbump","fisted","five","fix","fj","flag","flags","flamboyant","flame","flamenco","flamingo","flan","flapjacks","flash","flashing","flashlight","flat","flatbread","flattered","flavoring","fleur","flex","flexed","flexing","flick","flight","flip","flipped","flipper","flipping","flirt","flirting","float","floor","floppy","flops","flour","flower","flowers","flowing","fluctuate","flushed","flute","flutter","fluttering","fly","flying","fog","foggy","fog bridge","folded","folder","folding","fondue","food","foot","football","footprint","footprints","footsteps","footwear","for","forbid","forbidden","force","forever","forgetful","fork","form","formal","formula","fortress","fortune","forward","foul","fountain","four","fox","fr","frame","framed","frames","france","frankfurter","free","freezing","french","fresh","freshwater","fried","friend","friends","friendship","fries","frightening","frisbee","frog","from","front","front of","frostbite","frosty","frown","frowning","frozen","fruit","frustrated","frying","ftw","fu","fuel","fuelpump","fugu","fuji","full","fullness","fun","funeral","fungus","funicular","funny","furin","furniture","futuna","future","ga","gabon","gabonese","gadgets","galaxy","galloping","gambia","gambian flag","gamble","gambling","game","gamepad","garbage","garcia","garden","gardener","garlic","gas","gasp","gasping","gate","gay","gb","gd","ge","gear","gecko","geek","gem","gemini","gemstone","gender","gene","genetics","genie","gentleman","geometric","george","georgia","georgian","germ","german","germany","germs","gesture","gesturing","gesundheit","get","getting","gg","gh","ghana","ghanaian","gherkin","ghost","ghoul","gi","gibbous","gibraltar","gibraltarian","gift","ginger","gingerbread","giraffe","girl","girls","give","gl","glad","glass","glasses","glide","glitter","glittery","global","globe","gloss","glossy","glove","gloves","glow","glowing","glyphs","gm","gn","go","goal","goat","goblin","goch","goggles","goguma","gokart","gold","golden","golf","golfer","golfing","gondola","good","goodbye","goofy","goose","gooseberry","goosebumps","gorilla","gourd","gown","gp","gps","gr","grade","grade”","graduate","graduation","grain","grandma","grandpa","grandstand","granny","grape","grapes","graph","grasp","grass","grasshopper","grateful","gratitude","grave","graveyard","grawlix","gray","great","greece","greek","green","greenery","greenland","greenlandic","greens","green face","grenada","grenadian","grenadines","grey","grid","gridiron","grievance","grievances","grimace","grimacing","grin","grinning","groan","groceries","groggy","groom","gross","ground","group","grow","growing","growth","grumpy","gt","gu","gua","guadeloupe","guadeloupean","guam","guamanian","guanaco","guard","guardsman","guardswoman","guatemala","guatemalan","guernsey","guiana","guide","guinea","guinean","guitar","gun","gust","guy","guyana","guyanese","gw","gy","gym","gymnast","gymnastic","gymnastics","gyoza","gyro","gyōza","h","haha","hair","haircut","hairdresser","haired","hairless","hairstyle","haiti","haitian","hallelujah","halloween","halo","halt","hamam","hamburger","hammer","hamsa","hamster","hanabi","hanafuda","hand","handbag","handball","handgun","handle","hands","handset","handshake","handy","handyman","hang","hankey","hanukkah","happiness","happy","happytears","hard","harm","harp","harvest","hash","hashi","hashtag","hat","hatched","hatchet","hatching","hate","haunted","have","haze","head","headdress","heading","headline","headphone","headphones","headscarf","headstone","heal","healing","health","healthcare","healthcheck","healthier","healthy","hear","heard","hearing","heart","heartbeat","heartbreak","heartpulse","hearts","heat","heaven","heavy","hedgehog","heel","heeled","heels","helena","helicopter","helix","hello","helm","helmet","help","helpless","hen","herb","herd","here","hero","heroine","herzegovina","heterosexual","hexagram","hi","hibiscus","hidden","hide","high","highfive","highway","hijab","hike","hiking","hinamatsuri","hindu","hinduism","hippie","hippo","hippopotamus","hipster","hiss","history","hit","hitting","hmmm","hn","hobby","hocho","hockey","hog","hoist","hold","holding","hole","hollow","hollywood","home","homosexual","honduran","honduras","honey","honeybee","honeydew","honeypot","hong","honk","hook","hoop","hooray","hoot","hop","hope","hopeful","horizontal","horizontally","horizontal arrows","horn","horns","horrible","horror","horse","horseshoe","hospital","hot","hotcake","hotcakes","hotdog","hotel","hotsprings","hour","hourglass","hours","house","housecat","houseplant","houses","hover","hovering","hr","ht","hu","hug","hugging","hugs","huh","human","hump","hundred","hungarian","hungary","hungry","hurricane","hurt","hush","hushed","hut","hwatu","hyacinth","hygiene","hyperlink","hypnotized","hóngbāo","i","i18n","ice","iceberg","icecream","iceland","icelandic","icicles","icon","id","idaho","idea","identification","identity","ideograph","ie","ignorance","ignore","ikea","il","ill","ily","imac","immortal","imp","impact","impaired","imperial","impractical","impressed","improve","improvement","improving","in","inbox","inclusive","incognito","incoming","increase","increasing","indecisive","index","india","indian","indicator","indifference","indifferent","indiffernt","indonesia","indonesian","industrial","industry","inexpressive","infant","infatuation","infinity","info","information","infrastructure","inhalation","injured","injury","ink","inline","innocent","input","insect","insert","inside","inspection","instructment","instructor","instrument","intelligent","intercardinal","interlocking","international","internationalization","internet","interrobang","interrogation","interstate","interweb","intoxicated","introvert","invader","investigate","invisible","ip","iphone","ipod","iq","iran","iranian flag","iraq","iraqi","ireland","irish","irish flag","iron","ironic","is","islam","islamic","island","islander","islander flag","islands","islas","isle","isolation","israel","israeli","iss","issue","italian","italy","its","ivoire","ivory","iwazaru","izakaya","ja","jabsco","jack","jacket","jaguar","jainism","jamaica","jamaican flag","jan","jandals","japan","japanese","jar","jaws","jazz","je","jeans","jellyfish","jemima","jeotgarak","jersey","jew","jewel","jewelry","jewish","jiaozi","jigsaw","jinni","jm","jo","job","jockey","joey","jog","jogging","join","joint","joke","joker","jolly","jordan","jordanian","joy","joystick","jp","judaism","judge","judo","jug","juggle","juggler","juggling","juice","july","jump","justice","kaaba","kadomatsu","kale","kamaboko","kami","kangaroo","kanji","karaoke","karate","karl","katakana","kawaii","kazakh","kazakhstan","kazakhstani","ke","kebab","keeling","keep","kenya","kenyan","kettle","key","keyboard","keycap","kg","kh","khanda","ki","kick","kid","kidney","kids","kikazaru","kills","kimono","king","kingdom","kinshasa","kiribati","kiss","kissing","kissy","kitchen","kite","kitten","kitts","kitty","kiwi","kiwifruit","km","knee","kneel","kneeling","knife","knit","knobs","knocked","knot","knowledge","koala","kod","koinobori","koko","kong","korea","korean","kosovar","kosovo","kr","kuaizi","kuwait","kuwaiti","kw","kwik","kyoto","kyrgyzstan","kyrgyzstani","kz","lab","label","labor","laboratory","lacking","lacrosse","ladder","ladies","lady","ladybird","ladybug","lai","lamb","lambchop","lamp","landing","lands","landscape","lanka","lankan","lantern","lao","laos","laotian","laptop","large","last","late","lather","latin","latte","latvia","latvian","laugh","laughing","launch","laundry","lavash","lavatory","lavender","law","lawn","lazy","lb","lead","leader","leaf","leafless","leafy","league","learn","leaves","lebanese","lebanon","ledger","left","leftovers","leftward","leftwards","left arrow","leg","legal","legolas","legume","lemon","lemonade","length","leo","leone","leonean","leopard","lesbian","lesotho","less","leste","leste flag","letter","letters","lettuce","level","levitate","levitating","lgbt","lgbtq","li","liar","liberia","liberian","liberty","libra","library","libya","libyan","license","lick","licking","lie","liechtenstein","liechtensteiner","life","lift","lifter","lifting","light","lighting","lightning","like","limb","limbs","lime","limit","line","lines","link","linked","lion","lip","lips","lipstick","liquid","liquor","lis","listen","listening","lit","literals","literature","lithuania","lithuanian","litter","litterbox","littering","little","lizard","llama","load","loaf","lobster","localization","location","lock","locked","locker","lock with","locomotive","log","logo","lol","lollipop","lolly","lollypop","londoneye","lonely","long","loo","look","loop","lord","lorry","loser","losing","lost","lotion","lotus","loud","loudly","loudspeaker","lounge","love","lovestruck","loving","loving cat","low","lower","lowercase","lowered","lr","ls","lt","lu","lucia","luck","lucky","luge","luggage","lumber","lunch","lungs","lust","luxembourg","luxembourger","lv","ly","lying","m","ma","maarten","mac","macanese flag","macao","macau","macedonia","macedonian","machine","mad","madagascan","madagascar","mag","mage","magen","maggot","magic","magical","magnet","magnetic","magnifier","magnify","magnifying","mahjong","maiden","mail","mailbox","maintainer","maize","makeup","malaria","malawi","malawian flag","malaysia","malaysian","maldives","maldivian","male","mali","malian","mall","mallard","malt","malta","maltese","malvinas","mammoth","man","manager","mandarin","manga","mango","manicure","manilla","mans","mansplaining","mantelpiece","mantilla","manual","manx","man’s","mao","map","maple","maracas","marathon","mariana","marino","mark","marker","market","marriage","mars","marshall","marshallese","marsupial","mart","martial","martin","martini","martiniquais flag","martinique","marvel","mary","masa","mask","masks","massage","massaging","mastercard","matcha","mate","math","mathematician","matryoshka","maté","mauritania","mauritanian","mauritian","mauritius","mayen","mayotte","maze","mc","mcdonald","mcdonalds","mcdonald’s","md","me","meal","mean","meaning","meat","meatball","mecca","mechanic","mechanical","medal","medallion","medical","medicine","medio","meditate","meditation","mediterranean","medium","meeting","mega","megafrown","megaphone","meh","melilla","melon","melt","melted","melting","memo","memorandum","men","mending","menorah","mens","menstruation","men’s","meow","merboy","mercy","merge","mergirl","meridians","mermaid","merman","merperson","merry","merwoman","message","metal","meteoroid","metrics","metro","mexican","mexico","mg","mic","mice","michi","microbe","micronesia","micronesian","microorganism","microphone","microscope","mid","midday","middle","middle finger","midnight","mild","milestone","military","milk","milkshake","milky","minaret","mind","mindfulness","miniature","minibus","minidisc","minidisk","mining","minivan","minor","minus","miquelon","miracle","miriam","mirror","mischievous","mizaru","ml","mm","mn","moai","mobile","mobility","mock","mode","moisturizer","mojito","moldova","moldovan","molester","molusc","mom","momi","monaco","monarch","money","moneybag","moneybags","mongolia","mongolian","monitor","monkey","monochrome","monocle","monorail","monster","montenegrin","montenegro","month","monthly","montserrat","montserratian","monégasque","moo","moon","mooncake","moonface","moose","more","morning","moroccan","morocco","mortar","mosque","mosquito","mother","mothers","motor","motorbike","motorboat","motorcycle","motorhome","motorized","motorway","mount","mountain","mountains","mouse","mouse2","mousetrap","moustache","mouth","mouthless","move","mover","movie","movies","moving","moyai","mozambican","mozambique","mq","mr","mrs","mrt","ms","mt","mu","mug","mugs","mule","multiple","multiplication","multiply","multitask","munch","muscle","muscles","museum","mushroom","music","musical","musician","muskmelon","muslim","mustache","mute","muted","mutual","mv","mw","mx","my","myanmar","myanmarese flag","mystical","myth","mythtical","mz","na","naan","nail","nam","namaste","name","namibia","namibian","nanna","nap","narutomaki","nasa","nation","national","nations","nature","nauru","nauruan","nausea","nauseated","nauseous","navigation","nazar","nba","nct","ne","neck","necklace","necktie","needle","needs","negation","negative","negative chart","nemo","nepal","nepalese","nerd","nerdy","nervous","nest","nesting","net","netherlands","neutral","nevis","new","newborn","news","newspaper","newyork","next","nfl","ng","ni","nib","nicaragua","nicaraguan","nicholas","niger","nigeria","nigerian","nigerien flag","night","nike","nine","ninja","ninjutsu","niue","niuean","nl","no","noble","nod","noise","noisy","nom","non","nonchalant","nonconforming","nonplussed","noodle","noodles","noon","nope","norfolk","north","northeast","northern","northwest","norway","norwegian","nose","not","note","notebook","notepad","notes","nothing","notification","notifications","novel","no speaking","np","nr","nsfw","nu","nuclear","null","number","numbers","numeric","nurse","nursery","nursing","nurturing","nut","nuts","o","o2","oatmeal","oberon","objects","observation","obsolete","obtain","ocean","oclock","octagonal","octopus","octothorpe","oden","of","off","offer","office","officer","of cards","of martinique","ogre","oh","ohyeah","oil","oink","ok","okay","olaf","old","older","oldschool","olive","olives","om","oman","omani","omg","omkara","omusubi","on","once","oncoming","one","oni","onigiri","onion","onsen","oops","open","opening","operating","ophiuchus","optical","or","orange","orangutan","orbit","orchestra","order","oreo","organ","organizing","orienteering","orleans","ornament","orthodox","orthoptera","ostentatious","otter","out","outbox","outdoors","outer","outerspace","outgoing","outlined","outlying","over","overcast","overheated","overlay","owl","own","ox","oxen","oyster","o’clock","p","pa","package","packet","packing","pad","paddle","paddles","padlock","paella","page","pageant","pager","pail","pain","pained","paint","paintbrush","painter","painting","pair","pakistan","pakistani","palau","palauan","palestine","palestinian","palette","palm","palms","pan","panama","panamanian","pancake","pancakes","panda","pants","pao","paper","paperclip","paperclips","papua","parachute","paraguay","paraguayan","parasail","parasite","parasol","parcel","parchment","parent","parents","park","parking","parlor","parrot","part","partly","party","partying","pass","passenger","passing","passionate","passport","password","pasta","pastry","patrol","pattern","paul","pause","paw","pawn","payment","pc","pe","pea","peace","peach","peacock","peahen","peanut","peanuts","pear","pearl","pedestrian","pedestrians","peek","peeking","peep","peerson","pen","pencil","pencil2","penguin","pensive","people","pepper","pepperoni","percent","percussion","perfect","perform","performance","performer","performing","period","permanent","permissions","persevere","persevering","person","personal","peru","peruvian","pest","pester","pests","pet","petri","petrol","petroleum","ph","phallic","pharmacy","phew","philippines","phoenix","phone","phones","photo","photography","physician","physicist","physics","pi","piano","picard","pick","pickaxe","picket","pickle","pickup","picnic","picture","pie","piece","pied","pierogi","pierre","pig","pig2","pile","pill","pilot","pin","pinata","pinched","pinching","pine","pineapple","ping","pinged","pingpong","pink","pinocchio","pins","piper","pirate","pisces","pistol","pita","pitcairn","pitchfork","pizza","piña","piñata","pk","pl","placard","place","places","plane","planet","planets","planning","plant","plantain","plaster","plate","platform","play","player","playful","playground","playing","playstation","plaything","pleading","please","pleased","plewds","plug","plumage","plumber","plunder","plunger","plus","plush","png","pod","podcast","point","pointe","pointed","pointing","points","poison","poisoned","poker","poland","polar","pole","police","policeman","policewoman","polish","pollution","polo","polygon","polynesia","polynesian","pong","poo","poodle","pool","poop","pop","popcorn","popper","popping","pork","porkchop","porous","porridge","portugal","portugese","position","positive chart","post","postal","postbox","pot","potable","potato","potsticker","potted","potty","pouch","poultry","pound","pouring","pout","pouting","power","powerboat","praise","pranava","prank","prawn","pray","prayer","prc","pregnancy","pregnant","pregnant lady","present","presentation","preserve","preserver","press","pressed","pressing","pretend","pretent","pretty","pretzel","previous","price","pride","primary","prime","prince","princess","principe","print","printed","printer","prints","privacy","private","prize","probing","problem","profanity","professional","professor","program","programmer","progress","prohibit","prohibited","projector","proof","prophecy","propose","prosper","prosthetic","protect","protection","protest","proud","príncipe","ps4","psychic","pt","pub","public","puck","pudding","puerto","puff","pufferfish","puke","pulsating","pulse","pump","pumpkin","pumps","punch","punctuation","punk","pupil","puppy","purchase","pure","purity","purple","purse","push","pushing","pushpin","put","putto","puzzle","puzzled","pw","py","python","qa","qatar","qatari","quarter","quartet","quavers","queen","queer","quench","question","quid","quiet","quivering","quiz","quotes","r","rabbit","rabbit2","raccoon","race","racehorse","racing","racket","racquet","radiation","radical","radio","radioactive","radish","rage","rail","railcar","railroad","railway","rain","rainbow","raining","rainy","raised","raising","ram","ramen","rancher","random","rashers","rat","rate","ray","rays","razor","read","reborn","rebound","receipt","receive","receiver","reception","recession","record","recorder","recording","recovering","recovery","recreational","recruit","recuperating","recycle","recycling","red","redhead","redhot","reduce","red devil","reef","reflection","reflector","refresh","regal","regardless","regional","registered","regular","reindeer","relax","relaxed","relief","relieve","relieved","religion","religious","reload","reminder","remove","rep","repair","repeat","repercussion","reply","reptile","republic","request","rescue","research","reserved","resist","resort","resources","respect","respectful","respectiful","respiration","responsive","rest","restaurant","restricted","restriction","restroom","retro","return","retweet","reunion","reuse","reverse","reversed","revert","revolver","revolving","rewind","rex","rhino","rhinoceros","rhythm","ribbon","rica","rican","rice","rich","rickshaw","rico","right","rightward","rightwards","right arrow","right curved","right fist","right triangle","ring","ringed","ringer","rings","rip","rise","ro","roach","road","roadwork","roar","roasted","robot","rock","rocker","rocket","rockstar","rod","rodent","rofl","roger","roles","roll","rolled","roller","rollercoaster","rolling","rolodex","rom","romaine","romance","romania","romanian","roo","roof","room","rooster","root","rope","ropeway","rosary","rose","rosette","rotary","rotate","rotating","rotfl","rotting","round","rounded","roundhouse","rowboat","rowing","royal","royalty","rs","ru","rubbish","ruby","rucksack","rude","rugby","ruler","rules","rum","run","rung","runner","running","rushed","russia","russian","rv","rw","rwanda","rwandan","réunion","réunionnais","s","sa","saba","sacred","sad","sadface","sad cat","safari","safety","sagittarius","sahara","saharah","saharan","sailboat","sailing","saint","saints","sake","sakura","salad","sale","sales","salon","salsa","salt","saltire","salute","saluting","salvador","salvadoran","sammarinese","samoa","samoan","samoan flag","san","sand","sandal","sandals","sandwich","sane","sanfrancisco","santa","sao","sar","sarcasm","sarcastic","saree","sari","sark","sash","sasha","sashimi","sassy","satchel","satellite","satisfied","saturn","saturnine","sauce","saucer","saudi","sauna","sauropod","sausage","save","saver","savoring","savouring","saw","sax","saxophone","say","sc","scale","scales","scared","scarf","scary","scene","scenery","scepticism","schedule","schmear","school","science","scientist","scissors","scooter","score","scorpio","scorpion","scorpius","scotch","scotland","scottish","scout","scouts","scream","screaming","screen","screw","screwdriver","scribble","scroll","scrunched","scuba","sd","se","sea","seafood","seal","sealed","search","seashell","season","seat","second","secret","secure","security","see","seed","seedling","seeing","selfie","selling","semaphore","semi","senbei","senegal","sengalese","senior","senko","sensu","sent","seo","serbia","serbian flag","serenity","serious","serpent","serve","service","set","settee","seven","sewing","sexual","sexy","seychelles","seychellois flag","sg","shade","shadow","shadows","shadow moon","shaka","shake","shaker","shaking","shallow","shame","shampoo","shamrock","shape","shaped","shari","shark","sharp","shave","shaved","shawarma","sheaf","shedding","sheep","sheet","shell","shellfish","shh","shhh","shield","shifty","shine","shining","shinkansen","shinto","shiny","ship","shipit","shipping","shirt","shit","shitface","shock","shocked","shoe","shoes","shoo","shoot","shooting","shop","shopping","shops","shortcake","shorts","shoshinsha","shot","shout","shouting","shovel","show","shower","showing","shrek","shrimp","shrine","shroom","shrug","shruggie","shrugging","shuffle","shush","shushing","shuttle","shuttlecock","shy","si","sick","side","sideways","sierra","sigh","sight","sign","signal","sikh","sikhism","silence","silent","silhouette","silhouettes","silk","silly","silver","silverware","simp","sing","singapore","singaporean","singer","singing","single","singlet","sint","sinterklaas","sir","siren","sit","six","size","sk","skate","skateboard","skating","skeleton","skeptic","skeptical","sketch","skewer","ski","skier","skiing","skill","skillet","skills","skip","skirt","skis","skittles","skull","skullcap","skunk","sky","skydive","skyline","slash","slate","slay","sled","sledge","sleep","sleeping","sleepy","sleigh","sleuth","slice","slide","slider","slightly","slip","slipper","slot","sloth","slovakia","slovakian","slovak flag","slovenia","slovenian","slow","slug","sly","small","smallest","smart","smartphone","smartphones","smell","smelling","smelly","smh","smile","smiley","smileys","smiling","smirk","smirking","smith","smog","smoke","smoking","smoothie","smug","sn","snack","snail","snake","snap","snapchat","snapshots","snapstreak","snare","sneaker","sneakers","sneeze","sneezing","sniff","sniffing","snooker","snoring","snorkeling","snot","snout","snow","snowboard","snowboarder","snowboarding","snowflake","snowflakes","snowing","snowman","so","soap","soapdish","soar","sob","sobbing","soccer","socks","soda","sofa","soft","softball","software","solar","soldier","solid","solomon","solong","somalia","somalian flag","son","song","sons","soon","sorcerer","sorceress","sorrowful","sorry","sos","sound","soup","source","south","southeast","southern","southwest","sow","spa","space","spaceflight","spade","spades","spaghetti","spain","spanish","spanner","spark","sparkle","sparkler","sparkles","sparkling","sparkly","speak","speaker","speaking","spear","speculum","speech","speechless","speed","speedboat","spent","spew","spice","spicy","spider","spiderweb","spill","spin","spiny","spiral","spiral eyes","splashing","splatter","splayed","split","spock","spoked","sponge","spooky","spool","spoon","sport","sports","spots","spouting","spring","springs","sprout","sprouting","spy","square","squared","squeeze","squid","squiggle","squinting","squirrel","squirt","sr","sri","sshh","st","stack","stadium","staff","staffmode","stag","stage","stairs","stalk","stamp","stand","standard","standing","star","star2","starch","stare","stargazing","starry","stars","stars heart","start","states","station","stationery","stats","statue","steak","stealth","steam","steambath","steamed","steaming","steamroom","steamy","steer","stein","step","steps","sterling","stethoscope","stew","stick","stiletto","still","sting","stink","stinky","stitches","stocking","stockings","stomp","stone","stop","stopwatch","store","straight","straw","strawberry","streamer","strength","string","stringed","strip","stripe","striped","stripes","stroke","strong","struck","structure","struggling","stub","stuck","student","studio","study","stuffed","stuffy","stunned","style","subscription","subtract","subway","success","sucker","suction","sudan","sudanese","sudanese flag","suggestive","suit","suitcase","suits","suitup","summer","sun","sunface","sunflower","sunglass","sunglasses","sunny","sunrise","sunscreen","sunset","sunshine","superbowl","superhero","supernature","superpower","superpowers","superstition","supervillain","suppedaneum","support","surf","surfer","surfing","surgery","surgical","surimi","suriname","surinamer","surprise","surprised","surrender","sushi","suspension","suspicious","sustain","sutures","svalbard","sven","swan","swaziland","swearing","sweat","sweating","sweden","swedish","sweep","sweeping","sweet","swim","swimmer","swimming","swimsuit","swirl","swiss","switch","switzerland","sword","swords","symbol","symbols","symbol input","sympathy","symphony","synagog","synagogue","sync","syria","syrian","syringe","system","sz","são","t","table","tablet","tabletop","tableware","tabs","tack","taco","tada","taekwondo","tag","tailoring","taiwan","taiwanese","tajik","tajikistan","take","takeout","taking","tale","talisman","talk","talkshow","tamal","tamale","tanabata","tangerine","tangled","tanzaku","tanzania","tanzanian","tao","taoist","tap","tape","tapioca","target","taste","taurus","taxi","taxicab","td","tea","teach","teacher","teacup","team","teapot","tear","tears","technician","technologist","technology","teddy","tee","teenager","teeth","telephone","telescope","television","teller","temperature","temple","tempura","ten","tengu","tennis","tent","tentacles","terrapin","terrified","territories","territory","terrorism","test","tests","text","textbook","tg","th","thai","thailand","thank","thanks","thanksgiving","the","theater","theatre","theatre masks","theme","then","therapist","thermometer","think","thinker","thinking","third","thirst","thirsty","thirty","this","thong","thongs","thought","thread","three","throw","throwing","thumb","thumbs","thumbsdown","thumbsup","thunder","thunderbolt","tiara","tichel","tick","ticket","tickets","tidy","tie","tiger","tiger2","tightly","tiki","tile","tilted","timber","time","timepiece","timer","timor","timorese","tin","tinned","tiny","tipping","tipsy","tire","tired","titania","titanic","tj","tk","tm","tn","to","toad","toadstool","toast","tobacco","tobago","toboggan","toddler","tofu","together","togo","togolese","toilet","tokelau","tokelauan","tokyo","tomato","tomatoes","tombstone","tome","tomé","tone","tonga","tongan flag","tongue","tool","toolbox","tools","tooth","toothbrush","top","tophat","torch","tornado","tortoise","toss","totally","touched","tour","tourist","towels","tower","toy","tr","track","trackball","tracking","trackpad","tracks","tractor","trade","trademark","tradesperson","traffic","tragedy","train","train2","trainer","training","tram","tramway","trans","transgender","transitions","transparent","transport","transportation","trap","trash","travel","tray","treasure","treble","tree","trefoil","trek","trend","trex","triangle","triangular","trident","trinidad","triple","tristan","triton","triumph","troll","trolley","trolleybus","troops","trophy","tropical","trouble","trousers","truck","trumpet","trunk","tshirt","tsukimi","tsunami","tube","tuber","tuk","tulip","tumbler","tunisia","tunisian","turban","turd","turkey","turkish flag","turkmen","turkmenistan","turks","turn","turrets","turtle","tusk","tusks","tuvalu","tuvaluan","tuxedo","tv","tw","tweet","twelve","twenty","twilight","twine","twins","twist","twisted","twister","twitter","two","type","typhoon","typos","tyrannosaurus","türkiye","u","u5272","u5408","u55b6","u6307","u6708","u6709","u6e80","u7121","u7533","u7981","u7a7a","ua","uae","uber","ufo","ug","uganda","ugandan flag","ugh","ugly","uk","ukraine","ukrainian","ultimate","um","umbrella","un","unamused","unbounded","unbroken","uncomfortable","unconscious","undead","unded","under","underage","underarm","underground","underwater","underwear","undo","uneven","unexpressive","unhappy","unicorn","unified","uniform","unimpressed","union","united","universal","universe","university","unlock","unlocked","unlucky","unrealistic","unspecified","unsure","unwell","up","update","upgrade","upon","upper","uppercase","upset","upside","upward","upwards","urban","url","urn","uruguay","uruguayan","us","usa","usability","useless","user","users","utility","uy","uz","uzbek","uzbekistan","uzbekistani","v","vacancy","vacancy”","vacation","vaccination","vaccine","valentine","valentines","vampire","vanticanien","vanuatu","vanuatu flag","vaping","vase","vat","vatican","vcr","ve","vegas","vegatable","vegetable","vegetables","vehicle","veil","vein","venezuela","venezuelan","venison","venue","venus","verde","verdian","versus","vertical","vertically","vespa","vest","vhs","vibration","vice","victory","vicuña","video","videocassette","viet","vietnam","vietnamese","view","viewer","viewing","villain","vincent","violence","violin","virgin","virgo","virus","visa","visually","voicemail","volcano","volleyball","voltage","volume","vomit","vomiting","vortex","vote","voting","vs","vu","vulcan","vuoi","wacky","waffle","wagon","wailing","wait","wake","wales","walk","walker","walking","wall","wallet","wallis","walt","wand","waning","warm","warning","warrior","warthog","washroom","wastebasket","wastepaper","wat","watch","water","watermelon","wave","waves","waving","wavy","wax","waxing","way","wc","wealthy","weapon","wear","wearing","weary","weather","web","wedding","wedge","weed","weep","weight","weightlifter","weights","weird","welder","welding","well","welsh","west","western","whale","whale2","what","wheat","wheel","wheelchair","when","whew","whine","whippy","whirlpool","whirlwind","whiskey","whisky","whisper","whistle","whistling","white","whoa","whoops","wicked","wide","wiener","wifi","wii","wild","wildcard","wilted","win","wind","window","wine","wing","wings","wink","winking","winky","winner","winners","winning","winter","winzip","wip","wireless","wise","wisent","wish","wishes","witch","with","withershins","without","witness","wizard","wolf","woman","womans","woman’s","women","womens","womens toilet","women’s","won","woo","wood","woof","woohoo","wool","woolly","woozy","word","words","work","worker","worker’s","working","workout","world","world’s","worm","worried","worry","worship","wound","wounded","wow","wrap","wrapped","wrench","wrestle","wrestler","wrestlers","wrestling","wrist","wristwatch","write","writing","wry","ws","www","x","xbox","xd","xk","xmas","xmas tree","xox","y","yacht","yam","yang","yarn","yawn","yawning","yay","ye","yea","year","years","yellow","yemen","yemeni flag","yen","yerba","yes","yin","yo","yoga","york","you","young","yoyo","yt","yum","yummy","yurt","yuèbǐng","zag","zambia","zambian","zany","zap","zealand","zebra","zen","zero","zig","zim","zimbabwe","zimbabwean flag","zip","zipper","zm","zodiac","zombie","zoom","zoomin","zw","zzz","zōri","Åland","“acceptable”","“application”","“bargain”","“congratulations”","“discount”","“free","“full","“here”","“monthly","“no","“not","“open","“passing","“prohibited”","“reserved”","“secret”","“service","“service”","“vacancy”","✉ letter","✒ fountain","🚓 cop"
+};
+
+static constexpr std::array<std::uint32_t, 5086> TOKEN_OFFSETS = {
+0,1,14,15,16,22,25,27,28,29,30,32,33,34,36,37,38,39,41,42,43,44,46,47,48,50,51,52,54,55,56,58,59,60,63,64,65,67,68,69,70,74,76,77,78,79,81,82,83,85,86,87,89,90,91,92,93,98,110,111,112,113,117,118,119,122,123,124,125,128,129,130,131,134,135,136,137,141,142,144,145,146,149,150,155,161,162,165,166,167,168,169,170,171,173,181,182,183,184,185,187,188,189,218,219,226,227,229,230,231,232,235,236,237,238,239,240,241,242,327,374,377,378,379,381,382,383,384,385,387,388,410,411,414,415,420,421,422,447,448,449,451,453,454,455,456,457,463,465,466,467,471,476,477,485,488,489,490,491,494,495,496,504,505,507,508,509,512,513,514,515,516,528,529,531,532,533,535,538,543,544,545,546,548,549,550,551,553,556,557,560,561,562,564,565,578,579,580,581,582,585,588,589,590,597,598,599,600,726,885,886,887,889,890,892,893,894,896,897,899,900,901,902,904,905,906,909,910,911,915,916,917,918,919,920,921,923,924,927,928,929,930,932,935,936,938,940,945,946,947,948,949,950,951,953,956,957,958,960,962,965,966,967,968,1008,1015,1023,1024,1025,1031,1033,1034,1035,1036,1038,1039,1040,1043,1047,1048,1049,1052,1053,1054,1055,1057,1058,1071,1074,1075,1079,1080,1082,1083,1084,1085,1086,1087,1088,1089,1090,1091,1092,1093,1097,1098,1099,1100,1101,1102,1103,1105,1108,1109,1112,1115,1116,1118,1124,1125,1126,1127,1131,1132,1133,1134,1135,1136,1137,1152,1157,1162,1163,1164,1165,1167,1168,1170,1171,1179,1181,1182,1183,1188,1189,1191,1194,1195,1196,1197,1198,1199,1200,1201,1202,1203,1204,1210,1211,1217,1221,1249,1250,1252,1256,1258,1260,1267,1270,1271,1273,1274,1277,1279,1280,1282,1283,1284,1285,1286,1296,1299,1304,1308,1309,1561,1562,1579,1580,1581,1583,1587,1588,1590,1592,1593,1594,1595,1596,1597,1598,1600,1602,1606,1607,1608,1611,1615,1616,1621,1628,1630,1631,1632,1634,1635,1636,1637,1638,1639,1640,1659,1660,1661,1662,1663,1664,1665,1669,1672,1675,1678,1679,1680,1684,1685,1686,1688,1689,1690,1691,1695,1696,1698,1699,1700,1702,1703,1704,1708,1709,1710,1711,1712,1713,1714,1719,1721,1723,1724,1725,1726,1727,1728,1729,1730,1732,1733,1734,1735,1736,1749,1752,1753,1754,1755,1756,1757,1758,1759,1760,1768,1769,1775,1779,1788,1791,1792,1798,1799,1800,1806,1807,1808,1809,1811,1814,1815,1816,1821,1822,1845,1846,1847,1850,1856,1857,1858,1859,1860,1861,1862,1863,1864,1906,1907,1909,1910,1911,1922,1924,1925,1927,1931,1935,1942,1943,1946,1947,1948,1952,1953,1956,1958,2050,2051,2052,2053,2054,2055,2058,2060,2061,2062,2063,2064,2067,2068,2078,2079,2467,2468,2469,2470,2471,2472,2473,2475,2477,2478,2479,2480,2483,2484,2493,2494,2496,2497,2500,2501,2504,2505,2512,2515,2517,2519,2520,2521,2522,2523,2524,2531,2537,2538,2541,2544,2545,2546,2547,2549,2556,2557,2560,2566,2567,2568,2581,2582,2620,2621,2622,2623,2625,2627,2628,2630,2631,2632,2633,2634,2635,2642,2645,2656,2657,2658,2659,2660,2661,2662,2663,2667,2669,2670,2671,2672,2677,2680,2681,2689,2690,2693,2694,2695,2699,2700,2701,2702,2703,2704,2711,2712,2715,2716,2717,2720,2721,2722,2723,2731,2732,2733,2735,2736,2739,2740,2742,2747,2748,2755,2756,2780,2783,2784,2785,2786,2789,2790,2792,2794,2795,2796,2797,2802,2807,2808,2809,2810,2811,2812,2813,2814,2816,2817,2818,2819,2820,2821,2827,2845,2846,2847,2848,2849,2851,2852,2853,2854,2855,2856,2858,2924,2925,2926,2927,2928,2929,2930,2932,2934,2935,2938,2939,2940,2941,2942,2943,2944,2949,2950,2955,2956,2957,2960,2963,2964,2965,2966,2967,2968,2970,2976,2977,2978,2979,2983,2984,2986,2989,2991,2992,2994,2996,2998,2999,3000,3002,3003,3007,3015,3016,3017,3018,3021,3022,3028,3030,3032,3033,3034,3035,3036,3052,3053,3054,3067,3068,3072,3073,3079,3082,3083,3084,3089,3090,3091,3092,3093,3095,3096,3104,3105,3108,3111,3112,3113,3115,3116,3117,3118,3119,3120,3122,3123,3137,3138,3141,3143,3153,3154,3155,3156,3157,3159,3160,3188,3195,3196,3198,3199,3200,3201,3203,3204,3206,3208,3209,3210,3211,3212,3213,3216,3217,3219,3220,3222,3223,3224,3225,3226,3227,3228,3231,3232,3235,3236,3240,3241,3243,3244,3247,3248,3249,3250,3252,3253,3255,3262,3263,3266,3271,3275,3276,3277,3280,3281,3282,3283,3284,3285,3288,3295,3296,3335,3337,3359,3360,3361,3362,3363,3364,3365,3367,3368,3372,3395,3396,3397,3398,3399,3404,3405,3409,3411,3412,3413,3416,3417,3427,3430,3431,3433,3434,3438,3471,3477,3487,3488,3489,3496,3498,3509,3510,3511,3512,3513,3514,3515,3516,3517,3518,3519,3521,3524,3525,3526,3527,3532,3536,3537,3538,3540,3543,3544,3545,3548,3551,3553,3555,3556,3558,3559,3590,3591,3592,3593,3594,3595,3596,3597,3598,3599,3600,3601,3602,3603,3604,3605,3606,3607,3608,3609,3610,3611,3612,3613,3614,3617,3630,3631,3633,3638,3677,3691,3692,3694,3696,3697,3700,3701,3702,3704,3705,3706,3707,3708,3709,3710,3711,3713,3714,3715,3716,3717,3718,3720,3721,3723,3724,3727,3729,3730,3731,3732,3734,3735,3736,3737,3752,3753,3754,3755,3756,3757,3758,3759,3760,3761,3762,3776,3777,3813,3814,3815,3816,3817,3818,3822,3823,3824,3825,3839,3840,3841,3842,3845,3846,3847,3849,3850,3851,3852,3853,3854,3862,3863,3864,3866,3867,3868,3869,3872,3873,3874,3875,3876,3877,3886,3887,3892,3893,3895,3897,3898,3900,3901,3902,3910,3911,3913,3923,3929,3933,3934,3935,3936,3938,3939,3940,3942,3943,3944,3946,3948,3949,3950,3951,3952,3953,3954,3955,3956,4204,4219,4223,4226,4227,4233,4236,4242,4243,4244,4246,4247,4248,4250,4251,4253,4254,4255,4256,4258,4262,4265,4268,4275,4276,4277,4282,4283,4288,4290,4291,4294,4295,4296,4297,4298,4299,4300,4301,4302,4304,4305,4318,4320,4327,4329,4330,4334,4336,4339,4340,4341,4348,4352,4354,4355,4356,4357,4358,4359,4360,4361,4362,4363,4365,4367,4372,4373,4374,4376,4377,4378,4379,4380,4381,4384,4385,4388,4393,4394,4402,4404,4405,4406,4407,4409,4413,4414,4415,4416,4417,4424,4427,4428,4432,4434,4435,4438,4445,4447,4448,4449,4450,4451,4452,4453,4454,4455,4459,4460,4462,4463,4465,4466,4467,4471,4476,4481,4490,4491,4492,4497,4498,4499,4500,4502,4503,4504,4505,4512,4520,4530,4535,4536,4538,4540,4541,4542,4544,4553,4554,4555,4557,4561,4563,4568,4569,4570,4571,4572,4573,4579,4581,4582,4583,4586,4587,4589,4590,4591,4592,4595,4597,4598,4600,4602,4603,4608,4609,4610,4611,4615,4616,4618,4619,4620,4622,4629,4630,4631,4632,4637,4640,4644,4646,4647,4663,4664,4669,4670,4673,4677,4678,4679,4684,4688,4690,4699,4700,4701,4702,4705,4707,4709,4711,4721,4723,4724,4725,4726,4727,4728,4729,4731,4732,4733,4760,4761,4762,4763,4776,4778,4779,4782,4787,4788,4790,4792,4797,4800,4803,4804,4806,4809,4810,4811,4812,4813,4815,4819,4820,4821,4822,4823,4824,4825,4827,4828,4829,4830,4832,4833,4835,4836,4837,4839,4840,4846,4847,4848,4849,4850,4853,4854,4855,4856,4857,4858,4871,4876,4877,4888,4889,4897,4898,4899,4900,4901,4902,4905,4907,4916,4918,4919,4920,4921,4923,4924,4925,4926,4929,4930,4931,4932,4935,4936,4938,4939,4942,4944,4955,4959,4960,4961,4962,4977,4978,4979,4980,4987,4988,4989,4992,4996,4997,4999,5003,5006,5007,5008,5011,5016,5017,5151,5153,5154,5156,5158,5159,5160,5161,5162,5163,5167,5168,5169,5170,5172,5173,5175,5178,5180,5181,5188,5189,5190,5191,5193,5194,5195,5196,5197,5198,5201,5203,5205,5206,5207,5208,5210,5211,5219,5220,5244,5245,5246,5254,5258,5259,5260,5265,5268,5269,5270,5271,5274,5275,5276,5277,5286,5289,5290,5291,5292,5293,5296,5297,5298,5299,5300,5301,5307,5308,5309,5310,5311,5317,5319,5322,5329,5332,5335,5336,5337,5338,5340,5341,5343,5344,5347,5362,5363,5365,5367,5368,5369,5373,5374,5375,5376,5378,5547,5548,5552,5553,5555,5559,5560,5561,5563,5569,5572,5574,5575,5576,5577,5578,5581,5636,5637,5638,5641,5648,5652,5653,5654,5655,5656,5657,5658,5659,5660,5663,5664,5665,5666,5667,5668,5669,5671,5672,5673,5674,5675,5676,5679,5680,5695,5696,5697,5698,5699,5713,5714,5715,5718,5721,5723,5727,5735,5753,5754,5755,5756,5758,5759,5760,5761,5762,5763,5764,5768,5769,5772,5773,5774,5779,5780,5781,5782,5783,5784,5788,5790,5791,5792,5795,5823,5824,5826,5827,5828,5829,5858,5859,5862,5863,6067,6068,6071,6074,6075,6077,6100,6101,6105,6107,6108,6110,6111,6131,6133,6135,6136,6137,6138,6139,6144,6145,6148,6178,6179,6180,6221,6222,6226,6229,6235,6236,6237,6258,6259,6271,6289,6294,6295,6298,6300,6302,6303,6307,6309,6310,6311,6312,6314,6315,6316,6321,6325,6326,6448,6449,6450,6451,6454,6463,6464,6466,6467,6468,6470,6471,6472,6473,6474,6478,6479,6480,6486,6487,6489,6490,6505,6506,6525,6526,6527,6528,6529,6531,6532,6541,6542,6545,6547,6550,6551,6555,6558,6568,6569,6570,6573,6577,6579,6580,6586,6589,6590,6866,7137,7138,7139,7140,7141,7142,7143,7144,7145,7146,7148,7150,7151,7153,7154,7155,7156,7157,7158,7164,7166,7167,7168,7169,7172,7174,7175,7176,7177,7179,7180,7194,7199,7200,7201,7203,7204,7205,7206,7220,7224,7227,7228,7229,7230,7232,7233,7234,7378,7379,7382,7383,7385,7386,7388,7399,7402,7419,7420,7421,7422,7424,7425,7429,7430,7431,7434,7439,7440,7444,7448,7449,7450,7454,7455,7456,7458,7459,7462,7463,7471,7474,7475,7477,7479,7480,7483,7484,7485,7486,7487,7488,7494,7495,7496,7497,7503,7509,7512,7538,7544,7545,7546,7547,7548,7549,7550,7551,7557,7558,7564,7566,7568,7569,7571,7572,7573,7574,7575,7576,7577,7578,7582,7583,7584,7585,7586,7588,7591,7617,7618,7621,7623,7625,7628,7629,7631,7634,7635,7636,7646,7649,7650,7651,7652,7653,7655,7662,7663,7664,7677,7678,7679,7682,7683,7717,7718,7720,7721,7722,7723,7725,7726,7754,7760,7761,7762,7768,7769,7770,7771,7772,7773,7774,7775,7776,7778,7779,7780,7784,7787,7788,7789,7827,7829,7830,7831,7832,7841,7847,7848,7850,7851,7852,7856,7857,7858,7860,7861,7862,7863,7864,7865,7867,7869,7871,7873,7875,7876,7877,7878,7879,7885,7887,7893,7896,7899,7901,7919,7921,7923,7924,7925,7926,7927,7928,7930,7931,7932,7933,7934,7935,7939,7942,7943,7944,7945,7946,7947,7948,7949,7954,7955,7959,7960,7961,7962,7963,7965,7966,7969,7971,7972,7974,7998,7999,8000,8001,8002,8003,8004,8005,8006,8010,8011,8012,8013,8014,8015,8016,8021,8031,8032,8033,8034,8038,8039,8040,8042,8043,8044,8046,8049,8050,8051,8052,8053,8054,8055,8056,8057,8060,8063,8064,8065,8066,8067,8068,8069,8073,8077,8078,8079,8081,8086,8087,8088,8089,8090,8093,8094,8095,8098,8099,8100,8101,8102,8109,8130,8134,8136,8148,8151,8159,8160,8161,8162,8170,8172,8175,8178,8179,8182,8183,8184,8185,8186,8248,8249,8252,8253,8254,8270,8271,8272,8273,8274,8275,8276,8277,8279,8301,8302,8305,8306,8307,8308,8309,8310,8311,8321,8322,8323,8324,8325,8326,8327,8328,8344,8345,8347,8349,8350,8351,8352,8353,8354,8355,8365,8368,8369,8370,8371,8374,8376,8378,8423,8425,8426,8427,8431,8433,8435,8449,8450,8451,8454,8455,8456,8457,8458,8460,8461,8466,8470,8471,8472,8473,8474,8477,8481,8484,8485,8486,8487,8488,8489,8490,8491,8503,8507,8508,8509,8512,8513,8514,8516,8521,8522,8523,8524,8527,8528,8531,8533,8534,8536,8537,8543,8544,8546,8547,8548,8552,8557,8559,8560,8561,8589,8590,8591,8592,8595,8596,8597,8598,8599,8600,8603,8604,8606,8607,8608,8609,8610,8612,8613,8614,8618,8622,8623,8625,8629,8630,8636,8656,8657,8658,8659,8666,8667,8668,8670,8671,8678,8679,8680,8681,8682,8683,8684,8685,8686,8689,8691,8692,8694,8781,8783,8784,8785,8786,8787,8788,8791,8794,8795,8796,8797,8798,8799,8800,8801,8802,8806,8807,8815,8816,8817,8818,8819,8820,8832,8834,8835,8836,8838,8839,8854,8855,8858,8860,8861,8862,8867,8868,8869,8870,8872,8873,8876,8877,8878,8879,8880,8881,8882,8915,8924,8927,8928,8930,8933,8935,8936,8946,8948,8953,8962,8968,8972,8973,8974,8975,8979,8980,8981,8985,8991,8992,8995,9000,9001,9002,9003,9005,9007,9008,9009,9018,9030,9031,9032,9033,9034,9037,9048,9049,9054,9055,9060,9061,9064,9065,9066,9067,9068,9069,9070,9071,9072,9073,9074,9077,9078,9079,9080,9081,9082,9083,9086,9088,9089,9090,9091,9092,9095,9096,9119,9123,9124,9142,9143,9144,9145,9146,9147,9148,9149,9151,9153,9154,9155,9156,9157,9158,9159,9160,9162,9163,9164,9166,9167,9168,9170,9171,9177,9222,9224,9225,9228,9229,9230,9232,9233,9234,9235,9237,9243,9245,9250,9251,9252,9253,9254,9255,9256,9257,9258,9261,9262,9263,9264,9265,9266,9267,9268,9269,9278,9279,9280,9282,9285,9286,9287,9290,9293,9296,9298,9299,9301,9306,9307,9308,9309,9310,9311,9312,9327,9328,9329,9330,9332,9334,9335,9336,9337,9338,9340,9341,9342,9343,9344,9345,9350,9352,9365,9366,9367,9368,9369,9372,9374,9375,9376,9377,9378,9380,9383,9384,9385,9386,9397,9408,9411,9417,9418,9420,9421,9422,9424,9425,9426,9427,9430,9436,9440,9441,9442,9443,9444,9449,9450,9451,9452,9453,9454,9456,9458,9459,9460,9461,9462,9463,9464,9465,9466,9467,9468,9469,9470,9476,9478,9482,9483,9484,9485,9486,9487,9492,9493,9494,9495,9496,9497,9499,9501,9502,9503,9504,9505,9507,9508,9509,9510,9514,9537,9540,9564,9565,9574,9575,9576,9577,9582,9586,9587,9588,9589,9593,9594,9607,9611,9612,9613,9614,9615,9621,9622,9623,9624,9630,9632,9633,9634,9635,9658,9659,9660,9669,9672,9675,9685,9686,9687,9688,9689,9690,9692,9693,9694,9695,9704,9705,9706,9707,9708,9722,9734,9736,9738,9739,9740,9760,9762,9763,9764,9765,9766,9768,9770,9776,9777,9778,9781,9782,9783,9784,9785,9786,9789,9791,9794,9797,9810,9811,9814,9848,9849,9850,9851,9855,9857,9858,9860,9862,9865,9867,9872,9874,9877,9878,9879,9880,9881,9882,9883,9885,9886,9887,9890,9891,9892,9893,9895,9896,9897,9898,9899,9900,9903,9910,9914,9915,9916,9917,9918,9920,9923,9924,9925,9926,9927,9928,9931,9933,9937,9941,9942,9943,9944,9946,9947,9948,9952,9954,9955,9956,9957,9999,10000,10001,10002,10006,10013,10015,10017,10018,10019,10020,10021,10022,10031,10033,10034,10036,10038,10041,10042,10043,10044,10045,10046,10047,10048,10050,10052,10053,10054,10055,10056,10057,10058,10059,10063,10069,10070,10071,10073,10076,10077,10078,10095,10100,10101,10103,10105,10106,10108,10109,10111,10123,10128,10130,10131,10132,10133,10134,10135,10136,10137,10138,10139,10254,10255,10256,10258,10259,10260,10261,10262,10263,10264,10389,10392,10393,10394,10395,10396,10397,10398,10399,10400,10401,10408,10409,10410,10411,10414,10415,10416,10420,10421,10422,10446,10447,10448,10461,10462,10463,10464,10466,10467,10468,10470,10471,10472,10473,10475,10476,10477,10482,10483,10489,10490,10491,10492,10493,10501,10504,10505,10506,10507,10508,10509,10511,10513,10514,10515,10516,10519,10520,10521,10524,10526,10527,10528,10545,10553,10554,10555,10559,10561,10566,10567,10571,10581,10582,10583,10587,10589,10597,10598,10599,10600,10602,10607,10609,10610,10611,10612,10613,10615,10616,10723,10724,10725,10726,10727,10728,10730,10731,10732,10733,10734,10735,10738,10740,10741,10742,10744,10746,10748,10749,10752,10754,10758,10760,10761,10763,10764,10765,10766,10767,10769,10770,10772,10773,10774,10775,10781,10782,10783,10784,10786,10789,10798,10799,10800,10801,10802,10804,10805,10806,10807,10808,10809,10810,10811,10812,10813,10814,10815,10817,10821,10822,10823,10824,10825,10826,10832,10838,10839,10840,10841,10846,10847,10848,10849,10850,10851,10852,10853,10854,10873,10874,10875,10876,10877,10878,10885,10886,10887,10888,10898,10899,10900,10901,10902,10903,10904,10905,10907,10926,10927,10928,10929,10930,10936,10937,10938,10940,10942,10943,10962,10967,10969,10970,10972,10973,10974,10981,10982,10983,10994,10995,11000,11001,11002,11005,11028,11029,11035,11036,11042,11043,11044,11045,11046,11047,11048,11050,11051,11052,11053,11054,11055,11058,11059,11060,11062,11064,11066,11069,11071,11072,11073,11075,11077,11105,11109,11112,11113,11117,11119,11125,11127,11128,11129,11130,11132,11133,11134,11135,11137,11139,11140,11141,11142,11143,11144,11145,11146,11147,11148,11149,11150,11151,11152,11154,11402,11403,11404,11606,11607,11608,11609,11610,11611,11612,11613,11614,11615,11616,11617,11618,11619,11622,11623,11624,11630,11631,11632,11633,11634,11635,11637,11645,11647,11650,11651,11653,11661,11662,11672,11673,11675,11677,11678,11680,11681,11684,11686,11688,11689,11690,11691,11692,11693,11694,11695,11719,11720,11724,11725,11726,11727,11728,11729,11759,11760,11761,11762,11763,11764,11765,11766,11767,11768,11770,11771,11772,11774,11775,11781,11782,11784,11786,11788,11789,11798,11816,11827,11831,11832,11837,11838,11839,11840,11841,11842,11843,11844,11845,11846,11847,11848,11851,11864,11865,11869,11870,11874,11875,11878,11879,11895,11896,11897,11899,12163,12164,12165,12166,12181,12193,12194,12195,12196,12197,12218,12223,12226,12235,12238,12239,12240,12241,12242,12243,12245,12247,12261,12263,12264,12273,12276,12282,12283,12284,12286,12287,12288,12290,12291,12292,12300,12301,12306,12320,12321,12322,12323,12324,12328,12352,12354,12355,12357,12360,12363,12384,12385,12386,12387,12388,12389,12392,12394,12395,12396,12400,12401,12402,12403,12404,12410,12411,12413,12415,12417,12418,12422,12424,12429,12430,12431,12432,12433,12434,12440,12441,12443,12455,12456,12459,12460,12461,12462,12464,12466,12467,12469,12470,12472,12473,12474,12476,12477,12478,12482,12483,12486,12490,12501,12502,12503,12504,12505,12506,12507,12511,12523,12524,12526,12527,12528,12529,12530,12532,12534,12535,12550,12552,12553,12554,12555,12556,12557,12558,12559,12560,12561,12562,12574,12591,12596,12597,12600,12601,12603,12604,12618,12622,12625,12629,12630,12631,12633,12636,12637,12642,12643,12644,12645,12647,12648,12649,12654,12655,12656,12657,12660,12661,12662,12663,12664,12665,12666,12668,12673,12674,12675,12676,12677,12678,12683,12685,12686,12687,12688,13076,13078,13079,13080,13081,13083,13084,13085,13086,13087,13088,13089,13090,13091,13092,13166,13167,13168,13169,13172,13173,13174,13184,13185,13186,13187,13188,13189,13190,13193,13194,13195,13206,13207,13238,13241,13244,13247,13248,13249,13250,13251,13254,13255,13256,13257,13258,13260,13261,13262,13266,13267,13268,13269,13274,13275,13277,13278,13281,13285,13286,13287,13288,13290,13291,13292,13293,13294,13307,13308,13309,13310,13314,13316,13317,13319,13320,13321,13322,13323,13324,13325,13326,13327,13335,13553,13560,13576,13580,13582,13631,13632,13633,13634,13635,13649,13652,13657,13659,13667,13668,13669,13670,13671,13674,13675,13676,13677,13681,13682,13683,13684,13685,13686,13687,13689,13700,13701,13708,13737,13738,13740,13741,13747,13748,13749,13752,13758,13760,13762,13764,13765,13769,13770,13771,13772,13773,13774,13775,13779,13780,13782,13783,13784,13786,13787,13788,13789,13790,13791,13792,13795,13796,13801,13804,13809,13813,13815,13818,13819,13820,13821,13822,13823,13825,13826,13827,13832,13837,13838,13840,13841,13845,13847,13854,13858,13859,13860,13863,13864,13865,13870,13871,13872,13874,13875,13877,13878,13879,13880,13881,13883,13884,13905,13906,13910,13911,13912,13913,13915,13916,13917,13918,13924,13926,13927,13931,13932,13933,13936,13939,13941,13943,13945,13946,13963,13964,13965,13966,13967,13968,13970,13971,13976,13977,13982,13983,13984,13985,13986,13989,13993,13996,13997,13998,13999,14000,14001,14002,14004,14006,14007,14008,14011,14019,14020,14023,14026,14027,14028,14029,14053,14056,14057,14059,14061,14062,14063,14064,14065,14066,14067,14068,14069,14070,14071,14075,14076,14077,14079,14080,14081,14085,14086,14092,14093,14096,14097,14098,14100,14101,14102,14110,14112,14119,14120,14122,14123,14124,14127,14128,14129,14130,14131,14132,14133,14143,14151,14153,14154,14155,14167,14171,14173,14175,14178,14180,14181,14182,14183,14184,14185,14187,14193,14194,14195,14196,14199,14200,14201,14202,14213,14214,14215,14216,14217,14218,14219,14220,14221,14222,14275,14277,14278,14279,14280,14281,14282,14283,14285,14286,14287,14296,14297,14298,14299,14304,14306,14308,14309,14312,14331,14333,14334,14335,14339,14340,14343,14346,14347,14348,14350,14361,14362,14364,14366,14367,14368,14369,14370,14374,14377,14378,14379,14380,14383,14384,14386,14387,14393,14394,14397,14398,14399,14400,14402,14403,14404,14405,14407,14408,14409,14410,14411,14412,14415,14416,14418,14426,14429,14430,14431,14467,14468,14480,14482,14483,14484,14485,14488,14489,14491,14492,14495,14497,14498,14499,14500,14501,14503,14504,14505,14518,14521,14525,14528,14530,14536,14537,14538,14539,14543,14544,14546,14547,14549,14550,14552,14553,14568,14569,14570,14571,14572,14578,14579,14581,14582,14583,14584,14586,14587,14588,14590,14591,14592,14593,14605,14606,14607,14610,14613,14618,14621,14622,14623,14624,14625,14626,14628,14629,14631,14632,14633,14634,14635,14639,14648,14649,14651,14653,14654,14655,14656,14657,14658,14659,14675,14676,14677,14678,14697,14700,14701,14703,14708,14710,14711,14712,14713,14714,14715,14723,14724,14725,14726,14727,14731,14743,14747,14748,14749,14750,14752,14753,14754,14755,14756,14758,14759,14760,14762,14765,14767,14769,14772,14773,14774,14777,14778,14780,14784,14785,14786,14787,14788,14789,14790,14791,14794,14795,14797,14798,14799,14800,14801,14802,14803,14806,14807,14808,14811,14812,14813,14814,14815,14816,14817,14818,14819,14821,14826,14831,14832,14836,14839,14840,14841,14868,14869,14882,14887,14891,14892,14894,14899,14901,14903,14905,14906,14908,14909,14911,14912,14914,14916,14919,14921,14922,14924,14925,14927,14928,14930,14931,14949,14953,14954,14955,14957,14958,14961,14963,14964,14971,14972,14979,14983,14984,14985,14986,14987,14988,14989,14990,14991,14992,14993,14996,14997,14998,15000,15001,15002,15003,15006,15008,15010,15011,15017,15018,15019,15022,15024,15025,15026,15027,15028,15029,15030,15031,15032,15033,15034,15035,15037,15041,15042,15043,15044,15045,15070,15072,15073,15074,15075,15076,15077,15078,15079,15080,15082,15083,15085,15086,15088,15089,15091,15092,15094,15095,15097,15098,15099,15111,15112,15113,15117,15118,15119,15122,15126,15133,15138,15140,15142,15143,15145,15156,15157,15158,15159,15160,15162,15163,15164,15165,15166,15170,15173,15175,15177,15178,15179,15182,15183,15186,15187,15188,15189,15190,15191,15194,15195,15206,15212,15213,15214,15215,15216,15304,15310,15311,15314,15322,15326,15330,15331,15332,15336,15339,15340,15341,15344,15345,15346,15349,15351,15353,15354,15356,15357,15358,15359,15361,15365,15367,15368,15371,15372,15373,15376,15378,15380,15382,15384,15389,15390,15391,15394,15396,15397,15399,15400,15401,15402,15405,15406,15407,15415,15416,15417,15418,15419,15420,15421,15422,15440,15443,15449,15450,15453,15455,15456,15457,15459,15460,15461,15462,15463,15464,15465,15466,15467,15468,15471,15472,15473,15492,15493,15494,15495,15496,15498,15499,15500,15501,15529,15537,15706,15731,15733,15735,15736,15737,15741,15743,15744,15746,15747,15755,15756,15760,15761,15763,15764,15765,15767,15768,15769,15770,15771,15772,15773,15774,15775,15776,15777,15778,15788,15789,15790,15791,15792,15793,15795,15797,15798,15800,15801,15802,15803,15804,15805,15807,15808,15809,15813,15815,15818,15819,15820,15821,15822,15823,15824,15825,15835,15836,15841,15842,15844,15846,15847,15851,15852,15863,15866,15867,15874,15875,15876,15877,15878,15884,15913,15914,15915,15916,15917,15918,15919,15921,15922,15929,15930,15931,15934,15935,15937,15942,15943,15944,15945,15950,15951,15956,15957,15958,15959,15962,15964,15966,15967,15968,15969,15970,15976,15977,15978,15979,15980,15982,15983,15984,15985,15987,15988,15990,16010,16069,16070,16071,16090,16091,16092,16093,16096,16232,16261,16262,16263,16265,16267,16269,16270,16271,16272,16273,16283,16284,16285,16286,16287,16288,16289,16290,16291,16292,16295,16296,16300,16318,16319,16320,16322,16323,16325,16335,16336,16337,16340,16343,16362,16367,16369,16370,16371,16379,16382,16383,16387,16389,16392,16393,16394,16395,16397,16398,16399,16400,16408,16409,16412,16413,16414,16415,16416,16417,16418,16419,16426,16437,16438,16441,16446,16449,16451,16452,16454,16456,16457,16458,16459,16460,16462,16466,16467,16468,16469,16470,16471,16474,16479,16480,16490,16492,16493,16495,16497,16498,16499,16500,16501,16502,16503,16505,16506,16507,16508,16518,16521,16525,16526,16554,16569,16570,16571,16572,16574,16578,16581,16582,16586,16587,16588,16591,16592,16598,16604,16605,16608,16609,16611,16612,16615,16618,16619,16620,16621,16622,16623,16632,16637,16638,16639,16640,16641,16642,16643,16645,16646,16647,16648,16649,16655,16656,16658,16659,16660,16661,16678,16686,16689,16694,16698,16700,16703,16704,16705,16706,16707,16783,17008,17009,17010,17011,17012,17013,17015,17016,17017,17018,17020,17021,17022,17024,17026,17027,17028,17033,17034,17035,17036,17037,17038,17041,17042,17044,17045,17046,17047,17048,17049,17051,17067,17068,17072,17074,17075,17076,17077,17078,17079,17080,17081,17082,17083,17084,17086,17089,17090,17091,17093,17095,17097,17099,17100,17105,17106,17109,17110,17112,17113,17121,17128,17132,17135,17150,17152,17153,17155,17158,17166,17167,17168,17170,17172,17176,17177,17181,17182,17185,17188,17189,17190,17191,17193,17194,17195,17199,17200,17202,17206,17207,17209,17210,17211,17212,17217,17218,17221,17224,17225,17226,17227,17229,17232,17234,17235,17236,17239,17240,17241,17242,17254,17255,17256,17257,17258,17259,17265,17266,17269,17274,17276,17277,17278,17281,17282,17283,17284,17287,17289,17290,17291,17293,17295,17296,17298,17299,17300,17302,17303,17333,17334,17337,17338,17339,17340,17341,17343,17346,17347,17348,17357,17359,17360,17361,17362,17363,17364,17365,17366,17368,17371,17372,17373,17374,17375,17376,17379,17380,17381,17388,17389,17390,17391,17392,17393,17394,17395,17396,17397,17398,17399,17404,17437,17438,17448,17449,17450,17458,17459,17460,17462,17463,17464,17465,17467,17468,17469,17470,17472,17478,17479,17483,17484,17486,17487,17489,17490,17491,17492,17495,17499,17500,17511,17512,17513,17515,17519,17520,17521,17523,17524,17525,17528,17570,17571,17575,17795,17797,17799,17800,17808,17809,17810,17813,17814,17828,17830,17831,17832,17833,17835,17836,17837,17838,17840,17844,17845,17846,17852,17853,17854,17858,17859,17860,17861,17862,17863,17865,17866,17867,17868,17869,17870,17871,17874,17875,17878,17879,17880,17881,17882,17883,17884,17885,17886,17887,17888,17889,17892,17893,17894,17895,17897,17898,17911,17912,17913,17915,17917,17919,17920,17952,17957,17958,17959,17960,17961,17964,17965,17966,17967,17968,17969,17970,17971,17972,17973,17974,17975,17976,17977,17979,17982,17983,17984,17985,17986,17987,17991,17992,17993,17994,17995,18000,18001,18002,18003,18004,18005,18006,18012,18013,18016,18017,18018,18019,18020,18022,18023,18024,18025,18030,18032,18043,18044,18045,18048,18054,18056,18057,18058,18059,18060,18061,18062,18069,18070,18071,18095,18096,18097,18098,18100,18101,18112,18113,18115,18123,18124,18125,18126,18127,18128,18131,18134,18135,18136,18139,18140,18141,18142,18143,18144,18145,18146,18147,18149,18150,18154,18155,18156,18157,18189,18194,18195,18196,18197,18198,18200,18201,18202,18203,18204,18205,18206,18231,18232,18285,18288,18289,18290,18291,18292,18293,18294,18295,18296,18297,18304,18305,18306,18307,18308,18309,18310,18311,18312,18324,18325,18326,18328,18329,18332,18333,18334,18337,18338,18340,18341,18345,18347,18349,18350,18353,18354,18355,18356,18357,18364,18366,18367,18368,18371,18372,18373,18374,18375,18376,18377,18378,18379,18380,18381,18382,18384,18389,18390,18403,18404,18405,18406,18407,18408,18410,18413,18419,18420,18421,18422,18423,18424,18425,18428,18452,18453,18457,18459,18462,18464,18465,18468,18470,18475,18476,18483,18484,18490,18492,18543,18545,18554,18556,18557,18559,18563,18566,18569,18571,18574,18575,18577,18578,18582,18583,18585,18586,18587,18589,18592,18607,18608,18610,18611,18612,18613,18614,18615,18616,18617,18619,18621,18660,18662,18663,18664,18667,18668,18671,18672,18680,18681,18682,18683,18689,18690,18695,18696,18700,18702,18704,18705,18707,18708,18711,18720,18721,18726,18728,18729,18730,18733,18734,18738,18837,18838,18841,18842,18846,18847,18974,18978,18983,19094,19095,19096,19098,19099,19100,19104,19105,19106,19108,19109,19110,19111,19127,19132,19149,19150,19151,19159,19166,19167,19169,19172,19173,19178,19179,19180,19184,19185,19187,19191,19194,19197,19200,19203,19204,19205,19211,19217,19218,19220,19221,19226,19227,19228,19229,19237,19238,19240,19241,19244,19245,19246,19247,19248,19250,19251,19252,19253,19254,19255,19270,19271,19272,19274,19275,19281,19282,19283,19286,19288,19292,19297,19298,19299,19300,19301,19302,19303,19304,19305,19306,19307,19308,19309,19310,19312,19313,19314,19315,19316,19317,19318,19319,19320,19345,19348,19351,19352,19353,19355,19356,19357,19358,19359,19360,19361,19362,19363,19364,19365,19366,19367,19368,19369,19370,19371,19372,19373,19374,19375,19376,19377,19378,19379
+};
+
+static constexpr std::array<std::uint16_t, 19379> TOKEN_EMOJIS = {
+1552,992,993,994,996,998,1000,1002,1004,1006,1008,1010,1012,1014,992,993,196,197,994,995,1553,1565,1012,1013,1562,156,994,1012,563,1013,1014,1015,1014,1015,992,993,992,993,1565,994,995,995,994,995,996,997,996,997,998,999,998,999,1000,1001,1000,1001,1002,1003,1002,1003,1004,1005,1435,1004,1005,1006,1007,1006,1007,1087,996,997,1554,1565,1008,1009,996,1008,1009,1010,1011,1010,1011,1012,1013,1012,1013,1014,1015,997,1014,1015,1088,18,998,999,1555,1565,993,995,997,999,1001,1003,1005,1007,1009,1011,1013,1015,998,999,1089,1000,1001,1556,1565,1000,1001,1002,1003,1557,1002,1003,1600,1004,1005,1558,1004,1005,1601,1006,1007,1559,1006,1007,1597,1008,1009,1121,1560,1008,1241,1253,1009,1121,1010,1011,1561,1010,1229,1240,1241,1242,1253,337,338,927,930,956,1582,1011,17,1568,1632,1231,1569,1244,869,869,1567,1563,1564,139,1291,1454,1455,1456,1457,1458,1583,42,1400,1233,1187,196,1594,1594,1415,213,214,218,276,277,278,423,425,427,429,430,431,432,433,434,435,436,437,438,439,440,561,562,943,944,1355,1375,1379,1415,1415,987,1148,1149,1169,1170,1171,1185,1170,506,877,877,1214,1214,312,313,314,1286,63,719,748,1215,1590,1141,1063,1064,1065,1066,1067,1068,1069,1070,1071,1072,1073,1074,1075,1076,1077,1078,1079,1080,1081,1082,1083,1084,1085,1086,1087,1088,1089,1090,1091,1092,1093,1094,1095,1096,1097,1098,1099,1100,1101,1102,1103,1104,1105,1106,1107,1108,1109,1110,1111,1112,1113,1114,1115,1116,1117,1118,1119,1120,1121,1122,1123,1124,1125,1126,1127,1128,1129,1130,1131,1132,1133,1134,1135,1136,1137,1138,1139,1140,1141,1142,1143,1144,1145,1146,1147,371,372,373,885,905,907,908,910,1035,1063,1064,1065,1066,1069,1070,1071,1072,1073,1074,1075,1076,1077,1083,1117,1126,1140,1141,1143,1173,1186,1187,1204,1205,1206,1210,1211,1213,1215,1216,1217,1218,1219,1245,1248,1403,1503,1638,321,322,323,1645,1233,346,1514,1514,1199,1374,961,1082,1083,14,234,236,240,241,242,243,244,245,246,247,248,249,250,251,252,255,256,257,549,550,551,552,1590,312,313,314,979,970,971,972,973,975,1528,1647,14,15,17,20,21,121,130,131,133,134,135,136,137,145,146,147,148,150,155,509,515,517,518,878,885,1647,1647,845,1900,573,1685,1900,1183,1504,1435,196,267,1535,1536,1580,1594,207,1596,939,1649,218,1190,1374,1375,161,183,203,1048,1381,102,327,328,329,970,971,972,973,975,972,973,1423,1650,322,1659,135,988,990,1650,1650,823,825,826,827,828,829,830,831,1364,956,1425,1709,1709,115,116,982,63,644,94,595,1547,1563,1564,1567,1568,1569,1570,1571,1574,1576,1579,1581,1542,164,1651,83,31,927,956,769,1885,1892,887,1095,1281,1655,1885,846,1285,684,182,1587,1587,1566,844,1407,1408,906,907,908,139,312,313,314,1317,221,961,1531,1271,31,109,185,509,839,840,1039,1340,1341,1346,1351,1383,1467,1645,1645,1904,1078,13,370,639,104,157,166,1652,1652,86,103,104,107,157,166,199,1649,1649,88,118,119,120,121,122,123,124,125,126,127,128,129,460,555,556,557,558,559,560,561,562,563,564,565,566,567,568,570,571,572,573,574,577,578,579,580,582,583,584,585,586,587,588,589,590,591,592,593,594,595,596,597,599,600,601,602,603,604,605,606,607,608,609,610,611,612,613,614,615,616,617,618,619,620,621,622,623,624,625,626,627,628,629,630,631,632,633,634,636,637,638,643,644,645,646,647,648,649,650,651,652,653,654,655,656,657,658,659,660,664,665,666,667,669,670,671,672,673,675,676,678,679,680,681,683,797,555,556,557,558,559,560,561,562,563,564,565,566,567,568,569,570,571,572,573,574,575,576,577,578,579,580,581,582,583,584,585,586,587,588,589,590,591,592,593,594,595,596,597,598,599,600,601,602,603,604,605,606,607,608,609,610,611,612,613,614,615,616,617,618,619,620,621,622,623,624,625,626,627,628,629,630,631,632,633,634,635,636,637,638,639,640,641,642,643,644,645,646,647,648,649,650,651,652,653,654,655,656,657,658,659,660,661,662,663,664,665,666,667,668,669,670,671,672,673,674,675,676,677,678,679,680,681,682,683,684,685,686,687,688,689,690,691,692,693,694,695,696,697,698,699,700,701,702,703,704,705,706,707,708,709,710,711,712,713,159,683,1199,1410,104,1535,1537,273,672,1653,1867,1653,1370,1506,1453,1648,1699,90,229,1652,558,279,280,281,797,202,723,724,987,1225,1595,1595,208,204,196,1653,844,1482,1654,352,1646,1862,1843,593,1843,353,354,678,679,680,116,1346,1480,1117,1346,312,313,314,1325,1326,863,612,756,1654,1654,391,590,1472,211,212,213,1651,1651,203,264,1084,1189,337,338,1358,973,973,973,131,1226,1291,1346,1438,1439,1440,1441,1442,1443,1444,1445,1446,1447,1448,1449,1450,1451,1452,1453,1454,1455,1456,1457,1458,1485,1486,1487,1488,1489,1490,1491,1492,1493,1494,1495,1496,1497,1498,1529,1446,1447,1452,1453,1485,1486,1487,324,325,326,862,1141,1142,1143,1305,938,980,321,324,325,326,1143,1207,1107,1141,1658,1658,139,1644,1849,1528,1406,847,850,1077,355,594,790,1259,208,1528,309,310,311,787,1375,562,1543,1551,83,1472,1473,1474,1475,1476,1477,1478,1479,1480,1481,1482,1483,1484,330,331,332,1369,195,901,903,1656,1460,473,474,1176,1113,1412,1460,199,270,1361,1657,735,1461,1657,618,847,1345,1657,1657,1656,1656,1421,945,1412,933,934,708,799,1077,1597,327,328,329,327,328,329,734,87,1658,1084,1085,1086,1087,1088,1089,1081,161,31,196,1034,1068,1545,46,1338,1660,1660,1660,1570,149,230,363,364,365,366,367,368,369,370,624,625,626,818,1419,86,170,1444,1448,1454,170,189,190,191,193,1173,1177,1428,1492,1494,765,684,1366,594,110,197,377,378,379,1318,1427,1542,1532,1533,619,1105,1170,1171,1172,1173,1278,758,1423,1424,57,1167,1172,755,1424,1676,1676,1667,1667,1667,1389,1662,736,755,756,757,758,770,811,876,499,500,501,1354,1464,1478,243,251,252,630,463,464,465,475,476,477,496,497,498,789,1071,1090,1091,1092,1093,1094,1095,1096,1097,1099,1100,1101,1103,1104,1121,1122,1131,1146,267,1178,1181,163,166,167,1069,1300,1536,209,1304,800,1091,1092,1093,1094,1095,1097,1072,1073,1223,172,556,720,1374,60,142,1374,60,142,1905,158,1524,1519,1663,1663,1219,876,1280,1281,1282,1283,1284,1285,1287,1412,1526,312,313,314,1280,1281,1282,1283,1284,1280,1281,1282,1283,1428,1072,1075,1643,1645,1646,1647,1648,1649,1650,1651,1652,1653,1654,1655,1656,1657,1658,1659,1660,1661,1662,1663,1664,1665,1666,1667,1668,1669,1670,1671,1672,1673,1674,1675,1676,1677,1679,1680,1681,1682,1683,1684,1685,1686,1687,1688,1689,1690,1691,1692,1693,1695,1696,1697,1698,1699,1700,1701,1702,1703,1705,1706,1707,1708,1709,1711,1712,1713,1714,1715,1716,1717,1718,1719,1720,1721,1722,1723,1724,1725,1726,1727,1728,1729,1730,1731,1732,1733,1734,1735,1736,1737,1738,1739,1740,1741,1742,1743,1744,1746,1747,1748,1749,1750,1751,1752,1753,1754,1755,1756,1757,1758,1759,1760,1761,1762,1763,1764,1765,1766,1767,1768,1769,1770,1771,1772,1773,1774,1775,1776,1777,1778,1779,1780,1781,1782,1783,1784,1785,1786,1787,1788,1789,1790,1792,1793,1794,1795,1796,1797,1798,1799,1800,1801,1802,1803,1804,1805,1806,1807,1808,1809,1810,1811,1812,1813,1814,1815,1816,1817,1818,1819,1820,1821,1822,1823,1824,1825,1826,1827,1828,1829,1830,1831,1832,1833,1834,1835,1836,1837,1838,1839,1840,1841,1842,1843,1844,1845,1846,1847,1848,1849,1850,1852,1853,1854,1855,1856,1857,1858,1859,1860,1861,1862,1863,1865,1866,1867,1868,1869,1870,1871,1872,1873,1874,1875,1876,1877,1878,1879,1880,1881,1882,1884,1885,1886,1887,1888,1889,1890,1891,1892,1893,1894,1895,1896,1897,1898,1899,1900,1901,1902,203,813,823,824,825,826,827,828,829,1117,1259,1319,1397,1490,1491,1494,1499,1506,1662,1662,762,800,405,406,407,909,1648,61,62,1590,1591,953,960,1506,925,1670,1670,1091,1188,1330,1394,475,476,477,1093,1782,1215,610,1100,1104,505,904,1387,1388,1166,505,1163,1164,1165,1397,505,1385,1387,1388,1399,1415,1418,505,1388,610,1679,1231,1232,93,1662,1229,762,1663,1664,73,467,468,553,654,657,659,660,661,692,701,798,827,857,1029,1054,1062,1166,1174,956,1407,1191,1205,3,747,611,612,613,1129,237,238,239,237,238,239,647,1482,1484,1221,135,210,405,406,407,608,177,506,1382,1382,168,673,582,583,585,766,1229,828,829,829,817,674,675,85,1533,1038,1040,1041,1042,1680,1680,1664,1664,1681,1681,740,983,1076,1202,1203,270,983,364,365,572,1669,1669,787,1671,1671,727,728,729,73,1126,460,173,819,820,822,823,825,826,827,828,829,830,831,835,836,237,238,239,146,1666,1667,1677,1677,1668,212,212,481,482,483,484,485,486,946,1429,1429,481,482,483,484,485,486,1,4,907,910,481,482,483,484,485,486,942,946,1429,484,485,486,1429,481,482,483,484,485,486,1166,729,1280,1281,1282,1283,1284,1285,1188,1121,1121,1283,1284,1330,1413,1431,1269,1437,315,316,317,1366,1367,1366,192,621,622,623,624,625,626,627,628,629,630,631,632,633,634,635,637,638,640,642,710,711,763,1105,639,367,368,369,71,809,1069,1070,1071,1080,808,1641,581,665,1742,229,1669,876,143,152,569,640,960,1029,1133,1134,1135,1136,1137,1138,1227,1268,1302,1327,1438,1440,1442,1444,1488,1489,1490,1491,1492,1493,1494,1496,1498,1500,1501,1521,1529,1536,1544,1609,1618,1620,1622,1624,1635,1639,842,40,261,1372,1229,127,423,424,425,426,427,428,561,562,610,1355,364,365,1428,319,320,235,253,254,351,235,253,254,351,386,1371,1372,1568,1569,1570,1579,1578,686,687,694,694,1167,17,161,709,1048,658,17,69,1048,69,158,65,90,148,149,268,657,729,916,935,1049,1194,1265,1412,1413,1414,1415,1416,1418,1420,1421,1422,1423,1424,1430,1438,1439,1440,1441,1442,1443,1444,1445,1446,1448,1449,1450,1451,1453,1458,1485,1487,1488,1489,1490,1491,1492,1493,1495,1496,1497,1498,1499,1500,1501,1502,1503,1506,1550,1552,1553,1554,1555,1556,1557,1558,1559,1560,1561,1562,1563,1564,1565,1566,1567,1572,1573,1574,1576,1577,1578,1580,1581,1583,1585,1586,1597,1606,1615,1627,1629,1632,1642,729,729,1213,1506,49,12,19,84,30,84,1671,1672,1673,588,948,1187,1248,973,469,470,471,961,963,964,965,967,968,969,834,108,109,169,170,171,172,173,174,175,176,177,178,179,180,181,182,183,184,185,186,187,188,189,190,191,192,193,194,195,196,197,198,199,200,201,202,203,204,205,206,207,208,209,210,211,212,213,214,215,216,217,218,219,220,221,222,223,224,225,226,227,228,229,230,231,232,233,234,235,236,237,238,239,240,241,242,243,244,245,246,247,248,249,250,251,252,253,254,255,256,257,258,259,260,261,262,263,264,265,266,267,268,269,270,271,272,273,274,275,276,277,278,279,280,281,282,283,284,285,286,287,288,289,290,291,292,293,294,295,296,297,298,299,300,301,302,303,304,305,306,307,308,309,310,311,312,313,314,315,316,317,318,319,320,321,322,323,324,325,326,327,328,329,330,331,332,333,334,335,336,337,338,339,340,341,342,343,344,345,346,347,348,349,350,351,352,353,354,355,356,357,358,359,360,361,362,363,364,365,366,367,368,369,370,371,372,373,374,375,376,377,378,379,380,381,382,383,384,385,386,387,388,389,390,391,392,393,394,395,396,397,398,399,400,401,402,403,404,405,406,407,408,409,410,411,412,413,414,415,416,417,418,419,420,421,422,423,424,425,426,427,428,429,430,431,432,433,434,435,436,437,438,439,440,441,442,443,444,445,446,447,448,449,450,451,452,453,454,455,456,457,458,459,460,461,462,463,464,465,466,467,468,469,470,471,472,473,474,475,476,477,478,479,480,481,482,483,484,485,486,487,488,489,490,491,492,493,494,495,496,497,498,499,500,501,502,503,504,505,506,507,508,509,510,511,512,513,514,515,516,517,518,519,520,521,522,523,524,525,526,527,528,529,530,531,532,533,534,535,536,537,538,539,540,541,542,543,544,545,546,547,548,549,550,551,552,553,554,478,790,742,1890,1673,1673,1055,1351,158,1344,836,1674,1407,224,762,763,1377,1261,1262,1263,1264,1265,1266,1267,1268,1269,1286,1275,1276,1267,158,1067,1344,1345,1114,1177,1182,1182,823,825,826,827,828,829,831,1421,1422,1638,44,101,168,698,624,1661,117,203,1679,367,368,369,818,823,824,1391,726,1442,1451,1497,1498,1631,865,456,457,458,475,476,477,1269,685,831,1678,1817,208,279,280,281,1079,1185,1346,322,279,280,281,779,781,790,792,806,822,1099,1079,132,787,803,835,1080,1214,1292,1293,1294,1300,1328,1404,1536,1106,230,231,232,254,259,262,265,268,271,274,279,280,283,286,350,355,403,406,443,448,449,519,521,522,524,526,527,529,531,532,534,535,537,539,540,542,548,1511,451,1675,650,42,220,876,1072,1469,148,1548,1675,1217,1675,1675,1686,753,754,755,756,757,758,770,140,158,1357,753,754,758,759,760,765,776,777,781,807,822,140,366,366,222,222,864,864,360,361,362,885,896,903,1164,1308,1164,73,1029,1030,1031,1505,1029,1504,1505,1726,342,343,344,822,1283,1726,1756,1891,199,1196,1197,1198,743,199,140,142,869,1357,140,510,650,1089,1393,151,574,708,751,1175,1608,1617,72,759,760,765,1672,1672,1305,1393,1399,1676,1677,150,54,163,164,165,166,167,834,1388,1398,824,580,1527,1396,688,1461,1463,1463,581,584,671,672,673,674,675,1201,346,347,348,1190,1337,1340,1341,346,862,863,868,869,870,871,872,873,874,875,876,877,878,879,880,881,882,883,884,888,898,901,902,1459,868,901,902,1257,1666,1666,583,1117,1473,914,913,914,1199,1200,583,1117,673,199,200,201,593,594,450,451,452,605,606,962,872,766,1665,1665,1796,1796,141,1060,1398,772,1668,1668,197,923,924,925,926,950,975,312,313,314,449,463,465,876,1109,1153,1308,1309,1311,1316,1317,1318,1328,1542,1600,313,314,1600,950,545,546,546,91,842,726,784,205,670,1238,1453,1485,1486,1487,1488,1489,1490,1491,1492,1493,1494,1495,1496,1497,1498,1499,1500,1501,1502,1504,1505,1535,1539,1568,1569,1570,1571,1572,1573,1575,1577,1578,1579,1580,1581,1582,1583,1584,1585,1586,1587,1588,1589,1590,1591,1592,1593,1594,1595,1596,1597,1598,1599,1600,1601,1606,1609,1618,1619,1620,1622,1623,1633,1634,1635,1172,1891,1679,1680,1681,1546,707,1682,742,743,1329,978,979,1233,978,1698,702,820,820,1865,798,799,809,810,811,1325,1244,1513,1514,1515,1516,1811,1811,1312,1313,1315,188,1226,1228,1226,688,1767,1767,1252,593,594,211,1245,1250,1251,1252,1503,1691,1691,935,856,895,1177,1258,856,786,1330,575,707,1682,707,1682,1750,1513,1538,1195,1203,664,1475,1469,1256,809,1469,1469,813,814,815,1130,423,424,425,426,427,428,1355,1375,786,964,715,355,1187,1188,1698,1563,1568,1570,1576,1579,1581,852,855,592,1481,740,1373,166,32,912,921,922,923,926,929,930,933,934,935,936,939,940,955,956,979,816,1398,1133,1134,1135,1136,1138,1140,1285,1311,1316,1328,1411,1611,1613,1294,1438,1440,1442,1444,221,1133,1134,1135,1136,1138,1140,210,547,1528,1308,1674,905,907,908,910,1065,905,1075,1348,1348,912,922,737,928,929,931,932,937,938,956,1581,1402,487,488,489,487,488,489,1409,956,876,1412,1126,1396,1404,778,1541,883,884,1154,118,119,120,121,122,123,124,125,126,567,568,569,571,620,568,177,1108,1359,670,671,118,119,120,121,122,123,124,125,126,568,1081,960,1774,1774,1242,1243,830,71,203,371,372,373,809,824,830,1063,1064,1065,1066,1069,1070,1071,1072,1073,1074,1075,1076,1077,1079,1080,1081,1084,1130,1187,1638,684,1225,1226,1434,1506,1508,1509,1506,1404,1405,881,1685,156,313,314,781,1077,1085,1710,1716,1687,1866,761,1866,1756,1356,1357,1358,1358,975,1384,1741,824,830,1085,1419,1419,1469,885,1566,1586,1588,1592,1233,1586,1588,1592,1407,1287,1317,1318,1319,163,163,165,181,1535,1536,1537,1536,1636,877,24,556,1200,829,830,601,758,761,768,770,780,1389,766,303,304,305,315,316,317,1151,1365,315,1364,1365,1460,1636,727,686,687,727,370,1137,1360,748,1533,624,625,626,622,623,624,625,626,763,776,775,230,231,232,233,366,367,368,369,520,521,522,523,524,525,526,527,528,529,530,531,532,533,534,535,536,537,538,539,540,541,542,543,548,549,550,551,552,1419,1426,24,25,521,522,523,524,525,526,527,528,529,530,531,532,533,535,537,538,540,542,543,550,552,1426,1690,1690,739,1383,739,836,1076,1202,34,1692,1744,1798,1879,355,648,649,730,742,803,1139,1587,1588,1589,1590,1591,1592,1593,1594,1595,1596,1597,1598,1599,1600,1601,1692,808,607,767,676,132,780,808,813,820,132,764,842,1338,1348,792,838,742,888,888,1465,1466,1465,371,372,373,1056,1057,1058,1064,1080,1202,1700,885,888,1459,346,1403,1430,836,1245,1246,1247,1503,159,955,1427,1428,1429,1431,1432,1433,1434,1435,1452,1453,1486,1487,1501,1534,1546,1547,1576,1590,1594,1598,1599,1602,1603,1604,1605,1606,1607,1608,1609,1610,1633,1487,1576,1590,1594,1598,1599,555,556,557,597,910,1069,1070,1071,1122,1186,719,718,872,896,897,898,901,902,1888,898,901,1587,1588,1589,1591,1592,1593,1595,1596,1597,1600,1601,1571,1423,1122,1353,202,1248,1248,202,862,1261,236,1186,371,372,373,1337,665,864,505,1387,1388,1398,1399,1393,1397,1400,1414,1571,1204,198,199,312,313,314,1238,1362,456,457,458,456,457,458,829,830,829,830,1320,1694,1724,1323,880,985,987,988,989,990,991,992,993,994,995,996,997,998,999,1000,1001,1002,1003,1004,1005,1006,1007,1008,1009,1010,1011,1012,1013,1014,1015,994,1012,1013,1014,1015,992,993,995,996,997,998,999,1000,1001,1002,1003,1004,1005,1006,1007,1008,1009,1010,1011,1452,1486,1487,4,20,27,33,123,199,1051,1262,1295,1296,1309,1331,1334,1420,1153,1154,1156,1157,1159,1160,1167,553,1051,1052,1053,1148,1150,1151,1153,1154,1155,1156,1157,1158,1159,1160,1161,1162,1163,1164,1165,1166,1167,1169,1170,1171,1175,1176,1177,1178,1179,1180,1181,1182,1184,1185,1186,1187,1188,1191,167,1037,1038,1039,1040,1041,1042,1043,1044,1045,1046,1047,1048,1049,42,1037,1038,705,706,111,463,1136,1285,1136,622,1128,1336,60,1171,1691,1692,1693,1688,908,1151,1158,738,679,623,623,677,826,827,733,701,733,1683,318,319,320,151,820,1404,1352,1352,1169,1279,1278,733,37,5,58,59,65,90,98,837,852,1028,1044,1056,1057,1058,1061,1114,1051,1187,158,1693,1693,1143,1183,177,1141,1059,110,157,158,159,160,161,163,167,168,212,1061,1257,1344,1632,163,873,980,1199,1200,1201,1212,1225,1226,1227,1228,1229,1230,1273,1288,1289,1290,1291,1292,1293,1294,1295,1296,1297,1298,1299,1303,1304,1305,1306,1307,1324,1370,1434,1506,1508,1509,1769,1769,1242,851,460,209,1204,1216,1307,1268,1353,1353,117,318,319,320,1234,1235,1236,1237,1238,1239,1240,1241,1242,1243,1235,78,90,861,1082,1083,1214,270,785,843,805,1071,1536,95,77,68,76,77,95,286,287,1521,1522,1221,781,1684,1686,202,1598,1598,1065,1070,1598,1506,34,1124,1484,1357,346,347,348,863,864,865,866,960,1190,1507,803,818,843,1294,1396,52,1085,1636,1438,1489,546,1209,1421,1124,879,303,304,305,744,745,784,1060,1689,790,802,808,303,304,305,749,777,778,839,840,842,844,73,196,575,1068,1149,1572,336,337,338,929,1546,662,824,738,783,879,1726,58,684,1534,742,210,1192,331,332,1696,450,1688,1383,1244,986,1453,1244,850,1638,1645,1646,1647,1648,1649,1650,1651,1652,1653,1654,1655,1656,1657,1658,1659,1660,1661,1662,1663,1664,1665,1666,1667,1668,1669,1670,1671,1672,1673,1674,1675,1676,1677,1679,1680,1681,1682,1683,1684,1685,1686,1687,1688,1689,1690,1691,1692,1693,1696,1697,1698,1699,1700,1701,1702,1703,1705,1706,1707,1708,1709,1711,1712,1713,1714,1715,1716,1717,1719,1720,1721,1722,1723,1724,1725,1726,1727,1728,1729,1730,1731,1732,1733,1734,1735,1736,1737,1738,1739,1740,1741,1742,1743,1744,1746,1747,1748,1749,1750,1751,1752,1753,1754,1755,1756,1757,1758,1759,1760,1761,1762,1763,1764,1765,1766,1767,1768,1769,1770,1771,1772,1773,1774,1775,1776,1777,1778,1779,1780,1781,1782,1783,1784,1785,1786,1787,1788,1789,1790,1792,1793,1794,1795,1796,1797,1798,1799,1800,1801,1802,1803,1804,1805,1806,1807,1808,1809,1810,1811,1812,1813,1814,1815,1816,1817,1818,1819,1820,1821,1822,1823,1824,1825,1826,1827,1828,1829,1830,1831,1832,1833,1834,1835,1836,1837,1838,1839,1840,1841,1842,1843,1844,1845,1846,1847,1848,1849,1850,1852,1853,1854,1855,1856,1857,1858,1859,1860,1861,1862,1863,1865,1866,1867,1868,1869,1870,1871,1872,1873,1874,1875,1876,1877,1878,1879,1880,1881,1882,1885,1886,1887,1888,1889,1890,1891,1892,1893,1894,1895,1896,1897,1898,1899,1900,1901,1902,357,360,507,508,509,510,511,512,513,514,515,516,517,518,885,511,512,513,514,297,298,299,1261,30,33,105,127,128,129,58,59,684,582,583,584,585,764,819,585,70,70,1182,750,1695,664,1475,788,1144,1146,863,110,1306,25,26,758,804,806,1278,1337,1340,1341,324,1305,1306,112,113,114,115,116,655,660,1411,1285,108,112,113,1025,1063,816,754,1017,1023,1024,1467,676,1100,340,377,378,379,643,1747,1747,644,1146,644,754,1359,703,704,300,67,184,875,888,1190,1465,1466,1538,1539,1638,1687,1903,1904,109,1643,67,184,185,1343,1428,1485,1638,1426,1433,640,349,350,351,1184,966,969,12,14,15,664,1375,7,22,85,86,92,93,125,7,92,93,125,1122,1632,759,759,1697,1697,1697,837,741,1121,303,862,1366,1849,1864,822,823,832,833,1386,811,951,131,370,206,1699,1699,1699,566,1270,1540,1541,1270,1116,1540,1541,241,247,248,1540,1541,1270,1279,1280,1281,1282,1283,1287,1526,1527,778,791,105,1503,1359,1448,1451,1448,1449,1450,1451,105,816,1421,1422,764,842,1327,1338,1348,1390,1591,279,571,652,1632,839,840,841,842,405,1327,1701,942,1452,1453,481,482,483,484,485,486,1429,1046,1049,632,1905,1701,1701,1702,1702,1702,1688,0,1,2,1688,1864,236,548,1342,585,784,694,608,447,448,1131,1181,447,448,450,451,452,447,448,450,451,452,108,109,571,1055,1426,1436,1437,1524,1602,800,1706,152,1016,1025,1149,1258,1117,1117,1672,161,1525,161,1240,1328,507,508,509,510,1312,1313,1315,509,511,513,514,515,517,518,878,520,521,525,526,530,531,536,537,541,542,523,528,533,538,543,1462,902,1004,1312,1313,84,1905,1530,1703,67,108,398,399,400,691,1232,1404,1406,989,109,38,39,128,276,277,278,207,264,108,109,1404,1405,1406,1064,700,1140,264,1261,138,139,689,1073,1079,1084,1261,1530,1504,1318,279,280,281,580,1187,1271,53,1538,770,23,723,724,937,1274,177,1684,1776,107,112,1410,264,265,266,1427,1428,1155,1706,1399,223,288,289,290,1539,881,928,972,972,969,981,41,53,92,93,97,259,260,41,949,869,593,594,702,858,859,798,1143,1225,270,271,272,1313,1234,1235,103,799,800,802,804,805,806,807,808,809,810,811,812,813,814,815,816,1585,339,340,341,1254,1255,1703,318,319,320,106,107,112,187,1463,1191,77,1439,1441,1443,1445,1209,1225,1227,1228,163,165,1135,1193,1194,1426,1626,1627,1628,1629,1632,1135,1392,1127,1127,1404,1406,1704,1756,915,954,1339,1363,1552,1553,1554,1555,1556,1557,1558,1559,1560,1561,1212,1250,1504,1285,1076,963,839,839,650,651,650,1117,189,190,191,193,194,849,1438,1439,1440,1441,1442,1443,1444,1445,1446,1447,1449,1450,1451,1488,1492,1495,1496,1497,1498,1630,1631,1248,1309,110,429,430,431,432,433,434,435,436,437,438,439,440,1375,1203,1415,1428,10,41,114,77,79,91,97,282,37,50,197,854,1062,31,37,282,283,284,1098,1242,1243,448,1122,1131,1591,259,260,58,681,682,72,72,61,61,1366,1370,1240,1241,1242,1243,197,176,1234,44,10,1364,99,100,1582,37,192,1516,1591,1311,668,1112,1516,1688,1349,1360,1260,49,66,67,68,159,1049,1705,1221,1705,1705,395,396,397,395,1706,1707,1367,1431,58,288,289,290,875,1151,1371,1372,1373,1374,1376,1377,1528,1270,1271,1272,1307,1411,1307,1270,1271,1272,1293,1307,1308,1309,1310,1320,1323,1324,634,110,559,560,561,562,563,620,769,560,560,279,560,687,487,488,489,1074,1132,28,1278,1280,1281,1282,1284,1285,1526,1527,1074,1132,654,1708,889,568,584,1707,1708,1372,687,985,986,774,576,807,1335,1336,1378,1378,74,1148,602,139,1470,1632,41,1470,1367,1489,1490,1491,1493,1494,1496,1498,1499,1519,1541,285,286,287,1521,1522,807,629,9,51,176,193,197,1291,1318,1441,1442,1443,1446,1451,1497,1498,1631,98,1442,897,1291,1318,1442,1451,1452,1453,1497,1442,1318,386,387,399,648,649,1139,1905,1232,783,1141,324,1143,1525,1540,1305,1306,1325,1684,10,42,167,168,447,1160,1161,1162,1175,1161,714,715,716,717,718,719,720,721,722,723,724,725,726,727,728,729,730,731,732,733,734,735,736,737,738,739,740,741,742,743,744,745,746,747,748,749,750,751,752,753,754,755,756,757,758,759,760,761,762,763,764,765,766,767,768,769,770,771,772,773,774,775,776,777,778,779,780,781,782,783,784,785,786,787,788,789,790,791,792,793,794,795,796,797,798,799,800,801,802,803,804,805,806,807,808,809,810,811,812,813,814,815,816,817,818,819,820,821,822,823,824,825,826,827,828,829,830,831,832,833,834,835,836,837,838,839,840,841,842,843,844,1414,1432,1435,1414,1432,829,160,1061,958,1426,1051,593,55,55,691,176,1053,1061,1372,1061,160,1322,160,1053,1373,1371,1373,953,1220,1221,762,763,1220,66,823,825,826,828,829,831,83,206,44,18,631,632,801,1077,110,1137,901,902,1004,1816,1861,1242,1243,1067,1709,1688,879,1289,630,217,218,276,450,451,452,703,738,1211,992,993,994,995,996,997,998,999,1000,1001,1002,1003,1004,1005,1006,1007,1008,1009,1010,1011,1012,1013,1014,1015,1211,1211,128,217,392,393,394,450,451,452,845,846,847,848,49,683,847,1439,1440,1441,1872,605,776,1409,839,1711,1016,1317,1318,1542,1711,1711,1325,291,292,293,294,295,296,880,1173,1187,294,295,296,1712,46,576,1713,624,776,777,735,711,1713,1713,886,1008,1009,1121,1543,1544,1560,1435,1205,1502,1860,242,249,250,255,256,257,256,257,1300,1535,1536,912,915,1055,1215,1233,1257,1258,306,307,308,1055,1233,1257,925,1232,880,597,598,1379,1014,1015,879,392,393,394,130,874,1288,1289,1290,1291,1292,1293,1295,1296,1297,1298,1299,1448,1449,31,12,84,32,162,1531,1145,875,956,1152,1582,956,1646,1646,150,1312,0,1,2,3,4,5,6,7,8,9,10,11,12,13,14,15,16,17,18,19,20,21,22,23,24,25,26,27,28,29,30,31,32,33,34,35,36,37,38,39,40,41,42,43,44,45,46,47,48,49,50,51,52,53,54,55,56,57,58,59,60,61,62,63,64,65,66,67,68,69,70,71,72,73,74,75,76,77,78,79,80,81,82,83,84,85,86,87,88,89,90,91,92,93,94,95,96,97,98,99,100,101,102,103,104,105,106,107,108,109,110,111,112,113,114,115,116,117,118,119,120,121,122,123,124,125,126,127,128,129,130,131,132,133,134,135,136,137,138,139,140,141,142,143,144,145,146,147,148,149,150,151,152,153,154,155,156,157,158,159,160,161,162,163,164,165,166,167,168,801,710,832,843,1597,1455,1231,1232,337,338,929,930,1193,1193,911,928,315,316,317,318,319,320,1283,1726,1903,1726,1903,103,1359,1448,876,321,322,323,905,907,908,910,1063,1064,1065,1066,1068,1069,1070,1071,1072,1074,1075,1076,1077,1080,1082,1083,1111,1117,1124,1125,1127,1138,1140,1141,1143,1186,1198,1201,1204,1205,1206,1210,1211,1212,1213,1215,1216,1217,1218,1219,1240,1243,1245,1246,1247,1248,1249,1250,1252,1253,1503,141,1082,1378,1427,1428,130,873,1078,1288,1290,1291,1299,852,853,860,1529,1517,1517,1737,1737,577,1715,1715,1715,956,1425,1602,854,1716,820,1712,1712,1863,115,1717,1717,1717,1718,1282,845,874,884,1718,1674,897,901,1016,1017,1018,1019,1020,1021,1022,1023,1024,1025,1026,1027,1030,1083,699,869,1286,106,107,109,113,127,128,129,152,187,377,378,379,647,1407,1367,591,156,985,1307,282,283,284,1287,1526,16,26,133,134,139,1425,1456,1519,1520,1523,1524,1583,5,98,411,412,413,441,442,443,444,445,446,473,474,478,480,482,483,946,222,47,47,57,100,1588,1378,1137,1286,185,1426,1151,1364,1365,1368,105,158,1067,1344,69,75,69,158,1065,1067,1344,1067,938,39,192,115,598,634,650,651,598,634,1401,1401,115,116,982,2,3,11,12,15,20,21,25,26,27,32,44,45,73,119,121,123,164,187,225,226,339,561,1117,1148,1149,1150,1407,225,37,91,16,1148,45,1,2,3,4,12,14,15,16,20,21,26,27,28,30,31,45,57,66,67,68,84,85,96,119,121,123,127,225,1150,1148,73,1148,1149,940,0,1,2,3,4,5,6,7,8,9,10,11,12,13,14,15,16,17,18,19,20,21,22,23,24,25,26,27,28,29,30,31,32,33,34,35,36,37,38,39,40,41,42,43,44,45,46,47,48,49,52,53,54,55,56,57,58,59,60,61,62,63,64,65,66,67,68,69,70,71,72,73,74,75,76,77,78,79,80,81,82,83,84,85,86,87,88,89,90,91,92,93,94,95,96,97,98,99,100,101,102,103,104,105,106,107,108,109,110,111,112,113,114,115,116,117,118,119,120,121,122,123,124,125,126,127,128,129,155,217,225,226,261,264,267,282,283,284,346,370,402,403,404,544,555,559,564,565,566,567,570,571,574,578,579,582,586,589,596,601,604,605,609,611,612,613,614,643,648,652,992,993,994,995,996,997,998,999,1000,1001,1002,1003,1004,1005,1006,1007,1008,1009,1010,1011,1012,1013,1014,1015,1025,1026,1027,1030,1031,1048,1050,1149,1190,1409,38,282,283,284,282,283,284,199,238,239,200,201,206,411,412,413,420,421,422,424,426,428,430,432,434,436,438,440,444,445,446,626,1272,1230,309,310,311,882,110,1640,1318,905,907,1354,13,106,107,108,112,113,114,115,116,350,351,370,383,384,385,401,648,649,811,1122,559,560,774,775,775,1721,1721,1721,693,707,708,1038,1063,708,707,708,1035,519,520,521,522,523,524,525,526,527,528,529,530,531,532,533,534,535,536,537,538,539,540,541,542,543,548,549,550,551,552,1168,1632,13,106,107,112,113,114,115,116,350,351,370,374,375,376,377,378,379,380,381,382,383,384,385,386,387,388,389,390,391,392,393,394,395,396,397,398,399,400,401,982,1122,169,300,301,302,939,300,301,302,300,301,302,703,939,1394,1723,161,210,358,359,1148,1153,1154,1155,1160,1161,1163,1166,1167,1169,1170,1175,1179,1180,1182,1185,1192,1193,1665,161,766,767,914,940,941,1055,1290,1489,1493,1496,1498,236,371,519,520,521,522,523,524,525,526,527,528,534,535,536,537,538,548,524,525,526,527,528,1408,1061,1414,1432,280,281,1275,1276,1230,89,94,124,229,89,94,635,212,894,100,261,1722,1841,366,367,368,369,818,409,410,553,620,568,233,234,239,244,245,247,249,251,253,255,257,260,263,266,269,270,272,275,278,281,284,287,290,293,296,299,302,305,308,311,314,317,320,323,326,329,332,335,338,341,344,348,351,354,356,359,362,363,366,367,372,376,379,382,385,388,391,394,397,400,404,407,410,416,419,427,433,439,443,447,452,455,458,465,468,471,474,477,480,483,486,489,492,495,498,501,504,508,509,511,512,514,515,516,518,520,521,522,523,529,530,531,532,533,536,538,539,540,541,542,543,548,591,1161,1166,1167,1179,1185,1192,1417,1510,1512,459,459,907,961,966,967,371,799,910,1064,1065,1071,1072,1074,1077,203,59,681,64,1719,1100,1101,345,1106,1720,1720,1309,1310,1328,1329,1329,812,1245,1246,1247,1248,1252,1503,783,1254,1255,8,33,171,173,181,184,185,187,189,190,191,192,193,194,210,1589,554,170,171,172,173,180,181,183,184,186,187,189,190,191,192,193,194,198,205,210,1636,1636,1719,1719,654,659,699,141,333,334,335,928,1060,1256,1401,1532,1067,333,334,335,334,335,333,334,335,1066,1065,1066,1067,1545,1018,1026,1087,654,656,657,658,659,796,798,1075,1111,1483,798,961,616,1111,1359,198,199,200,201,200,201,199,171,172,208,1002,1003,1557,1349,1351,1360,1720,1075,1109,1295,1296,1297,1298,1636,1637,1638,1639,1640,1641,1642,1643,1644,1645,1646,1647,1648,1649,1650,1651,1652,1653,1654,1655,1656,1657,1658,1659,1660,1661,1662,1663,1664,1665,1666,1667,1668,1669,1670,1671,1672,1673,1674,1675,1676,1677,1678,1679,1680,1681,1682,1683,1684,1685,1686,1687,1688,1689,1690,1691,1692,1693,1694,1695,1696,1697,1698,1699,1700,1701,1702,1703,1704,1705,1706,1707,1708,1709,1710,1711,1712,1713,1714,1715,1716,1717,1718,1719,1720,1721,1722,1723,1724,1725,1726,1727,1728,1729,1730,1731,1732,1733,1734,1735,1736,1737,1738,1739,1740,1741,1742,1743,1744,1745,1746,1747,1748,1749,1750,1751,1752,1753,1754,1755,1756,1757,1758,1759,1760,1761,1762,1763,1764,1765,1766,1767,1768,1769,1770,1771,1772,1773,1774,1775,1776,1777,1778,1779,1780,1781,1782,1783,1784,1785,1786,1787,1788,1789,1790,1791,1792,1793,1794,1795,1796,1797,1798,1799,1800,1801,1802,1803,1804,1805,1806,1807,1808,1809,1810,1811,1812,1813,1814,1815,1816,1817,1818,1819,1820,1821,1822,1823,1824,1825,1826,1827,1828,1829,1830,1831,1832,1833,1834,1835,1836,1837,1838,1839,1840,1841,1842,1843,1844,1845,1846,1847,1848,1849,1850,1851,1852,1853,1854,1855,1856,1857,1858,1859,1860,1861,1862,1863,1864,1865,1866,1867,1868,1869,1870,1871,1872,1873,1874,1875,1876,1877,1878,1879,1880,1881,1882,1883,1884,1885,1886,1887,1888,1889,1890,1891,1892,1893,1894,1895,1896,1897,1898,1899,1900,1901,1902,1903,1904,1905,1075,1636,1637,1638,1639,1640,1641,1642,1643,1644,1645,1646,1647,1648,1649,1650,1651,1652,1653,1654,1655,1656,1657,1658,1659,1660,1661,1662,1663,1664,1665,1666,1667,1668,1669,1670,1671,1672,1673,1674,1675,1676,1677,1678,1679,1680,1681,1682,1683,1684,1685,1686,1687,1688,1689,1690,1691,1692,1693,1694,1695,1696,1697,1698,1699,1700,1701,1702,1703,1704,1705,1706,1707,1708,1709,1710,1711,1712,1713,1714,1715,1716,1717,1718,1719,1720,1721,1722,1723,1724,1725,1726,1727,1728,1729,1730,1731,1732,1733,1734,1735,1736,1737,1738,1739,1740,1741,1742,1743,1744,1745,1746,1747,1748,1749,1750,1751,1752,1753,1754,1755,1756,1757,1758,1759,1760,1761,1762,1763,1764,1765,1766,1767,1768,1769,1770,1771,1772,1773,1774,1775,1776,1777,1778,1779,1780,1781,1782,1783,1784,1785,1786,1787,1788,1789,1790,1791,1792,1793,1794,1795,1796,1797,1798,1799,1800,1801,1802,1803,1804,1805,1806,1807,1808,1809,1810,1811,1812,1813,1814,1815,1816,1817,1818,1819,1820,1821,1822,1823,1824,1825,1826,1827,1828,1829,1830,1831,1832,1833,1834,1835,1836,1837,1838,1839,1840,1841,1842,1843,1844,1845,1846,1847,1848,1849,1850,1851,1852,1853,1854,1855,1856,1857,1858,1859,1860,1861,1862,1863,1864,1865,1866,1867,1868,1869,1870,1871,1872,1873,1874,1875,1876,1877,1878,1879,1880,1881,1882,1883,1884,1885,1886,1887,1888,1889,1890,1891,1892,1893,1894,1895,1896,1897,1898,1899,1900,1901,1902,1903,1904,1905,636,1060,1168,636,816,759,1251,956,1258,756,1178,756,774,84,744,745,1530,212,212,212,270,635,970,971,972,973,975,1174,1180,9,654,192,11,17,229,43,229,962,6,1241,1174,1180,756,685,686,687,688,689,690,691,692,693,694,695,696,1140,1632,685,690,692,694,695,986,1118,12,84,1223,709,709,327,627,629,635,639,682,970,971,974,975,976,981,1119,1284,639,982,1098,1284,42,896,1047,896,896,208,1309,1310,1168,780,23,303,304,305,367,368,369,656,658,666,667,668,714,715,716,717,718,719,720,721,722,723,724,725,726,727,728,729,730,731,732,733,734,735,736,737,738,739,740,741,742,743,744,745,746,747,748,749,750,751,752,753,754,755,756,757,758,759,760,761,762,763,764,765,766,767,768,769,770,771,772,773,774,775,776,777,778,779,780,781,782,783,784,785,786,787,788,789,790,791,792,793,794,795,796,797,798,799,800,801,802,803,804,805,806,807,808,809,810,811,812,813,814,815,816,817,818,819,820,821,822,823,824,825,826,827,828,829,830,831,832,833,834,835,836,837,838,839,840,841,842,843,844,1111,216,1090,1095,1096,553,553,620,553,949,1174,1500,1501,1533,1563,1564,1565,1566,1567,1600,1675,1796,1428,1532,1593,127,128,129,264,265,266,1203,1427,1428,1429,1430,1431,1432,1433,1434,1435,1593,1386,1518,42,839,840,1595,358,359,1153,1186,940,883,802,1122,1470,1449,1488,1489,1490,1495,105,894,1302,1303,1333,706,1000,1001,1556,565,1724,1142,1244,1381,1635,1142,1246,755,1724,769,1573,1588,1592,65,754,755,767,1201,1724,1729,1825,1867,894,1381,1577,656,777,797,559,560,73,507,508,510,767,32,1098,643,102,626,914,924,932,934,1378,930,65,1058,79,80,87,258,259,260,79,80,87,258,259,260,65,1057,1058,714,715,716,717,718,719,720,721,722,723,724,725,726,727,728,729,730,731,732,733,734,740,741,743,827,1126,45,77,99,100,102,104,777,1085,192,954,954,658,855,156,364,365,1020,1030,1601,1601,447,448,906,908,1099,1398,1404,1406,712,751,921,1,2,1076,1384,1895,1370,1725,1725,1725,1211,1225,1250,1251,1036,577,1734,1734,577,1126,460,1126,1127,116,1092,1094,1098,1099,1100,1101,1102,1103,1104,1105,1116,1117,1121,1124,1125,1126,1127,1133,1134,1135,1136,1137,1138,1139,1140,1124,1330,1431,1529,1704,1756,669,871,300,301,302,744,102,954,31,47,83,83,903,510,513,517,524,525,526,527,528,1050,1641,343,344,1726,1727,1728,1352,646,74,1148,1193,1194,1626,1627,1628,1629,1632,1474,1194,231,234,246,248,250,252,255,507,511,515,1416,1417,1418,1367,1367,395,396,397,1186,1602,1603,1604,1605,1606,1607,1608,1609,1610,1611,1612,1613,1614,1615,1616,1617,1618,1619,1620,1621,1622,1623,1624,1625,1626,1627,1628,1629,1630,1631,1632,1633,1634,1635,1903,1728,1739,1728,684,1703,757,1703,684,127,128,129,169,181,186,188,203,206,208,258,259,260,261,262,263,264,265,266,267,268,269,273,274,275,279,280,281,264,265,266,267,268,269,63,1590,402,403,404,405,406,407,1730,1731,1731,1731,741,114,114,1732,1019,1021,1732,1732,132,1078,1080,1294,240,245,749,749,596,230,231,233,253,260,263,266,269,270,272,275,281,284,287,351,404,407,447,520,521,523,525,526,528,530,531,533,536,537,538,541,542,543,1079,1166,1192,1510,1636,244,452,1640,1733,4,819,825,826,830,831,832,1254,1255,1381,72,73,74,830,1148,1149,974,1068,1131,1034,848,845,846,847,848,1192,85,1092,1106,1157,1034,1034,1566,1734,1735,1737,833,905,1103,1108,592,1481,107,113,1905,1150,794,1636,146,1033,1086,1087,1279,1335,724,903,202,463,464,465,1098,1109,463,464,465,463,464,465,978,979,184,196,264,265,266,374,375,376,762,902,1034,1068,1078,1317,1545,1578,1580,1594,169,547,23,26,641,730,641,557,1063,1160,1161,1736,980,1738,1596,1596,291,292,293,1187,292,293,1187,703,257,256,861,724,714,714,1287,1317,1318,1319,1542,198,697,704,709,1077,676,22,86,1405,1404,1405,105,1019,1522,1523,659,1726,1738,1141,1738,61,147,648,649,709,724,742,750,782,800,822,938,1097,1264,1287,1529,1533,1535,1539,1543,1545,1589,1605,1614,698,1733,1733,742,61,1727,1727,1889,108,153,1522,1523,1636,1095,85,102,46,46,0,2,3,4,119,0,1,2,3,4,5,16,26,118,119,47,879,66,357,358,885,1186,61,1054,546,868,698,134,1287,1317,103,104,126,1740,1741,355,1736,1736,1741,1741,595,342,343,344,342,343,344,344,1740,1740,1730,1729,561,1735,1737,1742,1826,1729,1735,1737,1826,1215,1120,161,1048,232,236,254,343,347,1743,1743,1742,1743,478,479,480,487,487,487,488,489,801,774,801,877,1,2,4,6,7,120,127,235,238,239,240,241,242,243,245,246,247,248,249,250,251,252,253,254,270,405,909,1183,405,406,407,909,405,909,235,240,241,242,245,246,247,248,249,250,253,254,243,251,252,235,240,241,245,246,247,248,405,1748,1748,203,108,109,112,114,569,1063,1259,1405,13,370,264,265,266,453,454,455,766,1337,1340,1341,1408,604,1066,1140,30,31,169,170,171,172,173,174,175,176,177,178,179,180,181,182,183,184,185,186,187,188,189,190,191,192,193,194,196,197,198,199,200,201,202,203,205,207,208,209,211,212,264,265,266,267,268,269,270,271,272,273,274,275,507,508,509,510,1157,1168,1348,1408,1170,496,497,498,1120,822,29,169,188,202,203,204,205,206,207,208,267,507,508,509,510,1157,1228,207,1351,1337,974,110,1469,19,52,0,1,2,3,4,5,7,8,11,12,19,22,23,106,118,119,120,273,274,275,582,1050,7,98,218,346,1372,1224,1077,1550,838,1550,70,71,346,355,1070,1185,1186,1187,1188,1190,626,1338,624,103,869,1588,42,42,50,51,60,69,267,282,402,403,404,544,555,574,586,648,1387,352,1450,1451,1273,1274,1211,1211,356,1405,1374,142,221,288,289,290,875,927,1371,1373,1376,1528,288,289,290,1376,142,782,128,217,276,1657,1745,217,218,15,17,121,130,131,132,133,134,135,136,137,138,139,140,141,142,143,144,145,146,147,148,149,150,151,152,153,154,155,185,204,221,511,512,513,514,515,516,517,518,878,885,1134,1376,1508,135,221,140,134,14,136,137,1134,10,64,13,370,139,143,187,865,1513,1514,1515,1516,1517,1524,1527,1534,1535,1537,609,1179,1179,1180,1182,1179,1849,976,1367,169,547,1463,346,347,348,1189,1190,270,271,272,1582,96,622,704,581,1321,1322,1585,374,375,376,378,374,376,379,1661,509,1470,169,692,345,41,172,208,872,880,913,914,1055,1179,1182,1198,1505,1583,172,178,179,208,951,356,408,409,410,1177,1074,890,1461,353,354,688,1461,1463,1468,600,600,482,483,946,647,862,884,1271,199,1117,282,34,76,1746,457,458,470,471,1111,1121,842,1101,1102,587,1379,507,508,509,510,86,507,508,509,510,162,1109,1534,1245,94,520,521,522,523,524,525,526,527,528,529,530,531,532,533,534,535,536,537,538,539,540,541,542,543,548,870,871,1641,1746,1746,619,673,817,673,715,817,1744,641,1359,1448,1449,1093,203,1070,633,618,208,184,957,1447,50,1447,71,599,1201,1217,106,107,187,580,27,94,124,460,574,577,905,1361,288,875,878,927,1371,1528,5,10,64,98,505,593,594,739,769,779,791,804,805,806,820,821,904,1028,1060,1168,759,759,769,506,877,878,983,1172,1382,1383,904,879,985,986,1600,698,867,868,869,870,871,1378,568,698,868,449,449,1747,1748,1749,29,205,547,29,547,29,76,1522,255,256,257,268,269,271,272,289,290,292,293,295,296,298,299,301,302,304,305,307,308,310,311,313,314,316,317,319,320,322,323,325,326,328,329,331,332,334,335,339,341,347,348,409,410,473,474,475,477,485,486,508,509,510,515,517,518,520,521,522,523,524,525,526,527,528,529,530,531,532,533,534,535,536,537,538,539,540,541,542,543,544,545,546,548,1409,1413,593,594,156,1749,1749,23,1049,60,1372,1375,33,36,129,82,867,1140,696,1399,1356,68,1078,164,186,1574,1768,848,65,149,804,805,806,837,1102,1110,837,804,1759,1759,65,1254,1255,1578,1606,1618,1619,1620,1621,1622,1623,1624,1625,1411,1575,736,1257,1411,1575,1575,1587,1588,1589,1590,1591,1592,1593,1594,1595,1596,1597,1598,1599,1600,1601,1752,285,286,287,127,129,1349,1753,58,59,61,62,68,186,1235,642,106,107,158,424,426,428,1074,42,81,1143,110,142,42,94,164,357,358,359,429,430,431,432,433,434,435,436,437,438,439,440,449,453,454,455,502,503,504,506,545,546,709,960,1109,1413,1755,1288,1289,1290,1292,1293,1295,1296,1297,1298,231,234,507,72,1226,1290,1198,1505,1514,1287,1317,760,184,185,189,190,191,193,194,195,1311,1316,688,1755,353,354,791,1755,1756,1692,1703,1716,1724,1760,1764,1772,1841,1885,38,44,76,285,286,287,39,77,286,287,50,1751,1751,309,310,311,882,882,39,366,367,368,369,14,15,17,18,20,21,1518,164,1413,1574,270,271,272,1272,1574,864,222,60,60,1372,1236,1333,949,13,1237,1563,1564,1565,1566,1567,1633,1634,1635,670,671,672,673,674,675,676,677,678,679,681,682,1291,1632,75,1219,294,295,296,1201,1213,1215,1216,1217,1218,1219,1220,1222,1223,1224,220,1439,1441,1443,1445,1446,1128,845,846,847,848,1436,848,848,1506,1507,1520,181,951,848,66,41,116,1368,41,1546,1225,1226,1434,1211,1757,1758,1758,1757,1757,706,1726,1752,705,706,1752,760,122,1759,889,893,1467,1758,859,1409,1644,1678,1683,1689,1694,1700,1721,1723,1724,1739,1750,1756,1774,1793,1799,1813,1831,1844,1865,1891,1892,1689,1723,1891,1892,1844,1659,1683,1689,1721,1723,1739,1745,1750,1774,1793,1799,1831,1844,1865,1883,1885,1891,1892,1721,1754,41,1753,1753,980,1425,793,1760,768,1760,1413,1688,1688,129,1259,1764,449,1063,1726,1158,573,1461,1463,1762,1762,1817,1851,1174,798,850,873,892,1077,1764,112,113,345,687,787,788,789,792,795,796,800,823,850,855,873,883,886,1072,1073,1074,1075,1140,1161,1259,1280,1533,1585,1586,1587,1588,1589,1590,1591,1592,1593,1594,1595,1596,1597,1598,1599,1600,1601,1638,1764,843,844,659,205,1213,1217,1761,1155,663,1076,641,838,1761,891,1462,1194,1626,1627,1628,1629,1632,1193,1194,758,891,1462,1469,1470,801,1128,395,1762,1763,1308,460,618,444,445,446,441,1596,1403,25,1138,1643,1763,1763,0,1,2,3,4,7,12,23,120,1125,1764,891,1462,297,298,299,1107,844,499,500,501,499,500,501,499,500,501,833,835,1312,449,618,297,298,299,1354,1478,893,1073,742,798,892,618,1139,1587,1588,1589,1590,1591,1592,1593,1594,1595,1596,1597,1598,1599,1601,1210,1107,896,1585,1586,3,1632,1775,1775,1775,1765,774,795,1683,156,1765,1765,821,1334,1335,1336,1424,1550,1216,1237,1550,1551,1552,1553,1554,1555,1556,1557,1558,1559,1560,1561,1562,1766,1767,1471,1768,215,216,947,549,551,747,1426,128,1403,1074,1161,350,766,1184,1726,1684,1768,17,18,20,21,123,155,228,511,512,513,514,17,18,20,21,123,155,228,511,512,513,514,18,20,21,303,777,817,840,841,842,1119,567,620,1770,567,730,1821,730,1769,1182,417,418,419,417,418,419,420,421,422,839,840,842,1342,1146,1209,67,1147,1262,1263,1264,1265,1266,613,1184,1075,1585,1744,1771,1772,1771,1772,1897,1897,1772,838,1773,1773,1773,879,892,1766,1766,1775,315,316,317,1151,1365,1366,1276,1277,309,346,347,348,1368,1592,1103,1362,1185,244,257,675,1185,1510,675,675,1078,591,764,1260,1383,972,973,1867,901,1780,1780,1063,1259,1776,1776,1776,318,319,320,1234,26,598,634,1041,1534,1602,1603,1604,1605,1606,1607,1608,1611,1612,1613,1614,1615,1616,1617,1618,1619,1626,1627,1022,1027,1494,992,993,994,995,996,997,998,999,1000,1001,1002,1003,1004,1005,1006,1007,1008,1009,1010,1011,1012,1013,1014,1015,1397,1465,1563,1564,1567,1568,1570,1576,1579,1581,820,1785,1785,2,4,5,6,7,4,6,7,120,981,1394,756,1416,1417,1418,1420,696,297,298,299,336,337,338,929,930,956,1308,1354,1546,1548,697,704,709,1410,615,1777,1301,1184,704,706,707,708,709,1533,713,742,1096,291,880,1187,1262,1263,1265,708,709,1777,1777,1269,50,165,175,189,200,209,1226,1254,1303,1304,1305,1306,1424,1443,1444,1445,1447,1448,1449,1456,1492,1493,1494,803,175,175,178,200,1444,1448,1454,1455,1486,1487,1443,1444,1445,214,215,763,337,338,929,930,956,1187,1307,1308,1546,1548,392,747,718,718,1325,570,1476,1853,1853,573,508,514,518,529,530,531,532,533,1641,1782,1515,1872,1872,130,1288,1289,1290,1291,1292,1293,1299,1568,1570,1574,1576,1579,1581,1563,1564,1567,1692,1703,1716,1724,1760,1764,1772,1841,1885,742,782,1208,1583,449,449,508,510,513,514,517,518,524,525,526,527,528,529,530,531,532,533,1050,1512,1641,1642,1512,1642,1779,48,1781,1781,887,1202,1354,1478,1262,1263,1264,1265,1266,1267,1786,1786,1270,1411,1546,23,23,48,1779,1779,898,962,1367,177,1379,478,479,480,478,479,480,149,635,917,956,957,958,1063,1256,1257,1258,1259,1505,1642,1260,1039,1045,1055,2,14,15,17,18,20,121,130,131,133,134,135,136,137,138,143,145,146,147,148,150,155,196,508,509,510,511,513,514,515,517,518,878,885,215,180,719,985,1427,1428,1593,41,1525,1290,1324,1356,1324,1356,570,655,1476,229,1192,23,33,36,155,228,155,1192,10,832,1414,831,1530,217,217,1060,163,1263,1267,1783,1783,1330,1413,1431,1413,1431,182,644,646,595,1310,753,665,848,849,1321,1322,1331,1332,1333,1334,1335,1336,1358,1331,1333,1334,1424,1424,1333,911,866,1141,1529,4,6,7,815,814,815,907,41,48,113,1221,1385,1417,102,225,226,261,1486,1487,1540,1541,1184,938,1640,1284,1640,1640,1391,502,503,504,688,1198,1199,93,1199,1383,14,15,17,18,20,121,130,131,132,133,134,135,136,137,138,139,141,143,145,146,147,148,150,155,185,186,204,508,509,510,511,512,513,514,515,516,517,518,519,690,878,885,131,515,121,1196,1197,1232,1504,209,1303,1304,1305,1306,1441,1443,1564,1574,1296,1298,1781,1782,1783,1784,1778,184,460,569,577,706,1078,1121,1126,1127,184,706,1115,984,1424,866,1348,770,787,839,222,141,1784,1784,1785,1786,48,1542,1576,181,1787,1861,723,1798,1798,1798,1794,1794,117,1126,1230,1412,69,102,103,104,157,166,1792,1792,1254,1255,380,381,382,1462,682,159,380,605,606,1024,1034,1068,1070,1121,1122,1123,1133,1134,1135,1136,1138,1186,383,392,393,394,395,1361,851,1361,1254,1255,1368,1254,1255,1139,233,1477,130,1289,1290,1291,1292,1293,1294,1295,1296,1297,1298,1299,1295,1296,1297,1298,1299,1349,1360,738,1192,681,1806,1806,1808,1808,1805,1805,232,234,236,238,240,241,242,243,254,255,256,259,262,265,268,271,274,277,280,283,286,289,292,295,298,301,304,307,310,313,316,319,322,325,328,331,334,337,340,343,347,350,353,355,357,358,361,368,371,375,378,381,384,387,390,393,396,399,403,406,409,415,418,425,431,437,442,448,449,451,454,457,464,467,470,473,476,479,482,485,488,491,494,497,500,503,509,510,511,512,513,515,516,517,520,521,522,523,524,525,526,527,528,534,535,536,537,538,542,548,590,1175,1416,1511,1512,1795,1795,881,1172,631,833,1803,1803,1721,598,232,234,235,236,237,238,240,241,242,243,254,255,256,259,262,265,268,271,274,277,279,280,283,286,289,292,295,298,301,304,307,310,313,316,319,322,325,328,331,334,337,340,343,347,350,352,353,355,357,358,361,364,368,371,375,378,381,384,387,390,393,396,399,403,406,409,413,415,418,422,425,426,431,432,437,438,442,446,448,449,451,454,457,464,467,470,473,476,479,482,485,488,491,494,497,500,503,509,510,511,512,513,515,516,517,519,520,521,522,523,524,525,526,527,528,534,535,536,537,538,548,1175,1416,1511,1754,312,313,314,717,762,722,210,1309,1175,544,991,356,435,436,437,438,439,440,943,1754,1175,355,849,850,1322,707,1222,441,442,443,1113,1799,1854,139,155,873,1275,1276,1321,1456,1519,1520,1521,1522,1523,1524,1533,1534,1535,1536,1537,1538,1539,1542,1548,1583,1637,1275,1287,357,360,361,362,509,511,513,514,515,517,518,885,1193,1511,1793,1793,613,618,879,1107,1724,1791,826,1800,1800,374,377,1408,773,58,112,113,1112,1141,1141,19,52,279,402,403,404,402,1285,822,836,1244,1325,1326,1513,1514,1515,1516,1517,315,316,317,1132,836,1801,1801,1804,634,1804,1817,1851,1899,738,1788,767,1657,1745,766,1542,288,289,290,188,1790,839,43,1585,1586,1587,1588,1589,1590,1591,1592,1593,1594,1595,1596,1597,1598,1599,1600,1601,762,763,764,765,766,770,779,800,775,893,306,307,308,1360,213,214,1084,1086,1087,1088,1089,1084,58,875,1377,1528,58,704,875,1371,1372,1373,1374,1376,1377,1528,192,502,502,503,504,688,774,775,1033,1197,1609,1610,1620,1621,1622,1623,207,1200,80,1199,1200,38,39,44,76,77,1710,1716,715,10,780,10,1307,1314,1307,234,236,238,240,241,242,243,254,255,256,259,262,265,268,271,274,277,280,283,286,289,292,295,298,301,304,307,310,313,316,319,322,325,328,331,334,337,340,343,347,350,353,357,358,361,368,371,375,378,381,384,387,390,393,396,399,403,406,409,415,418,425,431,437,442,448,449,451,454,457,464,467,470,473,476,479,482,485,488,491,494,497,500,503,509,510,511,512,513,515,516,517,520,521,522,523,524,525,526,527,528,534,535,537,548,1416,1511,142,1469,1416,1372,1416,567,568,389,85,1485,389,848,389,390,391,389,390,389,905,389,391,163,165,187,1279,1035,1317,1318,1319,916,1576,771,772,773,1807,1130,1807,1792,1207,1210,602,892,684,1722,1722,1799,684,1207,1210,1368,1077,992,173,184,191,192,880,1470,192,992,37,1636,1637,689,1084,1189,366,367,368,369,582,585,818,819,834,833,1036,889,69,503,504,563,926,1240,1240,1339,926,1435,1515,1830,203,1408,1131,1380,11,24,25,27,127,1795,1796,1797,1409,1225,1226,1434,1506,1508,1509,432,434,436,438,440,1375,111,1508,1391,701,826,827,857,859,1789,1789,1025,667,548,834,1788,349,28,185,876,1078,1169,1278,1279,1280,1281,1282,1283,1284,1285,1287,1317,1318,1412,1526,1527,1278,1278,1797,1797,1234,127,128,129,555,556,720,1595,153,75,920,108,109,110,112,113,114,115,116,117,401,1790,1790,1587,1587,1802,1802,1788,582,585,330,331,332,799,1016,1017,1018,1019,1020,1021,1022,1023,1024,1025,1026,1027,1030,1077,1587,799,1030,575,1514,899,900,902,988,1031,1038,1787,1787,864,1187,889,893,681,366,372,519,520,521,522,523,529,530,531,532,533,539,540,541,542,543,548,1048,529,530,531,532,533,942,968,941,965,968,941,935,429,430,431,432,433,434,944,951,855,484,485,486,852,853,854,855,896,899,921,978,899,601,602,603,1238,1389,602,1389,72,236,1525,1,2,4,5,28,30,31,36,38,39,40,62,66,77,81,87,90,95,105,118,129,227,228,40,408,441,469,481,484,945,926,783,1245,1246,1247,1248,1503,1503,1294,1409,1809,1809,1800,804,1801,372,916,1802,1803,1804,820,828,829,829,576,134,1206,1513,1538,1513,1538,499,500,501,94,124,212,212,1142,1143,712,751,321,322,323,1201,1204,1205,1206,1207,1208,1209,1210,1211,1212,1213,1214,1215,1216,1217,1218,1219,1220,1221,1222,1223,1224,1485,1566,1633,1204,1205,1206,1216,321,322,323,715,352,889,893,1467,236,1525,40,129,1195,1203,1434,1509,1195,1203,73,1805,1806,373,1807,1808,1796,1796,401,578,648,649,642,1809,1810,756,210,1893,208,1532,1810,1810,257,54,798,980,981,850,1638,1645,1646,1647,1648,1649,1650,1651,1652,1653,1654,1655,1656,1657,1658,1659,1660,1661,1662,1663,1664,1665,1666,1667,1668,1669,1670,1671,1672,1673,1674,1675,1676,1677,1679,1680,1681,1682,1683,1684,1685,1686,1687,1688,1689,1690,1691,1692,1693,1696,1697,1698,1699,1700,1701,1702,1703,1705,1706,1707,1708,1709,1711,1712,1713,1714,1715,1716,1717,1719,1720,1721,1722,1723,1724,1725,1726,1727,1728,1729,1730,1731,1732,1733,1734,1735,1736,1737,1738,1739,1740,1741,1742,1743,1744,1746,1747,1748,1749,1750,1751,1752,1753,1754,1755,1756,1757,1758,1759,1760,1761,1762,1763,1764,1765,1766,1767,1768,1769,1770,1771,1772,1773,1774,1775,1776,1777,1778,1779,1780,1781,1782,1783,1784,1785,1786,1787,1788,1789,1790,1792,1793,1794,1795,1796,1797,1798,1799,1800,1801,1802,1803,1804,1805,1806,1807,1808,1809,1810,1811,1812,1813,1814,1815,1816,1817,1818,1819,1820,1821,1822,1823,1824,1825,1826,1827,1828,1829,1830,1831,1832,1833,1834,1835,1836,1837,1838,1839,1840,1841,1842,1843,1844,1845,1846,1847,1848,1849,1850,1852,1853,1854,1855,1856,1857,1858,1859,1860,1861,1862,1863,1865,1866,1867,1868,1869,1870,1871,1872,1873,1874,1875,1876,1877,1878,1879,1880,1881,1882,1885,1886,1887,1888,1889,1890,1891,1892,1893,1894,1895,1896,1897,1898,1899,1900,1901,1902,860,1884,127,128,129,555,556,557,558,559,560,561,562,563,564,565,566,567,568,569,570,571,572,573,574,575,576,577,578,579,580,581,582,583,584,585,586,587,588,589,590,591,592,593,594,595,596,597,598,599,600,601,602,603,604,605,606,607,608,609,610,611,612,613,614,615,616,617,618,619,620,621,622,623,624,625,626,627,628,629,630,631,632,633,634,635,636,637,638,639,640,641,642,643,644,645,646,647,648,649,650,651,652,653,654,655,656,657,658,659,660,661,662,663,664,665,666,667,668,669,670,671,672,673,674,675,676,677,678,679,680,681,682,683,684,685,686,687,688,689,690,691,692,693,694,695,696,697,698,699,700,701,702,703,704,705,706,707,708,709,710,711,712,713,715,717,718,721,724,725,726,728,731,733,735,794,852,853,854,855,860,866,871,1016,1017,1018,1019,1020,1021,1022,1023,1025,1026,1027,1029,1030,1031,1038,1048,1050,1062,1072,1073,1076,1819,1819,68,61,68,851,1407,1093,147,1812,1156,1191,1153,1144,1145,1371,110,1592,1539,1568,1569,1570,1579,1581,1318,657,1818,1818,74,74,1148,46,78,88,89,90,91,134,229,710,711,710,711,1132,1108,1674,1816,38,148,231,234,255,507,511,515,1770,887,931,1016,1025,1073,1530,1577,1811,1821,1826,230,1273,1274,1273,1274,887,1440,1490,1095,265,266,1578,1815,1894,1302,1333,1815,1815,371,1812,1814,1814,1812,56,897,898,903,1016,1017,1018,1019,1020,1021,1022,1023,1024,1025,1026,1027,1030,1033,1034,1035,1036,1066,1258,1435,1537,1010,1011,1469,1561,345,345,1820,1820,1816,40,96,127,128,129,197,243,251,252,264,265,266,892,1203,1232,1298,1427,1428,1429,1430,1431,1432,1433,1434,1435,1538,1539,1578,1601,1817,349,51,1198,1198,23,1432,210,507,76,792,793,792,992,265,266,1813,1438,1439,1445,1771,1794,1799,1439,1726,1799,1445,1446,1678,1817,1817,48,72,102,113,217,219,589,597,914,127,128,129,264,265,266,986,1203,1427,1428,1429,1430,1431,1432,1433,1434,1435,1588,130,1205,1206,1280,1281,1282,1283,1284,1307,1314,1566,1234,1261,1268,1269,1314,1205,1206,1261,1268,1269,1592,1202,1203,1263,129,1818,1819,1435,1820,1436,1552,1487,1550,1562,156,1552,1553,1554,1555,1556,1557,1558,1559,1560,1561,1562,1565,1565,288,289,290,1371,1419,366,367,368,369,698,746,748,1351,746,81,992,994,996,998,1000,1002,1004,1006,1008,1010,1012,1014,1063,1534,1579,1579,781,383,384,1148,1149,1150,1151,1152,1153,1154,1155,1156,1157,1158,1159,1160,1161,1162,1163,1164,1165,1166,1167,1168,1169,1170,1171,1172,1173,1174,1175,1176,1177,1178,1179,1180,1181,1182,1183,1184,1185,1186,1187,1188,1189,1190,1191,1192,1193,1194,1195,1196,1197,1198,1199,1200,1201,1202,1203,1204,1205,1206,1207,1208,1209,1210,1211,1212,1213,1214,1215,1216,1217,1218,1219,1220,1221,1222,1223,1224,1225,1226,1227,1228,1229,1230,1231,1232,1233,1234,1235,1236,1237,1238,1239,1240,1241,1242,1243,1244,1245,1246,1247,1248,1249,1250,1251,1252,1253,1254,1255,1256,1257,1258,1259,1260,1261,1262,1263,1264,1265,1266,1267,1268,1269,1270,1271,1272,1273,1274,1275,1276,1277,1278,1279,1280,1281,1282,1283,1284,1285,1286,1287,1288,1289,1290,1291,1292,1293,1294,1295,1296,1297,1298,1299,1300,1301,1302,1303,1304,1305,1306,1307,1308,1309,1310,1311,1312,1313,1314,1315,1316,1317,1318,1319,1320,1321,1322,1323,1324,1325,1326,1327,1328,1329,1330,1331,1332,1333,1334,1335,1336,1337,1338,1339,1340,1341,1342,1343,1344,1345,1346,1347,1348,1349,1350,1351,1352,1353,1354,1355,1356,1357,1358,1359,1360,1361,1362,1363,1364,1365,1366,1367,1368,1369,1370,1371,1372,1373,1374,1375,1376,1377,1378,1379,1380,1381,1382,1383,1384,1385,1386,1387,1388,1389,1390,1391,1392,1393,1394,1395,1396,1397,1398,1399,1400,1401,1402,1403,1404,1405,1406,1407,1408,1409,1410,1411,907,634,1590,467,468,652,653,654,657,658,659,660,662,666,667,1062,1112,1756,992,994,996,998,1000,1002,1004,1006,1008,1010,1012,1014,959,660,1550,795,7,110,120,170,187,703,738,764,778,779,819,850,887,1372,1395,1459,1462,1463,1588,1592,1754,972,1195,1203,1313,1509,174,175,177,312,313,314,872,873,874,1270,1272,1309,336,337,338,1140,1800,112,124,183,953,1260,586,589,35,180,196,264,265,266,267,268,269,1535,1536,1537,1580,1594,180,1580,1058,242,249,250,255,256,257,869,1336,1633,255,256,257,985,986,1229,1241,1249,1253,732,732,1461,1822,1822,1822,94,129,1461,789,6,105,141,187,762,1054,1178,1456,1487,199,924,930,932,934,26,37,273,274,275,593,940,994,995,1163,1197,1435,1487,1553,112,789,745,904,89,95,96,160,1,2,4,5,29,31,62,81,84,87,90,118,205,1052,1263,1297,1298,1310,1332,1452,1453,1486,1487,1600,1381,1600,1600,647,1484,1240,1242,1243,339,1491,1586,145,717,737,901,1093,1266,1419,1508,1509,1544,1584,1587,1588,1592,1594,1595,1600,1603,1612,1626,1628,558,980,1218,1275,808,220,221,222,1311,1329,851,1530,139,1521,1522,1523,1466,676,637,616,24,25,27,67,227,803,1292,856,895,115,981,330,1032,1291,19,1522,1523,1634,1883,1885,30,31,105,899,902,1037,64,1487,633,1588,581,582,583,584,585,1473,583,668,803,992,994,996,998,1000,1002,1004,1006,1008,1010,1012,1014,1581,1199,1210,1823,1294,1078,984,1314,1315,964,1104,469,1331,1332,778,1270,1272,1113,1229,803,1396,229,88,324,325,326,1143,1305,324,325,326,324,1142,1143,1305,508,509,510,511,513,514,515,517,518,1159,1205,1828,1828,1835,1835,1833,1833,324,325,326,1143,169,171,172,174,175,176,177,282,283,284,701,733,206,777,778,1823,1823,759,759,614,1073,1155,1165,1078,687,1236,1259,1261,1268,1269,1270,1271,1272,1273,1274,1301,1307,1395,1518,1323,1324,1324,1826,974,1836,1836,974,683,1054,1294,1271,534,535,536,537,538,539,540,541,542,543,551,552,520,521,522,523,524,525,526,527,528,529,530,531,532,533,548,549,550,860,894,906,907,908,1581,405,406,407,638,173,1542,1038,71,768,809,824,828,829,830,910,1069,1070,1071,1122,1130,1131,71,450,451,452,156,1083,1535,915,966,967,969,1596,141,1421,1422,1331,1335,1336,793,798,809,810,811,812,929,961,115,1491,1499,620,1137,1278,1284,1285,1412,1527,1234,1824,750,183,629,1468,726,637,637,746,746,725,668,834,408,409,410,1426,1433,1433,225,32,32,411,209,1302,1303,1304,1333,1301,1307,1301,628,53,169,170,171,172,173,174,175,176,177,178,179,180,181,182,183,184,185,186,187,188,189,190,191,192,193,194,195,196,197,198,199,200,201,202,203,204,205,206,207,208,209,210,211,212,213,214,215,216,217,218,219,220,221,222,223,224,225,226,227,228,229,230,231,232,233,234,235,236,237,238,239,240,241,242,243,244,245,246,247,248,249,250,251,252,253,254,255,256,257,258,259,260,261,262,263,264,265,266,267,268,269,270,271,272,273,274,275,276,277,278,279,280,281,282,283,284,285,286,287,288,289,290,291,292,293,294,295,296,297,298,299,300,301,302,303,304,305,306,307,308,309,310,311,312,313,314,315,316,317,318,319,320,321,322,323,324,325,326,327,328,329,330,331,332,333,334,335,336,337,338,339,340,341,342,343,344,345,346,347,348,349,350,351,352,353,354,355,356,357,358,359,360,361,362,363,364,365,366,367,368,369,370,371,372,373,374,375,376,377,378,379,380,381,382,383,384,385,386,387,388,389,390,391,392,393,394,395,396,397,398,399,400,401,402,403,404,405,406,407,408,409,410,411,412,413,414,415,416,417,418,419,420,421,422,423,424,425,426,427,428,429,430,431,432,433,434,435,436,437,438,439,440,441,442,443,444,445,446,447,448,449,450,451,452,453,454,455,456,457,458,459,460,461,462,463,464,465,466,467,468,469,470,471,472,473,474,475,476,477,478,479,480,481,482,483,484,485,486,487,488,489,490,491,492,493,494,495,496,497,498,499,500,501,502,503,504,505,506,507,508,509,510,511,512,513,514,515,516,517,518,519,520,521,522,523,524,525,526,527,528,529,530,531,532,533,534,535,536,537,538,539,540,541,542,543,544,545,546,547,548,549,550,551,552,553,554,926,1433,739,740,768,1566,1222,156,180,450,499,321,1141,1372,1518,1421,96,96,203,208,231,234,235,237,246,248,250,252,253,254,255,258,261,264,267,270,273,276,279,282,285,306,307,308,349,352,355,357,358,360,365,369,402,405,408,411,412,413,414,417,420,423,424,429,430,435,436,441,444,449,453,456,459,463,466,469,472,475,478,481,484,487,493,496,499,502,505,506,544,545,546,1413,1234,1824,1824,677,681,682,619,677,559,560,563,567,568,569,604,605,606,620,1366,954,954,1827,735,1373,52,91,102,1827,642,188,211,1225,1226,1227,1228,1231,1434,1506,1508,1509,1434,852,853,854,855,856,858,859,860,861,868,883,886,894,895,896,898,899,900,901,902,903,905,907,908,1035,1036,1050,1065,1077,1250,1251,1142,1250,1251,288,289,290,315,316,317,1460,355,1216,282,1183,1339,1340,1339,1410,741,936,716,1394,1142,812,810,1128,1137,1163,1223,801,1830,586,587,588,589,765,587,110,1267,1373,327,328,329,1099,1321,1322,1392,1130,181,182,699,1073,721,1104,956,1104,134,135,137,144,269,686,798,800,1051,1079,1167,1591,1642,48,1099,1223,109,638,1639,1643,656,1483,1120,756,774,1831,1531,768,733,1130,1828,1829,1410,861,1085,1087,1088,1089,1413,1459,1637,845,846,847,848,849,850,851,852,853,854,855,856,857,858,859,860,861,862,863,864,865,866,867,868,869,870,871,872,873,874,875,876,877,878,879,880,881,882,883,884,885,886,887,888,889,890,891,892,893,894,895,896,897,898,899,900,901,902,903,904,905,906,907,908,909,910,911,912,913,914,915,916,917,918,919,920,921,922,923,924,925,926,927,928,929,930,931,932,933,934,935,936,937,938,939,940,941,942,943,944,945,946,947,948,949,950,951,952,953,954,955,956,957,958,959,960,961,962,963,964,965,966,967,968,969,970,971,972,973,974,975,976,977,978,979,980,981,982,983,984,985,986,987,988,989,990,991,992,993,994,995,996,997,998,999,1000,1001,1002,1003,1004,1005,1006,1007,1008,1009,1010,1011,1012,1013,1014,1015,1016,1017,1018,1019,1020,1021,1022,1023,1024,1025,1026,1027,1028,1029,1030,1031,1032,1033,1034,1035,1036,1037,1038,1039,1040,1041,1042,1043,1044,1045,1046,1047,1048,1049,1050,1051,1052,1053,1054,1055,1056,1057,1058,1059,1060,1061,1062,327,328,329,970,971,972,973,845,846,847,1016,1017,1018,1019,1020,1021,1022,1023,1025,1026,1027,1030,1032,330,331,332,1032,1313,1315,685,686,689,690,691,692,693,694,695,697,698,699,700,701,702,703,704,705,706,707,708,709,712,714,715,716,717,718,720,721,723,724,725,726,727,728,731,735,738,739,740,742,744,745,748,794,871,1072,1073,720,1374,839,918,116,906,1099,1113,1117,1124,1125,1127,1138,1139,1488,1489,1491,1493,475,476,477,24,25,27,227,616,906,908,493,494,495,496,497,498,1138,1140,1124,1129,85,208,2,19,52,160,1233,635,306,307,308,1386,1643,1386,1514,1129,1826,750,1207,1212,189,190,191,193,194,195,1359,1439,1445,1495,1589,1181,392,393,394,1470,1544,1630,1631,189,190,191,193,194,195,1226,1254,1255,1317,1438,1440,1442,1444,1450,1451,1488,1489,1490,1491,1492,1493,1494,1495,1496,1497,1498,1630,1631,156,108,109,83,1126,1133,1134,1135,1136,1138,1829,612,909,1111,1637,336,337,338,929,930,956,336,337,336,338,210,1829,882,493,494,495,1154,1544,1825,1825,1104,110,563,472,494,495,1121,110,157,833,783,1070,783,824,765,764,1400,781,1834,1834,502,503,504,1317,873,874,1201,1410,1637,873,1201,1288,1295,1296,1297,1298,1299,779,780,817,821,1414,1432,736,767,794,801,698,1385,1171,763,1283,1550,832,103,103,126,261,262,263,198,349,1123,1231,1233,965,202,203,1461,24,25,27,43,666,797,208,417,418,419,420,421,422,206,208,1191,1459,1692,363,363,364,365,363,1080,1287,1317,1318,1319,1542,786,962,1273,1274,208,178,179,22,72,670,757,1444,1494,1276,102,508,510,513,514,517,518,524,525,526,527,528,529,530,531,532,533,1050,1512,1641,1642,1050,1554,1555,1557,1559,350,351,1859,553,620,1272,1236,620,1331,1332,1333,1334,1427,1599,339,1331,1085,423,425,427,1355,1425,105,288,289,290,294,295,296,1212,1249,319,320,863,960,1593,127,128,129,264,265,266,1203,1427,1428,1429,1430,1431,1432,1433,1434,1435,1593,1247,1286,802,1193,173,213,214,342,1150,1152,1189,1347,1408,1410,12,22,86,102,637,1859,1124,1122,1834,828,829,1435,914,918,922,1199,383,384,1102,816,1832,161,658,62,135,134,221,198,954,1063,1179,198,199,827,139,1519,1520,1521,1522,1523,1524,1525,1392,291,292,293,85,559,620,1172,154,688,106,107,138,150,735,1122,1417,1470,1472,1473,1474,1475,1476,1477,1478,1479,1480,1481,1482,1483,1484,1575,1607,1616,181,1169,1170,946,178,179,1321,1322,1413,370,1128,76,1835,1836,647,1837,1837,1837,1018,1022,1026,1027,1218,1205,351,1184,1641,1401,273,1520,1521,1522,1283,30,33,40,1195,1203,1509,95,156,985,1307,183,1547,605,606,606,566,442,443,460,485,486,940,941,1636,460,577,442,443,460,577,940,941,1636,1097,1097,1105,1436,1587,1212,1370,1633,1436,752,103,917,912,912,911,912,913,914,915,917,918,921,952,977,1039,1042,1043,1050,1051,1052,1053,1054,1050,1641,1053,1053,37,170,171,172,173,198,203,273,274,275,1295,1297,203,273,274,275,590,1472,792,798,300,301,302,1127,1485,765,603,1287,1377,1029,947,1390,1262,1263,1264,1265,1266,1383,642,1345,1286,1226,1290,1293,1228,1506,1318,1240,1245,1247,1248,1252,1253,1261,1268,1486,1501,1503,1223,1207,142,1317,935,195,142,1529,1529,64,103,112,113,139,143,158,240,245,246,447,690,723,727,825,875,886,933,1069,1078,1139,1140,1232,1259,1262,1322,1428,1495,1497,1519,1520,1521,1524,1534,1538,1568,1569,1570,1571,1579,1582,1593,1596,1598,1599,1601,1602,1611,1630,1631,1637,1687,1905,240,245,769,1197,106,662,1380,1380,1418,1453,349,285,1692,1703,1716,1724,1760,1764,1772,1841,1885,1547,915,580,402,453,828,829,904,19,52,5,47,47,22,52,91,888,889,890,891,892,893,1191,1408,1459,1461,1462,1463,1464,1465,1466,1467,1469,1470,1471,1191,1459,1452,1081,1060,1404,1515,1538,1708,306,307,308,1452,1486,1487,1345,1448,644,646,1684,1685,1686,1702,1708,1758,1776,1789,1862,1880,1890,1595,962,1190,316,317,1589,86,963,937,35,279,280,281,417,418,419,279,222,1225,54,506,1382,839,1428,1593,1435,1385,1414,1416,1417,1418,1420,116,1448,1449,1454,1486,1838,1529,1492,1493,192,1493,1120,136,956,1493,651,599,599,1221,132,1079,1081,1696,1696,1832,703,788,789,790,791,796,823,1077,28,75,1278,945,1832,166,174,190,201,411,412,413,420,421,422,424,426,428,430,432,434,436,438,440,444,445,446,1255,1439,1440,1441,1447,1448,1449,1450,1451,1456,1488,1489,1490,1491,174,174,179,201,1226,1440,1449,1450,1451,1457,1485,1486,1487,1440,1441,1449,201,1488,173,962,1193,1032,1202,1203,1356,1404,1405,1406,872,1287,1839,677,951,960,571,572,794,117,37,187,321,322,323,456,457,458,865,1116,1215,1392,1409,321,322,323,330,331,332,981,321,322,323,1111,1528,601,602,603,607,608,1389,6,1643,1421,45,754,1274,1395,1274,908,949,908,6,45,1316,1242,1243,742,130,131,155,511,512,513,514,515,516,517,518,685,885,1193,1194,1839,1839,618,889,453,454,455,875,1416,1417,623,749,752,1147,979,1191,690,691,689,1227,1449,1453,956,6,682,202,905,1322,1452,1534,1603,1604,1605,1607,1608,1609,1610,700,867,469,470,471,469,470,471,343,344,350,351,1184,349,884,1184,1840,1841,1330,1194,1173,192,449,1096,1325,1326,1433,831,441,1362,441,442,443,1176,161,441,442,443,444,445,446,1113,1176,90,1132,1841,1132,1841,935,1842,1842,1842,1838,1838,76,95,767,909,1167,1175,1180,1182,1185,1190,1416,1417,1883,1892,1903,1904,1586,1674,141,22,53,78,79,80,85,86,91,92,93,97,98,99,107,125,140,258,259,260,53,78,97,125,579,596,346,962,1150,1152,1392,1346,1480,1714,858,1714,963,963,371,1670,1724,1770,1778,1830,1849,1889,1530,823,686,782,1277,1278,1284,1591,876,1169,1280,1281,1282,1283,1285,1317,1318,1412,1526,1527,402,403,404,909,447,785,1904,35,173,35,1860,1860,1854,1655,1896,1655,1896,855,1854,857,985,986,1174,1180,1174,1180,770,774,1739,322,903,371,372,373,1859,1744,1798,9,10,43,44,181,1162,1162,1695,1113,942,796,270,271,272,1173,980,1370,4,1032,1032,843,982,1843,453,454,455,650,769,1241,1275,1276,962,23,23,1348,1213,1213,544,1845,1208,1354,297,298,299,1354,1478,31,32,89,94,124,1156,109,112,113,114,1077,1490,1494,1381,37,992,993,994,995,996,997,998,999,1000,1001,1002,1003,1004,1005,1006,1007,1008,1009,1010,1011,1012,1013,1014,1015,1312,1313,1315,758,291,292,293,295,296,723,880,923,1173,1187,1301,1325,1426,1364,1365,1368,1369,1460,315,316,317,1151,1327,942,947,156,1204,1205,1206,1211,680,1479,680,1479,680,1479,831,1726,1904,1904,1147,1530,1530,94,124,94,124,1234,1235,1503,1350,1351,1350,1525,1540,1271,95,96,1112,1846,1858,1847,389,466,467,468,652,653,654,655,658,659,660,661,662,667,798,961,963,1062,665,666,795,796,655,36,1254,1255,661,1056,1057,1058,975,1384,1088,11,31,36,194,1333,1334,1599,1334,1331,1332,1333,1334,1347,1411,1427,127,225,226,1078,697,697,561,211,1359,958,938,788,1855,1855,255,256,257,1066,1168,1291,1292,1255,1840,1840,502,503,504,44,105,647,1484,804,303,304,305,562,983,1586,1326,1383,1006,1007,1559,1144,1145,43,229,1845,1845,1848,34,545,546,1016,188,207,785,1222,49,50,51,207,778,84,1391,705,1447,1540,1544,1578,1602,1606,1609,1610,1618,1619,1620,1621,1622,1623,1624,1625,1626,1627,1628,1629,1630,1631,1632,1634,1635,15,121,1162,659,1390,1390,805,774,703,700,590,591,1204,661,669,666,33,82,33,1347,1533,225,1066,1068,1034,913,914,892,1068,470,471,961,963,964,965,966,967,968,969,981,1531,591,1294,1113,1153,1154,1167,110,110,30,31,49,69,83,89,94,1175,1176,1178,1179,1180,1181,1182,1176,1179,1180,1181,1182,161,176,159,1120,1035,879,909,879,881,1155,1160,1167,1169,1170,1171,1172,1285,1402,881,810,1165,1533,831,1371,544,544,1363,1249,42,505,1387,1388,845,846,847,112,401,666,797,892,712,285,286,287,285,285,286,287,1485,33,33,981,1105,12,32,84,1850,58,59,61,62,63,68,95,96,100,1371,1373,44,54,913,929,931,933,1447,1853,47,1258,28,157,168,169,180,183,186,187,188,196,197,199,202,205,959,960,1055,1280,1281,1282,1283,1287,1410,1412,1413,1418,1425,1426,1428,1429,1430,1436,1437,1468,1472,1473,1474,1475,1476,1477,1478,1479,1480,1481,1482,1483,1484,1510,1511,1512,1513,1514,1515,1516,1517,1518,1527,1546,1547,1548,1550,1571,1572,1573,1575,1577,1578,1580,1581,1582,1583,1585,1586,1587,1588,1589,1590,1591,1592,1593,1594,1595,1596,1597,1598,1599,1600,1601,957,958,1370,1506,1507,1582,352,1461,1463,1471,31,33,36,40,82,1195,1196,1509,40,1195,1203,1508,544,545,546,850,546,679,9,23,25,641,153,1088,1279,840,85,544,1207,1210,1848,1848,321,322,323,1206,1210,226,1487,1113,1674,1861,371,236,956,975,1384,1004,1005,1470,1558,181,182,1852,948,949,1110,948,1110,108,224,1377,37,77,44,77,1325,1326,795,800,461,462,978,979,1114,461,1114,499,500,501,777,778,345,1490,1494,1160,1114,1099,108,109,1643,355,617,901,1019,1024,1031,1036,1037,1050,1597,974,898,1203,1248,210,1115,1115,54,56,168,506,1016,1017,1018,1019,1020,1021,1022,1023,1024,1025,1026,1027,1030,1382,56,168,506,54,56,57,99,101,168,1115,339,340,341,768,810,906,1208,8,79,1178,1178,1126,615,1852,1852,1852,1850,1850,615,645,669,669,566,26,137,181,182,666,971,1040,1171,1495,1497,1564,1622,1623,1624,1625,1628,1629,1630,1631,1218,220,1225,1434,219,1430,219,617,282,0,1,2,3,4,5,8,9,11,12,13,15,16,19,21,22,23,24,25,27,29,43,73,106,118,119,121,122,0,1,2,12,19,118,1030,1031,0,1,2,3,4,5,6,7,8,9,10,11,12,13,14,15,16,17,18,19,20,21,22,23,24,25,26,27,28,29,30,31,32,33,34,35,36,37,38,39,40,41,42,43,44,45,46,47,48,49,50,51,52,53,54,55,56,57,58,59,60,61,62,63,64,65,66,67,68,69,70,71,72,73,74,75,76,77,78,79,80,81,82,83,84,85,86,87,88,89,90,91,92,93,94,95,96,97,98,99,100,101,102,103,104,105,106,107,108,109,110,111,112,113,114,115,116,117,118,119,120,121,122,123,124,125,126,127,128,129,130,131,132,133,134,135,136,137,138,139,140,141,142,143,144,145,146,147,148,149,150,151,152,153,154,155,156,157,158,159,160,161,162,163,164,165,166,167,168,1,2,3,4,5,8,12,13,14,15,19,21,22,23,29,30,73,74,106,110,118,119,121,1030,1031,43,122,43,122,724,882,161,882,1403,1430,1403,1430,833,43,102,1855,767,783,788,807,808,813,814,815,669,647,1484,1528,1800,185,73,146,1251,1060,1220,1389,1176,1176,63,63,219,219,1121,56,1112,54,589,461,462,805,852,855,1044,1056,1057,1058,1114,462,462,462,1056,1057,1056,1057,1057,1058,1856,1397,1398,1397,1119,93,93,1090,1075,1159,833,1383,757,804,833,1196,1091,1092,318,319,320,1016,1189,865,1844,169,1856,1856,519,521,524,526,529,531,534,537,539,542,321,522,527,532,535,540,1457,380,381,380,382,53,140,279,280,281,1582,217,1195,1196,1197,1198,1199,1200,1202,1203,1205,1210,779,786,792,1574,1441,1442,1443,1739,1772,1858,1900,1441,1867,1443,587,402,403,404,453,454,455,115,116,330,331,332,980,981,982,1016,1017,1018,1019,1020,1021,1022,1023,1024,1025,1026,1027,1029,1030,1031,1032,1035,1036,1059,1369,1370,980,1133,1133,793,1716,1716,1341,1349,158,133,159,1034,1066,1068,1543,1545,1066,1068,133,824,1398,133,129,544,1195,1196,1197,1198,1200,544,1531,1380,163,164,165,166,167,82,577,913,914,1055,1489,965,67,62,744,745,749,739,791,678,679,679,832,1049,609,68,661,1049,1269,1314,1315,67,160,1549,171,173,1338,173,1543,1400,114,1259,1144,781,841,456,464,466,469,472,476,479,481,484,487,490,493,496,861,935,1092,1098,1103,1112,1176,457,458,459,461,462,463,465,467,468,470,471,473,474,475,477,478,480,482,483,485,486,491,492,494,495,497,498,861,940,941,946,949,1081,1082,1086,1090,1091,1092,1093,1094,1095,1096,1097,1098,1099,1100,1101,1102,1103,1104,1105,1106,1108,1109,1110,1114,1116,1176,1346,596,652,605,606,627,673,685,686,687,690,695,697,709,1029,1038,1050,1052,1053,1061,1076,1185,904,697,697,339,340,341,138,916,1187,1287,1412,1413,1414,1415,1416,1417,1418,1419,1420,1421,1422,1423,1424,1430,1438,1439,1440,1441,1442,1443,1444,1445,1446,1448,1449,1450,1451,1453,1458,1470,1472,1473,1474,1475,1476,1477,1478,1479,1480,1481,1482,1483,1484,1485,1487,1488,1489,1490,1491,1492,1493,1495,1496,1497,1498,1499,1500,1501,1502,1503,1506,1508,1509,1535,1536,1539,1543,1544,1545,1550,1552,1553,1554,1555,1556,1557,1558,1559,1560,1561,1562,1563,1564,1565,1566,1567,1568,1569,1570,1571,1572,1573,1574,1575,1577,1578,1579,1580,1581,1582,1583,1584,1585,1586,1587,1588,1589,1591,1592,1593,1595,1596,1597,1600,1601,1611,1612,1613,1614,1615,1616,1617,1618,1619,1620,1621,1622,1623,1624,1625,1634,1635,1539,1568,1569,1570,1571,1572,1573,1575,1577,1578,1579,1580,1581,1582,1583,1584,1585,1586,1587,1588,1589,1591,1592,1593,1595,1596,1597,1600,1601,1214,667,1525,1540,4,27,607,748,1120,1857,1780,1599,1670,1724,1770,1778,1791,1830,1849,1889,1903,1904,1267,861,1528,981,580,1503,1506,225,687,414,415,416,563,414,415,416,626,16,159,173,321,322,323,897,1033,1034,1035,1068,1072,1462,1467,1470,1543,1544,1551,1034,736,32,226,1369,16,897,330,331,332,897,1035,1036,1066,1068,1369,1545,133,1577,1722,1885,1892,918,954,1419,209,1268,1301,1302,1303,1304,1307,1311,1314,1316,1320,1321,1322,1323,1324,1325,1326,1327,1328,1287,1317,1318,1319,1542,887,1409,764,345,42,102,161,453,454,455,904,911,453,454,455,790,102,792,820,904,454,455,453,454,455,583,828,1362,409,410,1283,1376,779,426,428,795,800,1101,1102,1103,1375,1179,414,415,416,663,617,219,1145,1159,1159,216,865,1116,1194,1409,1619,1621,1623,172,178,179,264,265,266,950,959,1427,1428,1500,989,843,879,881,38,39,44,509,1325,833,834,835,728,810,1075,212,1506,1144,1218,1219,1246,579,960,579,909,64,1195,1203,1512,212,16,867,96,1083,24,25,27,291,292,293,880,1173,1207,1261,1263,1264,1265,1266,1267,1268,1301,1307,1368,774,1129,75,82,88,909,1192,1285,1515,916,1317,815,1386,1846,1858,1846,1858,43,357,358,449,1133,1134,1135,1136,1163,1164,1165,984,1308,1424,1133,1134,1135,1136,1153,73,212,467,468,473,474,695,701,716,797,804,805,827,828,829,857,894,963,965,1029,1031,1054,1072,1109,1111,1166,1174,1504,73,693,899,900,901,902,1029,1031,1038,1040,1041,1042,1054,1504,1505,1031,693,73,73,1149,35,857,1029,1038,899,900,902,1391,900,901,902,1140,1029,1095,374,375,376,1123,374,375,376,377,378,379,374,375,376,377,378,379,569,377,378,379,1466,204,1081,466,466,467,468,466,467,468,875,58,798,1857,1857,30,31,37,81,82,1519,1520,1523,1524,81,82,83,89,124,1640,796,977,37,1231,1145,1817,1851,575,632,1863,105,5,90,91,98,160,1061,64,575,1847,1847,1393,1393,794,800,804,805,806,807,808,809,810,811,812,813,814,815,816,817,835,472,473,474,657,1163,1164,1165,1166,472,473,474,472,473,474,1150,1166,1163,1164,1165,1166,798,1049,761,780,1687,1453,1687,459,1343,156,157,158,159,160,161,168,1016,1017,1018,1019,1020,1021,1022,1023,1289,1356,1403,1413,1414,1415,1416,1417,1419,1425,1430,1431,1432,1435,1436,1460,1461,1468,1485,1486,1487,1489,1490,1491,1493,1494,1499,1500,1501,1502,1503,1504,1505,1510,1511,1512,1513,1514,1515,1516,1524,1528,1529,1533,1535,1550,1563,1564,1565,1566,1567,1692,1703,1716,1724,1760,1764,1772,1822,1841,1885,105,1412,1413,1414,1415,1416,1417,1418,1419,1420,1421,1422,1423,1424,1425,1426,1427,1428,1429,1430,1431,1432,1433,1434,1435,1436,1437,1438,1439,1440,1441,1442,1443,1444,1445,1446,1447,1448,1449,1450,1451,1452,1453,1454,1455,1456,1457,1458,1459,1460,1461,1462,1463,1464,1465,1466,1467,1468,1469,1470,1471,1472,1473,1474,1475,1476,1477,1478,1479,1480,1481,1482,1483,1484,1485,1486,1487,1488,1489,1490,1491,1492,1493,1494,1495,1496,1497,1498,1499,1500,1501,1502,1503,1504,1505,1506,1507,1508,1509,1510,1511,1512,1513,1514,1515,1516,1517,1518,1519,1520,1521,1522,1523,1524,1525,1526,1527,1528,1529,1530,1531,1532,1533,1534,1535,1536,1537,1538,1539,1540,1541,1542,1543,1544,1545,1546,1547,1548,1549,1550,1551,1552,1553,1554,1555,1556,1557,1558,1559,1560,1561,1562,1563,1564,1565,1566,1567,1568,1569,1570,1571,1572,1573,1574,1575,1576,1577,1578,1579,1580,1581,1582,1583,1584,1585,1586,1587,1588,1589,1590,1591,1592,1593,1594,1595,1596,1597,1598,1599,1600,1601,1602,1603,1604,1605,1606,1607,1608,1609,1610,1611,1612,1613,1614,1615,1616,1617,1618,1619,1620,1621,1622,1623,1624,1625,1626,1627,1628,1629,1630,1631,1632,1633,1634,1635,1566,81,1218,891,891,1452,1453,1862,1862,1371,1199,1316,1863,1859,651,1154,1104,1353,1373,1127,781,833,839,840,841,1275,1321,771,1070,1107,1276,1277,1532,1145,834,1879,1879,1870,1870,803,803,505,972,13,106,107,108,112,113,114,115,116,350,351,370,401,648,649,1122,1407,163,165,544,638,1207,1210,773,773,1072,717,1147,1072,1880,1880,1464,1464,1414,1432,1247,1253,1541,834,1117,27,227,583,1473,931,932,931,932,1866,820,821,822,834,836,880,294,295,296,822,546,1096,821,7,22,54,92,93,120,125,1313,7,85,86,92,93,120,125,306,315,316,317,318,319,320,318,319,320,1225,1227,1228,1230,1234,1235,1237,1239,1240,1241,1242,1249,611,1129,1154,232,233,46,223,1399,1225,1226,1227,1228,1434,1506,1508,1509,1369,1249,1122,1412,59,1028,890,891,892,1459,797,1012,1013,1099,1562,113,1097,1104,1176,856,895,910,663,645,89,1833,1867,1756,1344,156,985,1307,1365,1535,163,1237,1262,1264,1265,1266,1868,597,1869,1869,1869,208,208,279,280,281,547,621,6,187,195,783,1141,1503,1141,1141,908,1450,1451,288,289,290,59,1028,34,34,34,166,167,1089,1414,1414,993,995,997,999,1001,1003,1005,1007,1009,1011,1013,1015,8,1174,1174,167,1144,14,998,999,1198,1238,1555,61,17,34,62,34,185,196,197,1321,196,197,197,196,1039,1045,1055,1055,351,356,1535,1536,1537,1082,1083,1082,1275,1147,1153,571,572,572,4,27,827,1139,1254,1255,866,985,986,987,988,989,991,992,993,994,995,996,997,998,999,1000,1001,1002,1003,1004,1005,1006,1007,1008,1009,1010,1011,1012,1013,1014,1015,987,985,986,990,1872,1872,786,786,181,182,270,271,272,66,955,47,54,56,57,98,99,100,101,168,383,385,969,1870,1871,1548,1874,1875,643,712,751,753,770,830,1403,1877,1115,230,1532,206,208,1596,1868,1868,1385,1386,1395,1416,1417,1418,1420,1871,1871,886,731,786,1405,1859,1859,1205,1875,1875,23,24,25,27,227,842,844,961,1060,1120,1122,1254,1255,1258,1327,1337,1338,1339,1340,1341,1346,1348,1349,1350,1351,1352,1353,1354,1359,1360,1362,1363,1364,1368,1369,1371,1531,1533,1360,1337,1339,1340,1341,1349,1350,1351,1359,1360,1362,223,1399,910,1186,1438,1450,1458,1495,1496,1630,1186,1258,1046,1049,645,1330,83,22,86,1083,1574,1395,880,886,563,1074,1118,1119,1129,1132,1876,952,1487,1490,1494,1239,553,620,1239,553,1485,939,1548,1548,306,307,308,957,958,1426,1427,1141,911,912,913,914,915,916,918,921,922,952,975,915,1176,478,480,912,919,922,925,979,1642,1512,1642,159,1381,955,975,1423,485,486,911,912,913,914,915,916,917,918,919,920,921,922,923,924,925,926,928,929,931,933,934,935,936,937,938,945,950,952,957,958,963,965,969,970,971,976,977,978,979,982,1389,1330,1413,1431,1529,845,846,847,848,849,850,851,852,853,854,855,856,857,858,859,860,861,862,863,864,865,866,867,868,869,870,871,872,873,874,875,876,877,878,879,880,881,882,883,884,885,886,887,888,889,890,891,892,893,894,895,896,897,898,899,900,901,902,903,904,905,906,907,908,909,910,911,912,913,914,915,916,917,918,919,920,921,922,923,924,925,926,927,928,929,930,931,932,933,934,935,936,937,938,939,940,941,942,943,944,945,946,947,948,949,950,951,952,953,954,955,956,957,958,959,960,961,962,963,964,965,966,967,968,969,970,971,972,973,974,975,976,977,978,979,980,981,982,983,984,985,986,987,988,989,990,991,992,993,994,995,996,997,998,999,1000,1001,1002,1003,1004,1005,1006,1007,1008,1009,1010,1011,1012,1013,1014,1015,1016,1017,1018,1019,1020,1021,1022,1023,1024,1025,1026,1027,1028,1029,1030,1031,1032,1033,1034,1035,1036,1037,1038,1039,1040,1041,1042,1043,1044,1045,1046,1047,1048,1049,1050,1051,1052,1053,1054,1055,1056,1057,1058,1059,1060,1061,1062,1424,1526,1292,1293,1279,1643,1204,699,700,701,709,713,871,1064,1072,705,173,1287,1317,1318,651,1326,1488,1489,1490,1491,1492,1493,1494,1495,1496,1497,1498,1630,1631,1326,1637,1531,1877,134,1849,1864,390,102,401,925,1402,912,919,922,925,35,1085,636,657,701,722,827,859,68,1155,928,936,937,938,1217,866,1154,1077,1062,916,1365,736,945,695,831,1874,1874,352,353,354,110,621,763,1876,1876,1873,1873,1865,955,884,645,598,598,1878,1878,357,358,359,1249,1879,627,992,993,1283,386,1016,1017,1018,1019,1020,1021,1022,1023,1025,1026,1027,1030,1147,1474,757,1147,757,1485,1046,1049,1550,136,137,183,203,508,510,513,514,517,518,522,523,524,525,526,527,528,529,530,531,532,533,535,538,540,543,546,594,996,997,1554,1638,1237,1568,1569,1570,1579,1049,1301,651,1876,1124,1883,1892,1591,1596,1600,1589,1587,1588,1601,1592,1595,1593,1597,1881,1646,931,932,115,116,982,1882,1882,1882,44,632,343,344,1283,1726,1881,1881,1098,23,857,1051,1052,1053,1054,1884,44,1518,142,229,67,386,387,388,398,399,400,388,57,896,1435,1435,1092,916,1398,1164,1165,1448,66,39,44,79,80,259,260,578,1050,1587,1588,1589,1591,1592,1593,1595,1596,1597,1600,1601,1107,44,1096,1718,1726,1646,1726,1880,1884,1885,1892,1518,1529,1036,1187,1332,1332,569,42,231,234,246,248,250,252,255,77,95,61,62,100,177,191,194,196,206,261,273,1272,1274,1317,1438,1439,1445,1446,1450,1458,1495,1496,1583,1630,1640,346,1438,1035,1439,1445,1563,53,79,80,92,93,96,97,99,100,125,261,9,1287,1317,1287,1317,1438,1450,1452,1453,1458,1495,898,1356,1406,1886,1886,1883,1885,1892,846,1885,1892,1426,698,544,545,546,546,935,1886,1887,1887,1887,1887,183,1597,1601,1601,827,899,900,1064,1371,1371,132,14,15,17,18,20,21,121,130,131,132,133,134,135,136,137,143,144,145,146,147,148,150,155,509,511,513,514,515,517,518,690,1193,386,387,388,610,1404,1888,1894,1894,161,844,1406,1396,1888,1253,1890,1126,736,692,701,702,704,705,706,707,708,709,712,731,735,736,737,738,740,741,742,743,744,745,746,752,782,1073,770,469,470,471,911,912,913,914,915,916,917,918,919,920,921,922,923,924,925,926,927,928,929,930,931,932,933,934,935,936,937,938,939,942,946,947,956,963,965,966,968,969,970,971,972,973,976,977,978,979,980,981,982,1429,360,361,362,157,1890,1890,580,861,1510,1698,1698,1584,958,1446,1452,1490,1491,1494,1499,51,942,1152,1253,1508,1353,183,595,116,1124,1125,1212,1243,1245,1247,1249,1250,1251,1252,1253,1253,1893,688,1893,1893,899,900,1381,195,1077,377,378,379,1889,199,1120,1218,233,1477,1891,1892,233,1477,681,684,1285,424,426,428,1541,854,1094,1055,1195,1196,1197,1198,1199,1200,1203,61,62,62,1049,1300,1535,1536,1300,1584,1894,173,181,26,760,912,99,950,988,1726,1905,408,409,410,424,426,408,398,399,400,408,409,410,411,412,413,442,443,553,1433,864,1169,1895,449,1123,1021,1023,858,904,1504,956,960,1425,1426,1523,1524,1189,588,1385,1330,1330,1520,225,226,987,160,470,471,473,474,493,494,495,584,832,833,837,894,963,964,1061,1062,1120,1387,1396,1414,1420,1432,1482,716,169,1062,1197,1525,1062,1198,169,1639,1640,66,1525,1256,1017,1019,1021,1036,1446,1385,1416,1417,1418,1420,75,842,1120,1342,1343,1345,1347,1531,1186,352,353,354,450,451,452,99,124,73,854,857,896,897,899,900,901,902,903,1016,1017,1018,1019,1020,1021,1022,1023,1024,1025,1026,1027,1028,1029,1030,1031,1036,1037,1038,1039,1040,1041,1042,1043,1044,1045,1046,1047,1048,1049,1050,1051,1052,1053,1054,1055,1056,1057,1058,1061,1062,679,848,357,358,359,360,361,362,885,1193,1202,601,761,704,7,125,478,479,480,1354,478,479,480,478,479,480,76,115,309,310,311,1150,142,687,1905,1443,1444,1445,1714,1714,652,653,653,87,703,753,907,955,1463,429,430,431,432,433,434,435,436,437,438,439,440,943,944,1415,1035,52,91,100,804,1049,1046,831,831,47,21,47,18,21,19,80,154,189,190,191,193,194,242,249,250,423,424,425,426,427,428,612,659,687,800,1033,1040,1041,1042,1190,1268,1355,1522,1523,1535,1610,1619,1621,1623,1625,1634,1640,1642,68,81,30,152,84,225,848,769,135,1506,1507,1124,26,564,571,588,611,621,727,743,1138,691,1085,161,709,1048,1075,1076,1119,1381,714,823,824,825,830,639,370,383,385,1284,11,25,11,25,11,1085,1086,1085,1084,1086,1087,461,462,852,1056,1057,1058,1114,1156,1157,1353,347,348,863,960,1425,1212,1507,633,581,208,1035,1072,395,380,382,1123,1393,1,2,3,5,7,12,13,14,15,20,21,22,24,25,27,29,30,31,32,37,45,57,58,59,60,67,68,73,75,77,81,87,90,98,102,105,106,107,119,120,121,122,131,132,171,185,218,349,355,356,360,361,362,423,424,425,426,427,428,450,451,452,515,516,517,518,711,781,798,824,833,839,848,857,871,897,1031,1039,1043,1044,1045,1053,1203,1226,1251,1261,1270,1284,1287,1291,1295,1296,1297,1298,1300,1333,1334,1536,1632,1453,40,822,1058,164,380,381,382,1123,564,233,234,239,244,245,247,249,251,253,255,257,258,260,263,266,269,270,272,275,278,281,284,287,290,293,296,299,302,305,308,311,314,317,320,323,326,329,332,335,338,341,344,348,351,354,356,359,360,362,363,366,367,372,376,379,382,385,388,391,394,397,400,404,407,410,412,416,419,421,427,428,433,434,439,440,443,445,447,455,458,465,468,471,474,477,480,483,486,489,492,495,498,501,504,508,509,511,512,514,515,516,518,519,520,521,522,523,529,530,531,532,533,539,540,541,542,543,548,1166,1167,1179,1180,1182,1185,1192,1417,1510,1167,1180,1182,1185,1167,1178,1180,1182,1185,234,239,244,245,247,249,251,253,255,257,260,263,266,269,270,272,275,278,281,284,287,290,293,296,299,302,305,308,311,314,317,320,323,326,329,332,335,338,341,344,348,351,354,359,362,363,366,367,372,376,379,382,385,388,391,394,397,400,404,407,410,416,419,427,433,439,443,447,450,452,455,458,465,468,471,474,477,480,483,486,489,492,495,498,501,504,508,509,511,512,514,515,516,518,520,521,522,523,529,530,531,532,533,539,540,541,543,548,1161,1417,1510,1417,1417,1170,1417,102,82,699,700,866,1338,559,71,591,595,598,66,1585,163,165,1454,1455,1456,1457,1458,1563,1571,1572,1573,1575,1577,1578,1582,1584,98,872,960,1308,1600,288,289,290,300,301,302,306,309,310,311,312,313,314,346,347,348,1190,1190,863,160,212,441,442,443,478,479,480,845,846,847,848,849,1083,1312,1218,671,683,78,229,258,229,421,422,889,891,1459,1372,142,16,81,1523,1524,772,773,1080,307,308,1341,1349,490,491,492,490,491,492,490,491,492,490,491,492,987,987,209,1301,1302,1303,1304,1307,209,1301,1302,1303,1304,1307,122,1655,1896,848,264,1377,1513,1538,1539,1124,4,1897,371,372,1056,1057,1058,1064,1080,1202,1064,67,83,1905,963,966,967,794,1464,1146,101,87,101,202,1898,203,1073,1073,146,244,625,657,693,694,749,960,1020,1033,1269,1426,1533,1604,1613,1898,1898,1280,1287,836,35,196,1536,1537,1580,1594,1464,1118,502,503,504,887,931,186,195,208,1035,230,231,232,233,697,1118,1899,23,23,867,799,166,1901,1901,26,1055,1821,579,503,504,1552,166,1902,1902,1902,36,36,1901,233,570,583,590,592,647,656,664,680,844,1346,1354,1472,1473,1474,1475,1476,1477,1478,1479,1480,1481,1482,1483,1484,398,399,400,1254,1255,1369,1368,1902,56,168,1174,1659,1594,1595,1590,1598,1591,1592,1601,1585,1587,1601,1588,1600,1596,1593,1589,1599,1586,1586,1597,1288,1302,930
+};
+
+const std::array<EmojiData, StaticEmojiDatabase::count>& StaticEmojiDatabase::orderedList() { return EMOJI_LIST; }
+
+const std::array<std::string_view, 9>& StaticEmojiDatabase::groups() { return GROUPS; }
+
+const EmojiData* StaticEmojiDatabase::find(std::string_view emoji) {
+	const EmojiData& data = EMOJI_LIST[mphIndex(emoji)];
+	return data.emoji == emoji ? &data : nullptr;
+}
+
+std::span<const std::string_view> StaticEmojiDatabase::tokens() { return TOKENS; }
+
+std::span<const std::uint16_t> StaticEmojiDatabase::tokenEmojis(std::size_t tokenIdx) {
+	return std::span(TOKEN_EMOJIS).subspan(TOKEN_OFFSETS[tokenIdx], TOKEN_OFFSETS[tokenIdx + 1] - TOKEN_OFFSETS[tokenIdx]);
+}
@@ -0,0 +1,84 @@
+#include <catch2/benchmark/catch_benchmark.hpp>
+#include <catch2/catch_test_macros.hpp>
+#include <algorithm>
+#include <cctype>
+#include <string>
+#include <vector>
+#include "emoji/emoji.hpp"
+
+// what searchCandidates computes, by looking at every emoji
+static std::vector<std::uint16_t> scanCandidates(std::string_view query) {
+  auto words = [](std::string_view text) {
+    std::vector<std::string> words{""};
+    for (char c : text) {
+      auto uc = static_cast<unsigned char>(c);
+      if (uc < 0x80 && !std::isalnum(uc)) {
+        if (!words.back().empty()) words.emplace_back();
+      } else {
+        words.back().push_back(std::tolower(uc));
+      }
+    }
+    if (words.back().empty()) words.pop_back();
+    return words;
+  };
+  auto hasPrefix = [&](const EmojiData &data, const std::string &prefix) {
+    std::vector<std::string_view> texts{data.name, data.group};
+    texts.insert(texts.end(), data.keywords.begin(), data.keywords.end());
+    return std::ranges::any_of(texts, [&](std::string_view text) {
+      return std::ranges::any_of(words(text),
+                                 [&](const std::string &word) { return word.starts_with(prefix); });
+    });
+  };
+  auto queryWords = words(query);
+  std::vector<std::uint16_t> indexes;
+
+  if (queryWords.empty()) return indexes;
+
+  for (std::uint16_t i = 0; i != emoji::emojis().size(); ++i) {
+    const auto &data = emoji::emojis()[i];
+    if (std::ranges::all_of(queryWords, [&](const std::string &word) { return hasPrefix(data, word); })) {
+      indexes.emplace_back(i);
+    }
+  }
+
+  return indexes;
+}
+
+TEST_CASE("perfect hash finds every emoji") {
+  for (const auto &data : emoji::emojis()) {
+    REQUIRE(emoji::findStaticEmoji(data.emoji) == &data);
+  }
+}
+
+TEST_CASE("perfect hash rejects unknown strings") {
+  REQUIRE(emoji::findStaticEmoji("") == nullptr);
+  REQUIRE(emoji::findStaticEmoji("smile") == nullptr);
+  REQUIRE(emoji::findStaticEmoji("😄😄") == nullptr);
+  REQUIRE(emoji::findStaticEmoji("👋🏻") == nullptr);
+}
+
+TEST_CASE("tokens are sorted") { REQUIRE(std::ranges::is_sorted(StaticEmojiDatabase::tokens())); }
+
+TEST_CASE("search candidates match a scan of the database") {
+  for (auto query : {"a", "smi", "SMILE", "thumbs up", "heart red", "flag: fr", "cat", "face with", "80s",
+                     "zzzzz", "", "  ", "-", "grin fa"}) {
+    INFO(query);
+    REQUIRE(emoji::searchCandidates(query) == scanCandidates(query));
+  }
+}
+
+TEST_CASE("search candidates include prefix matches") {
+  auto candidates = emoji::searchCandidates("grinn");
+  auto smile = emoji::findStaticEmoji("😀");
+  auto idx = static_cast<std::uint16_t>(smile - emoji::emojis().data());
+
+  REQUIRE(std::ranges::binary_search(candidates, idx));
+}
+
+TEST_CASE("search candidates benchmark") {
+  BENCHMARK("index: smi") { return emoji::searchCandidates("smi"); };
+  BENCHMARK("index: heart red") { return emoji::searchCandidates("heart red"); };
+  BENCHMARK("index: a") { return emoji::searchCandidates("a"); };
+  BENCHMARK("scan: smi") { return scanCandidates("smi"); };
+  BENCHMARK("perfect hash lookup") { return emoji::findStaticEmoji("🏴󠁧󠁢󠁷󠁬󠁳󠁿"); };
+}
@@ -11,10 +11,11 @@
 #include <sys/un.h>
 #include "ipc.hpp"
 #include <unistd.h>
+#include <utility>
 
 namespace ipc {
 
-using CliSchema = RpcSchema<ipc::Ping, ipc::DMenu, ipc::Deeplink, ipc::LaunchApp>;
+using CliSchema = RpcSchema<ipc::Ping, ipc::DMenu, ipc::DMenuAppend, ipc::Deeplink, ipc::LaunchApp>;
 using BrowserExtensionSchema = RpcSchema<ipc::Ping, ipc::BrowserInit, ipc::BrowserTabsChanged>;
 
 template <IsRpcSchema SchemaType = CliSchema> class Client {
@@ -33,18 +34,21 @@ public:
     return Client(fd);
   }
 
-  ~Client() { close(m_sock); }
+  Client(Client &&other) noexcept
+      : m_sock(std::exchange(other.m_sock, -1)), m_connected(other.m_connected),
+        m_path(std::move(other.m_path)), m_rpc(std::move(other.m_rpc)) {}
+  Client(const Client &) = delete;
 
-  std::expected<void, std::string> connect() {
-    int fd = socket(AF_UNIX, SOCK_STREAM, 0);
-
-    if (fd == -1) { return std::unexpected(std::format("Failed to create socket: {}", strerror(errno))); }
+  ~Client() {
+    if (m_sock != -1) close(m_sock);
+  }
 
+  std::expected<void, std::string> connect() {
     struct sockaddr_un addr{.sun_family = AF_UNIX};
 
     strncpy(addr.sun_path, m_path.data(), m_path.size());
 
-    if (::connect(fd, reinterpret_cast<sockaddr *>(&addr), sizeof(addr)) == -1) {
+    if (::connect(m_sock, reinterpret_cast<sockaddr *>(&addr), sizeof(addr)) == -1) {
       return std::unexpected(std::format("Failed to connect to socket at {}: {}", m_path, strerror(errno)));
     }
 
@@ -80,39 +84,50 @@ public:
    * Make a request and block until we get a response.
    */
   template <InSchema<Schema> T> std::expected<typename T::Response, std::string> request(T::Request payload) {
-    int id = 0;
-    std::string data;
-    uint32_t size;
+    if (!sendRequest<T>(std::move(payload))) { return std::unexpected("Failed to send request"); }
+    return readResponse<T>();
+  }
 
-    sendRaw(m_rpc.template request<T>(payload));
+  /**
+   * Send a request without waiting for its response, which is to be read using `readResponse`.
+   * Useful for requests that are followed by notifications (e.g. a streaming dmenu).
+   */
+  template <InSchema<Schema> T> bool sendRequest(T::Request payload) {
+    return sendRaw(m_rpc.template request<T>(std::move(payload)));
+  }
 
-    {
-      if (::recv(m_sock, reinterpret_cast<char *>(&size), sizeof(size), 0) < sizeof(size)) {
-        return std::unexpected("Failed to read response size");
-      }
+  /**
+   * Block until the response to the request last sent with `sendRequest` is received.
+   */
+  template <InSchema<Schema> T> std::expected<typename T::Response, std::string> readResponse() {
+    std::string data;
+    uint32_t size;
 
-      data.resize(size);
+    if (::recv(m_sock, reinterpret_cast<char *>(&size), sizeof(size), MSG_WAITALL) < sizeof(size)) {
+      return std::unexpected("Failed to read response size");
+    }
 
-      if (::recv(m_sock, data.data(), data.size(), 0) < data.size()) {
-        return std::unexpected("Failed to read response data");
-      }
+    data.resize(size);
 
-      typename Schema::Response res;
+    if (::recv(m_sock, data.data(), data.size(), MSG_WAITALL) < data.size()) {
+      return std::unexpected("Failed to read response data");
+    }
 
-      if (const auto error = glz::read_json(res, data)) {
-        return std::unexpected(std::format("Failed to parse response: {}", glz::format_error(error)));
-      }
+    typename Schema::Response res;
 
-      if (res.error) { return std::unexpected(res.error->message); }
+    if (const auto error = glz::read_json(res, data)) {
+      return std::unexpected(std::format("Failed to parse response: {}", glz::format_error(error)));
+    }
 
-      typename T::Response resData;
+    if (res.error) { return std::unexpected(res.error->message); }
 
-      if (const auto error = glz::read_json(resData, res.result->str)) {
-        return std::unexpected(std::format("Failed to read response data: {}", glz::format_error(error)));
-      }
+    typename T::Response resData;
 
-      return resData;
+    if (const auto error = glz::read_json(resData, res.result->str)) {
+      return std::unexpected(std::format("Failed to read response data: {}", glz::format_error(error)));
     }
+
+    return resData;
   }
 
   /**
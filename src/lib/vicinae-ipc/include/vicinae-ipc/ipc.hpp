@@ -76,6 +76,8 @@ struct DMenu {
   static constexpr const auto key = "dmenu";
   struct Request {
     std::string rawContent;
+    // content is (also) sent afterwards, through DMenuAppend notifications on the same connection
+    bool stream = false;
     std::optional<std::string> navigationTitle;
     std::optional<std::string> placeholder;
     std::optional<std::string> sectionTitle;
@@ -94,6 +96,21 @@ struct DMenu {
   };
 };
 
+/**
+ * Content for the dmenu opened by a streaming DMenu request on the same connection.
+ * Sent as a notification, as many times as needed: `data` does not need to end on a line boundary.
+ */
+struct DMenuAppend {
+  static constexpr const auto key = "dmenu/append";
+
+  struct Request {
+    std::string data;
+    bool eof = false; // no more content will follow
+  };
+
+  struct Response {};
+};
+
 struct BrowserInit {
   static constexpr const auto key = "browser/init";
 
@@ -0,0 +1,139 @@
+#include <xdgpp/xdgpp.hpp>
+#include <atomic>
+#include <catch2/benchmark/catch_benchmark.hpp>
+#include <catch2/catch_test_macros.hpp>
+#include <chrono>
+#include <cstdlib>
+#include <filesystem>
+#include <format>
+#include <fstream>
+#include <new>
+#include "utils/utils.hpp"
+
+namespace fs = std::filesystem;
+
+static const fs::path FIXTURES = XDGPP_FIXTURE_DIR;
+static constexpr size_t CORPUS_SIZE = 5000;
+
+static std::atomic<size_t> allocationCount = 0;
+
+void *operator new(size_t size) {
+  ++allocationCount;
+  if (void *ptr = std::malloc(size)) return ptr;
+  throw std::bad_alloc();
+}
+
+void operator delete(void *ptr) noexcept { std::free(ptr); }
+void operator delete(void *ptr, size_t) noexcept { std::free(ptr); }
+
+static std::vector<fs::path> fixtureFiles() {
+  std::vector<fs::path> files;
+
+  for (const auto &entry : fs::directory_iterator(FIXTURES)) {
+    if (entry.path().extension() == ".desktop") files.emplace_back(entry.path());
+  }
+
+  return files;
+}
+
+/**
+ * Write a corpus of desktop files alternating between the fixtures, which are heavily localized, and a
+ * small application entry.
+ */
+static std::vector<fs::path> makeCorpus(const fs::path &dir) {
+  constexpr const char *SMALL_ENTRY = R"([Desktop Entry]
+Type=Application
+Name=Application {}
+Comment=Synthetic application number {}
+Exec=app-{} %U
+Icon=app-{}
+Categories=Utility;Development;
+Keywords=synthetic;benchmark;
+MimeType=text/plain;application/x-app-{};
+)";
+  std::vector<std::string> fixtures;
+  std::vector<fs::path> files;
+
+  for (const auto &fixture : fixtureFiles()) {
+    fixtures.emplace_back(slurp(fixture));
+  }
+
+  fs::remove_all(dir);
+  fs::create_directories(dir);
+
+  for (size_t i = 0; i != CORPUS_SIZE; ++i) {
+    fs::path path = dir / std::format("app-{}.desktop", i);
+    std::ofstream ofs(path);
+
+    if (i % 2 == 0) {
+      ofs << fixtures.at(i / 2 % fixtures.size());
+    } else {
+      ofs << std::format(SMALL_ENTRY, i, i, i, i, i);
+    }
+
+    files.emplace_back(path);
+  }
+
+  return files;
+}
+
+TEST_CASE("desktop entry parsing benchmark", "[benchmark]") {
+  auto fixtures = fixtureFiles();
+  auto corpusDir = fs::temp_directory_path() / "xdgpp-benchmark-corpus";
+  auto corpus = makeCorpus(corpusDir);
+  size_t corpusBytes = 0;
+
+  REQUIRE_FALSE(fixtures.empty());
+
+  for (const auto &path : corpus) {
+    corpusBytes += fs::file_size(path);
+  }
+
+  BENCHMARK("fixtures: fromFile") {
+    size_t valid = 0;
+    for (const auto &path : fixtures) {
+      valid += xdgpp::DesktopEntry::fromFile(path).isValid();
+    }
+    return valid;
+  };
+
+  BENCHMARK("fixtures: fromData from a string read in memory") {
+    size_t valid = 0;
+    for (const auto &path : fixtures) {
+      valid += xdgpp::DesktopEntry::fromData(slurp(path)).isValid();
+    }
+    return valid;
+  };
+
+  BENCHMARK("corpus: fromFile") {
+    size_t valid = 0;
+    for (const auto &path : corpus) {
+      valid += xdgpp::DesktopEntry::fromFile(path).isValid();
+    }
+    return valid;
+  };
+
+  {
+    size_t valid = 0;
+    size_t allocationsBefore = allocationCount;
+    auto start = std::chrono::steady_clock::now();
+
+    for (const auto &path : corpus) {
+      valid += xdgpp::DesktopEntry::fromFile(path).isValid();
+    }
+
+    std::chrono::duration<double> elapsed = std::chrono::steady_clock::now() - start;
+    double allocationsPerFile = static_cast<double>(allocationCount - allocationsBefore) / corpus.size();
+
+    double filesPerSecond = corpus.size() / elapsed.count();
+    double mibPerSecond = corpusBytes / elapsed.count() / (1024 * 1024);
+
+    REQUIRE(valid == corpus.size());
+    WARN(std::format("{} files ({} KiB) in {:.1f}ms: {:.0f} files/s, {:.1f} MiB/s, "
+                     "{:.1f} allocations per file",
+                     corpus.size(), corpusBytes / 1024, elapsed.count() * 1000, filesPerSecond, mibPerSecond,
+                     allocationsPerFile));
+  }
+
+  fs::remove_all(corpusDir);
+}
@@ -1,5 +1,6 @@
 #include <xdgpp/xdgpp.hpp>
 #include <catch2/catch_test_macros.hpp>
+#include <sstream>
 
 constexpr const char *GROUP = XDGPP_GROUP;
 
@@ -45,3 +46,39 @@ TEST_CASE("fromId should return valid desktop file if found", GROUP) {
     REQUIRE(file.has_value());
   }
 }
+
+TEST_CASE("deserialized desktop file should match the parsed one", GROUP) {
+  auto file = xdgpp::DesktopFile::fromFile(FIXTURES / "firefox-bin.desktop", FIXTURES);
+  std::stringstream ss;
+
+  file.serialize(ss);
+
+  auto copy = xdgpp::DesktopFile::deserialize(ss);
+
+  REQUIRE(copy.has_value());
+  REQUIRE(copy->id() == file.id());
+  REQUIRE(copy->path() == file.path());
+  REQUIRE(copy->name() == file.name());
+  REQUIRE(copy->genericName() == file.genericName());
+  REQUIRE(copy->exec() == file.exec());
+  REQUIRE(copy->icon() == file.icon());
+  REQUIRE(copy->mimes() == file.mimes());
+  REQUIRE(copy->categories() == file.categories());
+  REQUIRE(copy->keywords() == file.keywords());
+  REQUIRE(copy->startupWMClass() == file.startupWMClass());
+  REQUIRE(copy->actions().size() == file.actions().size());
+  REQUIRE(copy->actions().at(1).id() == file.actions().at(1).id());
+  REQUIRE(copy->actions().at(1).exec() == file.actions().at(1).exec());
+}
+
+TEST_CASE("truncated serialized desktop file should be rejected", GROUP) {
+  auto file = xdgpp::DesktopFile::fromFile(FIXTURES / "firefox-bin.desktop", FIXTURES);
+  std::stringstream ss;
+
+  file.serialize(ss);
+
+  std::string data = ss.str();
+  std::stringstream truncated(data.substr(0, data.size() / 2));
+
+  REQUIRE_FALSE(xdgpp::DesktopFile::deserialize(truncated).has_value());
+}
@@ -1,5 +1,6 @@
 #include "action.hpp"
 #include "exec.hpp"
+#include "../utils/serialize.hpp"
 
 namespace xdgpp {
 std::string DesktopEntryAction::id() const { return m_id; }
@@ -30,6 +31,24 @@ DesktopEntryAction xdgpp::DesktopEntryAction::fromGroup(const DesktopEntryGroup
   return DesktopEntryAction(group);
 }
 
+DesktopEntryAction DesktopEntryAction::deserialize(std::istream &is) {
+  DesktopEntryAction action;
+
+  action.m_id = serialize::readString(is);
+  action.m_name = serialize::readString(is);
+  action.m_icon = serialize::readOptional(is);
+  action.m_exec = serialize::readOptional(is);
+
+  return action;
+}
+
+void DesktopEntryAction::serialize(std::ostream &os) const {
+  serialize::writeString(os, m_id);
+  serialize::writeString(os, m_name);
+  serialize::writeOptional(os, m_icon);
+  serialize::writeOptional(os, m_exec);
+}
+
 DesktopEntryAction::DesktopEntryAction(const DesktopEntryGroup &group) {
   std::string prefix = "Desktop Action ";
 
@@ -1,5 +1,7 @@
 #pragma once
+#include <istream>
 #include <optional>
+#include <ostream>
 #include <string>
 #include <vector>
 #include "group.hpp"
@@ -14,6 +16,9 @@ namespace xdgpp {
 class DesktopEntryAction {
 public:
   static DesktopEntryAction fromGroup(const DesktopEntryGroup &group);
+  static DesktopEntryAction deserialize(std::istream &is);
+
+  void serialize(std::ostream &os) const;
 
   std::string id() const;
 
@@ -24,6 +29,7 @@ public:
                                      const std::optional<std::string> &launchPrefix = {}) const;
 
 private:
+  DesktopEntryAction() = default;
   DesktopEntryAction(const DesktopEntryGroup &group);
 
   std::string m_id;
@@ -1,7 +1,8 @@
 #include "entry.hpp"
 #include "action.hpp"
 #include "reader.hpp"
-#include "../utils/utils.hpp"
+#include "../utils/mapped-file.hpp"
+#include "../utils/serialize.hpp"
 #include "../env/env.hpp"
 #include <ranges>
 #include <algorithm>
@@ -22,6 +23,92 @@ DesktopEntry DesktopEntry::fromData(std::string_view data, const ParseOptions &o
   return DesktopEntry(data, opts);
 }
 
+std::optional<DesktopEntry> DesktopEntry::deserialize(std::istream &is) {
+  DesktopEntry entry;
+
+  entry.m_error = serialize::readOptional(is);
+  entry.m_type = static_cast<Type>(serialize::readU32(is));
+  entry.m_version = serialize::readString(is);
+  entry.m_name = serialize::readString(is);
+  entry.m_genericName = serialize::readString(is);
+  entry.m_noDisplay = serialize::readBool(is);
+  entry.m_comment = serialize::readOptional(is);
+  entry.m_hidden = serialize::readBool(is);
+  entry.m_terminal = serialize::readBool(is);
+  entry.m_singleMainWindow = serialize::readBool(is);
+  entry.m_icon = serialize::readOptional(is);
+  entry.m_exec = serialize::readOptional(is);
+  entry.m_tryExec = serialize::readOptional(is);
+  entry.m_wmClass = serialize::readOptional(is);
+  entry.m_mimes = serialize::readStringList(is);
+  entry.m_categories = serialize::readStringList(is);
+  entry.m_keywords = serialize::readStringList(is);
+  entry.m_onlyShowIn = serialize::readStringList(is);
+  entry.m_notShowIn = serialize::readStringList(is);
+  entry.m_path = serialize::readOptional(is);
+
+  uint32_t actionCount = serialize::readU32(is);
+
+  for (uint32_t i = 0; i != actionCount && is; ++i) {
+    entry.m_actions.emplace_back(DesktopEntryAction::deserialize(is));
+  }
+
+  entry.m_url = serialize::readOptional(is);
+
+  if (serialize::readBool(is)) {
+    TerminalExec texec;
+    texec.exec = serialize::readOptional(is);
+    texec.appId = serialize::readOptional(is);
+    texec.title = serialize::readOptional(is);
+    texec.dir = serialize::readOptional(is);
+    texec.hold = serialize::readOptional(is);
+    entry.m_terminalExec = texec;
+  }
+
+  if (!is) return std::nullopt;
+
+  return entry;
+}
+
+void DesktopEntry::serialize(std::ostream &os) const {
+  serialize::writeOptional(os, m_error);
+  serialize::writeU32(os, static_cast<uint32_t>(m_type));
+  serialize::writeString(os, m_version);
+  serialize::writeString(os, m_name);
+  serialize::writeString(os, m_genericName);
+  serialize::writeBool(os, m_noDisplay);
+  serialize::writeOptional(os, m_comment);
+  serialize::writeBool(os, m_hidden);
+  serialize::writeBool(os, m_terminal);
+  serialize::writeBool(os, m_singleMainWindow);
+  serialize::writeOptional(os, m_icon);
+  serialize::writeOptional(os, m_exec);
+  serialize::writeOptional(os, m_tryExec);
+  serialize::writeOptional(os, m_wmClass);
+  serialize::writeStringList(os, m_mimes);
+  serialize::writeStringList(os, m_categories);
+  serialize::writeStringList(os, m_keywords);
+  serialize::writeStringList(os, m_onlyShowIn);
+  serialize::writeStringList(os, m_notShowIn);
+  serialize::writeOptional(os, m_path.transform([](const fs::path &path) { return path.string(); }));
+  serialize::writeU32(os, m_actions.size());
+
+  for (const auto &action : m_actions) {
+    action.serialize(os);
+  }
+
+  serialize::writeOptional(os, m_url);
+  serialize::writeBool(os, m_terminalExec.has_value());
+
+  if (m_terminalExec) {
+    serialize::writeOptional(os, m_terminalExec->exec);
+    serialize::writeOptional(os, m_terminalExec->appId);
+    serialize::writeOptional(os, m_terminalExec->title);
+    serialize::writeOptional(os, m_terminalExec->dir);
+    serialize::writeOptional(os, m_terminalExec->hold);
+  }
+}
+
 DesktopEntry::Type DesktopEntry::type() const { return m_type; }
 
 bool DesktopEntry::isApplication() const { return m_type == Type::Application; }
@@ -126,14 +213,14 @@ const std::vector<DesktopEntryAction> &DesktopEntry::actions() const { return m_
 const std::optional<DesktopEntry::TerminalExec> &DesktopEntry::terminalExec() const { return m_terminalExec; }
 
 DesktopEntry::DesktopEntry(const fs::path &path, const ParseOptions &opts) {
-  std::error_code ec;
+  MappedFile file(path);
 
-  if (!fs::is_regular_file(path, ec)) {
+  if (!file.isValid()) {
     m_error = std::string("Could not read file at ") + path.c_str();
     return;
   }
 
-  *this = DesktopEntry(std::string_view(slurp(path)), opts);
+  *this = DesktopEntry(file.view(), opts);
 }
 
 DesktopEntry::DesktopEntry(std::string_view data, const ParseOptions &opts) {
@@ -3,7 +3,9 @@
 #include "action.hpp"
 #include "reader.hpp"
 #include <filesystem>
+#include <istream>
 #include <optional>
+#include <ostream>
 #include <vector>
 
 namespace xdgpp {
@@ -26,6 +28,15 @@ public:
   static DesktopEntry fromFile(const std::filesystem::path &path, const ParseOptions &opts = {});
   static DesktopEntry fromData(std::string_view data, const ParseOptions &opts = {});
 
+  /**
+   * Read back an entry written by `serialize`, without parsing the original desktop file again.
+   * Returns nothing if the data is malformed.
+   * Localized values are stored as they were resolved at parse time.
+   */
+  static std::optional<DesktopEntry> deserialize(std::istream &is);
+
+  void serialize(std::ostream &os) const;
+
   enum class Type { Application = 1, Link, Directory };
 
   /**
@@ -179,6 +190,9 @@ public:
   // Only available if app has the TerminalEmulator category
   const std::optional<TerminalExec> &terminalExec() const;
 
+protected:
+  DesktopEntry() = default;
+
 private:
   DesktopEntry(std::string_view data, const ParseOptions &opts = {});
   DesktopEntry(const std::filesystem::path &path, const ParseOptions &opts = {});
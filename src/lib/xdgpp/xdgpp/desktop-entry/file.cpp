@@ -1,6 +1,7 @@
 #include "file.hpp"
 #include "entry.hpp"
 #include "../env/env.hpp"
+#include "../utils/serialize.hpp"
 #include <algorithm>
 #include <filesystem>
 
@@ -23,6 +24,22 @@ std::string DesktopFile::relativeId(const std::filesystem::path &file, const std
   return id;
 }
 
+std::optional<DesktopFile> DesktopFile::deserialize(std::istream &is) {
+  auto id = serialize::readString(is);
+  fs::path path = serialize::readString(is);
+  auto entry = DesktopEntry::deserialize(is);
+
+  if (!entry) return std::nullopt;
+
+  return DesktopFile(id, path, *entry);
+}
+
+void DesktopFile::serialize(std::ostream &os) const {
+  serialize::writeString(os, m_id);
+  serialize::writeString(os, m_path.string());
+  DesktopEntry::serialize(os);
+}
+
 const std::filesystem::path &DesktopFile::path() const { return m_path; }
 
 std::string_view DesktopFile::id() const { return m_id; }
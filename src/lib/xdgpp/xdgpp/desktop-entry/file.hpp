@@ -22,11 +22,18 @@ public:
                                            const std::vector<std::filesystem::path> &searchPaths);
   static std::optional<DesktopFile> fromId(std::string_view id);
 
+  /**
+   * Read back a desktop file written by `serialize`. Returns nothing if the data is malformed.
+   */
+  static std::optional<DesktopFile> deserialize(std::istream &is);
+
   static std::string relativeId(const std::filesystem::path &file, const std::filesystem::path &appDir);
 
   const std::filesystem::path &path() const;
   std::string_view id() const;
 
+  void serialize(std::ostream &os) const;
+
 private:
   DesktopFile(const std::string &id, const std::filesystem::path &path, const DesktopEntry &entry);
 
@@ -1,33 +1,37 @@
 #pragma once
 #include "../locale/locale.hpp"
 #include "value.hpp"
-#include <string>
+#include <string_view>
 #include <unordered_map>
 
 namespace xdgpp {
+/**
+ * A group of a desktop entry file.
+ * Names, keys and values point into the data the group was parsed from, which has to outlive it.
+ */
 class DesktopEntryGroup {
   struct LocalizedValue {
-    std::string value;
+    std::string_view value;
     Locale locale;
   };
 
   struct Entry {
-    std::string value;
+    std::string_view value;
     std::optional<LocalizedValue> localized;
   };
 
   using ValueType = DesktopEntryValueType;
 
 public:
-  DesktopEntryGroup(const std::string &name);
+  DesktopEntryGroup(std::string_view name);
 
-  const std::string &name() const;
+  std::string_view name() const;
 
-  void set(const std::string &key, const std::string &value);
+  void set(std::string_view key, std::string_view value);
 
-  std::unordered_map<std::string, Entry> entries() const { return m_entries; }
+  const std::unordered_map<std::string_view, Entry> &entries() const { return m_entries; }
 
-  void setLocalized(const std::string &key, const std::string &value, const Locale &locale);
+  void setLocalized(std::string_view key, std::string_view value, const Locale &locale);
 
   /**
    * Returns the raw representation of the value associated to the passed key,
@@ -36,14 +40,14 @@ public:
    * Note that leading and trailing spaces are never considered to be
    * part of the value, even in raw form.
    */
-  std::optional<std::string> rawKey(std::string_view name) const;
+  std::optional<std::string_view> rawKey(std::string_view name) const;
 
-  std::optional<LocalizedValue> localizedKey(std::string_view name);
+  const LocalizedValue *localizedKey(std::string_view name) const;
   std::optional<ValueType> key(std::string_view name, bool preferLocalized = true) const;
 
 private:
-  std::string m_name;
-  std::unordered_map<std::string, Entry> m_entries;
+  std::string_view m_name;
+  std::unordered_map<std::string_view, Entry> m_entries;
 };
 
 } // namespace xdgpp
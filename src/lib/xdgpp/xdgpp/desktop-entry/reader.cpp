@@ -1,20 +1,23 @@
 #include "reader.hpp"
-#include <iostream>
 
 namespace xdgpp {
 
-void DesktopEntryReader::parseGroupHeader() {
-  std::string name;
+const Locale &DesktopEntryReader::systemLocale() {
+  static const Locale locale = Locale::system();
+  return locale;
+}
 
-  ++m_cursor;
+void DesktopEntryReader::parseGroupHeader() {
+  size_t start = ++m_cursor;
 
   while (m_cursor < m_data.size() && isGroupHeaderChar(m_data[m_cursor])) {
-    name += m_data[m_cursor];
     ++m_cursor;
   }
 
+  std::string_view name = m_data.substr(start, m_cursor - start);
+
   if (m_cursor == m_data.size() || m_data[m_cursor] != ']') {
-    warnings.emplace_back(std::string("Expected ] to finish group header name but got ") + m_data[m_cursor]);
+    warnings.emplace_back(std::string("Expected ] to finish group header name but got ") + peek());
   }
 
   auto grp = std::make_unique<Group>(name);
@@ -25,27 +28,29 @@ void DesktopEntryReader::parseGroupHeader() {
   ++m_cursor;
 }
 
-std::string DesktopEntryReader::parseKey() {
-  std::string key;
+std::string_view DesktopEntryReader::parseKey() {
+  size_t start = m_cursor;
+
   while (m_cursor < m_data.size() && isKeyChar(m_data[m_cursor])) {
-    key += m_data[m_cursor];
     ++m_cursor;
   }
 
-  return key;
+  return m_data.substr(start, m_cursor - start);
 }
 
-std::string DesktopEntryReader::parseRawValue() {
-  std::string value;
-  while (peek() && peek() != LF) {
-    value += consume();
-  }
-  size_t trimmable = 0;
-  for (auto it = value.rbegin(); it != value.rend() && std::isspace(*it); ++it) {
-    ++trimmable;
+std::string_view DesktopEntryReader::parseRawValue() {
+  size_t start = m_cursor;
+  size_t end = m_data.find_first_of(std::string_view("\n\0", 2), start);
+
+  if (end == std::string_view::npos) end = m_data.size();
+
+  m_cursor = end;
+
+  while (end > start && std::isspace(static_cast<unsigned char>(m_data[end - 1]))) {
+    --end;
   }
 
-  return value.substr(0, value.size() - trimmable);
+  return m_data.substr(start, end - start);
 }
 
 void DesktopEntryReader::skipSpace() {
@@ -71,18 +76,37 @@ char DesktopEntryReader::peek() const {
 
 bool DesktopEntryReader::isPeek(char c) const { return peek() && peek() == c; }
 
-std::string DesktopEntryReader::parseRawLocale() {
-  std::string locale;
-
+std::string_view DesktopEntryReader::parseRawLocale() {
   consume('[');
-  while (!isPeek(']')) {
-    locale += consume();
+
+  size_t start = m_cursor;
+
+  while (peek() && !isPeek(']')) {
+    consume();
   }
+
+  std::string_view locale = m_data.substr(start, m_cursor - start);
+
   consume(']');
 
   return locale;
 }
 
+bool DesktopEntryReader::matchesLanguage(std::string_view rawLocale) const {
+  // compares the language the same way Locale::parse extracts it
+  const std::string &lang = m_locale.lang();
+  size_t matched = 0;
+
+  for (char c : rawLocale) {
+    if (c == '_' || c == '.' || c == '@') break;
+    if (!std::isalpha(static_cast<unsigned char>(c))) continue;
+    if (matched == lang.size() || lang[matched] != c) return false;
+    ++matched;
+  }
+
+  return matched == lang.size();
+}
+
 size_t DesktopEntryReader::computeLocalScore(const Locale &locale) {
   using F = Locale::Component;
 
@@ -143,11 +167,11 @@ void DesktopEntryReader::parse() {
 }
 
 void DesktopEntryReader::parseEntry() {
-  std::string key = parseKey();
-  std::optional<Locale> locale;
+  std::string_view key = parseKey();
+  std::optional<std::string_view> rawLocale;
 
   skipSpace();
-  if (peek() == '[') { locale = Locale::parse(parseRawLocale()); }
+  if (peek() == '[') { rawLocale = parseRawLocale(); }
 
   // if we don't get expected '=' separator we just skip the current line.
   if (consume() != '=') {
@@ -158,12 +182,16 @@ void DesktopEntryReader::parseEntry() {
   }
 
   skipSpace();
-  std::string value = parseRawValue();
+  std::string_view value = parseRawValue();
 
   if (!m_currentGroup) return;
 
-  if (locale) {
-    size_t score = computeLocalScore(locale.value());
+  if (rawLocale) {
+    // most localized keys are in other languages, which can be dropped without parsing their locale
+    if (!matchesLanguage(*rawLocale)) return;
+
+    Locale locale = Locale::parse(*rawLocale);
+    size_t score = computeLocalScore(locale);
 
     if (!score) return;
 
@@ -171,7 +199,7 @@ void DesktopEntryReader::parseEntry() {
       if (computeLocalScore(current->locale) > score) return;
     }
 
-    m_currentGroup->setLocalized(key, value, locale.value());
+    m_currentGroup->setLocalized(key, value, locale);
     return;
   }
 
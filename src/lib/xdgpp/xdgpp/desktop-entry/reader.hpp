@@ -2,10 +2,11 @@
 #include "../locale/locale.hpp"
 #include "group.hpp"
 #include <cctype>
-#include <filesystem>
+#include <memory>
 #include <optional>
 #include <string>
 #include <string_view>
+#include <unordered_map>
 #include <vector>
 
 namespace xdgpp {
@@ -25,6 +26,10 @@ static constexpr const char LF = '\n';
  *
  * If that's what you want, you should use the higher level `DesktopEntry`
  * class.
+ *
+ * The reader does not copy the data it parses: group names, keys and values are views into it, so it
+ * has to outlive the reader and the values obtained from it.
+ * Localized keys that don't match the locale of the reader are dropped as they are parsed.
  */
 class DesktopEntryReader {
   using Group = DesktopEntryGroup;
@@ -38,12 +43,12 @@ public:
    * Parses the desktop entry passed as `data`.
    */
   DesktopEntryReader(std::string_view data, const DesktopEntryReaderSettings &opts = {}) : m_data(data) {
-    m_locale = opts.locale.value_or(Locale::system());
+    m_locale = opts.locale.value_or(systemLocale());
     parse();
   }
 
   const Group *group(std::string_view key) const {
-    if (auto it = m_groups.find(std::string(key)); it != m_groups.end()) { return it->second.get(); }
+    if (auto it = m_groups.find(key); it != m_groups.end()) { return it->second.get(); }
     return nullptr;
   }
 
@@ -62,10 +67,15 @@ private:
   static bool isInlineSpace(char c) { return c == ' ' || c == '\t' || c == '\v' || c == '\r' || c == '\f'; }
   static bool isKeyChar(char c) { return c != '=' && c != LF && c != '[' && !std::isspace(c); }
 
+  /**
+   * Locale of the process, resolved once as doing so is not thread safe.
+   */
+  static const Locale &systemLocale();
+
   // [Desktop Entry]
   void parseGroupHeader();
-  std::string parseKey();
-  std::string parseRawValue();
+  std::string_view parseKey();
+  std::string_view parseRawValue();
   void skipSpace();
 
   // consumes only if current character is c
@@ -75,15 +85,17 @@ private:
   bool isPeek(char c) const;
 
   // lang_COUNTRY.ENCODING@MODIFIER
-  std::string parseRawLocale();
+  std::string_view parseRawLocale();
+  // whether a localized key could match the locale of the reader, checked before parsing its locale
+  bool matchesLanguage(std::string_view rawLocale) const;
   // https://specifications.freedesktop.org/desktop-entry-spec/latest/localized-keys.html
   size_t computeLocalScore(const Locale &locale);
   void parseEntry();
   void parse();
 
   size_t m_cursor = 0;
-  std::string m_data;
-  std::unordered_map<std::string, std::unique_ptr<Group>> m_groups;
+  std::string_view m_data;
+  std::unordered_map<std::string_view, std::unique_ptr<Group>> m_groups;
   Group *m_currentGroup = nullptr;
   Locale m_locale;
 
@@ -9,9 +9,13 @@ bool DesktopEntryValueType::asBoolean() const { return m_value == "true"; }
 double DesktopEntryValueType::asNumber() const { return std::stod(std::string(m_value)); }
 
 std::string DesktopEntryValueType::asString() const {
+  if (m_value.find('\\') == std::string_view::npos) return std::string(m_value);
+
   std::string str;
   bool escaped = false;
 
+  str.reserve(m_value.size());
+
   for (const auto &c : m_value) {
     if (escaped) {
       char ch = getEscapeChar(c);
@@ -4,6 +4,10 @@
 #include <vector>
 
 namespace xdgpp {
+/**
+ * A raw value of a desktop entry, decoded on demand.
+ * It points into the data the value was parsed from.
+ */
 class DesktopEntryValueType {
 public:
   DesktopEntryValueType(std::string_view view);
@@ -16,6 +20,6 @@ public:
 private:
   static char getEscapeChar(char c);
 
-  std::string m_value;
+  std::string_view m_value;
 };
 } // namespace xdgpp
@@ -32,19 +32,19 @@ MimeAppsList::MimeAppsList(std::string_view data) {
 
   if (auto added = reader.group("Added Associations")) {
     for (const auto &[k, entry] : added->entries()) {
-      m_added[k] = DesktopEntryValueType(entry.value).asStringList();
+      m_added[std::string(k)] = DesktopEntryValueType(entry.value).asStringList();
     }
   }
 
   if (auto removed = reader.group("Removed Associations")) {
     for (const auto &[k, entry] : removed->entries()) {
-      m_removed[k] = DesktopEntryValueType(entry.value).asStringList();
+      m_removed[std::string(k)] = DesktopEntryValueType(entry.value).asStringList();
     }
   }
 
   if (auto dflt = reader.group("Default Applications")) {
     for (const auto &[k, entry] : dflt->entries()) {
-      m_default[k] = DesktopEntryValueType(entry.value).asStringList();
+      m_default[std::string(k)] = DesktopEntryValueType(entry.value).asStringList();
     }
   }
 }
@@ -0,0 +1,43 @@
+#include "mapped-file.hpp"
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+namespace xdgpp {
+
+MappedFile::MappedFile(const std::filesystem::path &path) {
+  int fd = open(path.c_str(), O_RDONLY | O_CLOEXEC);
+
+  if (fd == -1) return;
+
+  struct stat st;
+
+  if (fstat(fd, &st) == -1 || !S_ISREG(st.st_mode)) {
+    close(fd);
+    return;
+  }
+
+  m_size = st.st_size;
+
+  // zero-sized mappings are not allowed, an empty file is just an empty view
+  if (m_size > 0) {
+    void *data = mmap(nullptr, m_size, PROT_READ, MAP_PRIVATE, fd, 0);
+
+    if (data == MAP_FAILED) {
+      close(fd);
+      return;
+    }
+
+    m_data = data;
+  }
+
+  close(fd);
+  m_valid = true;
+}
+
+MappedFile::~MappedFile() {
+  if (m_data) munmap(m_data, m_size);
+}
+
+}; // namespace xdgpp
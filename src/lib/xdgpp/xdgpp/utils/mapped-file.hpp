@@ -0,0 +1,33 @@
+#pragma once
+#include <cstddef>
+#include <filesystem>
+#include <string_view>
+
+namespace xdgpp {
+
+/**
+ * Read-only memory mapping of a regular file, so that it can be parsed in place without being copied.
+ * Invalid if the file could not be opened, is not a regular file or could not be mapped.
+ */
+class MappedFile {
+public:
+  MappedFile(const std::filesystem::path &path);
+  ~MappedFile();
+
+  MappedFile(const MappedFile &) = delete;
+  MappedFile &operator=(const MappedFile &) = delete;
+
+  bool isValid() const { return m_valid; }
+
+  /**
+   * Content of the file. Only valid for the lifetime of the mapping.
+   */
+  std::string_view view() const { return {static_cast<const char *>(m_data), m_size}; }
+
+private:
+  void *m_data = nullptr;
+  size_t m_size = 0;
+  bool m_valid = false;
+};
+
+}; // namespace xdgpp
@@ -0,0 +1,90 @@
+#pragma once
+#include <cstdint>
+#include <istream>
+#include <optional>
+#include <ostream>
+#include <string>
+#include <vector>
+
+/**
+ * Minimal binary encoding used to serialize parsed desktop entries.
+ * Integers are written in host byte order: the output is a cache, not an exchange format.
+ * Readers leave the stream in a failed state on malformed input, callers only have to check it once
+ * they are done.
+ */
+namespace xdgpp::serialize {
+
+inline void writeU32(std::ostream &os, uint32_t n) {
+  os.write(reinterpret_cast<const char *>(&n), sizeof(n));
+}
+
+inline uint32_t readU32(std::istream &is) {
+  uint32_t n = 0;
+  is.read(reinterpret_cast<char *>(&n), sizeof(n));
+  return n;
+}
+
+inline void writeU64(std::ostream &os, uint64_t n) {
+  os.write(reinterpret_cast<const char *>(&n), sizeof(n));
+}
+
+inline uint64_t readU64(std::istream &is) {
+  uint64_t n = 0;
+  is.read(reinterpret_cast<char *>(&n), sizeof(n));
+  return n;
+}
+
+inline void writeBool(std::ostream &os, bool value) { os.put(value ? 1 : 0); }
+
+inline bool readBool(std::istream &is) { return is.get() == 1; }
+
+inline void writeString(std::ostream &os, const std::string &str) {
+  writeU32(os, str.size());
+  os.write(str.data(), str.size());
+}
+
+inline std::string readString(std::istream &is) {
+  // guards against allocating garbage sizes from a truncated or corrupted stream
+  static constexpr uint32_t MAX_STRING_SIZE = 1 << 20;
+  uint32_t size = readU32(is);
+
+  if (!is || size > MAX_STRING_SIZE) {
+    is.setstate(std::ios::failbit);
+    return {};
+  }
+
+  std::string str(size, '\0');
+  is.read(str.data(), size);
+
+  return str;
+}
+
+inline void writeOptional(std::ostream &os, const std::optional<std::string> &str) {
+  writeBool(os, str.has_value());
+  if (str) writeString(os, *str);
+}
+
+inline std::optional<std::string> readOptional(std::istream &is) {
+  if (!readBool(is)) return std::nullopt;
+  return readString(is);
+}
+
+inline void writeStringList(std::ostream &os, const std::vector<std::string> &list) {
+  writeU32(os, list.size());
+  for (const auto &str : list) {
+    writeString(os, str);
+  }
+}
+
+inline std::vector<std::string> readStringList(std::istream &is) {
+  std::vector<std::string> list;
+  uint32_t size = readU32(is);
+
+  for (uint32_t i = 0; i != size && is; ++i) {
+    list.emplace_back(readString(is));
+  }
+
+  return list;
+}
+
+}; // namespace xdgpp::serialize
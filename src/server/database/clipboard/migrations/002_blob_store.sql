@@ -0,0 +1,23 @@
+-- Offer contents are stored once per distinct content, in a file named after its hash (the blob id).
+-- Offers saved before this migration have no blob and keep being stored under their own id.
+
+CREATE TABLE IF NOT EXISTS blob (
+	id TEXT PRIMARY KEY,
+	size INTEGER NOT NULL,
+	ref_count INTEGER NOT NULL DEFAULT 0
+);
+
+ALTER TABLE data_offer ADD COLUMN blob_id TEXT;
+
+CREATE INDEX IF NOT EXISTS idx_data_offer_blob_id
+ON data_offer(
+	blob_id
+);
+
+-- blobs are referenced by the offers pointing to them, including the ones deleted along with
+-- their selection. Blobs that drop to zero references are garbage collected by the application.
+CREATE TRIGGER data_offer_blob_ai AFTER INSERT ON data_offer WHEN new.blob_id IS NOT NULL BEGIN
+  UPDATE blob SET ref_count = ref_count + 1 WHERE id = new.blob_id; END;
+
+CREATE TRIGGER data_offer_blob_ad AFTER DELETE ON data_offer WHEN old.blob_id IS NOT NULL BEGIN
+  UPDATE blob SET ref_count = ref_count - 1 WHERE id = old.blob_id; END;
@@ -0,0 +1,15 @@
+-- Files opened from vicinae, used to boost them in search results.
+-- This is kept separately from indexed_file so that it survives index rebuilds, and copied over
+-- to indexed_file so that ranking doesn't need a join.
+CREATE TABLE IF NOT EXISTS file_access (
+	path TEXT PRIMARY KEY,
+	access_count INT NOT NULL DEFAULT 0,
+	last_accessed_at INT NOT NULL
+);
+
+ALTER TABLE indexed_file ADD COLUMN access_count INT NOT NULL DEFAULT 0;
+ALTER TABLE indexed_file ADD COLUMN last_accessed_at INT;
+
+CREATE TRIGGER indexed_file_access_ai AFTER INSERT ON indexed_file 
+WHEN EXISTS (SELECT 1 FROM file_access WHERE path = new.path) BEGIN
+  UPDATE indexed_file SET (access_count, last_accessed_at) = (SELECT access_count, last_accessed_at FROM file_access WHERE path = new.path) WHERE id = new.id; END;
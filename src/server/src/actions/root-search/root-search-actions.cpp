@@ -83,7 +83,7 @@ ToggleItemAsFavorite::ToggleItemAsFavorite(const EntrypointId &id, bool currentV
 void DefaultActionWrapper::execute(ApplicationContext *ctx) {
   auto manager = ctx->services->rootItemManager();
 
-  if (manager->registerVisit(m_id)) {
+  if (manager->registerVisit(m_id, ctx->navigation->searchText().toStdString())) {
   } else {
     qWarning() << "Failed to register root item visit";
   }
@@ -0,0 +1,59 @@
+#pragma once
+#include <cstddef>
+#include <functional>
+#include <list>
+#include <optional>
+#include <unordered_map>
+#include <utility>
+
+/**
+ * Map holding at most `capacity` entries, evicting the least recently used one to make room for new ones.
+ * Lookups count as uses. Not thread safe.
+ */
+template <typename K, typename V, typename Hash = std::hash<K>> class LruCache {
+public:
+  explicit LruCache(size_t capacity) : m_capacity(capacity) {}
+
+  std::optional<V> get(const K &key) {
+    auto it = m_index.find(key);
+
+    if (it == m_index.end()) return std::nullopt;
+
+    m_entries.splice(m_entries.begin(), m_entries, it->second);
+
+    return it->second->second;
+  }
+
+  void put(const K &key, V value) {
+    if (auto it = m_index.find(key); it != m_index.end()) {
+      it->second->second = std::move(value);
+      m_entries.splice(m_entries.begin(), m_entries, it->second);
+      return;
+    }
+
+    if (m_capacity == 0) return;
+
+    if (m_entries.size() == m_capacity) {
+      m_index.erase(m_entries.back().first);
+      m_entries.pop_back();
+    }
+
+    m_entries.emplace_front(key, std::move(value));
+    m_index.emplace(key, m_entries.begin());
+  }
+
+  void clear() {
+    m_entries.clear();
+    m_index.clear();
+  }
+
+  size_t size() const { return m_entries.size(); }
+
+private:
+  using Entries = std::list<std::pair<K, V>>;
+
+  size_t m_capacity;
+  // most recently used first
+  Entries m_entries;
+  std::unordered_map<K, typename Entries::iterator, Hash> m_index;
+};
@@ -97,7 +97,14 @@ public:
     watcherPaths.setDescription("Semicolon-separated list of paths watched by experimental watcher");
     watcherPaths.setDefaultValue("");
 
-    return {indexing, paths, excludedPaths, watcherPaths};
+    auto inMemoryIndex = Preference::makeCheckbox("inMemoryIndex");
+    inMemoryIndex.setTitle("In-memory index");
+    inMemoryIndex.setDescription(
+        "Keep an in-memory index of file names, which allows matching anywhere in a name (not just at word "
+        "starts) as well as approximate matches. Uses roughly 150MB of memory per million files.");
+    inMemoryIndex.setDefaultValue(false);
+
+    return {indexing, paths, excludedPaths, watcherPaths, inMemoryIndex};
   }
 
   void preferenceValuesChanged(const QJsonObject &preferences) const override {
@@ -18,6 +18,8 @@ RootSearchController::RootSearchController(RootItemManager *manager, FileService
   connect(&m_calculatorDebounce, &QTimer::timeout, this, &RootSearchController::startCalculator);
   connect(&m_calcWatcher, &CalculatorWatcher::finished, this,
           &RootSearchController::handleCalculatorFinished);
+  connect(&m_fileWatcher, &FileSearchWatcher::resultsReadyAt, this,
+          &RootSearchController::handleFileSearchResultsReady);
   connect(&m_fileWatcher, &FileSearchWatcher::finished, this,
           &RootSearchController::handleFileSearchFinished);
 
@@ -63,7 +65,7 @@ void RootSearchController::setFilter(std::string_view text) {
     }
   }
 
-  auto items = m_manager->search(m_query.c_str());
+  auto items = m_manager->search(m_query.c_str(), {.limit = MAX_SEARCH_RESULTS});
 
   m_model->setSearchResults({
       .query = std::string(text),
@@ -111,7 +113,9 @@ void RootSearchController::startCalculator() {
 }
 
 void RootSearchController::handleCalculatorFinished() {
-  if (!m_calcWatcher.isFinished() || m_calculatorSearchQuery != m_query) return;
+  // superseded computations finish without a result
+  if (!m_calcWatcher.isFinished() || m_calcWatcher.future().resultCount() == 0) return;
+  if (m_calculatorSearchQuery != m_query) return;
   if (auto res = m_calcWatcher.result()) { m_model->setCalculatorResult(res.value()); }
 }
 
@@ -119,13 +123,29 @@ void RootSearchController::startFileSearch() {
   if (m_isFileSearchEnabled && m_query.size() >= MIN_FS_TEXT_LENGTH) {
     if (m_fileWatcher.isRunning()) { m_fileWatcher.cancel(); }
     m_fileSearchQuery = m_query;
-    m_fileWatcher.setFuture(m_fs->queryAsync(m_query));
+    m_fileSearchChunkCount = 0;
+    m_fileWatcher.setFuture(m_fs->queryStreamAsync(m_query));
+  }
+}
+
+void RootSearchController::handleFileSearchResultsReady(int begin, int end) {
+  if (m_fileSearchQuery != m_query) return;
+
+  auto future = m_fileWatcher.future();
+
+  for (int i = begin; i != end; ++i) {
+    // first chunk replaces the results of the previous search
+    if (m_fileSearchChunkCount++ == 0) {
+      m_model->setFileResults(future.resultAt(i));
+    } else {
+      m_model->appendFileResults(future.resultAt(i));
+    }
   }
 }
 
 void RootSearchController::handleFileSearchFinished() {
-  if (!m_fileWatcher.isFinished() || m_fileSearchQuery != m_query) return;
-  m_model->setFileResults(m_fileWatcher.result());
+  if (!m_fileWatcher.isFinished() || m_fileWatcher.isCanceled() || m_fileSearchQuery != m_query) return;
+  if (m_fileSearchChunkCount == 0) { m_model->setFileResults({}); }
   m_fileSearchQuery.clear();
 }
 
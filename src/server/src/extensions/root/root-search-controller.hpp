@@ -30,6 +30,7 @@ private slots:
   void startCalculator();
   void handleCalculatorFinished();
   void startFileSearch();
+  void handleFileSearchResultsReady(int begin, int end);
   void handleFileSearchFinished();
   void handleItemsChanged();
   void handleFallbackChanged();
@@ -37,6 +38,8 @@ private slots:
 
 private:
   static constexpr const int MIN_FS_TEXT_LENGTH = 3;
+  // nobody scrolls further than that, short queries can match thousands of windows and tabs
+  static constexpr const size_t MAX_SEARCH_RESULTS = 500;
 
   RootSearchModel *m_model = nullptr;
   RootItemManager *m_manager = nullptr;
@@ -52,6 +55,8 @@ private:
 
   std::string m_query;
   std::string m_fileSearchQuery;
+  // number of result chunks received for the current file search
+  int m_fileSearchChunkCount = 0;
   std::string m_calculatorSearchQuery;
   bool m_isFileSearchEnabled = false;
 };
@@ -40,6 +40,11 @@ void RootSearchModel::setFileResults(const std::vector<IndexerFileResult> &files
   emit dataChanged();
 }
 
+void RootSearchModel::appendFileResults(const std::vector<IndexerFileResult> &files) {
+  m_files.insert(m_files.end(), files.begin(), files.end());
+  emit dataChanged();
+}
+
 void RootSearchModel::setFallbackItems(const std::vector<std::shared_ptr<RootItem>> &items) {
   m_fallbackItems = items;
 }
@@ -67,6 +67,7 @@ public:
   void setItems(std::vector<RootItemManager::ScoredItem> items);
   void setCalculatorResult(const AbstractCalculatorBackend::CalculatorResult &result);
   void setFileResults(const std::vector<IndexerFileResult> &files);
+  void appendFileResults(const std::vector<IndexerFileResult> &files);
   void setFallbackItems(const std::vector<std::shared_ptr<RootItem>> &items);
   void setFavorites(const std::vector<std::shared_ptr<RootItem>> &favorites);
   void setDefaultOpener(const LinkItem &opener);
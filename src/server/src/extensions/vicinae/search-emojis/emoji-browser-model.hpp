@@ -14,7 +14,7 @@ public:
 
   void setGroupedEmojis(EmojiService::GroupedEmojis emojis) { m_grouped = emojis; }
 
-  void setSearchResults(std::span<Scored<const EmojiData *>> results) { m_results = results; }
+  void setSearchResults(std::vector<Scored<const EmojiData *>> results) { m_results = std::move(results); }
 
   void setPinnedEmojis(std::vector<const EmojiData *> pinned) { m_pinned = pinned; }
 
@@ -109,7 +109,7 @@ private:
   }
 
   bool m_root = true;
-  std::span<Scored<const EmojiData *>> m_results;
+  std::vector<Scored<const EmojiData *>> m_results;
   std::vector<const EmojiData *> m_pinned;
   std::vector<const EmojiData *> m_recent;
   EmojiService::GroupedEmojis m_grouped;
@@ -123,6 +123,8 @@ IpcCommandServer::IpcCommandServer(ApplicationContext *ctx, QWidget *parent)
     auto view = new DMenu::View(request);
     auto watcher = new Watcher;
 
+    if (request.stream) { ctx.caller->dmenu = view; }
+
     watcher->setFuture(future);
 
     QObject::connect(watcher, &Watcher::canceled, [nav = nav.get()]() { nav->closeWindow(); });
@@ -148,6 +150,16 @@ IpcCommandServer::IpcCommandServer(ApplicationContext *ctx, QWidget *parent)
     return future;
   });
 
+  m_rpc.route<ipc::DMenuAppend>([](const ipc::DMenuAppend::Request &req,
+                                   Ctx ctx) -> std::expected<ipc::DMenuAppend::Response, std::string> {
+    // the view may have been closed before the input ended
+    if (!ctx.caller->dmenu) { return std::unexpected("No streaming dmenu opened by this client"); }
+
+    ctx.caller->dmenu->appendContent(req.data, req.eof);
+
+    return ipc::DMenuAppend::Response();
+  });
+
   m_rpc.route<ipc::Deeplink>(
       [](const ipc::Deeplink::Request &req, Ctx ctx) -> std::expected<ipc::Deeplink::Response, std::string> {
         IpcCommandHandler handler(*ctx.global->app);
@@ -2,6 +2,7 @@
 #include "common/context.hpp"
 #include <QLocalSocket>
 #include <QFutureWatcher>
+#include <QPointer>
 #include <cstdint>
 #include <QDebug>
 #include <format>
@@ -15,8 +16,12 @@
 #include "common/qt.hpp"
 #include "types.hpp"
 
-using ServerSchema = ipc::RpcSchema<ipc::DMenu, ipc::Deeplink, ipc::Ping, ipc::LaunchApp, ipc::BrowserInit,
-                                    ipc::BrowserTabsChanged>;
+using ServerSchema = ipc::RpcSchema<ipc::DMenu, ipc::DMenuAppend, ipc::Deeplink, ipc::Ping, ipc::LaunchApp,
+                                    ipc::BrowserInit, ipc::BrowserTabsChanged>;
+
+namespace DMenu {
+class View;
+};
 
 using Watcher = QFutureWatcher<glz::raw_json>;
 
@@ -28,6 +33,8 @@ struct ClientInfo {
   } frame;
   std::vector<QObjectUniquePtr<Watcher>> m_pending;
   std::optional<ipc::BrowserInit::Request> browser;
+  // dmenu opened by this client in streaming mode, fed by its DMenuAppend notifications
+  QPointer<DMenu::View> dmenu;
 
   void sendMessage(std::string_view message) {
     uint32_t size = message.size();
@@ -1,4 +1,5 @@
 #include "crypto.hpp"
+#include <algorithm>
 #include <expected>
 #include <openssl/rand.h>
 #include <QDebug>
@@ -47,6 +48,56 @@ std::expected<QByteArray, EncryptError> encrypt(const QByteArray &data, const QB
   return iv + ciphertext + tag;
 }
 
+std::expected<void, EncryptError> encrypt(const QByteArray &data, const QByteArray &key, QIODevice &out) {
+  static constexpr const qsizetype CHUNK_SIZE = 1024 * 1024;
+  QByteArray iv(12, 0);
+
+  RAND_bytes(reinterpret_cast<unsigned char *>(iv.data()), iv.size());
+
+  if (out.write(iv) != iv.size()) return std::unexpected(EncryptError::OpenSslError);
+
+  EVP_CIPHER_CTX *ctx = EVP_CIPHER_CTX_new();
+  EVP_EncryptInit_ex(ctx, EVP_aes_256_gcm(), nullptr,
+                     reinterpret_cast<const unsigned char *>(key.constData()),
+                     reinterpret_cast<const unsigned char *>(iv.constData()));
+
+  // GCM is a stream mode: ciphertext is as long as the plaintext, and final produces nothing
+  QByteArray chunk(std::min(CHUNK_SIZE, data.size()), 0);
+  int len = 0;
+
+  for (qsizetype offset = 0; offset < data.size(); offset += CHUNK_SIZE) {
+    int size = std::min(CHUNK_SIZE, data.size() - offset);
+
+    if (EVP_EncryptUpdate(ctx, reinterpret_cast<unsigned char *>(chunk.data()), &len,
+                          reinterpret_cast<const unsigned char *>(data.constData() + offset), size) != 1 ||
+        out.write(chunk.constData(), len) != len) {
+      EVP_CIPHER_CTX_free(ctx);
+      return std::unexpected(EncryptError::OpenSslError);
+    }
+  }
+
+  unsigned char finalBlock[16];
+
+  if (EVP_EncryptFinal_ex(ctx, finalBlock, &len) != 1 ||
+      out.write(reinterpret_cast<const char *>(finalBlock), len) != len) {
+    EVP_CIPHER_CTX_free(ctx);
+    return std::unexpected(EncryptError::OpenSslError);
+  }
+
+  QByteArray tag(16, 0);
+
+  if (EVP_CIPHER_CTX_ctrl(ctx, EVP_CTRL_GCM_GET_TAG, 16, tag.data()) != 1) {
+    EVP_CIPHER_CTX_free(ctx);
+    return std::unexpected(EncryptError::OpenSslError);
+  }
+
+  EVP_CIPHER_CTX_free(ctx);
+
+  if (out.write(tag) != tag.size()) return std::unexpected(EncryptError::OpenSslError);
+
+  return {};
+}
+
 std::expected<QByteArray, DecryptError> decrypt(const QByteArray &encrypted, const QByteArray &key) {
   if (key.size() != 32) { return std::unexpected(DecryptError::InvalidKeySize); }
 
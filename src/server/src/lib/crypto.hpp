@@ -1,6 +1,7 @@
 #pragma once
 #include <expected>
 #include <QByteArray>
+#include <QIODevice>
 
 namespace Crypto::AES256GCM {
 enum class DecryptError {
@@ -13,6 +14,11 @@ enum class DecryptError {
 enum class EncryptError { OpenSslError };
 
 std::expected<QByteArray, EncryptError> encrypt(const QByteArray &dta, const QByteArray &ky);
+/**
+ * Same output as the in-memory `encrypt`, written to `out` chunk by chunk so that large payloads are
+ * never held twice in memory.
+ */
+std::expected<void, EncryptError> encrypt(const QByteArray &data, const QByteArray &key, QIODevice &out);
 std::expected<QByteArray, DecryptError> decrypt(const QByteArray &dta, const QByteArray &ky);
 QByteArray generateKey();
 } // namespace Crypto::AES256GCM
@@ -0,0 +1,56 @@
+#include "lib/fzf-unicode.hpp"
+#include <QString>
+
+namespace fzf {
+
+static size_t utf8SequenceLength(unsigned char lead) {
+  if (lead >= 0xF0) return 4;
+  if (lead >= 0xE0) return 3;
+  if (lead >= 0xC0) return 2;
+  return 1; // stray continuation byte, decodes to a replacement character
+}
+
+FoldedText foldText(std::string_view utf8) {
+  FoldedText folded;
+
+  folded.text.reserve(utf8.size());
+  folded.offsets.reserve(utf8.size());
+  folded.upper.reserve(utf8.size());
+
+  for (size_t i = 0; i < utf8.size();) {
+    auto lead = static_cast<unsigned char>(utf8[i]);
+
+    if (lead < 0x80) {
+      folded.text.push_back(foldAscii(static_cast<char32_t>(lead)));
+      folded.offsets.push_back(i++);
+      folded.upper.push_back(lead >= 'A' && lead <= 'Z');
+      continue;
+    }
+
+    size_t length = std::min(utf8SequenceLength(lead), utf8.size() - i);
+    QString decomposed =
+        QString::fromUtf8(utf8.data() + i, length).normalized(QString::NormalizationForm_KD);
+
+    for (char32_t cp : decomposed.toUcs4()) {
+      // diacritics are the non spacing marks the decomposition split from their base letter
+      if (QChar::category(cp) == QChar::Mark_NonSpacing) continue;
+
+      folded.text.push_back(QChar::toCaseFolded(cp));
+      folded.offsets.push_back(i);
+      folded.upper.push_back(QChar::category(cp) == QChar::Letter_Uppercase);
+    }
+
+    i += length;
+  }
+
+  folded.text.shrink_to_fit();
+  folded.offsets.shrink_to_fit();
+  folded.upper.shrink_to_fit();
+  folded.mask = charMask(folded.text);
+
+  return folded;
+}
+
+std::u32string foldQuery(std::string_view utf8) { return foldText(utf8).text; }
+
+} // namespace fzf
@@ -0,0 +1,22 @@
+#pragma once
+#include "lib/fzf.hpp"
+#include <string>
+#include <string_view>
+
+namespace fzf {
+
+/**
+ * Build the search form of a UTF-8 string: compatibility decomposed (NFKD), stripped of combining marks
+ * and case folded. "Éditeur de texte" becomes "editeur de texte", "ﬁ" becomes "fi" and full width forms
+ * become their ASCII counterpart.
+ *
+ * Meant to be called once, when a candidate is indexed, so that matching compares ready-made codepoints.
+ */
+FoldedText foldText(std::string_view utf8);
+
+/**
+ * Fold a query the same way candidates are, words are still separated by spaces.
+ */
+std::u32string foldQuery(std::string_view utf8);
+
+} // namespace fzf
@@ -17,6 +17,10 @@
 #include <string_view>
 #include <vector>
 
+#ifdef __SSE2__
+#include <emmintrin.h>
+#endif
+
 namespace fzf {
 
 // Scoring constants
@@ -30,6 +34,10 @@ constexpr const int BONUS_CAMEL123 = BONUS_BOUNDARY + SCORE_GAP_EXTENSION;
 constexpr const int BONUS_CONSECUTIVE = -(SCORE_GAP_START + SCORE_GAP_EXTENSION); // 4
 constexpr const int BONUS_FIRST_CHAR_MULTIPLIER = 2;
 
+template <typename CharT> constexpr CharT foldAscii(CharT c) {
+  return (c >= 'A' && c <= 'Z') ? c + ('a' - 'A') : c;
+}
+
 enum class CharClass : uint8_t { White = 0, NonWord, Delimiter, Lower, Upper, Letter, Number };
 
 struct Result {
@@ -42,13 +50,237 @@ struct Result {
   bool matched() const { return start >= 0; }
 };
 
+/**
+ * Summary of the characters a string contains, ignoring ASCII case: one bit per letter and digit, the
+ * remaining ASCII characters share the bits that are left and every non-ASCII byte maps to the last one.
+ *
+ * A pattern can only match a text that contains all of its characters, so a text whose mask misses
+ * bits of the pattern mask can be rejected without running the matcher. Computing the mask of the
+ * candidates ahead of time (when they are indexed) makes that rejection a single AND.
+ */
+using CharMask = uint64_t;
+
+// mask of a string we know nothing about, it never gets rejected
+constexpr const CharMask UNKNOWN_CHAR_MASK = ~CharMask(0);
+
+constexpr int charMaskBit(char32_t c) {
+  if (c >= 'a' && c <= 'z') return c - 'a';
+  if (c >= 'A' && c <= 'Z') return c - 'A';
+  if (c >= '0' && c <= '9') return 26 + c - '0';
+  if (c >= 128) return 63;
+  return 36 + c % 27;
+}
+
+template <typename CharT> constexpr CharMask basicCharMask(std::basic_string_view<CharT> str, bool isQuery) {
+  CharMask mask = 0;
+
+  for (CharT c : str) {
+    // in queries, spaces only separate words
+    if (isQuery && c == ' ') continue;
+    mask |= CharMask(1) << charMaskBit(static_cast<std::make_unsigned_t<CharT>>(c));
+  }
+
+  return mask;
+}
+
+constexpr CharMask charMask(std::string_view str) { return basicCharMask(str, false); }
+constexpr CharMask charMask(std::u32string_view str) { return basicCharMask(str, false); }
+
+/**
+ * Mask of the characters a text must contain to match `query`.
+ */
+constexpr CharMask queryCharMask(std::string_view query) { return basicCharMask(query, true); }
+constexpr CharMask queryCharMask(std::u32string_view query) { return basicCharMask(query, true); }
+
+/**
+ * Whether a text with mask `textMask` could match a pattern with mask `patternMask`.
+ */
+constexpr bool mayMatch(CharMask textMask, CharMask patternMask) { return (patternMask & ~textMask) == 0; }
+
+/**
+ * Whether every text `query` matches (as scored by `Matcher::fuzzy_match_v2_score_query`) is also matched
+ * by `previous`, in which case only the matches of `previous` have to be scored again.
+ *
+ * That is the case when `query` extends `previous`, unless `previous` has no word at all: such a query
+ * matches nothing, while the queries extending it can.
+ */
+constexpr bool narrowsQuery(std::string_view previous, std::string_view query) {
+  return query.starts_with(previous) && std::ranges::any_of(previous, [](char c) { return c != ' '; });
+}
+
+// bit to OR bytes with so that they compare equal to `folded` regardless of their case
+constexpr char caseFoldBit(char folded, bool caseSensitive) {
+  return (!caseSensitive && folded >= 'a' && folded <= 'z') ? 0x20 : 0;
+}
+
+/**
+ * Byte by byte version of `findByte`, also used for what is left once SIMD blocks don't fit.
+ */
+constexpr size_t findByteScalar(std::string_view text, size_t from, char c, bool caseSensitive) {
+  const char folded = caseSensitive ? c : foldAscii(c);
+  const char foldBit = caseFoldBit(folded, caseSensitive);
+
+  for (size_t i = from; i < text.size(); ++i) {
+    if ((text[i] | foldBit) == folded) return i;
+  }
+
+  return std::string_view::npos;
+}
+
+/**
+ * Byte by byte version of `rfindByte`.
+ */
+constexpr size_t rfindByteScalar(std::string_view text, size_t after, char c, bool caseSensitive) {
+  const char folded = caseSensitive ? c : foldAscii(c);
+  const char foldBit = caseFoldBit(folded, caseSensitive);
+
+  for (size_t end = text.size(); end > after + 1; --end) {
+    if ((text[end - 1] | foldBit) == folded) return end - 1;
+  }
+
+  return std::string_view::npos;
+}
+
+/**
+ * Position of the first byte at or after `from` equal to `c`, or to its other case if `c` is a letter
+ * and the search is case insensitive.
+ *
+ * Letters only differ from their other case by bit 0x20, so a case insensitive comparison is a single
+ * OR and compare per byte, which is done 16 bytes at a time when SSE2 is available.
+ */
+inline size_t findByte(std::string_view text, size_t from, char c, bool caseSensitive) {
+#ifdef __SSE2__
+  const char folded = caseSensitive ? c : foldAscii(c);
+  const char *data = text.data();
+  const size_t n = text.size();
+  const __m128i needle = _mm_set1_epi8(folded);
+  const __m128i fold = _mm_set1_epi8(caseFoldBit(folded, caseSensitive));
+  size_t i = from;
+
+  for (; i + 16 <= n; i += 16) {
+    __m128i block = _mm_loadu_si128(reinterpret_cast<const __m128i *>(data + i));
+    int hits = _mm_movemask_epi8(_mm_cmpeq_epi8(_mm_or_si128(block, fold), needle));
+    if (hits) return i + __builtin_ctz(hits);
+  }
+
+  // the tail is covered by a last block overlapping what was already scanned
+  if (i < n && n >= 16) {
+    __m128i block = _mm_loadu_si128(reinterpret_cast<const __m128i *>(data + n - 16));
+    int hits = _mm_movemask_epi8(_mm_cmpeq_epi8(_mm_or_si128(block, fold), needle)) >> (i - (n - 16));
+    return hits ? i + __builtin_ctz(hits) : std::string_view::npos;
+  }
+
+  return findByteScalar(text, i, c, caseSensitive);
+#else
+  return findByteScalar(text, from, c, caseSensitive);
+#endif
+}
+
+/**
+ * Same as `findByte`, looking for the last occurrence after `after`.
+ */
+inline size_t rfindByte(std::string_view text, size_t after, char c, bool caseSensitive) {
+#ifdef __SSE2__
+  const char folded = caseSensitive ? c : foldAscii(c);
+  const char *data = text.data();
+  const __m128i needle = _mm_set1_epi8(folded);
+  const __m128i fold = _mm_set1_epi8(caseFoldBit(folded, caseSensitive));
+  size_t end = text.size();
+
+  for (; end >= after + 1 + 16; end -= 16) {
+    __m128i block = _mm_loadu_si128(reinterpret_cast<const __m128i *>(data + end - 16));
+    int hits = _mm_movemask_epi8(_mm_cmpeq_epi8(_mm_or_si128(block, fold), needle));
+    if (hits) return end - 16 + (31 - __builtin_clz(hits));
+  }
+
+  return rfindByteScalar(text.substr(0, end), after, c, caseSensitive);
+#else
+  return rfindByteScalar(text, after, c, caseSensitive);
+#endif
+}
+
 struct WeightedString {
   std::string_view str;
   float weight;
+  CharMask mask = UNKNOWN_CHAR_MASK;
+};
+
+/**
+ * What the matcher needs to know about a folded string (see fzf::FoldedText), without owning it: search
+ * indexes pack many of them in a single buffer.
+ */
+struct FoldedView {
+  std::u32string_view text;
+  // one flag per codepoint of `text`
+  const uint8_t *upper = nullptr;
+  CharMask mask = UNKNOWN_CHAR_MASK;
+};
+
+/**
+ * Search form of a UTF-8 string, built by fzf::foldText (lib/fzf-unicode.hpp) when a candidate is
+ * indexed: one normalized codepoint per element, so that matching never has to normalize anything.
+ */
+struct FoldedText {
+  std::u32string text;
+  // byte offset, in the original string, of the character each codepoint comes from
+  std::vector<uint32_t> offsets;
+  // whether each codepoint was upper case before folding, which still counts for camelCase bonuses
+  std::vector<uint8_t> upper;
+  CharMask mask = 0;
+
+  FoldedView view() const { return {.text = text, .upper = upper.data(), .mask = mask}; }
+
+  /**
+   * Translate positions of a match over `text` into byte offsets in the original string, for
+   * highlighting. A character decomposed into several codepoints is only reported once.
+   */
+  std::vector<int> sourcePositions(const std::vector<int> &positions) const {
+    std::vector<int> result;
+
+    result.reserve(positions.size());
+
+    for (int pos : positions) {
+      int offset = offsets[pos];
+      if (result.empty() || result.back() != offset) result.emplace_back(offset);
+    }
+
+    return result;
+  }
+};
+
+struct WeightedFoldedText {
+  FoldedView text;
+  float weight;
 };
 
 enum class Scheme { Default, Path, History };
 
+/**
+ * Working memory of the matching algorithm.
+ * Buffers only ever grow, so once warmed up matching no longer allocates.
+ *
+ * A scratch must not be used by several threads at the same time: callers either own one per thread
+ * or use the matcher overloads that don't take one, which use `threadScratch()`.
+ */
+struct Scratch {
+  std::vector<int> H0; // Score for first pattern char
+  std::vector<int> C0; // Consecutive count for first char
+  std::vector<int> B;  // Bonus for each position
+  std::vector<int> F;  // First occurrence of each pattern char
+  std::vector<char> T; // Normalized text
+  std::vector<int> H;  // Score matrix
+  std::vector<int> C;  // Consecutive match matrix
+};
+
+inline Scratch &threadScratch() {
+  static thread_local Scratch scratch;
+  return scratch;
+}
+
+/**
+ * Matchers are immutable once constructed, all the per-match state lives in a Scratch.
+ * They can therefore be shared between threads.
+ */
 class Matcher {
 public:
   explicit Matcher(Scheme scheme = Scheme::Default) : m_scheme_(scheme) {
@@ -106,15 +338,77 @@ public:
     requires std::same_as<std::ranges::range_value_t<R>, WeightedString>
   int fuzzy_match_v2_score_query(R &&weightedStrs, std::string_view query,
                                  bool case_sensitive = false) const {
+    return fuzzy_match_v2_score_query(std::forward<R>(weightedStrs), query, threadScratch(), case_sensitive);
+  }
+
+  template <std::ranges::input_range R>
+    requires std::same_as<std::ranges::range_value_t<R>, WeightedString>
+  int fuzzy_match_v2_score_query(R &&weightedStrs, std::string_view query, Scratch &scratch,
+                                 bool case_sensitive = false) const {
+    return score_query(std::forward<R>(weightedStrs), query, scratch);
+  }
+
+  /**
+   * Variants working on folded text and query (see fzf::FoldedText), codepoint by codepoint.
+   * Folding already took care of case and diacritics.
+   */
+  template <std::ranges::input_range R>
+    requires std::same_as<std::ranges::range_value_t<R>, WeightedFoldedText>
+  int fuzzy_match_v2_score_query(R &&weightedTexts, std::u32string_view query) const {
+    return score_query(std::forward<R>(weightedTexts), query, threadScratch());
+  }
+
+  template <std::ranges::input_range R>
+    requires std::same_as<std::ranges::range_value_t<R>, WeightedFoldedText>
+  int fuzzy_match_v2_score_query(R &&weightedTexts, std::u32string_view query, Scratch &scratch) const {
+    return score_query(std::forward<R>(weightedTexts), query, scratch);
+  }
+
+  int fuzzy_match_v2_score_query(std::string_view text, std::string_view query,
+                                 bool case_sensitive = false) const {
+    return fuzzy_match_v2_score_query(text, query, threadScratch(), case_sensitive);
+  }
+
+  int fuzzy_match_v2_score_query(std::string_view text, std::string_view query, Scratch &scratch,
+                                 bool case_sensitive = false) const {
+    std::initializer_list<WeightedString> lst{{text, 1.0f}};
+    return fuzzy_match_v2_score_query(std::views::concat(lst), query, scratch, case_sensitive);
+  }
+
+  Result fuzzy_match_v2(std::string_view text, std::string_view pattern, bool case_sensitive = false,
+                        bool with_pos = false) const {
+    return fuzzy_match_v2(text, pattern, threadScratch(), case_sensitive, with_pos);
+  }
+
+  Result fuzzy_match_v2(std::string_view text, std::string_view pattern, Scratch &scratch,
+                        bool case_sensitive = false, bool with_pos = false) const {
+    return match(text, pattern, scratch, case_sensitive, with_pos);
+  }
+
+  Result fuzzy_match_v2(const FoldedView &text, std::u32string_view pattern, bool with_pos = false) const {
+    return fuzzy_match_v2(text, pattern, threadScratch(), with_pos);
+  }
+
+  Result fuzzy_match_v2(const FoldedView &text, std::u32string_view pattern, Scratch &scratch,
+                        bool with_pos = false) const {
+    return match(text.text, pattern, scratch, false, with_pos, text.upper);
+  }
+
+private:
+  template <typename CharT, typename R>
+  int score_query(R &&weightedStrs, std::basic_string_view<CharT> query, Scratch &scratch) const {
+    using StringView = std::basic_string_view<CharT>;
     int globalScore = 0;
     int globalCount = 0;
-    auto words = std::views::split(query, std::string_view{" "}) |
-                 std::views::transform([](auto &&part) { return std::string_view{part}; }) |
+    auto words = std::views::split(query, CharT(' ')) |
+                 std::views::transform([](auto &&part) { return StringView{part}; }) |
                  std::views::filter([](auto &&s) { return !s.empty(); });
 
     for (auto word : words) {
-      int maxScore = std::ranges::max(weightedStrs | std::views::transform([&](const WeightedString &str) {
-                                        return fuzzy_match_v2(str.str, word, false, false).score * str.weight;
+      CharMask wordMask = charMask(word);
+      int maxScore = std::ranges::max(weightedStrs | std::views::transform([&](const auto &str) {
+                                        if (!mayMatch(mask_of(str), wordMask)) return 0.0f;
+                                        return match_weighted(str, word, scratch).score * str.weight;
                                       }));
 
       if (!maxScore) return 0;
@@ -126,14 +420,26 @@ public:
     return globalCount != 0 ? globalScore / globalCount : 0;
   }
 
-  int fuzzy_match_v2_score_query(std::string_view text, std::string_view query,
-                                 bool case_sensitive = false) const {
-    std::initializer_list<WeightedString> lst{{text, 1.0f}};
-    return fuzzy_match_v2_score_query(std::views::concat(lst), query, case_sensitive);
+  static CharMask mask_of(const WeightedString &str) { return str.mask; }
+  static CharMask mask_of(const WeightedFoldedText &str) { return str.text.mask; }
+
+  Result match_weighted(const WeightedString &str, std::string_view word, Scratch &scratch) const {
+    return match(str.str, word, scratch, false, false);
   }
 
-  Result fuzzy_match_v2(std::string_view text, std::string_view pattern, bool case_sensitive = false,
-                        bool with_pos = false) const {
+  Result match_weighted(const WeightedFoldedText &str, std::u32string_view word, Scratch &scratch) const {
+    return match(str.text.text, word, scratch, false, false, str.text.upper);
+  }
+
+  /**
+   * The algorithm itself, over bytes (folding ASCII case unless `case_sensitive`) or over codepoints
+   * that were folded beforehand, in which case `upper` tells which ones were upper case.
+   */
+  template <typename CharT>
+  Result match(std::basic_string_view<CharT> text, std::basic_string_view<CharT> pattern, Scratch &scratch,
+               bool case_sensitive, bool with_pos, const uint8_t *upper = nullptr) const {
+    static constexpr bool isBytes = std::same_as<CharT, char>;
+    auto &[H0, C0, B, F, T, H, C] = scratch;
     const int M = static_cast<int>(pattern.length());
     const int N = static_cast<int>(text.length());
 
@@ -150,40 +456,52 @@ public:
     C0.resize(search_len);
     B.resize(search_len);
     F.resize(M);
-    T.resize(search_len);
+    if constexpr (isBytes) { T.resize(search_len); }
 
     // Phase 2: Calculate bonus for each position and find first occurrences
     int max_score = 0;
     int max_score_pos = 0;
     int pidx = 0;
     int last_idx = 0;
-    char pchar0 = std::tolower(static_cast<unsigned char>(pattern[0]));
-    char pchar = pchar0;
+    // folded the same way as the text is
+    auto fold_pattern = [&](int i) { return case_sensitive ? pattern[i] : foldAscii(pattern[i]); };
+    CharT pchar0 = fold_pattern(0);
+    CharT pchar = pchar0;
     int prev_h0 = 0;
     CharClass prev_class = m_initial_char_class;
     bool in_gap = false;
 
     for (int off = 0; off < search_len; ++off) {
-      char c = text[min_idx + off];
-      T[off] = case_sensitive ? c : std::tolower(static_cast<unsigned char>(c));
+      CharT c = text[min_idx + off];
+      CharT t = c;
+
+      if constexpr (isBytes) {
+        t = case_sensitive ? c : foldAscii(c);
+        T[off] = t;
+      }
 
       CharClass cls = char_class_of(c);
+
+      if constexpr (!isBytes) {
+        if (cls == CharClass::Lower && upper && upper[min_idx + off]) { cls = CharClass::Upper; }
+      }
+
       int bonus = bonus_matrix_[static_cast<int>(prev_class)][static_cast<int>(cls)];
       B[off] = bonus;
       prev_class = cls;
 
       // Track first occurrence of each pattern character
-      if (T[off] == pchar) {
+      if (t == pchar) {
         if (pidx < M) {
           F[pidx] = off;
           pidx++;
-          pchar = pidx < M ? std::tolower(static_cast<unsigned char>(pattern[pidx])) : pchar;
+          pchar = pidx < M ? fold_pattern(pidx) : pchar;
         }
         last_idx = off;
       }
 
       // Calculate score for first pattern character
-      if (T[off] == pchar0) {
+      if (t == pchar0) {
         int score = SCORE_MATCH + bonus * BONUS_FIRST_CHAR_MULTIPLIER;
         H0[off] = score;
         C0[off] = 1;
@@ -214,6 +532,15 @@ public:
     }
 
     // Phase 3: Fill in score matrix (dynamic programming)
+    // folded codepoints are compared as they are, bytes were folded into T
+    const CharT *folded = nullptr;
+
+    if constexpr (isBytes) {
+      folded = T.data();
+    } else {
+      folded = text.data() + min_idx;
+    }
+
     const int f0 = F[0];
     const int width = last_idx - f0 + 1;
 
@@ -227,10 +554,14 @@ public:
     // Fill remaining rows
     for (int i = 1; i < M; ++i) {
       const int f = F[i];
-      const char pc = std::tolower(static_cast<unsigned char>(pattern[i]));
+      const CharT pc = fold_pattern(i);
       const int row = i * width;
       in_gap = false;
 
+      // the cell left of the first one in the row is never computed, don't read whatever a previous
+      // match left in the scratch
+      H[row + f - f0 - 1] = 0;
+
       for (int j = f; j <= last_idx; ++j) {
         const int col = j - f0;
         const int offset = row + col;
@@ -246,7 +577,7 @@ public:
         }
 
         // Character match
-        if (T[j] == pc) {
+        if (folded[j] == pc) {
           s1 = H[offset - width - 1] + SCORE_MATCH;
           int b = B[j];
           consecutive = C[offset - width - 1] + 1;
@@ -312,8 +643,9 @@ public:
           i--;
         }
 
-        prefer_match =
-            C[I + j0] > 1 || (I + width + j0 + 1 < static_cast<int>(C.size()) && C[I + width + j0 + 1] > 0);
+        // only look at the next row's cell if it was computed by this match, not a previous one
+        bool next_computed = i + 1 < M && j + 1 >= F[i + 1] && j + 1 <= last_idx;
+        prefer_match = C[I + j0] > 1 || (next_computed && C[I + width + j0 + 1] > 0);
         j--;
       }
 
@@ -324,7 +656,6 @@ public:
     return result;
   }
 
-private:
   // Helper: Get character class
   CharClass char_class_of(char c) const {
     if (static_cast<unsigned char>(c) < 128) { return ascii_char_classes_[static_cast<unsigned char>(c)]; }
@@ -337,6 +668,12 @@ private:
     return CharClass::NonWord;
   }
 
+  // folded text has no upper case left, and NFKD turned exotic spaces and digits into ASCII ones
+  CharClass char_class_of(char32_t c) const {
+    if (c < 128) { return ascii_char_classes_[c]; }
+    return CharClass::Letter;
+  }
+
   // Calculate bonus for character class transition
   int bonus_for(CharClass prev_class, CharClass class_) const {
     if (class_ > CharClass::NonWord) {
@@ -363,9 +700,27 @@ private:
     return 0;
   }
 
+  static size_t find_char(std::string_view text, size_t from, char c, bool case_sensitive) {
+    return findByte(text, from, c, case_sensitive);
+  }
+
+  static size_t rfind_char(std::string_view text, size_t after, char c, bool case_sensitive) {
+    return rfindByte(text, after, c, case_sensitive);
+  }
+
+  static size_t find_char(std::u32string_view text, size_t from, char32_t c, bool) {
+    return text.find(c, from);
+  }
+
+  static size_t rfind_char(std::u32string_view text, size_t after, char32_t c, bool) {
+    size_t found = text.rfind(c);
+    return found != std::u32string_view::npos && found > after ? found : std::u32string_view::npos;
+  }
+
   // ASCII fast path to find pattern boundaries
-  std::pair<int, int> ascii_fuzzy_index(std::string_view text, std::string_view pattern,
-                                        bool case_sensitive) const {
+  template <typename CharT>
+  std::pair<int, int> ascii_fuzzy_index(std::basic_string_view<CharT> text,
+                                        std::basic_string_view<CharT> pattern, bool case_sensitive) const {
     if (pattern.empty()) return {0, static_cast<int>(text.length())};
 
     int first_idx = 0;
@@ -373,26 +728,7 @@ private:
     size_t idx = 0;
 
     for (size_t pidx = 0; pidx < pattern.length(); ++pidx) {
-      char p = pattern[pidx];
-      char p_lower = std::tolower(static_cast<unsigned char>(p));
-      char p_upper = std::toupper(static_cast<unsigned char>(p));
-
-      // Find next occurrence
-      size_t found = std::string_view::npos;
-      if (case_sensitive) {
-        found = text.find(p, idx);
-      } else {
-        // Search for both cases
-        size_t lower_pos = text.find(p_lower, idx);
-        size_t upper_pos = text.find(p_upper, idx);
-        if (lower_pos != std::string_view::npos && upper_pos != std::string_view::npos) {
-          found = std::min(lower_pos, upper_pos);
-        } else if (lower_pos != std::string_view::npos) {
-          found = lower_pos;
-        } else {
-          found = upper_pos;
-        }
-      }
+      size_t found = find_char(text, idx, pattern[pidx], case_sensitive);
 
       if (found == std::string_view::npos) { return {-1, -1}; }
 
@@ -402,53 +738,25 @@ private:
     }
 
     // Find last occurrence of last character
-    char last_char = pattern.back();
-    char last_lower = std::tolower(static_cast<unsigned char>(last_char));
-    char last_upper = std::toupper(static_cast<unsigned char>(last_char));
-
-    for (int i = static_cast<int>(text.length()) - 1; i > last_idx; --i) {
-      char c = text[i];
-      if (c == last_char || (!case_sensitive && (c == last_lower || c == last_upper))) {
-        return {first_idx, i + 1};
-      }
-    }
+    size_t last = rfind_char(text, last_idx, pattern.back(), case_sensitive);
 
-    return {first_idx, last_idx + 1};
-  }
+    if (last != std::string_view::npos) { return {first_idx, static_cast<int>(last) + 1}; }
 
-  size_t cacheKey(std::string_view txt, std::string_view pattern) const {
-    std::string s;
-    s.reserve(txt.size() + pattern.size() + 1);
-    std::ranges::copy(txt, std::back_inserter(s));
-    std::ranges::copy("\0", std::back_inserter(s));
-    std::ranges::copy(pattern, std::back_inserter(s));
-    return std::hash<std::string>()(s);
+    return {first_idx, last_idx + 1};
   }
 
   Scheme m_scheme_;
   int m_bonus_boundary_white;
   int m_bonus_boundary_delimiter;
-  std::string m_delimiter_chars;
+  std::string_view m_delimiter_chars;
   CharClass m_initial_char_class;
   std::array<CharClass, 128> ascii_char_classes_;
   std::array<std::array<int, 8>, 8> bonus_matrix_;
-
-  // we reuse these vectors across search in order to not allocate on every search
-  // this is what makes this matcher non thread safe,
-
-  mutable std::vector<int> H0; // Score for first pattern char
-  mutable std::vector<int> C0; // Consecutive count for first char
-  mutable std::vector<int> B;  // Bonus for each position
-  mutable std::vector<int> F;  // First occurrence of each pattern char
-  mutable std::vector<char> T; // Normalized text
-  mutable std::vector<int> H;  // Score matrix
-  mutable std::vector<int> C;  // Consecutive match matrix
 };
 
 /**
- * Non thread-safe global instance
- * If doing fuzzy matching work across threads, you need one matcher per thread.
+ * Shared instance, safe to use from any thread.
  */
-static const Matcher defaultMatcher;
+inline const Matcher defaultMatcher;
 
 } // namespace fzf
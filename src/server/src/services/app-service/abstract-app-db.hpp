@@ -7,6 +7,7 @@
 #include <qtmetamacros.h>
 #include <qurl.h>
 #include <quuid.h>
+#include <vector>
 #include "proto/application.pb.h"
 
 class AbstractApplication {
@@ -75,7 +76,13 @@ public:
 
   virtual std::optional<QString> windowClass() const { return std::nullopt; }
 
-  virtual bool matchesWindowClass(const QString &wmClass) const { return false; }
+  /**
+   * Window classes that windows of this application can have, normalized using `normalizeWindowClass`.
+   * The window manager indexes windows by these so that finding the windows of an app is cheap.
+   */
+  virtual std::vector<QString> windowClasses() const { return {}; }
+
+  static QString normalizeWindowClass(const QString &wmClass) { return wmClass.toLower().remove(".desktop"); }
 
   /**
    * A short multiline description that explains what the app does.
@@ -132,6 +139,15 @@ public:
    */
   virtual bool scan(const std::vector<std::filesystem::path> &paths) = 0;
 
+  /**
+   * Called when the content of `dir`, one of the watched search paths, changed.
+   * Implementers that can update their database incrementally only need to look at that directory; by
+   * default, a full scan is performed.
+   */
+  virtual bool refresh(const std::filesystem::path &dir, const std::vector<std::filesystem::path> &paths) {
+    return scan(paths);
+  }
+
   /**
    * Launch an instance of the application with the provided set of arguments.
    * How this is done is very implementation dependent but a few things are to be kept in mind:
@@ -112,10 +112,12 @@ std::shared_ptr<AbstractApplication> AppService::find(const QString &target) con
 
 void AppService::handleDirectoryChanged(const QString &path) {
   // This event can fire multiple times for a single change.
-  // Since scanning apps is fast we don't really need to batch events, at least for now.
+  // Only the files of that directory that changed are parsed again, so we don't really need to batch events,
+  // at least for now.
 
-  qInfo() << "app directory" << path << "changed, launching a new scan";
-  scanSync();
+  qInfo() << "app directory" << path << "changed, refreshing it";
+  m_provider->refresh(path.toStdString(), mergedPaths());
+  emit appsChanged();
 }
 
 void AppService::setAdditionalSearchPaths(const std::vector<std::filesystem::path> &paths) {
@@ -0,0 +1,189 @@
+#include "xdg-app-cache.hpp"
+#include <QElapsedTimer>
+#include <QtConcurrent/QtConcurrent>
+#include <fstream>
+#include <qlogging.h>
+#include <xdgpp/locale/locale.hpp>
+#include <xdgpp/utils/serialize.hpp>
+
+namespace fs = std::filesystem;
+namespace serialize = xdgpp::serialize;
+
+void XdgAppCache::refreshDirectory(const fs::path &dir) {
+  struct FoundFile {
+    fs::path path;
+    fs::file_time_type mtime;
+    std::uintmax_t size = 0;
+    std::optional<xdgpp::DesktopFile> file;
+  };
+
+  QElapsedTimer timer;
+  auto &cached = m_dirs[dir];
+  std::unordered_map<fs::path, CachedFile *> cachedByPath;
+  std::vector<FoundFile> found;
+  std::error_code ec;
+  size_t staleCount = 0;
+
+  timer.start();
+
+  for (auto &file : cached) {
+    cachedByPath[file.path] = &file;
+  }
+
+  for (const auto &entry : fs::recursive_directory_iterator(dir, ec)) {
+    if (!entry.is_regular_file(ec)) continue;
+    if (!entry.path().filename().string().ends_with(".desktop")) continue;
+
+    FoundFile file{.path = entry.path()};
+
+    file.mtime = entry.last_write_time(ec);
+    if (ec) continue;
+    file.size = entry.file_size(ec);
+    if (ec) continue;
+
+    if (auto it = cachedByPath.find(file.path); it != cachedByPath.end()) {
+      auto &previous = *it->second;
+      bool unchanged = previous.mtime == file.mtime && previous.size == file.size;
+
+      if (unchanged) { file.file = std::move(previous.file); }
+    }
+
+    if (!file.file) ++staleCount;
+    found.emplace_back(std::move(file));
+  }
+
+  if (staleCount > 0) {
+    QtConcurrent::blockingMap(found, [&dir](FoundFile &file) {
+      if (!file.file) file.file = xdgpp::DesktopFile::fromFile(file.path, dir);
+    });
+  }
+
+  // files that were removed don't show up as stale
+  m_dirty = m_dirty || staleCount > 0 || found.size() != cached.size();
+
+  cached.clear();
+  cached.reserve(found.size());
+
+  for (auto &file : found) {
+    cached.emplace_back(CachedFile{
+        .path = std::move(file.path), .mtime = file.mtime, .size = file.size, .file = std::move(*file.file)});
+  }
+
+  if (staleCount > 0) {
+    qInfo() << "Parsed" << staleCount << "desktop files out of" << cached.size() << "in" << dir.c_str()
+            << "in" << timer.elapsed() << "ms";
+  }
+}
+
+const std::vector<XdgAppCache::CachedFile> &XdgAppCache::files(const fs::path &dir) const {
+  static const std::vector<CachedFile> empty;
+
+  if (auto it = m_dirs.find(dir); it != m_dirs.end()) return it->second;
+
+  return empty;
+}
+
+void XdgAppCache::retain(const std::vector<fs::path> &dirs) {
+  auto removed = std::erase_if(m_dirs, [&](auto &&pair) { return !std::ranges::contains(dirs, pair.first); });
+
+  if (removed > 0) m_dirty = true;
+}
+
+bool XdgAppCache::load() {
+  std::ifstream ifs(m_path, std::ios::binary);
+
+  if (!ifs) return false;
+
+  if (serialize::readU32(ifs) != SNAPSHOT_MAGIC || serialize::readU32(ifs) != SNAPSHOT_VERSION) {
+    qWarning() << "Ignoring desktop file snapshot at" << m_path.c_str() << "as it uses an unknown format";
+    return false;
+  }
+
+  if (serialize::readString(ifs) != snapshotLocale()) {
+    qInfo() << "Locale changed since the desktop file snapshot was saved, all files will be parsed again";
+    return false;
+  }
+
+  std::unordered_map<fs::path, std::vector<CachedFile>> dirs;
+  uint32_t dirCount = serialize::readU32(ifs);
+
+  for (uint32_t i = 0; i != dirCount && ifs; ++i) {
+    auto &files = dirs[serialize::readString(ifs)];
+    uint32_t fileCount = serialize::readU32(ifs);
+
+    for (uint32_t j = 0; j != fileCount && ifs; ++j) {
+      fs::path path = serialize::readString(ifs);
+      auto mtime = fs::file_time_type(fs::file_time_type::duration(serialize::readU64(ifs)));
+      auto size = serialize::readU64(ifs);
+      auto file = xdgpp::DesktopFile::deserialize(ifs);
+
+      if (!file) break;
+
+      files.emplace_back(CachedFile{.path = path, .mtime = mtime, .size = size, .file = std::move(*file)});
+    }
+  }
+
+  if (!ifs) {
+    qWarning() << "Desktop file snapshot at" << m_path.c_str() << "is corrupted, ignoring it";
+    return false;
+  }
+
+  m_dirs = std::move(dirs);
+  m_dirty = false;
+
+  return true;
+}
+
+bool XdgAppCache::save() {
+  if (!m_dirty) return true;
+
+  std::error_code ec;
+  fs::path tmpPath = m_path;
+
+  tmpPath += ".tmp";
+  fs::create_directories(m_path.parent_path(), ec);
+
+  {
+    std::ofstream ofs(tmpPath, std::ios::binary | std::ios::trunc);
+
+    serialize::writeU32(ofs, SNAPSHOT_MAGIC);
+    serialize::writeU32(ofs, SNAPSHOT_VERSION);
+    serialize::writeString(ofs, snapshotLocale());
+    serialize::writeU32(ofs, m_dirs.size());
+
+    for (const auto &[dir, files] : m_dirs) {
+      serialize::writeString(ofs, dir.string());
+      serialize::writeU32(ofs, files.size());
+
+      for (const auto &file : files) {
+        serialize::writeString(ofs, file.path.string());
+        serialize::writeU64(ofs, file.mtime.time_since_epoch().count());
+        serialize::writeU64(ofs, file.size);
+        file.file.serialize(ofs);
+      }
+    }
+
+    if (!ofs.flush()) {
+      qWarning() << "Failed to write desktop file snapshot to" << tmpPath.c_str();
+      fs::remove(tmpPath, ec);
+      return false;
+    }
+  }
+
+  // a reader never sees a partially written snapshot
+  fs::rename(tmpPath, m_path, ec);
+
+  if (ec) {
+    qWarning() << "Failed to save desktop file snapshot to" << m_path.c_str() << ec.message();
+    fs::remove(tmpPath, ec);
+    return false;
+  }
+
+  m_dirty = false;
+
+  return true;
+}
+
+std::string XdgAppCache::snapshotLocale() { return xdgpp::Locale::system().toString(); }
+
+XdgAppCache::XdgAppCache(fs::path path) : m_path(std::move(path)) {}
@@ -0,0 +1,61 @@
+#pragma once
+#include <cstdint>
+#include <filesystem>
+#include <unordered_map>
+#include <vector>
+#include <xdgpp/desktop-entry/file.hpp>
+
+/**
+ * Parsed desktop files of every application directory, persisted to disk so that files that did not change
+ * don't have to be parsed again, even across restarts.
+ *
+ * A file is considered unchanged if its modification time and size are the same as when it was last parsed.
+ * Files that changed are parsed in parallel.
+ */
+class XdgAppCache {
+public:
+  struct CachedFile {
+    std::filesystem::path path;
+    std::filesystem::file_time_type mtime;
+    std::uintmax_t size = 0;
+    xdgpp::DesktopFile file;
+  };
+
+  /**
+   * Update the files of `dir` to match what is currently on disk. Only new and modified files are parsed.
+   */
+  void refreshDirectory(const std::filesystem::path &dir);
+
+  /**
+   * Files of `dir` as of its last refresh, in the order they were found.
+   */
+  const std::vector<CachedFile> &files(const std::filesystem::path &dir) const;
+
+  /**
+   * Forget about the directories that are not in `dirs`.
+   */
+  void retain(const std::vector<std::filesystem::path> &dirs);
+
+  /**
+   * Load the snapshot saved by a previous run, if it is still usable.
+   */
+  bool load();
+
+  /**
+   * Write the snapshot to disk, if anything changed since it was last loaded or saved.
+   */
+  bool save();
+
+  XdgAppCache(std::filesystem::path path);
+
+private:
+  static constexpr const uint32_t SNAPSHOT_MAGIC = 0x53454456; // VDES
+  static constexpr const uint32_t SNAPSHOT_VERSION = 1;
+
+  std::filesystem::path m_path;
+  std::unordered_map<std::filesystem::path, std::vector<CachedFile>> m_dirs;
+  bool m_dirty = false;
+
+  // localized values are resolved at parse time, so a snapshot is only valid for the locale it was made with
+  static std::string snapshotLocale();
+};
@@ -2,6 +2,7 @@
 #include "environment.hpp"
 #include "services/app-service/xdg/xdg-app.hpp"
 #include "timer.hpp"
+#include "vicinae.hpp"
 #include "xdgpp/desktop-entry/entry.hpp"
 #include "xdgpp/desktop-entry/file.hpp"
 #include "xdgpp/mime/iterator.hpp"
@@ -44,7 +45,33 @@ AppPtr XdgAppDatabase::findDefaultOpener(const QString &target) const {
 }
 
 bool XdgAppDatabase::scan(const std::vector<std::filesystem::path> &paths) {
+  m_appDirs = xdgpp::appDirs();
+  m_cache.retain(m_appDirs);
+
+  for (const auto &dir : m_appDirs) {
+    m_cache.refreshDirectory(dir);
+  }
+
+  rebuildApps();
+  m_cache.save();
+
+  return true;
+}
+
+bool XdgAppDatabase::refresh(const std::filesystem::path &dir,
+                             const std::vector<std::filesystem::path> &paths) {
+  if (!std::ranges::contains(m_appDirs, dir)) return scan(paths);
+
+  m_cache.refreshDirectory(dir);
+  rebuildApps();
+  m_cache.save();
+
+  return true;
+}
+
+void XdgAppDatabase::rebuildApps() {
   appMap.clear();
+  m_appsByClass.clear();
   m_apps.clear();
   m_mimeAppsLists.clear();
   m_dataDirToApps.clear();
@@ -52,20 +79,14 @@ bool XdgAppDatabase::scan(const std::vector<std::filesystem::path> &paths) {
 
   std::set<std::string> seen;
 
-  for (const auto &dir : xdgpp::appDirs()) {
-    std::error_code ec;
-
-    for (const auto &entry : fs::recursive_directory_iterator(dir, ec)) {
-      if (!entry.is_regular_file(ec)) continue;
-      if (!entry.path().filename().string().ends_with(".desktop")) continue;
-
-      std::string id = xdgpp::DesktopFile::relativeId(entry.path(), dir);
+  for (const auto &dir : m_appDirs) {
+    for (const auto &cached : m_cache.files(dir)) {
+      const auto &file = cached.file;
+      std::string id(file.id());
 
       if (seen.contains(id)) continue;
       seen.insert(id);
 
-      auto file = xdgpp::DesktopFile::fromFile(entry.path(), dir);
-
       if (file.deleted()) continue;
       if (file.errorMessage()) {
         qWarning() << "Desktop file" << file.path().c_str() << "is invalid" << *file.errorMessage();
@@ -78,13 +99,16 @@ bool XdgAppDatabase::scan(const std::vector<std::filesystem::path> &paths) {
       m_dataDirToApps[dir].emplace_back(app);
       appMap[app->id()] = app;
 
+      // the first app claiming a class wins, apps of higher priority directories come first
+      for (const auto &cl : app->windowClasses()) {
+        m_appsByClass.try_emplace(cl, app);
+      }
+
       for (const auto &action : app->actions()) {
         appMap[action->id()] = action;
       }
     }
   }
-
-  return true;
 }
 
 AppPtr XdgAppDatabase::terminalEmulator() const {
@@ -386,10 +410,9 @@ AppPtr XdgAppDatabase::findByCategory(const QString &category) const {
 }
 
 AppPtr XdgAppDatabase::findByClass(const QString &name) const {
-  // we might need to use a map to speed that up
-  if (auto it = std::ranges::find_if(m_apps, [&](auto &&app) { return app->matchesWindowClass(name); });
-      it != m_apps.end()) {
-    return *it;
+  if (auto it = m_appsByClass.find(AbstractApplication::normalizeWindowClass(name));
+      it != m_appsByClass.end()) {
+    return it->second;
   }
 
   return nullptr;
@@ -397,4 +420,7 @@ AppPtr XdgAppDatabase::findByClass(const QString &name) const {
 
 std::vector<AppPtr> XdgAppDatabase::list() const { return {m_apps.begin(), m_apps.end()}; }
 
-XdgAppDatabase::XdgAppDatabase() { scan(defaultSearchPaths()); }
+XdgAppDatabase::XdgAppDatabase() : m_cache(Omnicast::dataDir() / "desktop-entries.bin") {
+  m_cache.load();
+  scan(defaultSearchPaths());
+}
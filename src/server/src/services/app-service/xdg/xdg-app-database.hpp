@@ -2,6 +2,7 @@
 #include "services/app-service/abstract-app-db.hpp"
 #include <xdgpp/desktop-entry/file.hpp>
 #include "xdg-app.hpp"
+#include "xdg-app-cache.hpp"
 #include <qfileinfo.h>
 #include <qlogging.h>
 #include <qmimedatabase.h>
@@ -13,6 +14,7 @@
 class XdgAppDatabase : public AbstractAppDatabase {
 public:
   bool scan(const std::vector<std::filesystem::path> &paths) override;
+  bool refresh(const std::filesystem::path &dir, const std::vector<std::filesystem::path> &paths) override;
   std::vector<std::filesystem::path> defaultSearchPaths() const override;
   AppPtr findByClass(const QString &name) const override;
   AppPtr findDefaultOpener(const QString &target) const override;
@@ -46,7 +48,18 @@ private:
   QString mimeNameForTarget(const QString &target) const;
   AppPtr findByCategory(const QString &category) const;
 
+  /**
+   * Rebuild the app lists from the cached files of every app directory.
+   */
+  void rebuildApps();
+
+  XdgAppCache m_cache;
+  // app directories of the last scan, by decreasing priority
+  std::vector<std::filesystem::path> m_appDirs;
+
   std::unordered_map<QString, std::shared_ptr<AbstractApplication>> appMap;
+  // by normalized window class (see AbstractApplication::windowClasses)
+  std::unordered_map<QString, std::shared_ptr<XdgApplication>> m_appsByClass;
   std::vector<xdgpp::MimeAppsListFile> m_mimeAppsLists;
   QMimeDatabase m_mimeDb;
   std::vector<std::shared_ptr<XdgApplication>> m_apps;
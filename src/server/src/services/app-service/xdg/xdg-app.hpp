@@ -27,13 +27,13 @@ public:
     return ss.empty() ? QString() : ss.at(0);
   }
 
-  bool matchesWindowClass(const QString &target) const override {
-    auto normalizeClass = [](const QString &s) { return s.toLower().remove(".desktop"); };
-    QString normalizedTarget = normalizeClass(target);
+  std::vector<QString> windowClasses() const override {
+    std::vector<QString> classes;
 
-    if (auto cl = windowClass(); cl && normalizeClass(cl.value()) == normalizedTarget) { return true; }
+    if (auto cl = windowClass()) { classes.emplace_back(normalizeWindowClass(cl.value())); }
+    classes.emplace_back(normalizeWindowClass(id()));
 
-    return normalizeClass(id()) == normalizedTarget;
+    return classes;
   }
 
   std::optional<QString> windowClass() const override {
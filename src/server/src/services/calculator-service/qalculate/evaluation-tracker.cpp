@@ -0,0 +1,35 @@
+#include "services/calculator-service/qalculate/evaluation-tracker.hpp"
+
+uint64_t EvaluationTracker::ask() {
+  std::scoped_lock lock(m_mtx);
+  uint64_t generation = ++m_generation;
+
+  // whatever runs was asked before this, nobody is waiting for it anymore
+  if (m_running && *m_running != 0 && !m_aborted) {
+    m_abort();
+    m_aborted = true;
+  }
+
+  return generation;
+}
+
+bool EvaluationTracker::begin(uint64_t generation) {
+  std::scoped_lock lock(m_mtx);
+
+  if (!isCurrent(generation)) return false;
+
+  m_running = generation;
+  m_aborted = false;
+
+  return true;
+}
+
+bool EvaluationTracker::end() {
+  std::scoped_lock lock(m_mtx);
+  bool aborted = m_aborted;
+
+  m_running.reset();
+  m_aborted = false;
+
+  return aborted;
+}
@@ -0,0 +1,54 @@
+#pragma once
+#include <atomic>
+#include <cstdint>
+#include <functional>
+#include <mutex>
+#include <optional>
+
+/**
+ * Keeps track of the questions asked to a calculator that evaluates them one at a time on a worker thread,
+ * so that an evaluation nobody is waiting for anymore can be aborted.
+ *
+ * Every asynchronous question gets a generation, synchronous ones all use 0. Asking a new question
+ * aborts the asynchronous evaluation in progress, which can only be an older one. Checking what runs and
+ * aborting it happen under the same lock as the worker starting and ending evaluations, so the abort can
+ * never hit another evaluation than the one it was meant for. Synchronous evaluations have a caller
+ * waiting for them and are never aborted.
+ */
+class EvaluationTracker {
+public:
+  /**
+   * `abort` interrupts the evaluation in progress, it is called with the tracker locked.
+   */
+  explicit EvaluationTracker(std::function<void()> abort) : m_abort(std::move(abort)) {}
+
+  /**
+   * Record a new asynchronous question and return its generation.
+   */
+  uint64_t ask();
+
+  /**
+   * Whether `generation` is the one of the last question asked, always true for synchronous ones.
+   */
+  bool isCurrent(uint64_t generation) const { return generation == 0 || generation == m_generation; }
+
+  /**
+   * Called by the worker before evaluating a question of `generation`. Returns false if the question
+   * was superseded already, in which case it must not be evaluated (nor `end` called).
+   */
+  bool begin(uint64_t generation);
+
+  /**
+   * Called by the worker once the evaluation that `begin` started is over. Returns whether it was aborted,
+   * in which case its result is not an answer to the question.
+   */
+  bool end();
+
+private:
+  std::function<void()> m_abort;
+  std::mutex m_mtx;
+  std::atomic<uint64_t> m_generation = 0;
+  // generation of the evaluation in progress, if any
+  std::optional<uint64_t> m_running;
+  bool m_aborted = false;
+};
@@ -1,6 +1,7 @@
 #include "services/calculator-service/qalculate/qalculate-backend.hpp"
 #include "services/calculator-service/abstract-calculator-backend.hpp"
 #include <QDebug>
+#include <QElapsedTimer>
 #include <format>
 #include <libqalculate/MathStructure.h>
 #include <libqalculate/QalculateDateTime.h>
@@ -14,7 +15,10 @@
 using CalculatorResult = QalculateBackend::CalculatorResult;
 using CalculatorError = QalculateBackend::CalculatorError;
 
-QalculateBackend::QalculateBackend() {}
+QalculateBackend::QalculateBackend() {
+  m_worker.setMaxThreadCount(1);
+  m_worker.setExpiryTimeout(-1);
+}
 
 bool QalculateBackend::isActivatable() const {
   /**
@@ -33,13 +37,64 @@ bool QalculateBackend::start() {
   return true;
 }
 
-std::expected<CalculatorResult, CalculatorError> QalculateBackend::compute(const QString &question) const {
+QalculateBackend::ComputeResult QalculateBackend::compute(const QString &question) const {
+  if (auto cached = cachedResult(question)) { return *cached; }
+
+  return QtConcurrent::run(&m_worker, [this, question]() { return evaluate(question, 0); }).result();
+}
+
+QFuture<QalculateBackend::ComputeResult> QalculateBackend::asyncCompute(const QString &question) const {
+  uint64_t generation = m_evaluations.ask();
+
+  if (auto cached = cachedResult(question)) {
+    QPromise<ComputeResult> promise;
+    promise.addResult(*cached);
+    promise.finish();
+    return promise.future();
+  }
+
+  // superseded questions finish without a result
+  return QtConcurrent::run(&m_worker, [this, question, generation](QPromise<ComputeResult> &promise) {
+    if (promise.isCanceled() || !m_evaluations.isCurrent(generation)) return;
+
+    auto result = evaluate(question, generation);
+
+    if (m_evaluations.isCurrent(generation)) { promise.addResult(std::move(result)); }
+  });
+}
+
+QalculateBackend::ComputeResult QalculateBackend::evaluate(const QString &question,
+                                                          uint64_t generation) const {
+  // may have been computed while this was queued
+  if (auto cached = cachedResult(question)) { return *cached; }
+
   QString expression = preprocessQuestion(question);
+  QElapsedTimer timer;
+
+  if (!m_evaluations.begin(generation)) { return std::unexpected(CalculatorError("Superseded question")); }
+
+  timer.start();
+  auto result = calculate(expression);
+  bool aborted = m_evaluations.end();
+
+  // out of time or aborted, the answer is not worth keeping
+  bool interrupted = aborted || timer.elapsed() >= TIME_BUDGET_MS;
+
+  if (!interrupted) {
+    std::lock_guard lock(m_cacheMutex);
+    m_cache.put(expression, result);
+  }
+
+  if (result) { result->question.text = question; }
+
+  return result;
+}
+
+QalculateBackend::ComputeResult QalculateBackend::calculate(const QString &expression) const {
   std::string localizedExpression = CALCULATOR->unlocalizeExpression(expression.toStdString());
-  std::string res;
-  res = CALCULATOR->calculateAndPrint(localizedExpression, 10000, m_evalOpts, m_printOpts);
+  std::string res =
+      CALCULATOR->calculateAndPrint(localizedExpression, TIME_BUDGET_MS, m_evalOpts, m_printOpts);
 
-  MathStructure in = CALCULATOR->parse(localizedExpression);
   MathStructure result = CALCULATOR->parse(res);
   if (result.containsUnknowns()) { return std::unexpected(CalculatorError("Unknown component in question")); }
 
@@ -53,6 +108,10 @@ std::expected<CalculatorResult, CalculatorError> QalculateBackend::compute(const
 
   CalculatorResult calcRes;
   if (result.containsType(STRUCT_UNIT)) {
+    // the question is only parsed for conversions, to display its unit
+    MathStructure in = CALCULATOR->parse(localizedExpression);
+    CALCULATOR->clearMessages();
+
     if (auto unit = getUnitDisplayName(in)) { calcRes.question.unit = Unit{.displayName = unit->c_str()}; }
     if (auto unit = getUnitDisplayName(result)) { calcRes.answer.unit = Unit{.displayName = unit->c_str()}; }
     calcRes.type = CalculatorAnswerType::CONVERSION;
@@ -60,21 +119,32 @@ std::expected<CalculatorResult, CalculatorError> QalculateBackend::compute(const
     calcRes.type = CalculatorAnswerType::NORMAL;
   }
 
-  calcRes.question.text = question;
+  calcRes.question.text = expression;
   calcRes.answer.text = QString::fromStdString(res);
 
   return calcRes;
 }
 
-QString QalculateBackend::preprocessQuestion(const QString &query) const { return query.simplified(); }
+std::optional<QalculateBackend::ComputeResult> QalculateBackend::cachedResult(const QString &question) const {
+  std::optional<ComputeResult> result;
 
-QFuture<QalculateBackend::ComputeResult> QalculateBackend::asyncCompute(const QString &question) const {
-  QPromise<ComputeResult> promise;
-  promise.addResult(compute(question));
-  promise.finish();
-  return promise.future();
+  {
+    std::lock_guard lock(m_cacheMutex);
+    result = m_cache.get(preprocessQuestion(question));
+  }
+
+  if (result && *result) { result->value().question.text = question; }
+
+  return result;
+}
+
+void QalculateBackend::clearCache() {
+  std::lock_guard lock(m_cacheMutex);
+  m_cache.clear();
 }
 
+QString QalculateBackend::preprocessQuestion(const QString &query) const { return query.simplified(); }
+
 QString QalculateBackend::id() const { return "qalculate"; }
 
 QString QalculateBackend::displayName() const { return "Qalculate!"; }
@@ -82,14 +152,17 @@ QString QalculateBackend::displayName() const { return "Qalculate!"; }
 bool QalculateBackend::supportsRefreshExchangeRates() const { return true; }
 
 QFuture<AbstractCalculatorBackend::RefreshExchangeRatesResult> QalculateBackend::refreshExchangeRates() {
-  return QtConcurrent::run([this]() {
+  // fetching goes through the calculator too, so it has to run on the thread that owns it
+  return QtConcurrent::run(&m_worker, [this]() {
     qInfo() << "Refreshing Qalculate exchange rates...";
     auto die = [](auto &&s) {
       qWarning() << "Failed to refresh exchange rates" << s;
       return RefreshExchangeRatesResult{std::unexpected(s)};
     };
     if (!CALCULATOR->fetchExchangeRates()) { return die("Failed to fetch exchange rates"); }
-    QTimer::singleShot(0, [this]() { initializeCalculator(); });
+    initializeCalculator();
+    // conversions computed so far used the old rates
+    clearCache();
     qInfo() << "Done refreshing exchange rates";
     return RefreshExchangeRatesResult{};
   });
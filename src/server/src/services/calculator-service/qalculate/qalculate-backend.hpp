@@ -1,9 +1,23 @@
 #pragma once
+#include "common/lru-cache.hpp"
 #include "services/calculator-service/abstract-calculator-backend.hpp"
+#include "services/calculator-service/qalculate/evaluation-tracker.hpp"
+#include <QThreadPool>
+#include <cstdint>
 #include <libqalculate/Calculator.h>
 #include <libqalculate/MathStructure.h>
 #include <libqalculate/includes.h>
+#include <mutex>
 
+/**
+ * libqalculate is not reentrant, so every use of the calculator goes through a single worker thread.
+ * `compute` waits for it, `asyncCompute` queues the question and returns right away.
+ *
+ * Root search asks for a new answer on every keystroke: a question is dropped if a newer one was asked
+ * before the worker got to it, and the evaluation of a question that got superseded in the meantime is
+ * aborted. Evaluations are also limited to TIME_BUDGET_MS. Answers are cached, so that going back to a
+ * previous question (e.g. by deleting characters) doesn't evaluate it again.
+ */
 class QalculateBackend : public AbstractCalculatorBackend {
 
   QString displayName() const override;
@@ -21,13 +35,35 @@ public:
   QalculateBackend();
 
 private:
+  static constexpr const int TIME_BUDGET_MS = 500;
+  static constexpr const size_t CACHE_CAPACITY = 256;
+
   static std::optional<std::string> getUnitDisplayName(const MathStructure &s, std::string_view prefix = "");
 
   void initializeCalculator();
   QString preprocessQuestion(const QString &question) const;
 
+  /**
+   * Evaluates `question`, on the worker thread only. `generation` is the one of the asyncCompute call
+   * that asked for it, 0 for synchronous calls.
+   */
+  ComputeResult evaluate(const QString &question, uint64_t generation) const;
+  ComputeResult calculate(const QString &expression) const;
+
+  // cached answer to `question`, if it was already evaluated
+  std::optional<ComputeResult> cachedResult(const QString &question) const;
+  void clearCache();
+
   Calculator m_calc;
   bool m_initialized = false;
   EvaluationOptions m_evalOpts;
   PrintOptions m_printOpts;
+
+  mutable EvaluationTracker m_evaluations{[]() { CALCULATOR->abort(); }};
+
+  mutable std::mutex m_cacheMutex;
+  mutable LruCache<QString, ComputeResult> m_cache{CACHE_CAPACITY};
+
+  // declared last so that it is destroyed (and waited for) before the calculator
+  mutable QThreadPool m_worker;
 };
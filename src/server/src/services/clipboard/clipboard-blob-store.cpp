@@ -0,0 +1,81 @@
+#include "services/clipboard/clipboard-blob-store.hpp"
+#include "crypto.hpp"
+#include <QCryptographicHash>
+#include <QSaveFile>
+#include <qlogging.h>
+
+namespace fs = std::filesystem;
+
+static constexpr const char *BLOB_DIRECTORY = "blobs";
+static constexpr const char *ENCRYPTED_BLOB_SUFFIX = ".enc";
+
+QString ClipboardBlobStore::blobId(const QByteArray &data, ClipboardEncryptionType encryption) {
+  QString id = QCryptographicHash::hash(data, QCryptographicHash::Blake2b_256).toHex();
+
+  if (encryption == ClipboardEncryptionType::Local) id += ENCRYPTED_BLOB_SUFFIX;
+
+  return id;
+}
+
+fs::path ClipboardBlobStore::path(const QString &blobId) const {
+  std::string id = blobId.toStdString();
+
+  return m_dataDir / BLOB_DIRECTORY / id.substr(0, 2) / id;
+}
+
+fs::path ClipboardBlobStore::offerPath(const QString &offerId, const std::optional<QString> &blobId) const {
+  if (blobId) return path(*blobId);
+
+  return m_dataDir / offerId.toStdString();
+}
+
+bool ClipboardBlobStore::write(const QString &blobId, const QByteArray &data,
+                               const std::optional<QByteArray> &key) const {
+  fs::path target = path(blobId);
+  std::error_code ec;
+
+  fs::create_directories(target.parent_path(), ec);
+
+  // only replaces the target once everything is written and synced
+  QSaveFile file(target.c_str());
+
+  if (!file.open(QIODevice::WriteOnly)) {
+    qWarning() << "Failed to open" << file.fileName() << "for writing" << file.errorString();
+    return false;
+  }
+
+  if (key) {
+    if (!Crypto::AES256GCM::encrypt(data, *key, file)) {
+      qWarning() << "Failed to encrypt clipboard selection";
+      file.cancelWriting();
+      return false;
+    }
+  } else if (file.write(data) != data.size()) {
+    qWarning() << "Failed to write clipboard blob" << file.errorString();
+    file.cancelWriting();
+    return false;
+  }
+
+  if (!file.commit()) {
+    qWarning() << "Failed to save clipboard blob" << file.errorString();
+    return false;
+  }
+
+  return true;
+}
+
+void ClipboardBlobStore::remove(const QString &blobId) const {
+  std::error_code ec;
+
+  fs::remove(path(blobId), ec);
+}
+
+void ClipboardBlobStore::removeLegacyOffers() const {
+  std::error_code ec;
+
+  for (const auto &entry : fs::directory_iterator(m_dataDir, ec)) {
+    if (entry.is_regular_file(ec)) fs::remove(entry.path(), ec);
+  }
+}
+
+ClipboardBlobStore::ClipboardBlobStore(std::filesystem::path dataDir) : m_dataDir(std::move(dataDir)) {}
@@ -0,0 +1,48 @@
+#pragma once
+#include "services/clipboard/clipboard-db.hpp"
+#include <QByteArray>
+#include <QString>
+#include <filesystem>
+#include <optional>
+
+/**
+ * Stores offer contents on disk once per distinct content, in a file named after its hash, so that the
+ * same data copied several times or under several mime types is only written once.
+ *
+ * Files are spread over subdirectories named after the first byte of the hash to keep directories
+ * small. Which blobs are still referenced is tracked by the `blob` table, this class only deals with
+ * the files.
+ */
+class ClipboardBlobStore {
+public:
+  /**
+   * Encrypted and plain copies of the same content are distinct blobs, as an offer can only be
+   * decrypted the way it was stored.
+   */
+  static QString blobId(const QByteArray &data, ClipboardEncryptionType encryption);
+
+  std::filesystem::path path(const QString &blobId) const;
+
+  /**
+   * Where the data of an offer is stored. Offers saved before the blob store was introduced have no
+   * blob and are stored under their own id.
+   */
+  std::filesystem::path offerPath(const QString &offerId, const std::optional<QString> &blobId) const;
+
+  /**
+   * Write the blob atomically, encrypting it with `key` if set.
+   */
+  bool write(const QString &blobId, const QByteArray &data, const std::optional<QByteArray> &key) const;
+  void remove(const QString &blobId) const;
+
+  /**
+   * Remove the files of the offers saved before the blob store, which all sit at the top of the data
+   * directory.
+   */
+  void removeLegacyOffers() const;
+
+  ClipboardBlobStore(std::filesystem::path dataDir);
+
+private:
+  std::filesystem::path m_dataDir;
+};
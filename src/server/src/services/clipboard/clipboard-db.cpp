@@ -15,7 +15,7 @@ std::optional<ClipboardSelectionRecord> ClipboardDatabase::findSelection(const Q
   ClipboardSelectionRecord selection;
   QSqlQuery query(m_db);
 
-  query.prepare("SELECT id, mime_type, encryption_type from data_offer where selection_id = :id");
+  query.prepare("SELECT id, mime_type, encryption_type, blob_id from data_offer where selection_id = :id");
   query.addBindValue(id);
 
   if (!query.exec()) {
@@ -29,6 +29,7 @@ std::optional<ClipboardSelectionRecord> ClipboardDatabase::findSelection(const Q
     record.id = query.value(0).toString();
     record.mimeType = query.value(1).toString();
     record.encryption = static_cast<ClipboardEncryptionType>(query.value(2).toUInt());
+    if (!query.value(3).isNull()) { record.blobId = query.value(3).toString(); }
     selection.offers.emplace_back(record);
   }
 
@@ -190,7 +191,7 @@ bool ClipboardDatabase::removeAll() {
   return query.exec("DELETE FROM selection");
 }
 
-std::vector<QString> ClipboardDatabase::removeSelection(const QString &selectionId) {
+RemovedClipboardData ClipboardDatabase::removeSelection(const QString &selectionId) {
   if (!m_db.transaction()) { return {}; }
 
   QSqlQuery query(m_db);
@@ -200,7 +201,7 @@ std::vector<QString> ClipboardDatabase::removeSelection(const QString &selection
 		data_offer
 	WHERE 
 		selection_id = :selection_id
-	RETURNING id
+	RETURNING id, blob_id
   )");
   query.bindValue(":selection_id", selectionId);
 
@@ -210,10 +211,10 @@ std::vector<QString> ClipboardDatabase::removeSelection(const QString &selection
     return {};
   }
 
-  std::vector<QString> deletedOffers;
+  RemovedClipboardData removed;
 
   while (query.next()) {
-    deletedOffers.emplace_back(query.value(0).toString());
+    if (query.value(1).isNull()) { removed.legacyOffers.emplace_back(query.value(0).toString()); }
   }
 
   query.prepare("DELETE FROM selection WHERE id = :selection_id");
@@ -225,9 +226,56 @@ std::vector<QString> ClipboardDatabase::removeSelection(const QString &selection
     return {};
   }
 
+  removed.blobs = removeUnusedBlobs();
   m_db.commit();
 
-  return deletedOffers;
+  return removed;
+}
+
+std::vector<QString> ClipboardDatabase::removeUnusedBlobs() {
+  QSqlQuery query(m_db);
+
+  if (!query.exec("DELETE FROM blob WHERE ref_count <= 0 RETURNING id")) {
+    qCritical() << "Failed to remove unused clipboard blobs" << query.lastError();
+    return {};
+  }
+
+  std::vector<QString> blobs;
+
+  while (query.next()) {
+    blobs.emplace_back(query.value(0).toString());
+  }
+
+  return blobs;
+}
+
+bool ClipboardDatabase::insertBlob(const QString &id, quint64 size) {
+  QSqlQuery query(m_db);
+
+  query.prepare("INSERT INTO blob (id, size) VALUES (:id, :size) ON CONFLICT(id) DO NOTHING");
+  query.bindValue(":id", id);
+  query.bindValue(":size", size);
+
+  if (!query.exec()) {
+    qCritical() << "Failed to insert clipboard blob" << query.lastError();
+    return false;
+  }
+
+  return true;
+}
+
+bool ClipboardDatabase::hasBlob(const QString &id) {
+  QSqlQuery query(m_db);
+
+  query.prepare("SELECT 1 FROM blob WHERE id = :id");
+  query.bindValue(":id", id);
+
+  if (!query.exec()) {
+    qCritical() << "Failed to look up clipboard blob" << query.lastError();
+    return false;
+  }
+
+  return query.next();
 }
 
 std::optional<PreferredClipboardOfferRecord>
@@ -235,7 +283,7 @@ ClipboardDatabase::findPreferredOffer(const QString &selectionId) {
   QSqlQuery query(m_db);
 
   query.prepare(R"(
-		SELECT o.id, o.encryption_type FROM data_offer o
+		SELECT o.id, o.encryption_type, o.blob_id FROM data_offer o
 		JOIN selection s ON s.id = o.selection_id
 		WHERE o.mime_type = s.preferred_mime_type
 		AND selection_id = :selection
@@ -254,8 +302,11 @@ ClipboardDatabase::findPreferredOffer(const QString &selectionId) {
 
   QString id = query.value(0).toString();
   auto encryption = static_cast<ClipboardEncryptionType>(query.value(1).toUInt());
+  PreferredClipboardOfferRecord record{.id = id, .encryption = encryption};
 
-  return PreferredClipboardOfferRecord{.id = id, .encryption = encryption};
+  if (!query.value(2).isNull()) { record.blobId = query.value(2).toString(); }
+
+  return record;
 }
 
 bool ClipboardDatabase::setPinned(const QString &id, bool pinned) {
@@ -323,6 +374,20 @@ bool ClipboardDatabase::tryBubbleUpSelection(const QString &idLike) {
   return query.numRowsAffected() > 0;
 }
 
+bool ClipboardDatabase::hasSelectionHash(const QString &hash) {
+  QSqlQuery query(m_db);
+
+  query.prepare("SELECT 1 FROM selection WHERE hash_md5 = :hash LIMIT 1");
+  query.bindValue(":hash", hash);
+
+  if (!query.exec()) {
+    qCritical() << "Failed to look up selection hash" << query.lastError();
+    return false;
+  }
+
+  return query.next();
+}
+
 bool ClipboardDatabase::indexSelectionContent(const QString &selectionId, const QString &content) {
   QSqlQuery query(m_db);
 
@@ -350,8 +415,8 @@ bool ClipboardDatabase::insertOffer(const InsertClipboardOfferPayload &payload)
   QSqlQuery query(m_db);
 
   query.prepare(R"(
-		INSERT INTO data_offer (id, selection_id, mime_type, text_preview, content_hash_md5, encryption_type, size, kind, url_host)
-		VALUES (:id, :selection_id, :mime_type, :text_preview, :content_hash_md5, :encryption, :size, :kind, :url_host)
+		INSERT INTO data_offer (id, selection_id, mime_type, text_preview, content_hash_md5, encryption_type, size, kind, url_host, blob_id)
+		VALUES (:id, :selection_id, :mime_type, :text_preview, :content_hash_md5, :encryption, :size, :kind, :url_host, :blob_id)
   	)");
   query.bindValue(":id", payload.id);
   query.bindValue(":selection_id", payload.selectionId);
@@ -361,6 +426,7 @@ bool ClipboardDatabase::insertOffer(const InsertClipboardOfferPayload &payload)
   query.bindValue(":encryption", static_cast<quint8>(payload.encryption));
   query.bindValue(":size", payload.size);
   query.bindValue(":kind", static_cast<quint8>(payload.kind));
+  query.bindValue(":blob_id", payload.blobId);
 
   if (payload.urlHost) { query.bindValue(":url_host", *payload.urlHost); }
 
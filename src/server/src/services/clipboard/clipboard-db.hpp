@@ -12,6 +12,7 @@ enum class ClipboardEncryptionType : std::uint8_t {
 struct PreferredClipboardOfferRecord {
   QString id;
   ClipboardEncryptionType encryption;
+  std::optional<QString> blobId;
 };
 
 enum class ClipboardOfferKind : std::uint8_t {
@@ -42,6 +43,7 @@ struct InsertClipboardOfferPayload {
   ClipboardOfferKind kind;
   quint64 size;
   std::optional<QString> urlHost;
+  QString blobId;
 };
 
 struct InsertClipboardHistoryLine {
@@ -72,6 +74,16 @@ struct ClipboardSelectionOfferRecord {
   QString id;
   QString mimeType;
   ClipboardEncryptionType encryption;
+  std::optional<QString> blobId;
+};
+
+/**
+ * Files that are no longer referenced after a removal.
+ */
+struct RemovedClipboardData {
+  // offers saved before the blob store, whose file is named after the offer id
+  std::vector<QString> legacyOffers;
+  std::vector<QString> blobs;
 };
 
 struct ClipboardSelectionRecord {
@@ -103,14 +115,25 @@ public:
    * The id can either be the selection id or the selection hash.
    */
   bool tryBubbleUpSelection(const QString &idLike);
+  bool hasSelectionHash(const QString &hash);
   bool insertSelection(const InsertSelectionPayload &payload);
+  /**
+   * Offers have to reference a blob that was inserted beforehand. Inserting an existing blob is a
+   * no-op.
+   */
+  bool insertBlob(const QString &id, quint64 size);
+  bool hasBlob(const QString &id);
   bool insertOffer(const InsertClipboardOfferPayload &payload);
   bool indexSelectionContent(const QString &selectionId, const QString &content);
   /**
-   * Remove the selection from the database and return the list of offers
-   * that were deleted with it.
+   * Remove the selection from the database and return the data files
+   * that are no longer used.
+   */
+  RemovedClipboardData removeSelection(const QString &selectionId);
+  /**
+   * Remove the blobs no longer referenced by any offer, and return their ids.
    */
-  std::vector<QString> removeSelection(const QString &selectionId);
+  std::vector<QString> removeUnusedBlobs();
   std::optional<PreferredClipboardOfferRecord> findPreferredOffer(const QString &selectionId);
 
   /**
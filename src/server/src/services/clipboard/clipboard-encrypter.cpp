@@ -54,3 +54,9 @@ ClipboardEncrypter::DecryptResult ClipboardEncrypter::decrypt(const QByteArray &
   if (!decrypted) return std::unexpected("Decryption failed");
   return decrypted.value();
 }
+
+ClipboardEncrypter::KeyResult ClipboardEncrypter::key() const {
+  if (!m_keychainError.isEmpty()) return std::unexpected(m_keychainError);
+  if (m_key.isEmpty()) return std::unexpected("Encryption key is not loaded yet");
+  return m_key;
+}
@@ -7,11 +7,17 @@ class ClipboardEncrypter : public QObject {
 public:
   using EncryptResult = std::expected<QByteArray, QString>;
   using DecryptResult = std::expected<QByteArray, QString>;
+  using KeyResult = std::expected<QByteArray, QString>;
 
   void loadKey();
   EncryptResult encrypt(const QByteArray &plain) const;
   DecryptResult decrypt(const QByteArray &encrypted) const;
 
+  /**
+   * The key used to encrypt offers, for code that needs to encrypt off the main thread.
+   */
+  KeyResult key() const;
+
 private:
   QByteArray m_key;
   QString m_keychainError;
@@ -0,0 +1,305 @@
+#include "services/clipboard/clipboard-ingester.hpp"
+#include "crypto.hpp"
+#include "services/clipboard/clipboard-service.hpp"
+#include <QCryptographicHash>
+#include <QUrl>
+#include <algorithm>
+#include <numeric>
+#include <span>
+#include <qlogging.h>
+
+void ClipboardIngester::submit(Job job) {
+  {
+    std::scoped_lock lock(m_mutex);
+
+    m_pendingBytes += selectionSize(job.selection);
+    m_pending.emplace_back(std::move(job));
+
+    // always keep the latest selection, whatever its size
+    while (m_pending.size() > 1 &&
+           (m_pending.size() > MAX_PENDING_SELECTIONS || m_pendingBytes > MAX_PENDING_BYTES)) {
+      qWarning() << "Clipboard history can't keep up with new selections, dropping the oldest pending one";
+      m_pendingBytes -= selectionSize(m_pending.front().selection);
+      m_pending.pop_front();
+    }
+  }
+
+  m_pendingSignal.notify_one();
+}
+
+void ClipboardIngester::processLoop() {
+  ClipboardDatabase db;
+
+  while (true) {
+    std::unique_lock lock(m_mutex);
+    m_pendingSignal.wait(lock, [&]() { return !m_pending.empty() || !m_active; });
+
+    if (m_pending.empty() && !m_active) break;
+
+    Job job = std::move(m_pending.front());
+    m_pending.pop_front();
+    m_pendingBytes -= selectionSize(job.selection);
+    lock.unlock();
+
+    auto prepared = prepare(job, db);
+
+    if (!prepared) continue;
+
+    lock.lock();
+    m_writeSignal.wait(lock, [&]() { return m_writeQueue.size() < MAX_WRITE_QUEUE; });
+    m_writeQueue.emplace_back(std::move(*prepared));
+    lock.unlock();
+    m_writeSignal.notify_all();
+  }
+
+  {
+    std::scoped_lock lock(m_mutex);
+    m_processDone = true;
+  }
+
+  m_writeSignal.notify_all();
+}
+
+void ClipboardIngester::writeLoop() {
+  ClipboardDatabase db;
+
+  while (true) {
+    std::unique_lock lock(m_mutex);
+    m_writeSignal.wait(lock, [&]() { return !m_writeQueue.empty() || m_processDone; });
+
+    if (m_writeQueue.empty()) break;
+
+    std::vector<PreparedSelection> batch(std::make_move_iterator(m_writeQueue.begin()),
+                                         std::make_move_iterator(m_writeQueue.end()));
+    m_writeQueue.clear();
+    lock.unlock();
+    m_writeSignal.notify_all();
+
+    std::vector<WriteResult> results(batch.size(), WriteResult::Failed);
+
+    if (!insertAll(batch, results, db) && batch.size() > 1) {
+      qWarning() << "Failed to save" << batch.size() << "clipboard selections at once, retrying one by one";
+
+      for (size_t i = 0; i != batch.size(); ++i) {
+        insertAll(std::span(batch).subspan(i, 1), std::span(results).subspan(i, 1), db);
+      }
+    }
+
+    for (size_t i = 0; i != batch.size(); ++i) {
+      const auto &prepared = batch[i];
+
+      releaseBlobs(prepared, results[i] == WriteResult::Inserted, db);
+
+      if (results[i] == WriteResult::Failed) {
+        qWarning() << "Failed to save clipboard selection" << prepared.selection.id;
+        continue;
+      }
+
+      auto entry = results[i] == WriteResult::Inserted ? prepared.entry : ClipboardHistoryEntry{};
+
+      QMetaObject::invokeMethod(
+          this, [this, entry = std::move(entry)]() { emit selectionSaved(entry); }, Qt::QueuedConnection);
+    }
+  }
+}
+
+bool ClipboardIngester::insertAll(std::span<const PreparedSelection> batch, std::span<WriteResult> results,
+                                  ClipboardDatabase &db) const {
+  // transaction() reports a successful rollback as a success
+  bool inserted = false;
+  bool committed = db.transaction([&](ClipboardDatabase &db) {
+    for (size_t i = 0; i != batch.size(); ++i) {
+      results[i] = insert(batch[i], db);
+      if (results[i] == WriteResult::Failed) return false;
+    }
+    return inserted = true;
+  });
+
+  if (committed && inserted) return true;
+
+  std::ranges::fill(results, WriteResult::Failed);
+
+  return false;
+}
+
+std::optional<ClipboardIngester::PreparedSelection> ClipboardIngester::prepare(const Job &job,
+                                                                                ClipboardDatabase &db) const {
+  const auto &selection = job.selection;
+  QString preferredMimeType = ClipboardService::getSelectionPreferredMimeType(selection);
+  auto preferredOfferIt =
+      std::ranges::find_if(selection.offers, [&](auto &&o) { return o.mimeType == preferredMimeType; });
+
+  if (preferredOfferIt == selection.offers.end()) {
+    qCritical() << "preferredOfferIt is invalid, this should not be possible!";
+    return std::nullopt;
+  }
+
+  auto preferredKind = ClipboardService::getKind(*preferredOfferIt);
+
+  if (preferredKind == ClipboardOfferKind::Unknown) {
+    qWarning() << "Ignoring selection with primary offer of unknown kind" << preferredMimeType;
+    return std::nullopt;
+  }
+
+  if (preferredKind == ClipboardOfferKind::Text && preferredOfferIt->data.trimmed().isEmpty()) {
+    qInfo() << "Ignored text selection with empty text";
+    return std::nullopt;
+  }
+
+  PreparedSelection prepared;
+  QString selectionId = Crypto::UUID::v4();
+  auto selectionHash = QCryptographicHash::hash(preferredOfferIt->data, QCryptographicHash::Md5).toHex();
+
+  prepared.selection = {.id = selectionId,
+                        .offerCount = static_cast<int>(selection.offers.size()),
+                        .hash = selectionHash,
+                        .preferredMimeType = preferredMimeType,
+                        .kind = preferredKind,
+                        .source = selection.sourceApp};
+
+  // no need to write anything, the writer will only have to move it on top
+  if (db.hasSelectionHash(prepared.selection.hash)) return prepared;
+
+  ClipboardEncryptionType encryption =
+      job.encryptionKey ? ClipboardEncryptionType::Local : ClipboardEncryptionType::None;
+
+  // Index all offers, including empty ones
+  for (const auto &offer : selection.offers) {
+    ClipboardOfferKind kind = ClipboardService::getKind(offer);
+    bool isIndexableText = kind == ClipboardOfferKind::Text || kind == ClipboardOfferKind::Link;
+    auto md5sum = QCryptographicHash::hash(offer.data, QCryptographicHash::Md5).toHex();
+    PreparedOffer preparedOffer{.payload = {
+                                    .id = Crypto::UUID::v4(),
+                                    .selectionId = selectionId,
+                                    .mimeType = offer.mimeType,
+                                    .textPreview = ClipboardService::getOfferTextPreview(offer),
+                                    .md5sum = md5sum,
+                                    .encryption = encryption,
+                                    .size = static_cast<quint64>(offer.data.size()),
+                                    .blobId = ClipboardBlobStore::blobId(offer.data, encryption),
+                                }};
+
+    if (isIndexableText && !offer.data.isEmpty()) { preparedOffer.indexedText = offer.data; }
+
+    if (kind == ClipboardOfferKind::Link) {
+      auto url = QUrl::fromEncoded(offer.data, QUrl::StrictMode);
+      if (url.scheme().startsWith("http")) { preparedOffer.payload.urlHost = url.host(); }
+    }
+
+    const QString &blobId = preparedOffer.payload.blobId;
+
+    // identical offers, such as text under several mime types, are only written once
+    if (!prepared.writtenBlobs.contains(blobId) && !db.hasBlob(blobId)) {
+      if (!writeBlob(prepared, blobId, offer.data, job.encryptionKey)) {
+        releaseBlobs(prepared, false, db);
+        return std::nullopt;
+      }
+    }
+
+    if (offer.mimeType == preferredMimeType) {
+      prepared.entry.id = selectionId;
+      prepared.entry.pinnedAt = 0;
+      prepared.entry.updatedAt = {};
+      prepared.entry.mimeType = offer.mimeType;
+      prepared.entry.md5sum = preparedOffer.payload.md5sum;
+      prepared.entry.textPreview = preparedOffer.payload.textPreview;
+    }
+
+    prepared.offers.emplace_back(std::move(preparedOffer));
+  }
+
+  return prepared;
+}
+
+ClipboardIngester::WriteResult ClipboardIngester::insert(const PreparedSelection &prepared,
+                                                         ClipboardDatabase &db) const {
+  // a selection with the same hash may have been saved since this one was prepared
+  if (db.tryBubbleUpSelection(prepared.selection.hash)) {
+    qInfo() << "A similar clipboard selection is already indexed: moving it on top of the history";
+    return WriteResult::BubbledUp;
+  }
+
+  if (prepared.offers.empty()) {
+    qWarning() << "Selection" << prepared.selection.hash << "was removed before it could be moved on top";
+    return WriteResult::Failed;
+  }
+
+  if (!db.insertSelection(prepared.selection)) {
+    qWarning() << "failed to insert selection";
+    return WriteResult::Failed;
+  }
+
+  for (const auto &offer : prepared.offers) {
+    const QString &blobId = offer.payload.blobId;
+
+    if (!offer.indexedText.isEmpty() && !db.indexSelectionContent(prepared.selection.id, offer.indexedText)) {
+      qWarning() << "Failed to index selection content for offer" << offer.payload.mimeType;
+      return WriteResult::Failed;
+    }
+
+    if (prepared.writtenBlobs.contains(blobId)) {
+      if (!db.insertBlob(blobId, offer.payload.size)) return WriteResult::Failed;
+    } else if (!db.hasBlob(blobId)) {
+      qWarning() << "Blob" << blobId << "was removed before offer" << offer.payload.mimeType << "was saved";
+      return WriteResult::Failed;
+    }
+
+    if (!db.insertOffer(offer.payload)) {
+      qWarning() << "Failed to insert offer" << offer.payload.mimeType;
+      return WriteResult::Failed;
+    }
+  }
+
+  return WriteResult::Inserted;
+}
+
+bool ClipboardIngester::writeBlob(PreparedSelection &prepared, const QString &blobId, const QByteArray &data,
+                                  const std::optional<QByteArray> &key) const {
+  {
+    // claimed before the file is written, so that a selection discarding the same blob can't remove it
+    // from under us
+    std::scoped_lock lock(m_blobMutex);
+    ++m_pendingBlobs[blobId];
+  }
+
+  prepared.writtenBlobs.insert(blobId);
+
+  return m_blobStore.write(blobId, data, key);
+}
+
+void ClipboardIngester::releaseBlobs(const PreparedSelection &prepared, bool inserted,
+                                     ClipboardDatabase &db) const {
+  std::scoped_lock lock(m_blobMutex);
+
+  for (const auto &blobId : prepared.writtenBlobs) {
+    auto it = m_pendingBlobs.find(blobId);
+    bool stillPending = it != m_pendingBlobs.end() && --it->second > 0;
+
+    if (it != m_pendingBlobs.end() && !stillPending) m_pendingBlobs.erase(it);
+
+    // another selection may have saved the same content in the meantime
+    if (!inserted && !stillPending && !db.hasBlob(blobId)) m_blobStore.remove(blobId);
+  }
+}
+
+qsizetype ClipboardIngester::selectionSize(const ClipboardSelection &selection) {
+  return std::accumulate(selection.offers.begin(), selection.offers.end(), qsizetype{0},
+                         [](qsizetype acc, const auto &offer) { return acc + offer.data.size(); });
+}
+
+ClipboardIngester::ClipboardIngester(ClipboardBlobStore blobStore) : m_blobStore(std::move(blobStore)) {
+  m_processThread = std::thread([this]() { processLoop(); });
+  m_writeThread = std::thread([this]() { writeLoop(); });
+}
+
+ClipboardIngester::~ClipboardIngester() {
+  // whatever was already submitted is still saved
+  {
+    std::scoped_lock lock(m_mutex);
+    m_active = false;
+  }
+
+  m_pendingSignal.notify_all();
+  m_processThread.join();
+  m_writeThread.join();
+}
@@ -0,0 +1,114 @@
+#pragma once
+#include "services/clipboard/clipboard-blob-store.hpp"
+#include "services/clipboard/clipboard-db.hpp"
+#include "services/clipboard/clipboard-server.hpp"
+#include <condition_variable>
+#include <deque>
+#include <mutex>
+#include <optional>
+#include <qobject.h>
+#include <set>
+#include <span>
+#include <thread>
+#include <unordered_map>
+
+/**
+ * Saves clipboard selections to the history without blocking the thread that receives them.
+ *
+ * Selections go through two worker threads:
+ * - the processing thread hashes the selection, skips the file writes if it is already in the history,
+ *   and otherwise writes the content of its offers to the blob store, encrypting it along the way if
+ *   requested. Contents the store already has are not written again.
+ * - the writer thread inserts the selections that are ready into the database, using a connection of
+ *   its own and as few transactions as possible.
+ *
+ * `selectionSaved` is emitted once the files and database rows of a selection are written.
+ *
+ * When selections come in faster than they can be saved, the oldest ones not yet being processed are
+ * dropped to keep the amount of data waiting in memory bounded.
+ */
+class ClipboardIngester : public QObject {
+  Q_OBJECT
+
+signals:
+  void selectionSaved(const ClipboardHistoryEntry &entry) const;
+
+public:
+  struct Job {
+    ClipboardSelection selection;
+    // set if the offers have to be encrypted
+    std::optional<QByteArray> encryptionKey;
+  };
+
+  static constexpr const size_t MAX_PENDING_SELECTIONS = 16;
+  static constexpr const qsizetype MAX_PENDING_BYTES = 256 * 1024 * 1024;
+  // processed selections the writer can lag behind before the processing thread waits for it
+  static constexpr const size_t MAX_WRITE_QUEUE = 16;
+
+  void submit(Job job);
+
+  ClipboardIngester(ClipboardBlobStore blobStore);
+  ~ClipboardIngester();
+
+private:
+  struct PreparedOffer {
+    InsertClipboardOfferPayload payload;
+    // text content to index for search, if any
+    QString indexedText;
+  };
+
+  struct PreparedSelection {
+    InsertSelectionPayload selection;
+    // empty if a selection with the same hash is already saved, in which case it is only bubbled up
+    std::vector<PreparedOffer> offers;
+    // blobs this selection had to write, the other ones were already in the store
+    std::set<QString> writtenBlobs;
+    ClipboardHistoryEntry entry;
+  };
+
+  enum class WriteResult { Inserted, BubbledUp, Failed };
+
+  ClipboardBlobStore m_blobStore;
+
+  std::mutex m_mutex;
+  std::condition_variable m_pendingSignal;
+  std::condition_variable m_writeSignal;
+  std::deque<Job> m_pending;
+  qsizetype m_pendingBytes = 0;
+  std::deque<PreparedSelection> m_writeQueue;
+  bool m_active = true;
+  bool m_processDone = false;
+
+  // blobs written for selections that are not saved yet, with the number of such selections for each.
+  // Blobs are content addressed, so several pending selections can share the same file.
+  mutable std::mutex m_blobMutex;
+  mutable std::unordered_map<QString, int> m_pendingBlobs;
+
+  std::thread m_processThread;
+  std::thread m_writeThread;
+
+  void processLoop();
+  void writeLoop();
+
+  std::optional<PreparedSelection> prepare(const Job &job, ClipboardDatabase &db) const;
+  /**
+   * Insert all the selections in one transaction, filling `results`. On failure, nothing is inserted and
+   * all results are `Failed`.
+   */
+  bool insertAll(std::span<const PreparedSelection> batch, std::span<WriteResult> results,
+                 ClipboardDatabase &db) const;
+  WriteResult insert(const PreparedSelection &prepared, ClipboardDatabase &db) const;
+  /**
+   * Write a blob on behalf of `prepared`, which keeps it from being discarded until `releaseBlobs`
+   * is called for it.
+   */
+  bool writeBlob(PreparedSelection &prepared, const QString &blobId, const QByteArray &data,
+                 const std::optional<QByteArray> &key) const;
+  /**
+   * Called once the fate of `prepared` is known. If it was not inserted, the blobs it wrote are removed,
+   * unless a saved offer or another pending selection uses them.
+   */
+  void releaseBlobs(const PreparedSelection &prepared, bool inserted, ClipboardDatabase &db) const;
+
+  static qsizetype selectionSize(const ClipboardSelection &selection);
+};
@@ -243,10 +243,16 @@ QString ClipboardService::getSelectionPreferredMimeType(const ClipboardSelection
 bool ClipboardService::removeSelection(const QString &selectionId) {
   ClipboardDatabase cdb;
 
-  for (const auto &offer : cdb.removeSelection(selectionId)) {
+  auto removed = cdb.removeSelection(selectionId);
+
+  for (const auto &offer : removed.legacyOffers) {
     fs::remove(m_dataDir / offer.toStdString());
   }
 
+  for (const auto &blob : removed.blobs) {
+    m_blobStore.remove(blob);
+  }
+
   emit selectionRemoved(selectionId);
 
   return true;
@@ -277,7 +283,7 @@ ClipboardService::getMainOfferData(const QString &selectionId) const {
     return {};
   };
 
-  fs::path path = m_dataDir / offer->id.toStdString();
+  fs::path path = m_blobStore.offerPath(offer->id, offer->blobId);
 
   QFile file(path);
 
@@ -455,119 +461,21 @@ void ClipboardService::saveSelection(ClipboardSelection selection) {
     return;
   }
 
-  QString preferredMimeType = getSelectionPreferredMimeType(selection);
-  ClipboardHistoryEntry insertedEntry;
-  ClipboardDatabase cdb;
-  auto preferredOfferIt =
-      std::ranges::find_if(selection.offers, [&](auto &&o) { return o.mimeType == preferredMimeType; });
-
-  if (preferredOfferIt == selection.offers.end()) {
-    qCritical() << "preferredOfferIt is invalid, this should not be possible!";
-    return;
-  }
-
-  auto preferredKind = getKind(*preferredOfferIt);
-
-  if (preferredKind == ClipboardOfferKind::Unknown) {
-    qWarning() << "Ignoring selection with primary offer of unknown kind" << preferredMimeType;
-    return;
-  }
+  ClipboardIngester::Job job;
 
-  auto selectionHash = QCryptographicHash::hash(preferredOfferIt->data, QCryptographicHash::Md5).toHex();
+  if (m_encrypter) {
+    auto key = m_encrypter->key();
 
-  if (preferredKind == ClipboardOfferKind::Text && preferredOfferIt->data.trimmed().isEmpty()) {
-    qInfo() << "Ignored text selection with empty text";
-    return;
-  }
-
-  cdb.transaction([&](ClipboardDatabase &db) {
-    if (db.tryBubbleUpSelection(selectionHash)) {
-      qInfo() << "A similar clipboard selection is already indexed: moving it on top of the history";
-      return true;
-    }
-
-    QString selectionId = Crypto::UUID::v4();
-
-    if (!db.insertSelection({.id = selectionId,
-                             .offerCount = static_cast<int>(selection.offers.size()),
-                             .hash = selectionHash,
-                             .preferredMimeType = preferredMimeType,
-                             .kind = preferredKind,
-                             .source = selection.sourceApp})) {
-      qWarning() << "failed to insert selection";
-      return false;
+    if (!key) {
+      qWarning() << "Failed to encrypt clipboard selection" << key.error();
+      return;
     }
 
-    // Index all offers, including empty ones
-    for (const auto &offer : selection.offers) {
-      ClipboardOfferKind kind = getKind(offer);
-      bool isIndexableText = kind == ClipboardOfferKind::Text || kind == ClipboardOfferKind::Link;
-      QString textPreview = getOfferTextPreview(offer);
-
-      if (isIndexableText && !offer.data.isEmpty()) {
-        if (!db.indexSelectionContent(selectionId, offer.data)) {
-          qWarning() << "Failed to index selection content for offer" << offer.mimeType;
-          return false;
-        }
-      }
-
-      auto md5sum = QCryptographicHash::hash(offer.data, QCryptographicHash::Md5).toHex();
-      auto offerId = Crypto::UUID::v4();
-      ClipboardEncryptionType encryption = ClipboardEncryptionType::None;
-
-      if (m_encrypter) encryption = ClipboardEncryptionType::Local;
-
-      InsertClipboardOfferPayload dto{
-          .id = offerId,
-          .selectionId = selectionId,
-          .mimeType = offer.mimeType,
-          .textPreview = textPreview,
-          .md5sum = md5sum,
-          .encryption = encryption,
-          .size = static_cast<quint64>(offer.data.size()),
-      };
-
-      if (kind == ClipboardOfferKind::Link) {
-        auto url = QUrl::fromEncoded(offer.data, QUrl::StrictMode);
-        if (url.scheme().startsWith("http")) { dto.urlHost = url.host(); }
-      }
-
-      if (!db.insertOffer(dto)) {
-        qWarning() << "Failed to insert offer" << offer.mimeType;
-        return false;
-      }
-
-      fs::path targetPath = m_dataDir / offerId.toStdString();
-      QFile targetFile(targetPath);
-
-      if (!targetFile.open(QIODevice::WriteOnly)) { continue; }
-
-      if (m_encrypter) {
-        if (auto encrypted = m_encrypter->encrypt(offer.data)) {
-          targetFile.write(encrypted.value());
-        } else {
-          qWarning() << "Failed to encrypt clipboard selection";
-          return false;
-        }
-      } else {
-        targetFile.write(offer.data);
-      }
-
-      // Set the insertedEntry for the preferred offer
-      if (offer.mimeType == preferredMimeType) {
-        insertedEntry.id = selectionId;
-        insertedEntry.pinnedAt = 0;
-        insertedEntry.updatedAt = {};
-        insertedEntry.mimeType = offer.mimeType;
-        insertedEntry.md5sum = md5sum;
-        insertedEntry.textPreview = textPreview;
-      }
-    }
-
-    return true;
-  });
+    job.encryptionKey = key.value();
+  }
 
-  emit itemInserted(insertedEntry);
+  job.selection = std::move(selection);
+  m_ingester->submit(std::move(job));
 }
 
 std::optional<ClipboardSelection> ClipboardService::retrieveSelectionById(const QString &id) {
@@ -579,7 +487,7 @@ std::optional<ClipboardSelection> ClipboardService::retrieveSelectionById(const
 
   for (const auto &offer : selection->offers) {
     ClipboardDataOffer populatedOffer;
-    fs::path path = m_dataDir / offer.id.toStdString();
+    fs::path path = m_blobStore.offerPath(offer.id, offer.blobId);
     QFile file(path);
 
     if (!file.open(QIODevice::ReadOnly)) { continue; }
@@ -700,8 +608,12 @@ bool ClipboardService::removeAllSelections() {
     return false;
   }
 
-  fs::remove_all(m_dataDir);
-  fs::create_directories(m_dataDir);
+  // blobs written for selections that are still being saved are left alone
+  for (const auto &blob : db.removeUnusedBlobs()) {
+    m_blobStore.remove(blob);
+  }
+
+  m_blobStore.removeLegacyOffers();
 
   emit allSelectionsRemoved();
 
@@ -838,8 +750,7 @@ bool ClipboardService::copyMultipleSelections(const std::vector<QString> &ids,
 AbstractClipboardServer *ClipboardService::clipboardServer() const { return m_clipboardServer.get(); }
 
 ClipboardService::ClipboardService(const std::filesystem::path &path, WindowManager &wm, AppService &appDb)
-    : m_wm(wm), m_appDb(appDb) {
-  m_dataDir = path.parent_path() / "clipboard-data";
+    : m_dataDir(path.parent_path() / "clipboard-data"), m_blobStore(m_dataDir), m_wm(wm), m_appDb(appDb) {
   auto clip = QApplication::clipboard();
 
   {
@@ -855,6 +766,9 @@ ClipboardService::ClipboardService(const std::filesystem::path &path, WindowMana
   fs::create_directories(m_dataDir);
   ClipboardDatabase().runMigrations();
 
+  m_ingester = std::make_unique<ClipboardIngester>(m_blobStore);
+  connect(m_ingester.get(), &ClipboardIngester::selectionSaved, this, &ClipboardService::itemInserted);
+
   connect(m_clipboardServer.get(), &AbstractClipboardServer::selectionAdded, this,
           &ClipboardService::saveSelection);
 
@@ -2,8 +2,10 @@
 #include "common.hpp"
 #include "extensions/wm/wm-extension.hpp"
 #include "services/app-service/app-service.hpp"
+#include "services/clipboard/clipboard-blob-store.hpp"
 #include "services/clipboard/clipboard-db.hpp"
 #include "services/clipboard/clipboard-encrypter.hpp"
+#include "services/clipboard/clipboard-ingester.hpp"
 #include "services/clipboard/clipboard-server.hpp"
 #include "services/window-manager/abstract-window-manager.hpp"
 #include "services/window-manager/window-manager.hpp"
@@ -149,15 +151,18 @@ public:
   void setAutoPathToUri(bool value);
   bool isEncryptionReady() const;
 
+  static QString getSelectionPreferredMimeType(const ClipboardSelection &selection);
+  static QString getOfferTextPreview(const ClipboardDataOffer &offer);
+  static ClipboardOfferKind getKind(const ClipboardDataOffer &offer);
+
 private:
   std::unique_ptr<ClipboardEncrypter> m_encrypter;
 
   QMimeDatabase _mimeDb;
   std::filesystem::path m_dataDir;
+  ClipboardBlobStore m_blobStore;
   std::unique_ptr<AbstractClipboardServer> m_clipboardServer;
-
-  static QString getSelectionPreferredMimeType(const ClipboardSelection &selection);
-  static QString getOfferTextPreview(const ClipboardDataOffer &offer);
+  std::unique_ptr<ClipboardIngester> m_ingester;
 
   /**
    * Unique selection hash obtained by hashing all the data offer hashes together.
@@ -177,8 +182,6 @@ private:
   std::expected<QByteArray, ClipboardService::OfferDecryptionError>
   decryptOffer(const QByteArray &data, ClipboardEncryptionType type) const;
 
-  static ClipboardOfferKind getKind(const ClipboardDataOffer &offer);
-
   /**
    * Build a composite QMimeData from multiple selections.
    * Combines text and HTML content, embeds images as data URIs.
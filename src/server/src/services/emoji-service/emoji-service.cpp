@@ -13,10 +13,16 @@ void EmojiService::loadKeywords() {
   }
 }
 
-std::span<Scored<const EmojiData *>> EmojiService::search(std::string_view query) const {
-  static std::vector<Scored<const EmojiData *>> searchResults;
-  auto withScore = [&](const EmojiData &data) -> Scored<const EmojiData *> {
+std::vector<Scored<const EmojiData *>> EmojiService::search(std::string_view query) const {
+  std::vector<Scored<const EmojiData *>> results;
+  const fzf::CharMask queryMask = fzf::queryCharMask(query);
+  const auto &emojis = StaticEmojiDatabase::orderedList();
+
+  auto withScore = [&](size_t idx) -> Scored<const EmojiData *> {
     using WS = fzf::WeightedString;
+    const EmojiData &data = emojis[idx];
+
+    if (!fzf::mayMatch(m_charMasks[idx], queryMask)) return {&data, 0};
 
     auto fields = std::initializer_list<WS>{WS{data.name, 1.0f}, WS{data.group, 0.7f}};
     auto kws = data.keywords | std::views::transform([](auto &&s) {
@@ -28,13 +34,20 @@ std::span<Scored<const EmojiData *>> EmojiService::search(std::string_view query
     return {&data, score};
   };
 
-  auto filtered = StaticEmojiDatabase::orderedList() | std::views::transform(withScore) |
-                  std::views::filter([](auto &&s) { return s.score > 0; });
-  searchResults.clear();
-  std::ranges::copy(filtered, std::back_inserter(searchResults));
-  std::ranges::stable_sort(searchResults, std::greater{});
+  auto scoreAll = [&](auto &&indexes) {
+    std::ranges::copy(indexes | std::views::transform(withScore) |
+                          std::views::filter([](auto &&s) { return s.score > 0; }),
+                      std::back_inserter(results));
+  };
+
+  // when every word is the start of a word of the emoji, the prebuilt index narrows the search down to a
+  // few candidates. Anything else (typos, middle of words) needs to go through the whole list.
+  scoreAll(emoji::searchCandidates(query));
+  if (results.empty()) { scoreAll(std::views::iota(size_t(0), emojis.size())); }
+
+  std::ranges::stable_sort(results, std::greater{});
 
-  return searchResults;
+  return results;
 }
 
 void EmojiService::createDbEntry(std::string_view emoji) {
@@ -103,19 +116,18 @@ std::vector<EmojiWithMetadata> EmojiService::getVisited() const {
   }
 
   std::vector<EmojiWithMetadata> results;
-  const auto &mapping = StaticEmojiDatabase::mapping();
 
   while (query.next()) {
     EmojiWithMetadata result;
     auto emoji = query.value(0).toString();
-    auto it = mapping.find(emoji.toStdString());
+    auto data = StaticEmojiDatabase::find(emoji.toStdString());
 
-    if (it == mapping.end()) {
+    if (!data) {
       qWarning() << "Emoji is not in the mapping" << emoji;
       continue;
     }
 
-    result.data = it->second;
+    result.data = data;
     result.visitCount = query.value(1).toUInt();
     result.keywords = query.value(3).toString();
 
@@ -155,23 +167,23 @@ std::vector<EmojiWithMetadata> EmojiService::mapMetadata(const std::vector<const
 
 EmojiWithMetadata EmojiService::mapMetadata(std::string_view emoji) {
   QSqlQuery query = m_db.createQuery();
-  auto it = StaticEmojiDatabase::mapping().find(emoji);
+  auto data = StaticEmojiDatabase::find(emoji);
 
-  if (it == StaticEmojiDatabase::mapping().end()) { return {}; }
+  if (!data) { return {}; }
 
   query.prepare("SELECT visit_count, pinned_at, custom_keywords FROM visited_emoji WHERE emoji = :emoji");
   query.addBindValue(qStringFromStdView(emoji));
 
   if (!query.exec()) {
     qCritical() << "Failed to map metadata for" << query.lastError();
-    return {.data = it->second};
+    return {.data = data};
   }
 
-  if (!query.next()) { return EmojiWithMetadata{.data = it->second}; }
+  if (!query.next()) { return EmojiWithMetadata{.data = data}; }
 
   EmojiWithMetadata result;
 
-  result.data = it->second;
+  result.data = data;
   result.visitCount = query.value(0).toUInt();
   result.keywords = query.value(2).toString();
 
@@ -257,4 +269,16 @@ bool EmojiService::pin(std::string_view emoji) {
   return true;
 }
 
-EmojiService::EmojiService(OmniDatabase &db) : m_db(db) { loadKeywords(); }
+EmojiService::EmojiService(OmniDatabase &db) : m_db(db) {
+  loadKeywords();
+
+  for (const auto &data : StaticEmojiDatabase::orderedList()) {
+    fzf::CharMask mask = fzf::charMask(data.name) | fzf::charMask(data.group);
+
+    for (auto keyword : data.keywords) {
+      mask |= fzf::charMask(keyword);
+    }
+
+    m_charMasks.emplace_back(mask);
+  }
+}
@@ -5,6 +5,7 @@
 #include <unordered_set>
 #include <string_view>
 #include "common/scored.hpp"
+#include "lib/fzf.hpp"
 
 /**
  * Provides all emoji-related services. Also integrates with the local sqlite database to provide
@@ -38,7 +39,7 @@ public:
   EmojiService(OmniDatabase &db);
 
   void loadKeywords();
-  std::span<Scored<const EmojiData *>> search(std::string_view query) const;
+  std::vector<Scored<const EmojiData *>> search(std::string_view query) const;
 
   /**
    * List of emojis, ordered and grouped.
@@ -71,7 +72,12 @@ private:
    */
   std::unordered_map<std::string, std::string> m_keywordMap;
   std::unordered_set<std::string_view> m_pinned;
-  std::vector<Scored<const EmojiData *>> m_searchResults;
+
+  /**
+   * Characters of the name, group and keywords of each emoji of the static database, in the same
+   * order. Lets search skip emojis that can't match without running the matcher.
+   */
+  std::vector<fzf::CharMask> m_charMasks;
 
   OmniDatabase &m_db;
 };
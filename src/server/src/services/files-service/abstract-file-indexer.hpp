@@ -1,4 +1,5 @@
 #pragma once
+#include <qdatetime.h>
 #include <qfuture.h>
 #include <qobject.h>
 #include <qtmetamacros.h>
@@ -26,6 +27,12 @@ struct IndexerFileResult {
   double rank;
 };
 
+struct IndexerFileAccess {
+  std::filesystem::path path;
+  int accessCount = 0;
+  QDateTime lastAccessedAt;
+};
+
 struct IndexerAsyncQuery : public QObject {
   Q_OBJECT
 
@@ -51,5 +58,22 @@ public:
   virtual QFuture<std::vector<IndexerFileResult>> queryAsync(std::string_view view,
                                                              const QueryParams &params = {}) = 0;
 
+  /**
+   * Streaming variant of `queryAsync`: every result of the returned future is a chunk of results,
+   * reported as soon as it is available (see QFutureWatcher::resultsReadyAt).
+   * Indexers that can't stream report everything as a single chunk.
+   */
+  virtual QFuture<std::vector<IndexerFileResult>> queryStreamAsync(std::string_view view,
+                                                                   const QueryParams &params = {}) {
+    return queryAsync(view, params);
+  }
+
+  /**
+   * Files opened by the user rank higher in search results. Indexers keep their own copy of the access
+   * history: `setAccessHistory` replaces it entirely, `recordAccess` counts one more opening of `path`.
+   */
+  virtual void setAccessHistory(std::vector<IndexerFileAccess> history) {}
+  virtual void recordAccess(const std::filesystem::path &path) {}
+
   virtual ~AbstractFileIndexer() = default;
 };
@@ -56,6 +56,8 @@ protected:
   }
 
   void setInterruptFlag() { m_interrupted = true; }
+  bool isInterrupted() const { return m_interrupted; }
+  int recordId() const { return m_recordId; }
 
 public:
   AbstractScanner(std::shared_ptr<DbWriter> writer, const Scan &scan, FinishCallback callback)
@@ -1,6 +1,8 @@
 #include "db-writer.hpp"
 #include "file-indexer-db.hpp"
+#include "relevancy-scorer.hpp"
 #include <QtLogging>
+#include <chrono>
 
 void DbWriter::listen() {
   m_db = std::make_unique<FileIndexerDatabase>();
@@ -27,6 +29,30 @@ void DbWriter::submit(Work work) {
   m_updateSignal.notify_one();
 }
 
+void DbWriter::mirrorEvents(const std::vector<FileEvent> &events) {
+  if (!m_memoryIndex) return;
+
+  RelevancyScorer scorer;
+
+  for (const auto &event : events) {
+    switch (event.type) {
+    case FileEventType::Modify:
+      m_memoryIndex->upsert(event.path.native(), scorer.computeScore(event.path));
+      break;
+    case FileEventType::Delete:
+      m_memoryIndex->remove(event.path.native());
+      break;
+    }
+  }
+
+  m_memoryIndex->compactIfNeeded();
+}
+
+size_t DbWriter::queueSize() {
+  std::scoped_lock l(m_queueMtx);
+  return m_queue.size();
+}
+
 DbWriter::DbWriter() {
   m_workerThread = std::thread([this]() { listen(); });
 }
@@ -59,20 +85,96 @@ std::expected<FileIndexerDatabase::ScanRecord, QString> DbWriter::createScan(con
 }
 
 void DbWriter::indexFiles(std::vector<std::filesystem::path> paths) {
-  submit([paths = std::move(paths)](FileIndexerDatabase &db) { db.indexFiles(paths); });
+  submit([this, paths = std::move(paths)](FileIndexerDatabase &db) {
+    db.indexFiles(paths);
+
+    if (!m_memoryIndex) return;
+
+    RelevancyScorer scorer;
+
+    for (const auto &path : paths) {
+      m_memoryIndex->upsert(path.native(), scorer.computeScore(path));
+    }
+  });
 }
 
 void DbWriter::deleteIndexedFiles(std::vector<std::filesystem::path> paths) {
-  submit([paths = std::move(paths)](FileIndexerDatabase &db) { db.deleteIndexedFiles(paths); });
+  submit([this, paths = std::move(paths)](FileIndexerDatabase &db) {
+    db.deleteIndexedFiles(paths);
+
+    if (!m_memoryIndex) return;
+
+    for (const auto &path : paths) {
+      m_memoryIndex->remove(path.native());
+    }
+
+    m_memoryIndex->compactIfNeeded();
+  });
 }
 
 void DbWriter::deleteAllIndexedFiles(std::function<void()> onComplete) {
-  submit([onComplete = std::move(onComplete)](FileIndexerDatabase &db) {
+  submit([this, onComplete = std::move(onComplete)](FileIndexerDatabase &db) {
     db.deleteAllIndexedFiles();
+    if (m_memoryIndex) { m_memoryIndex->clear(); }
     if (onComplete) { onComplete(); }
   });
 }
 
 void DbWriter::indexEvents(std::vector<FileEvent> events) {
-  submit([events = std::move(events)](FileIndexerDatabase &db) { db.indexEvents(events); });
+  submit([this, events = std::move(events)](FileIndexerDatabase &db) {
+    db.indexEvents(events);
+    mirrorEvents(events);
+  });
+}
+
+EventCoalescer::Sink DbWriter::eventSink() {
+  return {.write = [this](std::vector<FileEvent> events) { indexEvents(std::move(events)); },
+          .queueSize = [this]() { return queueSize(); }};
+}
+
+void DbWriter::beginBulkLoad() {
+  submit([](FileIndexerDatabase &db) { db.beginBulkLoad(); });
+}
+
+void DbWriter::endBulkLoad() {
+  submit([](FileIndexerDatabase &db) { db.endBulkLoad(); });
+}
+
+void DbWriter::abandonBulkLoad() {
+  submit([](FileIndexerDatabase &db) { db.abandonBulkLoad(); });
+}
+
+void DbWriter::bulkIndexEvents(int scanId, std::vector<FileEvent> events) {
+  submit([this, scanId, events = std::move(events)](FileIndexerDatabase &db) {
+    db.bulkIndexEvents(scanId, events);
+    mirrorEvents(events);
+  });
+}
+
+void DbWriter::setAccessHistory(std::vector<IndexerFileAccess> history) {
+  submit([history = std::move(history)](FileIndexerDatabase &db) { db.setAccessHistory(history); });
+}
+
+void DbWriter::recordAccess(std::filesystem::path path) {
+  submit([path = std::move(path)](FileIndexerDatabase &db) { db.recordAccess(path); });
+}
+
+void DbWriter::setMemoryIndex(std::shared_ptr<TrigramIndex> index) {
+  submit([this, index = std::move(index)](FileIndexerDatabase &db) {
+    m_memoryIndex = index;
+
+    if (!m_memoryIndex) return;
+
+    auto start = std::chrono::steady_clock::now();
+    TrigramIndex fresh;
+
+    db.forEachIndexedFile([&](std::string_view path, double score) { fresh.upsert(path, score); });
+    m_memoryIndex->swap(fresh);
+    m_memoryIndex->setReady(true);
+
+    auto elapsed = std::chrono::steady_clock::now() - start;
+
+    qInfo() << "Built in-memory file index with" << m_memoryIndex->size() << "files in"
+            << std::chrono::duration_cast<std::chrono::milliseconds>(elapsed).count() << "ms";
+  });
 }
@@ -3,7 +3,9 @@
 #include <queue>
 #include <vector>
 #include <filesystem>
+#include "services/files-service/file-indexer/event-coalescer.hpp"
 #include "services/files-service/file-indexer/file-indexer-db.hpp"
+#include "services/files-service/file-indexer/trigram-index.hpp"
 
 class DbWriter {
 public:
@@ -18,9 +20,13 @@ private:
 
   std::unique_ptr<FileIndexerDatabase> m_db;
 
+  // only accessed from the worker thread
+  std::shared_ptr<TrigramIndex> m_memoryIndex;
+
   std::thread m_workerThread;
 
   void listen();
+  void mirrorEvents(const std::vector<FileEvent> &events);
 
 public:
   DbWriter();
@@ -29,6 +35,9 @@ public:
   // Use with std::move to avoid copies
   void submit(Work work);
 
+  // Number of work items waiting to be processed
+  size_t queueSize();
+
   // Utility functions
   void updateScanStatus(int scanId, ScanStatus status);
 
@@ -42,4 +51,25 @@ public:
   void deleteAllIndexedFiles(std::function<void()> onComplete = nullptr);
 
   void indexEvents(std::vector<FileEvent> events);
+
+  /**
+   * Sink for an EventCoalescer, handing its batches to `indexEvents`. The writer must outlive the
+   * coalescer.
+   */
+  EventCoalescer::Sink eventSink();
+
+  // See FileIndexerDatabase::beginBulkLoad
+  void beginBulkLoad();
+  void endBulkLoad();
+  void abandonBulkLoad();
+  void bulkIndexEvents(int scanId, std::vector<FileEvent> events);
+
+  void setAccessHistory(std::vector<IndexerFileAccess> history);
+  void recordAccess(std::filesystem::path path);
+
+  /**
+   * Rebuilds `index` from the database, then applies every subsequent write to it as well, so that
+   * it stays in sync with `indexed_file`. Pass nullptr to stop.
+   */
+  void setMemoryIndex(std::shared_ptr<TrigramIndex> index);
 };
@@ -0,0 +1,105 @@
+#include "event-coalescer.hpp"
+
+namespace fs = std::filesystem;
+
+void EventCoalescer::push(FileEvent event, bool isCreation) {
+  bool shouldFlush = false;
+
+  {
+    std::unique_lock lock(m_mtx);
+
+    m_spaceCv.wait(lock, [&]() { return m_pending.size() < m_options.maxPendingEvents || !m_alive; });
+
+    if (!m_alive) return;
+
+    ++m_stats.received;
+
+    if (m_pending.empty()) { m_windowStart = std::chrono::steady_clock::now(); }
+
+    auto it = m_pending.find(event.path);
+
+    if (it == m_pending.end()) {
+      fs::path path = event.path;
+      m_pending.emplace(std::move(path), Pending{.event = std::move(event), .createdInWindow = isCreation});
+    } else if (event.type == FileEventType::Delete && it->second.createdInWindow) {
+      // the file was born and died before we wrote anything, the index never needs to know
+      m_pending.erase(it);
+    } else {
+      it->second.event = std::move(event);
+    }
+
+    shouldFlush = m_pending.size() >= m_options.maxBatchSize;
+  }
+
+  if (shouldFlush) { m_flushCv.notify_one(); }
+}
+
+void EventCoalescer::waitForWriter() {
+  using namespace std::chrono_literals;
+
+  // the writer is shared with scans and other watchers, let it catch up before giving it more work
+  while (m_sink.queueSize() > m_options.maxWriterQueueSize) {
+    std::this_thread::sleep_for(10ms);
+  }
+}
+
+void EventCoalescer::run() {
+  while (true) {
+    std::vector<FileEvent> batch;
+
+    {
+      std::unique_lock lock(m_mtx);
+
+      m_flushCv.wait(lock, [&]() { return !m_pending.empty() || !m_alive; });
+
+      if (m_alive && m_pending.size() < m_options.maxBatchSize) {
+        m_flushCv.wait_until(lock, m_windowStart + m_options.flushInterval,
+                             [&]() { return m_pending.size() >= m_options.maxBatchSize || !m_alive; });
+      }
+
+      if (m_pending.empty()) {
+        if (!m_alive) break;
+        continue;
+      }
+
+      batch.reserve(m_pending.size());
+
+      for (auto &[path, pending] : m_pending) {
+        batch.emplace_back(std::move(pending.event));
+      }
+
+      m_pending.clear();
+      m_stats.written += batch.size();
+      ++m_stats.batches;
+    }
+
+    m_spaceCv.notify_all();
+    waitForWriter();
+    m_sink.write(std::move(batch));
+  }
+}
+
+void EventCoalescer::stop() {
+  {
+    std::lock_guard lock(m_mtx);
+    if (!m_alive) return;
+    m_alive = false;
+  }
+
+  m_flushCv.notify_one();
+  m_spaceCv.notify_all();
+
+  if (m_thread.joinable()) { m_thread.join(); }
+}
+
+EventCoalescer::Stats EventCoalescer::stats() const {
+  std::lock_guard lock(m_mtx);
+  return m_stats;
+}
+
+EventCoalescer::EventCoalescer(Sink sink, Options options)
+    : m_sink(std::move(sink)), m_options(options) {
+  m_thread = std::thread([this]() { run(); });
+}
+
+EventCoalescer::~EventCoalescer() { stop(); }
@@ -0,0 +1,84 @@
+#pragma once
+#include "services/files-service/file-indexer/scan.hpp"
+#include <chrono>
+#include <condition_variable>
+#include <functional>
+#include <mutex>
+#include <thread>
+#include <unordered_map>
+
+/**
+ * Sits between a watcher and the DbWriter to absorb event storms (git checkout, npm install...).
+ *
+ * Events are deduplicated by path while they wait to be written: the last event for a path wins,
+ * and a file that is both created and deleted within the same window is never written at all.
+ * Pending events are handed to the writer as a single batch (one transaction) when either
+ * `maxBatchSize` distinct paths are pending or `flushInterval` elapsed since the first pending event.
+ *
+ * Back-pressure: while the writer is lagging behind, events keep being coalesced, and `push` blocks
+ * once `maxPendingEvents` distinct paths are waiting.
+ */
+class EventCoalescer {
+public:
+  struct Options {
+    size_t maxBatchSize = 1000;
+    std::chrono::milliseconds flushInterval = std::chrono::milliseconds(250);
+    size_t maxPendingEvents = 100'000;
+    // batches queued in the writer above which we stop handing it new ones
+    size_t maxWriterQueueSize = 4;
+  };
+
+  /**
+   * Where batches are handed over to. Outside of tests, this is the DbWriter (see `DbWriter::eventSink`).
+   */
+  struct Sink {
+    std::function<void(std::vector<FileEvent> events)> write;
+    // number of batches the sink has yet to process
+    std::function<size_t()> queueSize;
+  };
+
+  struct Stats {
+    size_t received = 0;
+    size_t written = 0;
+    size_t batches = 0;
+  };
+
+  /**
+   * `isCreation` should be set when the event is known to create the path (e.g. IN_CREATE):
+   * a deletion following it within the same window cancels both events out.
+   */
+  void push(FileEvent event, bool isCreation = false);
+
+  /**
+   * Writes everything that is pending and stops the flushing thread. Further events are ignored.
+   */
+  void stop();
+
+  Stats stats() const;
+
+  EventCoalescer(Sink sink, Options options);
+  EventCoalescer(Sink sink) : EventCoalescer(std::move(sink), Options{}) {}
+  ~EventCoalescer();
+
+private:
+  struct Pending {
+    FileEvent event;
+    bool createdInWindow = false;
+  };
+
+  Sink m_sink;
+  Options m_options;
+
+  mutable std::mutex m_mtx;
+  std::condition_variable m_flushCv;
+  std::condition_variable m_spaceCv;
+  std::unordered_map<std::filesystem::path, Pending> m_pending;
+  std::chrono::steady_clock::time_point m_windowStart;
+  Stats m_stats;
+  bool m_alive = true;
+
+  std::thread m_thread;
+
+  void run();
+  void waitForWriter();
+};
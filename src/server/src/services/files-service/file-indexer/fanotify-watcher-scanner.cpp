@@ -0,0 +1,224 @@
+#include "fanotify-watcher-scanner.hpp"
+#include "scan.hpp"
+#include <QtLogging>
+#include <chrono>
+#include <cstring>
+#include <fcntl.h>
+#include <poll.h>
+#include <string_view>
+#include <unistd.h>
+#include <unordered_map>
+
+#ifdef __linux__
+#include <sys/eventfd.h>
+#include <sys/fanotify.h>
+#endif
+
+namespace fs = std::filesystem;
+
+// FAN_REPORT_DFID_NAME is only available from Linux 5.9 headers onwards
+#if defined(__linux__) && defined(FAN_REPORT_DFID_NAME)
+#define HAS_FANOTIFY_DFID_NAME 1
+
+static constexpr unsigned int FANOTIFY_INIT_FLAGS = FAN_CLASS_NOTIF | FAN_CLOEXEC | FAN_REPORT_DFID_NAME;
+static constexpr uint64_t FANOTIFY_EVENT_MASK =
+    FAN_CREATE | FAN_DELETE | FAN_MOVED_FROM | FAN_MOVED_TO | FAN_CLOSE_WRITE | FAN_ONDIR;
+
+static int createFanotifyMark(const fs::path &path) {
+  int fd = fanotify_init(FANOTIFY_INIT_FLAGS, O_RDONLY | O_LARGEFILE);
+
+  if (fd == -1) return -1;
+
+  if (fanotify_mark(fd, FAN_MARK_ADD | FAN_MARK_FILESYSTEM, FANOTIFY_EVENT_MASK, AT_FDCWD, path.c_str()) ==
+      -1) {
+    close(fd);
+    return -1;
+  }
+
+  return fd;
+}
+#endif
+
+bool FanotifyWatcherScanner::isSupported(const fs::path &path) {
+#ifdef HAS_FANOTIFY_DFID_NAME
+  int fd = createFanotifyMark(path);
+
+  if (fd == -1) return false;
+
+  close(fd);
+  return true;
+#else
+  return false;
+#endif
+}
+
+bool FanotifyWatcherScanner::isRelevant(const fs::path &path) const {
+  const auto &native = path.native();
+  const auto &root = m_scan.path.native();
+
+  // the mark covers the whole filesystem, only keep what is under the scan path
+  if (!isUnder(native, root)) return false;
+
+  for (const auto &filename : m_scan.excludedFilenames) {
+    if (native.ends_with(filename)) return false;
+  }
+
+  for (const auto &excluded : m_scan.excludedPaths) {
+    if (isUnder(native, excluded.native())) return false;
+  }
+
+  return true;
+}
+
+bool FanotifyWatcherScanner::isUnder(const std::string &path, const std::string &dir) {
+  if (!path.starts_with(dir)) return false;
+
+  // /home/u/foobar is not under /home/u/foo
+  return path.size() == dir.size() || dir.ends_with('/') || path[dir.size()] == '/';
+}
+
+void FanotifyWatcherScanner::readEvents() {
+#ifdef HAS_FANOTIFY_DFID_NAME
+  alignas(fanotify_event_metadata) char buf[64 * 1024];
+  // directory handles are resolved once per read, most events in a burst share the same parents
+  std::unordered_map<std::string, fs::path> dirCache;
+
+  ssize_t len = read(m_fanotifyFd, buf, sizeof(buf));
+
+  if (len <= 0) return;
+
+  auto now = fs::file_time_type::clock::now();
+  auto *meta = reinterpret_cast<fanotify_event_metadata *>(buf);
+
+  for (; FAN_EVENT_OK(meta, len); meta = FAN_EVENT_NEXT(meta, len)) {
+    if (meta->vers != FANOTIFY_METADATA_VERSION) {
+      qCritical() << "fanotify: unexpected metadata version" << meta->vers;
+      continue;
+    }
+
+    if (meta->mask & FAN_Q_OVERFLOW) {
+      qWarning() << "fanotify: event queue overflowed, some changes will only be picked up by the next scan";
+      continue;
+    }
+
+    auto *info = reinterpret_cast<fanotify_event_info_fid *>(meta + 1);
+
+    if (info->hdr.info_type != FAN_EVENT_INFO_TYPE_DFID_NAME) continue;
+
+    auto *handle = reinterpret_cast<file_handle *>(info->handle);
+    std::string handleKey(reinterpret_cast<const char *>(handle), sizeof(file_handle) + handle->handle_bytes);
+    const char *name = reinterpret_cast<const char *>(handle->f_handle + handle->handle_bytes);
+    auto it = dirCache.find(handleKey);
+
+    if (it == dirCache.end()) {
+      int dirFd = open_by_handle_at(m_mountFd, handle, O_PATH);
+      fs::path dirPath;
+
+      if (dirFd != -1) {
+        std::error_code ec;
+        dirPath = fs::read_symlink(fs::path("/proc/self/fd") / std::to_string(dirFd), ec);
+        close(dirFd);
+      }
+
+      // stale handle: the directory was deleted since the event was queued
+      it = dirCache.emplace(std::move(handleKey), std::move(dirPath)).first;
+    }
+
+    if (it->second.empty()) continue;
+
+    fs::path path = it->second / name;
+
+    if (!isRelevant(path)) continue;
+
+    // the kernel merges events for the same entry, so a single mask can be e.g. CREATE | DELETE
+    if (meta->mask & (FAN_DELETE | FAN_MOVED_FROM)) {
+      m_coalescer.push(FileEvent(FileEventType::Delete, path, now));
+    } else {
+      m_coalescer.push(FileEvent(FileEventType::Modify, path, now), meta->mask & FAN_CREATE);
+    }
+  }
+#endif
+}
+
+void FanotifyWatcherScanner::run() {
+  while (m_alive) {
+    pollfd fds[2] = {{.fd = m_fanotifyFd, .events = POLLIN}, {.fd = m_wakeFd, .events = POLLIN}};
+
+    if (poll(fds, 2, -1) == -1) {
+      if (errno == EINTR) continue;
+      qCritical() << "fanotify: poll failed" << strerror(errno);
+      reportFailure();
+      break;
+    }
+
+    if (fds[1].revents & POLLIN) break;
+    if (fds[0].revents & POLLIN) { readEvents(); }
+  }
+
+  m_coalescer.stop();
+}
+
+bool FanotifyWatcherScanner::setup() {
+#ifdef HAS_FANOTIFY_DFID_NAME
+  m_fanotifyFd = createFanotifyMark(m_scan.path);
+
+  if (m_fanotifyFd == -1) {
+    qWarning() << "fanotify: failed to mark filesystem for" << m_scan.path.c_str() << strerror(errno);
+    return false;
+  }
+
+  m_mountFd = open(m_scan.path.c_str(), O_DIRECTORY | O_RDONLY | O_CLOEXEC);
+
+  return m_mountFd != -1 && m_wakeFd != -1;
+#else
+  return false;
+#endif
+}
+
+FanotifyWatcherScanner::FanotifyWatcherScanner(std::shared_ptr<DbWriter> writer, const Scan &scan,
+                                               FinishCallback callback)
+    : AbstractScanner(writer, scan, callback), m_scan(scan), m_coalescer(writer->eventSink()) {
+#ifdef __linux__
+  m_wakeFd = eventfd(0, EFD_CLOEXEC);
+#endif
+
+  m_thread = std::thread([this]() {
+    start(m_scan);
+
+    if (!setup()) {
+      qCritical() << "fanotify watcher could not be set up for" << m_scan.path.c_str();
+      reportFailure();
+      return;
+    }
+
+    qInfo() << "Watching filesystem of" << m_scan.path.c_str() << "using fanotify";
+    run();
+  });
+}
+
+FanotifyWatcherScanner::~FanotifyWatcherScanner() {
+  for (int fd : {m_fanotifyFd, m_mountFd, m_wakeFd}) {
+    if (fd != -1) close(fd);
+  }
+}
+
+void FanotifyWatcherScanner::interrupt() {
+  setInterruptFlag();
+  m_alive = false;
+
+  if (m_wakeFd != -1) {
+    uint64_t value = 1;
+    (void)write(m_wakeFd, &value, sizeof(value));
+  }
+
+  // a scan that already failed must not be reported as interrupted on top of it
+  if (!m_reported.exchange(true)) finish();
+}
+
+void FanotifyWatcherScanner::reportFailure() {
+  if (!m_reported.exchange(true)) fail();
+}
+
+void FanotifyWatcherScanner::join() {
+  if (m_thread.joinable()) { m_thread.join(); }
+}
@@ -0,0 +1,48 @@
+#pragma once
+#include "services/files-service/file-indexer/abstract-scanner.hpp"
+#include "services/files-service/file-indexer/event-coalescer.hpp"
+#include <thread>
+
+/**
+ * Watcher scanner based on fanotify, marking the whole filesystem the scan path lives in.
+ *
+ * Unlike inotify, which needs one watch per directory (and runs out of them on large trees),
+ * a single filesystem mark covers every directory with constant kernel memory. Events are reported
+ * as (parent directory handle, entry name) pairs (FAN_REPORT_DFID_NAME), resolved back to paths and
+ * handed to an EventCoalescer.
+ *
+ * Filesystem marks require CAP_SYS_ADMIN, and resolving handles CAP_DAC_READ_SEARCH, so this is only
+ * used when `isSupported` says so. WatcherScanner remains the default otherwise.
+ */
+class FanotifyWatcherScanner : public AbstractScanner {
+public:
+  /**
+   * Whether a filesystem-wide fanotify mark can be placed for `path`.
+   */
+  static bool isSupported(const std::filesystem::path &path);
+
+  FanotifyWatcherScanner(std::shared_ptr<DbWriter> writer, const Scan &scan, FinishCallback callback);
+  ~FanotifyWatcherScanner() override;
+
+  void interrupt() override;
+  void join() override;
+
+private:
+  Scan m_scan;
+  EventCoalescer m_coalescer;
+  int m_fanotifyFd = -1;
+  int m_mountFd = -1;
+  // written to in order to wake up the event loop when interrupted
+  int m_wakeFd = -1;
+  std::atomic<bool> m_alive = true;
+  // whether the final status of the scan was reported, a scan either fails or finishes, never both
+  std::atomic<bool> m_reported = false;
+  std::thread m_thread;
+
+  bool setup();
+  void run();
+  void readEvents();
+  void reportFailure();
+  bool isRelevant(const std::filesystem::path &path) const;
+  static bool isUnder(const std::string &path, const std::string &dir);
+};
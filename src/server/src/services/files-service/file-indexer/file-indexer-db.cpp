@@ -20,10 +20,57 @@ static const std::vector<std::string> SQLITE_PRAGMAS = {
 	"PRAGMA busy_timeout = 100",
 	// "PRAGMA mmap_size = 30000000000"
 };
+
+/*
+ * Structures dropped while bulk loading, with the statements used to restore them.
+ * Must be kept in sync with the schema defined in migrations.
+ */
+static const std::vector<std::pair<QString, QString>> BULK_LOAD_INDEXES = {
+	{"idx_indexed_file_parent_path", "CREATE INDEX IF NOT EXISTS idx_indexed_file_parent_path ON indexed_file(parent_path)"},
+	{"idx_indexed_file_path", "CREATE INDEX IF NOT EXISTS idx_indexed_file_path ON indexed_file(path)"},
+	{"idx_indexed_file_covering", "CREATE INDEX IF NOT EXISTS idx_indexed_file_covering ON indexed_file(id, relevancy_score DESC, path)"},
+};
+
+static const std::vector<std::pair<QString, QString>> BULK_LOAD_TRIGGERS = {
+	{"unicode_idx_ai", R"(CREATE TRIGGER IF NOT EXISTS unicode_idx_ai AFTER INSERT ON indexed_file BEGIN
+		INSERT INTO unicode_idx(rowid, name) VALUES (new.id, new.name); END)"},
+	{"unicode_idx_ad", R"(CREATE TRIGGER IF NOT EXISTS unicode_idx_ad AFTER DELETE ON indexed_file BEGIN
+		INSERT INTO unicode_idx(unicode_idx, rowid, name) VALUES('delete', old.id, old.name); END)"},
+	{"indexed_file_access_ai", R"(CREATE TRIGGER IF NOT EXISTS indexed_file_access_ai AFTER INSERT ON indexed_file
+		WHEN EXISTS (SELECT 1 FROM file_access WHERE path = new.path) BEGIN
+		UPDATE indexed_file SET (access_count, last_accessed_at) =
+			(SELECT access_count, last_accessed_at FROM file_access WHERE path = new.path)
+		WHERE id = new.id; END)"},
+};
+
+// copies file_access over to indexed_file, for rows inserted while indexed_file_access_ai was not there
+static const QString SYNC_FILE_ACCESS_SQL = R"(
+	UPDATE indexed_file SET (access_count, last_accessed_at) = 
+		(SELECT access_count, last_accessed_at FROM file_access WHERE file_access.path = indexed_file.path)
+	WHERE path IN (SELECT path FROM file_access)
+)";
 // clang-format on
 
+// 5 bound values per row, keeps us well under SQLITE_MAX_VARIABLE_NUMBER (999 on older versions)
+static constexpr size_t BULK_INSERT_ROWS_PER_STATEMENT = 128;
+
 namespace fs = std::filesystem;
 
+static QString createBulkInsertStatement(size_t rowCount) {
+  QString sql = "INSERT INTO indexed_file (path, parent_path, name, last_modified_at, relevancy_score) "
+                "VALUES ";
+
+  for (size_t i = 0; i != rowCount; ++i) {
+    if (i > 0) sql += ',';
+    sql += "(?, ?, ?, ?, ?)";
+  }
+
+  sql += " ON CONFLICT (path) DO UPDATE SET last_modified_at = excluded.last_modified_at, "
+         "relevancy_score = excluded.relevancy_score";
+
+  return sql;
+}
+
 QString FileIndexerDatabase::createRandomConnectionId() {
   return QString("file-indexer-%1").arg(QUuid::createUuid().toString(QUuid::WithoutBraces));
 }
@@ -244,41 +291,202 @@ std::vector<FileIndexerDatabase::ScanRecord> FileIndexerDatabase::listScans(Scan
 
 QSqlDatabase *FileIndexerDatabase::database() { return &m_db; }
 
-std::vector<fs::path> FileIndexerDatabase::search(std::string_view searchQuery,
-                                                  const AbstractFileIndexer::QueryParams &params) {
-  auto queryString = QString(R"(
-  	SELECT path, rank FROM indexed_file f 
+QSqlQuery *FileIndexerDatabase::execSearchQuery(std::string_view searchQuery,
+                                                const AbstractFileIndexer::QueryParams &params) {
+  if (!m_searchQuery) {
+    m_searchQuery = std::make_unique<QSqlQuery>(m_db);
+    m_searchQuery->setForwardOnly(true);
+
+    // The time dependent part of the score is computed here rather than stored, see RelevancyScorer.
+    // With a LIMIT, sqlite only keeps the top rows in its sorter instead of sorting every match.
+    bool prepared = m_searchQuery->prepare(QString(R"(
+  	SELECT f.path, rank FROM indexed_file f 
 	JOIN unicode_idx ON unicode_idx.rowid = f.id 
 	WHERE 
-	    unicode_idx MATCH '%1'
-	ORDER BY f.relevancy_score DESC, unicode_idx.rank 
+	    unicode_idx MATCH :query
+	ORDER BY f.relevancy_score * %1 DESC, unicode_idx.rank 
 	LIMIT :limit
 	OFFSET :offset
   )")
-                         .arg(qStringFromStdView(searchQuery));
+                                               .arg(RelevancyScorer::queryTimeMultiplierSql("f")));
 
-  QSqlQuery query(m_db);
+    if (!prepared) {
+      qWarning() << "Failed to prepare search query" << m_searchQuery->lastError();
+      m_searchQuery.reset();
+      return nullptr;
+    }
+  }
+
+  QSqlQuery *query = m_searchQuery.get();
+
+  query->bindValue(":query", qStringFromStdView(searchQuery));
+  query->bindValue(":now", QDateTime::currentSecsSinceEpoch());
+  query->bindValue(":limit", params.pagination.limit);
+  query->bindValue(":offset", params.pagination.offset);
 
-  query.prepare(queryString);
-  query.bindValue(":limit", params.pagination.limit);
-  query.bindValue(":offset", params.pagination.offset);
+  if (!query->exec()) {
+    qWarning() << "Search query failed" << query->lastError();
+    return nullptr;
+  }
+
+  return query;
+}
 
-  if (!query.exec()) { qWarning() << "Search query failed" << query.lastError(); }
+std::vector<fs::path> FileIndexerDatabase::search(std::string_view searchQuery,
+                                                  const AbstractFileIndexer::QueryParams &params,
+                                                  const std::function<bool()> &isCancelled) {
+  QSqlQuery *query = execSearchQuery(searchQuery, params);
+
+  if (!query) return {};
 
   std::vector<fs::path> results;
   std::error_code ec;
 
   results.reserve(params.pagination.limit);
 
-  while (query.next()) {
-    fs::path path = query.value(0).toString().toStdString();
+  while (query->next()) {
+    if (isCancelled && isCancelled()) break;
+
+    fs::path path = query->value(0).toString().toStdString();
 
     if (fs::exists(path, ec)) { results.emplace_back(path); }
   }
 
+  // release the statement's read lock, otherwise WAL checkpoints can't make progress
+  query->finish();
+
   return results;
 }
 
+void FileIndexerDatabase::searchStream(
+    std::string_view searchQuery, const AbstractFileIndexer::QueryParams &params,
+    const std::function<bool(std::vector<std::filesystem::path> chunk)> &onChunk) {
+  static constexpr size_t FIRST_CHUNK_SIZE = 8;
+  static constexpr size_t MAX_CHUNK_SIZE = 64;
+
+  QSqlQuery *query = execSearchQuery(searchQuery, params);
+
+  if (!query) return;
+
+  size_t chunkSize = FIRST_CHUNK_SIZE;
+  std::vector<fs::path> chunk;
+
+  chunk.reserve(chunkSize);
+
+  while (query->next()) {
+    chunk.emplace_back(query->value(0).toString().toStdString());
+
+    if (chunk.size() >= chunkSize) {
+      if (!onChunk(std::move(chunk))) {
+        query->finish();
+        return;
+      }
+      chunkSize = std::min(chunkSize * 2, MAX_CHUNK_SIZE);
+      chunk = {};
+      chunk.reserve(chunkSize);
+    }
+  }
+
+  query->finish();
+
+  if (!chunk.empty()) { onChunk(std::move(chunk)); }
+}
+
+void FileIndexerDatabase::setAccessHistory(const std::vector<IndexerFileAccess> &history) {
+  if (!m_db.transaction()) {
+    qCritical() << "Failed to start transaction";
+    return;
+  }
+
+  QSqlQuery query(m_db);
+
+  if (!query.exec("UPDATE indexed_file SET access_count = 0, last_accessed_at = NULL "
+                  "WHERE path IN (SELECT path FROM file_access)") ||
+      !query.exec("DELETE FROM file_access")) {
+    qCritical() << "Failed to clear file access history" << query.lastError();
+    m_db.rollback();
+    return;
+  }
+
+  query.prepare("INSERT OR REPLACE INTO file_access (path, access_count, last_accessed_at) "
+                "VALUES (:path, :access_count, :last_accessed_at)");
+
+  for (const auto &access : history) {
+    query.bindValue(":path", access.path.c_str());
+    query.bindValue(":access_count", access.accessCount);
+    query.bindValue(":last_accessed_at", access.lastAccessedAt.toSecsSinceEpoch());
+
+    if (!query.exec()) {
+      qCritical() << "Failed to insert file access" << access.path.c_str() << query.lastError();
+      m_db.rollback();
+      return;
+    }
+  }
+
+  if (!query.exec(SYNC_FILE_ACCESS_SQL)) {
+    qCritical() << "Failed to copy file access history" << query.lastError();
+    m_db.rollback();
+    return;
+  }
+
+  if (!m_db.commit()) { qCritical() << "Failed to commit"; }
+}
+
+void FileIndexerDatabase::recordAccess(const fs::path &path) {
+  if (!m_db.transaction()) {
+    qCritical() << "Failed to start transaction";
+    return;
+  }
+
+  QSqlQuery query(m_db);
+
+  query.prepare(R"(
+	INSERT INTO file_access (path, access_count, last_accessed_at) VALUES (:path, 1, unixepoch())
+	ON CONFLICT (path) DO UPDATE SET 
+		access_count = access_count + 1, 
+		last_accessed_at = unixepoch()
+  )");
+  query.bindValue(":path", path.c_str());
+
+  if (!query.exec()) {
+    qCritical() << "Failed to record file access" << path.c_str() << query.lastError();
+    m_db.rollback();
+    return;
+  }
+
+  query.prepare(R"(
+	UPDATE indexed_file SET (access_count, last_accessed_at) = 
+		(SELECT access_count, last_accessed_at FROM file_access WHERE path = :path)
+	WHERE path = :path
+  )");
+  query.bindValue(":path", path.c_str());
+
+  if (!query.exec()) {
+    qCritical() << "Failed to update indexed file access" << path.c_str() << query.lastError();
+    m_db.rollback();
+    return;
+  }
+
+  if (!m_db.commit()) { qCritical() << "Failed to commit"; }
+}
+
+void FileIndexerDatabase::forEachIndexedFile(
+    const std::function<void(std::string_view path, double relevancyScore)> &fn) {
+  QSqlQuery query(m_db);
+
+  query.setForwardOnly(true);
+
+  if (!query.exec("SELECT path, relevancy_score FROM indexed_file ORDER BY id")) {
+    qCritical() << "Failed to list indexed files" << query.lastError();
+    return;
+  }
+
+  while (query.next()) {
+    QByteArray path = query.value(0).toString().toUtf8();
+    fn(std::string_view(path.constData(), path.size()), query.value(1).toDouble());
+  }
+}
+
 void FileIndexerDatabase::deleteIndexedFiles(const std::vector<fs::path> &paths) {
   if (!m_db.transaction()) {
     qCritical() << "Failed to start transaction";
@@ -325,7 +533,9 @@ void FileIndexerDatabase::indexEvents(const std::vector<FileEvent> &events) {
                 indexed_file (path, parent_path, name, last_modified_at, relevancy_score) 
         VALUES 
                 (:path, :parent_path, :name, :last_modified_at, :relevancy_score) 
-        ON CONFLICT (path) DO UPDATE SET last_modified_at = :last_modified_at
+        ON CONFLICT (path) DO UPDATE SET 
+                last_modified_at = excluded.last_modified_at, 
+                relevancy_score = excluded.relevancy_score
     )");
 
     QSqlQuery deleteQuery(m_db);
@@ -337,7 +547,9 @@ void FileIndexerDatabase::indexEvents(const std::vector<FileEvent> &events) {
       switch (event.type) {
       case FileEventType::Modify: {
         using namespace std::chrono;
-        long long secondsSinceEpoch = duration_cast<seconds>(event.eventTime.time_since_epoch()).count();
+        // file_clock's epoch is not the unix epoch, and recency is computed against unixepoch()
+        auto sctp = clock_cast<system_clock>(event.eventTime);
+        long long secondsSinceEpoch = duration_cast<seconds>(sctp.time_since_epoch()).count();
         modifyQuery.bindValue(":last_modified_at", secondsSinceEpoch);
 
         modifyQuery.bindValue(":path", event.path.c_str());
@@ -346,7 +558,7 @@ void FileIndexerDatabase::indexEvents(const std::vector<FileEvent> &events) {
 
         // Move this out of the loop if RelevancyScore ends up having any state
         RelevancyScorer scorer;
-        modifyQuery.bindValue(":relevancy_score", scorer.computeScore(event.path, event.eventTime));
+        modifyQuery.bindValue(":relevancy_score", scorer.computeScore(event.path));
 
         activeQuery = &modifyQuery;
         break;
@@ -373,6 +585,29 @@ void FileIndexerDatabase::indexEvents(const std::vector<FileEvent> &events) {
 }
 
 void FileIndexerDatabase::indexFiles(const std::vector<std::filesystem::path> &paths) {
+  struct Row {
+    std::optional<long long> lastModified;
+    double score;
+  };
+
+  std::vector<Row> rows;
+  std::error_code ec;
+  RelevancyScorer scorer;
+
+  rows.reserve(paths.size());
+
+  // stat everything before starting the transaction so that the write lock is held as little as possible
+  for (const auto &path : paths) {
+    if (auto lastModified = fs::last_write_time(path, ec); !ec) {
+      using namespace std::chrono;
+      auto sctp = clock_cast<system_clock>(lastModified);
+      long long epoch = duration_cast<seconds>(sctp.time_since_epoch()).count();
+
+      rows.emplace_back(Row{.lastModified = epoch, .score = scorer.computeScore(path)});
+    } else {
+      rows.emplace_back(Row{.lastModified = std::nullopt, .score = scorer.computeScore(path)});
+    }
+  }
 
   if (!m_db.transaction()) {
     qWarning() << "Failed to start batch insert transaction" << m_db.lastError();
@@ -387,30 +622,20 @@ void FileIndexerDatabase::indexFiles(const std::vector<std::filesystem::path> &p
 	  	indexed_file (path, parent_path, name, last_modified_at, relevancy_score) 
 	VALUES 
 		(:path, :parent_path, :name, :last_modified_at, :relevancy_score) 
-	ON CONFLICT (path) DO UPDATE SET last_modified_at = :last_modified_at
+	ON CONFLICT (path) DO UPDATE SET 
+		last_modified_at = excluded.last_modified_at, 
+		relevancy_score = excluded.relevancy_score
   )");
 
-    std::error_code ec;
-    RelevancyScorer scorer;
-    double score = 1.0;
-
-    for (const auto &path : paths) {
-      if (auto lastModified = fs::last_write_time(path, ec); !ec) {
-        using namespace std::chrono;
-        auto sctp = clock_cast<system_clock>(lastModified);
-        long long epoch = duration_cast<seconds>(sctp.time_since_epoch()).count();
-
-        query.bindValue(":last_modified_at", epoch);
-        score = scorer.computeScore(path, lastModified);
-      } else {
-        query.bindValue(":last_modified_at", QVariant());
-        score = scorer.computeScore(path, std::nullopt);
-      }
+    for (size_t i = 0; i != paths.size(); ++i) {
+      const auto &path = paths[i];
+      const auto &row = rows[i];
 
+      query.bindValue(":last_modified_at", row.lastModified ? QVariant(*row.lastModified) : QVariant());
       query.bindValue(":path", path.c_str());
       query.bindValue(":parent_path", path.parent_path().c_str());
       query.bindValue(":name", path.filename().c_str());
-      query.bindValue(":relevancy_score", score);
+      query.bindValue(":relevancy_score", row.score);
 
       if (!query.exec()) {
         qCritical() << "Failed to insert file in index" << path << query.lastError();
@@ -423,6 +648,186 @@ void FileIndexerDatabase::indexFiles(const std::vector<std::filesystem::path> &p
   if (!m_db.commit()) { qCritical() << "Failed to commit batchIndex" << m_db.lastError(); }
 }
 
+void FileIndexerDatabase::beginBulkLoad() {
+  if (m_bulkLoadDepth++ > 0) return;
+
+  qInfo() << "Entering file index bulk load mode";
+
+  QSqlQuery query(m_db);
+
+  for (const auto &[name, _] : BULK_LOAD_TRIGGERS) {
+    if (!query.exec(QString("DROP TRIGGER IF EXISTS %1").arg(name))) {
+      qCritical() << "Failed to drop trigger" << name << query.lastError();
+    }
+  }
+
+  for (const auto &[name, _] : BULK_LOAD_INDEXES) {
+    if (!query.exec(QString("DROP INDEX IF EXISTS %1").arg(name))) {
+      qCritical() << "Failed to drop index" << name << query.lastError();
+    }
+  }
+}
+
+void FileIndexerDatabase::endBulkLoad() {
+  if (m_bulkLoadDepth == 0 || --m_bulkLoadDepth > 0) return;
+
+  qInfo() << "Leaving file index bulk load mode, rebuilding indexes...";
+
+  using namespace std::chrono;
+  auto start = steady_clock::now();
+
+  if (!restoreIndexStructures()) return;
+
+  qInfo() << "File index rebuilt in" << duration_cast<milliseconds>(steady_clock::now() - start).count()
+          << "ms";
+}
+
+void FileIndexerDatabase::abandonBulkLoad() {
+  if (m_bulkLoadDepth == 0 || --m_bulkLoadDepth > 0) return;
+
+  qInfo() << "Leaving interrupted file index bulk load, indexes will be rebuilt later";
+}
+
+bool FileIndexerDatabase::restoreIndexStructures() {
+  if (!m_db.transaction()) {
+    qCritical() << "Failed to start index rebuild transaction" << m_db.lastError();
+    return false;
+  }
+
+  QSqlQuery query(m_db);
+
+  for (const auto &[name, sql] : BULK_LOAD_INDEXES) {
+    if (!query.exec(sql)) {
+      qCritical() << "Failed to create index" << name << query.lastError();
+      m_db.rollback();
+      return false;
+    }
+  }
+
+  // repopulates the whole FTS index from the content table in one pass
+  if (!query.exec("INSERT INTO unicode_idx(unicode_idx) VALUES('rebuild')")) {
+    qCritical() << "Failed to rebuild FTS index" << query.lastError();
+    m_db.rollback();
+    return false;
+  }
+
+  for (const auto &[name, sql] : BULK_LOAD_TRIGGERS) {
+    if (!query.exec(sql)) {
+      qCritical() << "Failed to create trigger" << name << query.lastError();
+      m_db.rollback();
+      return false;
+    }
+  }
+
+  if (!query.exec(SYNC_FILE_ACCESS_SQL)) {
+    qCritical() << "Failed to restore file access history" << query.lastError();
+    m_db.rollback();
+    return false;
+  }
+
+  if (!m_db.commit()) {
+    qCritical() << "Failed to commit index rebuild" << m_db.lastError();
+    return false;
+  }
+
+  return true;
+}
+
+void FileIndexerDatabase::recoverInterruptedBulkLoad() {
+  QSqlQuery query(m_db);
+
+  if (!query.exec("SELECT COUNT(*) FROM sqlite_master WHERE type = 'trigger' AND name = 'unicode_idx_ai'")) {
+    qCritical() << "Failed to check for interrupted bulk load" << query.lastError();
+    return;
+  }
+
+  if (query.next() && query.value(0).toInt() > 0) return;
+
+  qWarning() << "Previous file index bulk load was interrupted, rebuilding indexes";
+  restoreIndexStructures();
+}
+
+bool FileIndexerDatabase::insertFileRows(QSqlQuery &query, std::span<const FileEvent> events,
+                                         RelevancyScorer &scorer) {
+  int idx = 0;
+
+  for (const auto &event : events) {
+    // the walker reports file_time_type::min() when the modification time could not be read
+    bool hasTime = event.eventTime != fs::file_time_type::min();
+    QVariant lastModified;
+
+    if (hasTime) {
+      using namespace std::chrono;
+      auto sctp = clock_cast<system_clock>(event.eventTime);
+      lastModified = static_cast<qlonglong>(duration_cast<seconds>(sctp.time_since_epoch()).count());
+    }
+
+    query.bindValue(idx++, event.path.c_str());
+    query.bindValue(idx++, event.path.parent_path().c_str());
+    query.bindValue(idx++, event.path.filename().c_str());
+    query.bindValue(idx++, lastModified);
+    query.bindValue(idx++, scorer.computeScore(event.path));
+  }
+
+  if (!query.exec()) {
+    qCritical() << "Failed to bulk insert files in index" << query.lastError();
+    return false;
+  }
+
+  return true;
+}
+
+void FileIndexerDatabase::bulkIndexEvents(int scanId, const std::vector<FileEvent> &events) {
+  if (events.empty()) return;
+
+  if (!m_db.transaction()) {
+    qWarning() << "Failed to start bulk insert transaction" << m_db.lastError();
+    return;
+  }
+
+  {
+    RelevancyScorer scorer;
+    QSqlQuery fullQuery(m_db);
+    std::span<const FileEvent> remaining = events;
+
+    fullQuery.prepare(createBulkInsertStatement(BULK_INSERT_ROWS_PER_STATEMENT));
+
+    while (remaining.size() >= BULK_INSERT_ROWS_PER_STATEMENT) {
+      if (!insertFileRows(fullQuery, remaining.first(BULK_INSERT_ROWS_PER_STATEMENT), scorer)) {
+        m_db.rollback();
+        return;
+      }
+      remaining = remaining.subspan(BULK_INSERT_ROWS_PER_STATEMENT);
+    }
+
+    if (!remaining.empty()) {
+      QSqlQuery tailQuery(m_db);
+
+      tailQuery.prepare(createBulkInsertStatement(remaining.size()));
+
+      if (!insertFileRows(tailQuery, remaining, scorer)) {
+        m_db.rollback();
+        return;
+      }
+    }
+
+    QSqlQuery progressQuery(m_db);
+
+    progressQuery.prepare(
+        "UPDATE scan_history SET indexed_file_count = indexed_file_count + :count WHERE id = :id");
+    progressQuery.bindValue(":count", static_cast<qlonglong>(events.size()));
+    progressQuery.bindValue(":id", scanId);
+
+    if (!progressQuery.exec()) {
+      qCritical() << "Failed to update scan progress" << progressQuery.lastError();
+      m_db.rollback();
+      return;
+    }
+  }
+
+  if (!m_db.commit()) { qCritical() << "Failed to commit bulk insert" << m_db.lastError(); }
+}
+
 FileIndexerDatabase::FileIndexerDatabase() : m_connectionId(createRandomConnectionId()) {
   m_db = QSqlDatabase::addDatabase("QSQLITE", m_connectionId);
   m_db.setDatabaseName(getDatabasePath().c_str());
@@ -440,6 +845,7 @@ FileIndexerDatabase::FileIndexerDatabase() : m_connectionId(createRandomConnecti
 }
 
 FileIndexerDatabase::~FileIndexerDatabase() {
+  m_searchQuery.reset();
   m_db.close();
   m_db = QSqlDatabase();
   QSqlDatabase::removeDatabase(m_connectionId);
@@ -1,12 +1,17 @@
 #pragma once
 #include "services/files-service/abstract-file-indexer.hpp"
 #include "services/files-service/file-indexer/scan.hpp"
+#include "services/files-service/file-indexer/relevancy-scorer.hpp"
 #include <expected>
 #include <qdatetime.h>
 #include <qobject.h>
 #include <qrandom.h>
 #include <qsqldatabase.h>
+#include <qsqlquery.h>
 #include <filesystem>
+#include <functional>
+#include <memory>
+#include <span>
 
 /**
  * File indexer sqlite database operations.
@@ -18,6 +23,17 @@ class FileIndexerDatabase : public QObject {
   QSqlDatabase m_db;
   QString m_connectionId;
 
+  // prepared once and reused for every search made through this connection
+  std::unique_ptr<QSqlQuery> m_searchQuery;
+
+  QSqlQuery *execSearchQuery(std::string_view searchQuery, const AbstractFileIndexer::QueryParams &params);
+
+  // number of scans currently bulk loading through this connection
+  int m_bulkLoadDepth = 0;
+
+  bool insertFileRows(QSqlQuery &query, std::span<const FileEvent> events, RelevancyScorer &scorer);
+  bool restoreIndexStructures();
+
 public:
   struct ScanRecord {
     int id;
@@ -49,11 +65,67 @@ public:
   void deleteAllIndexedFiles();
   void deleteIndexedFiles(const std::vector<std::filesystem::path> &paths);
   void indexFiles(const std::vector<std::filesystem::path> &paths);
+  /**
+   * Runs a FTS5 search. `isCancelled` is polled while reading rows, so that
+   * a superseded search can stop early.
+   */
   std::vector<std::filesystem::path> search(std::string_view searchQuery,
-                                            const AbstractFileIndexer::QueryParams &params);
+                                            const AbstractFileIndexer::QueryParams &params,
+                                            const std::function<bool()> &isCancelled = nullptr);
+
+  /**
+   * Same query as `search`, but rows are handed to `onChunk` as soon as they are read,
+   * in chunks of growing size so that the first results are available as early as possible.
+   * Unlike `search`, no existence check is performed: the caller is expected to do it.
+   * Reading stops as soon as `onChunk` returns false.
+   */
+  void searchStream(std::string_view searchQuery, const AbstractFileIndexer::QueryParams &params,
+                    const std::function<bool(std::vector<std::filesystem::path> chunk)> &onChunk);
 
   void indexEvents(const std::vector<FileEvent> &events);
 
+  /**
+   * Access history used to rank search results, see RelevancyScorer.
+   */
+  void setAccessHistory(const std::vector<IndexerFileAccess> &history);
+  void recordAccess(const std::filesystem::path &path);
+
+  /**
+   * Calls `fn` for every indexed file, in id order. Used to rebuild in-memory indexes.
+   */
+  void forEachIndexedFile(const std::function<void(std::string_view path, double relevancyScore)> &fn);
+
+  /**
+   * Bulk load mode, meant for full scans where millions of rows are inserted at once.
+   * The FTS triggers and secondary indexes are dropped so that inserts only touch the table
+   * and its unique path index. Rows are then inserted using multi-row statements through
+   * `bulkIndexEvents`, and everything is rebuilt in a single pass once the last bulk load ends.
+   *
+   * Calls can be nested, e.g. when several full scans run at the same time.
+   */
+  void beginBulkLoad();
+  void endBulkLoad();
+  bool isBulkLoading() const { return m_bulkLoadDepth > 0; }
+
+  /**
+   * Ends a bulk load that was interrupted, without rebuilding anything. An interrupted scan is followed
+   * by another full scan or by a shutdown, the rebuild is left to the next bulk load to end or to
+   * `recoverInterruptedBulkLoad`.
+   */
+  void abandonBulkLoad();
+
+  /**
+   * Indexes `events` (only Modify events are expected) and adds their count to the
+   * scan's `indexed_file_count` in the same transaction.
+   */
+  void bulkIndexEvents(int scanId, const std::vector<FileEvent> &events);
+
+  /**
+   * Restores triggers and indexes dropped by a bulk load that never ended (e.g. crash).
+   * Should be called once at startup, before any bulk load is started.
+   */
+  void recoverInterruptedBulkLoad();
+
   void runMigrations();
 
   QSqlDatabase *database();
@@ -0,0 +1,165 @@
+#include "file-indexer-query-engine.hpp"
+#include "services/files-service/file-indexer/file-indexer-db.hpp"
+#include "utils.hpp"
+#include <QtConcurrent/QtConcurrentRun>
+#include <QtConcurrent/QtConcurrentFilter>
+#include <QDebug>
+#include <chrono>
+
+namespace {
+
+/**
+ * Read connection owned by the current pool thread, created on first use.
+ * Pool threads never expire: they only exit, closing their connection, when the pool of the engine that
+ * owns them is destroyed.
+ */
+FileIndexerDatabase &threadConnection() {
+  static thread_local std::unique_ptr<FileIndexerDatabase> db;
+
+  if (!db) { db = std::make_unique<FileIndexerDatabase>(); }
+
+  return *db;
+}
+
+} // namespace
+
+QFuture<std::vector<IndexerFileResult>>
+FileIndexerQueryEngine::query(std::string_view q, const AbstractFileIndexer::QueryParams &params) {
+  auto run = [this, params, index = readyMemoryIndex()](QPromise<std::vector<IndexerFileResult>> &promise,
+                                                        const QString &query) {
+    // superseded before we even got a worker
+    if (promise.isCanceled()) return;
+
+    auto start = std::chrono::steady_clock::now();
+    auto isCancelled = [&promise]() { return promise.isCanceled(); };
+    std::vector<std::filesystem::path> paths;
+
+    if (index) {
+      paths = index->search(query.toStdString(), params.pagination.offset, params.pagination.limit,
+                            isCancelled);
+      std::erase_if(paths, [](const std::filesystem::path &path) {
+        std::error_code ec;
+        return !std::filesystem::exists(path, ec);
+      });
+    } else {
+      paths = threadConnection().search(preparePrefixSearchQuery(query).toStdString(), params, isCancelled);
+    }
+
+    if (promise.isCanceled()) return;
+
+    std::vector<IndexerFileResult> results;
+
+    results.reserve(paths.size());
+
+    for (auto &path : paths) {
+      results.emplace_back(IndexerFileResult{.path = std::move(path)});
+    }
+
+    promise.addResult(std::move(results));
+    recordLatency(start);
+  };
+
+  return QtConcurrent::run(&m_pool, run, qStringFromStdView(q));
+}
+
+QFuture<std::vector<IndexerFileResult>>
+FileIndexerQueryEngine::queryStream(std::string_view q, const AbstractFileIndexer::QueryParams &params) {
+  auto run = [this, params, index = readyMemoryIndex()](QPromise<std::vector<IndexerFileResult>> &promise,
+                                                        const QString &query) {
+    if (promise.isCanceled()) return;
+
+    auto start = std::chrono::steady_clock::now();
+    bool firstChunk = true;
+
+    auto onChunk = [&](std::vector<std::filesystem::path> chunk) {
+      if (promise.isCanceled()) return false;
+
+      auto exists = [](const std::filesystem::path &path) {
+        std::error_code ec;
+        return std::filesystem::exists(path, ec);
+      };
+      auto existing = QtConcurrent::blockingFiltered(&m_statPool, chunk, exists);
+
+      if (promise.isCanceled()) return false;
+      if (existing.empty()) return true;
+
+      std::vector<IndexerFileResult> results;
+
+      results.reserve(existing.size());
+
+      for (auto &path : existing) {
+        results.emplace_back(IndexerFileResult{.path = std::move(path)});
+      }
+
+      promise.addResult(std::move(results));
+
+      // time to first results is what matters when streaming
+      if (firstChunk) {
+        recordLatency(start);
+        firstChunk = false;
+      }
+
+      return true;
+    };
+
+    if (index) {
+      // the whole page is ready at once, there is nothing to stream
+      auto paths = index->search(query.toStdString(), params.pagination.offset, params.pagination.limit,
+                                 [&promise]() { return promise.isCanceled(); });
+      if (!paths.empty()) { onChunk(std::move(paths)); }
+      return;
+    }
+
+    threadConnection().searchStream(preparePrefixSearchQuery(query).toStdString(), params, onChunk);
+  };
+
+  return QtConcurrent::run(&m_pool, run, qStringFromStdView(q));
+}
+
+void FileIndexerQueryEngine::recordLatency(std::chrono::steady_clock::time_point start) {
+  using namespace std::chrono;
+  auto count = m_latency.record(duration_cast<microseconds>(steady_clock::now() - start));
+
+  if (count % LATENCY_REPORT_INTERVAL == 0) {
+    qInfo() << "File search latency:" << m_latency.summary();
+  }
+}
+
+void FileIndexerQueryEngine::setMemoryIndex(std::shared_ptr<const TrigramIndex> index) {
+  std::scoped_lock lock(m_memoryIndexMtx);
+  m_memoryIndex = std::move(index);
+}
+
+std::shared_ptr<const TrigramIndex> FileIndexerQueryEngine::readyMemoryIndex() {
+  std::scoped_lock lock(m_memoryIndexMtx);
+
+  if (m_memoryIndex && m_memoryIndex->isReady()) return m_memoryIndex;
+
+  return nullptr;
+}
+
+QString FileIndexerQueryEngine::preparePrefixSearchQuery(QStringView query) {
+  QString finalQuery;
+
+  for (const auto &word : query.split(' ')) {
+    if (!finalQuery.isEmpty()) { finalQuery += ' '; }
+    // double quotes are escaped by doubling them inside a FTS5 string
+    finalQuery += QString("\"%1\"").arg(word.toString().replace('"', "\"\""));
+  }
+
+  finalQuery += '*';
+
+  return finalQuery;
+}
+
+FileIndexerQueryEngine::FileIndexerQueryEngine() {
+  m_pool.setMaxThreadCount(READER_THREAD_COUNT);
+  // keep threads (and therefore their connections) alive
+  m_pool.setExpiryTimeout(-1);
+  m_statPool.setMaxThreadCount(STAT_THREAD_COUNT);
+}
+
+FileIndexerQueryEngine::~FileIndexerQueryEngine() {
+  m_pool.waitForDone();
+  m_statPool.waitForDone();
+}
@@ -1,38 +1,60 @@
 #pragma once
 #include "services/files-service/abstract-file-indexer.hpp"
-#include "services/files-service/file-indexer/file-indexer-db.hpp"
-#include "utils.hpp"
-#include <QtConcurrent/QtConcurrentRun>
-#include <ranges>
-
-// FIXME: this fires a new query and creates a database connection on each search, which can
-// potentially cause issues when doing a lot of file search. Adding a slight debounce on
-// search is recommended.
+#include "services/files-service/file-indexer/query-latency-histogram.hpp"
+#include "services/files-service/file-indexer/trigram-index.hpp"
+#include <QThreadPool>
+#include <chrono>
+#include <mutex>
+
+/**
+ * Runs file search queries against the indexer database.
+ *
+ * Queries are executed on a small dedicated thread pool whose threads are never expired.
+ * Each worker thread lazily opens its own long-lived read connection (a sqlite connection
+ * can't be shared across threads) that keeps the prepared search statement around, so that
+ * a search only pays for the actual FTS lookup.
+ *
+ * Cancelling the returned future (e.g. because the query was superseded by a newer keystroke)
+ * is honored before the query starts and while rows are being read.
+ *
+ * `queryStream` reports results chunk by chunk (one future result per chunk). Existence checks
+ * for each chunk are spread over a separate I/O pool, as a serial stat loop dominates latency on
+ * cold caches or network filesystems.
+ *
+ * If an in-memory TrigramIndex is set, queries are served from it instead as soon as it is ready,
+ * which enables substring and fuzzy matches. Results then come as a single chunk.
+ */
 class FileIndexerQueryEngine {
 public:
   QFuture<std::vector<IndexerFileResult>> query(std::string_view q,
-                                                const AbstractFileIndexer::QueryParams &params) {
-    return QtConcurrent::run([params, query = qStringFromStdView(q)]() {
-      FileIndexerDatabase db;
-      QString finalQuery = preparePrefixSearchQuery(query);
+                                                const AbstractFileIndexer::QueryParams &params);
+  QFuture<std::vector<IndexerFileResult>> queryStream(std::string_view q,
+                                                      const AbstractFileIndexer::QueryParams &params);
+
+  const QueryLatencyHistogram &latency() const { return m_latency; }
+
+  // nullptr to go back to the database
+  void setMemoryIndex(std::shared_ptr<const TrigramIndex> index);
 
-      return db.search(finalQuery.toStdString(), params) |
-             std::views::transform([](auto &&path) { return IndexerFileResult(path); }) |
-             std::ranges::to<std::vector>();
-    });
-  }
+  FileIndexerQueryEngine();
+  ~FileIndexerQueryEngine();
 
 private:
-  static QString preparePrefixSearchQuery(QStringView query) {
-    QString finalQuery;
+  static constexpr const int READER_THREAD_COUNT = 2;
+  // stat calls are mostly waiting on I/O, so we can afford more threads than cores
+  static constexpr const int STAT_THREAD_COUNT = 8;
+  // log latency summary every N queries
+  static constexpr const int LATENCY_REPORT_INTERVAL = 256;
 
-    for (const auto &word : query.split(' ')) {
-      if (!finalQuery.isEmpty()) { finalQuery += ' '; }
-      finalQuery += QString("\"%1\"").arg(word);
-    }
+  static QString preparePrefixSearchQuery(QStringView query);
+  // the memory index, if there is one and it is ready to be queried
+  std::shared_ptr<const TrigramIndex> readyMemoryIndex();
+  void recordLatency(std::chrono::steady_clock::time_point start);
 
-    finalQuery += '*';
+  QThreadPool m_pool;
+  QThreadPool m_statPool;
+  QueryLatencyHistogram m_latency;
 
-    return finalQuery;
-  }
+  std::mutex m_memoryIndexMtx;
+  std::shared_ptr<const TrigramIndex> m_memoryIndex;
 };
@@ -118,6 +118,15 @@ void FileIndexer::preferenceValuesChanged(const QJsonObject &preferences) {
 
   std::string databaseFilename = FileIndexerDatabase::getDatabasePath().filename().string();
   m_excludedFilenames = {databaseFilename, databaseFilename + "-wal"};
+
+  bool useMemoryIndex = preferences.value("inMemoryIndex").toBool();
+
+  if (useMemoryIndex != (m_memoryIndex != nullptr)) {
+    qInfo() << (useMemoryIndex ? "Enabling" : "Disabling") << "in-memory file index";
+    m_memoryIndex = useMemoryIndex ? std::make_shared<TrigramIndex>() : nullptr;
+    m_writer->setMemoryIndex(m_memoryIndex);
+    m_queryEngine.setMemoryIndex(m_memoryIndex);
+  }
 }
 
 QFuture<std::vector<IndexerFileResult>> FileIndexer::queryAsync(std::string_view view,
@@ -125,6 +134,18 @@ QFuture<std::vector<IndexerFileResult>> FileIndexer::queryAsync(std::string_view
   return m_queryEngine.query(view, params);
 }
 
+QFuture<std::vector<IndexerFileResult>> FileIndexer::queryStreamAsync(std::string_view view,
+                                                                      const QueryParams &params) {
+  return m_queryEngine.queryStream(view, params);
+}
+
+void FileIndexer::setAccessHistory(std::vector<IndexerFileAccess> history) {
+  m_writer->setAccessHistory(std::move(history));
+}
+
+void FileIndexer::recordAccess(const fs::path &path) { m_writer->recordAccess(path); }
+
 FileIndexer::FileIndexer() : m_writer(std::make_shared<DbWriter>()), m_dispatcher(m_writer) {
   m_db.runMigrations();
+  m_db.recoverInterruptedBulkLoad();
 }
@@ -31,6 +31,8 @@ public:
   std::vector<std::string> m_excludedFilenames;
   FileIndexerQueryEngine m_queryEngine;
   FileIndexerDatabase m_db;
+  // optional, see TrigramIndex
+  std::shared_ptr<TrigramIndex> m_memoryIndex;
 
   ScanDispatcher m_dispatcher;
 
@@ -45,6 +47,10 @@ public:
   void preferenceValuesChanged(const QJsonObject &preferences) override;
   QFuture<std::vector<IndexerFileResult>> queryAsync(std::string_view view,
                                                      const QueryParams &params = {}) override;
+  QFuture<std::vector<IndexerFileResult>> queryStreamAsync(std::string_view view,
+                                                           const QueryParams &params = {}) override;
+  void setAccessHistory(std::vector<IndexerFileAccess> history) override;
+  void recordAccess(const std::filesystem::path &path) override;
   void start() override;
 
   FileIndexer();
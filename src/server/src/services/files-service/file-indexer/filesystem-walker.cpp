@@ -3,11 +3,12 @@
 #include <chrono>
 #include <cstdlib>
 #include <filesystem>
-#include <fstream>
-#include <fnmatch.h>
 #include <qlogging.h>
 #include <qobjectdefs.h>
+#include <deque>
+#include <mutex>
 #include <stack>
+#include <thread>
 #include <qlogging.h>
 #include <string>
 
@@ -35,36 +36,6 @@ static const std::vector<std::string_view> EXCLUDED_FILENAMES = {
     ".clangd",
 };
 
-bool GitIgnoreReader::matches(const fs::path &path) const {
-  for (const auto &pattern : m_patterns) {
-    std::string filename = getLastPathComponent(path);
-    std::string processedPattern = pattern;
-
-    if (pattern.starts_with('/')) {
-      // get rid of leading slash to match more gitignore patterns - this is a hack:
-      // directory separators are not handled properly.
-      processedPattern = pattern.substr(1);
-    }
-
-    if (fnmatch(processedPattern.c_str(), filename.c_str(), FNM_PATHNAME | FNM_EXTMATCH) == 0) {
-      return true;
-    }
-  }
-
-  return false;
-}
-
-const std::vector<std::string> &GitIgnoreReader::patterns() const { return m_patterns; }
-
-GitIgnoreReader::GitIgnoreReader(const fs::path &path) : m_path(path) {
-  std::ifstream ifs(path);
-  std::string line;
-
-  while (std::getline(ifs, line)) {
-    m_patterns.emplace_back(line);
-  }
-}
-
 void FileSystemWalker::setIgnoreFiles(const std::vector<std::string> &files) { m_ignoreFiles = files; }
 
 void FileSystemWalker::setExcludedPaths(const std::vector<std::filesystem::path> &paths) {
@@ -79,107 +50,235 @@ void FileSystemWalker::setIgnoreHiddenPaths(bool value) { m_ignoreHiddenFiles =
 
 void FileSystemWalker::setVerbose(bool value) { m_verbose = value; }
 
-bool FileSystemWalker::isIgnored(const std::filesystem::path &path) const {
-  if (m_ignoreFiles.empty()) return false;
+bool FileSystemWalker::isExcludedPath(const std::filesystem::path &path) const {
+  return std::ranges::find(m_excludedPaths, path) != m_excludedPaths.end();
+}
+
+void FileSystemWalker::setThreadCount(size_t count) { m_threadCount = std::max<size_t>(1, count); }
 
-  fs::path p = path.parent_path();
+bool FileSystemWalker::shouldSkip(const fs::directory_entry &entry,
+                                  const GitIgnoreStack::Ptr &ignoreStack) const {
   std::error_code ec;
 
-  while (p != p.root_directory()) {
-    for (const auto &name : m_ignoreFiles) {
-      fs::path ignorePath = p / name;
+  if (entry.is_symlink(ec)) { return true; }
 
-      if (!fs::is_regular_file(ignorePath, ec)) continue;
-      if (GitIgnoreReader(ignorePath).matches(path)) { return true; }
-    }
+  auto &path = entry.path();
 
-    p = p.parent_path();
+  if (m_ignoreHiddenFiles && isHiddenPath(path)) {
+    if (m_verbose) { qInfo() << "FileSystemWalker: ignoring hidden path" << path.c_str(); }
+    return true;
+  }
+
+  if (std::ranges::find(EXCLUDED_PATHS, path) != EXCLUDED_PATHS.end()) { return true; }
+  if (std::ranges::find(EXCLUDED_FILENAMES, path.filename()) != EXCLUDED_FILENAMES.end()) { return true; }
+  if (ignoreStack && GitIgnoreStack::isIgnored(ignoreStack, path, entry.is_directory(ec))) {
+    if (m_verbose) { qInfo() << "Indexing: ignoring git-ignored path" << path.c_str(); }
+    return true;
+  }
+
+  if (isExcludedPath(path)) {
+    if (m_verbose) { qInfo() << "FileSystemWalker: excluding path" << path.c_str(); }
+    return true;
   }
 
   return false;
 }
 
-bool FileSystemWalker::isExcludedPath(const std::filesystem::path &path) const {
-  return std::ranges::find(m_excludedPaths, path) != m_excludedPaths.end();
-}
+void FileSystemWalker::visitDirectory(const DirectoryWork &dir, const WalkCallback &callback,
+                                      const std::function<void(DirectoryWork)> &descend,
+                                      WalkStats &stats) const {
+  std::error_code ec;
+  // ignore files of this directory are only read once, and shared by all its descendants
+  auto ignoreStack = m_ignoreFiles.empty() ? nullptr
+                                           : GitIgnoreStack::push(dir.ignoreStack, dir.path, m_ignoreFiles);
+
+  // directory_iterator fills the entry type from d_type, so no extra stat is needed
+  // to know whether an entry is a directory or a symlink.
+  // The non-throwing increment is used as this can run on worker threads, where an exception
+  // (e.g. the directory being removed while we read it) would terminate the program.
+  for (fs::directory_iterator it(dir.path, ec), end; !ec && it != end; it.increment(ec)) {
+    const auto &entry = *it;
+    std::error_code entryEc;
+
+    if (shouldSkip(entry, ignoreStack)) continue;
+
+    bool isDir = entry.is_directory(entryEc);
+
+    if (isDir) {
+      ++stats.dirCount;
+    } else {
+      ++stats.fileCount;
+    }
 
-void FileSystemWalker::walk(const fs::path &root, const WalkCallback &callback) {
-  using namespace std::chrono;
+    if (m_recursive && isDir) {
+      size_t childDepth = dir.depth + 1;
+      bool shouldDescend = !m_maxDepth || childDepth <= *m_maxDepth;
+      if (shouldDescend) descend({.path = entry.path(), .depth = childDepth, .ignoreStack = ignoreStack});
+    }
 
-  auto start = high_resolution_clock::now();
-  std::stack<fs::path> dirStack;
-  size_t rootDepth = std::distance(root.begin(), root.end());
-  size_t dirCount = 0;
-  size_t fileCount = 0;
-  std::error_code ec;
+    callback(entry);
+  }
 
-  if (!fs::is_directory(root, ec)) {
-    qWarning() << "FileSystemWalker needs to be passed a readable directory as its root entrypoint"
-               << (ec ? ec.message().c_str() : "");
-    return;
+  if (ec) { qWarning() << "walk error" << dir.path.c_str() << ec.message().c_str(); }
+}
+
+FileSystemWalker::DirectoryWork FileSystemWalker::rootWork(const fs::path &root) const {
+  DirectoryWork work{.path = root, .depth = 0};
+
+  // ignore files located above the root also apply
+  if (!m_ignoreFiles.empty() && root.has_parent_path() && root.parent_path() != root) {
+    work.ignoreStack = GitIgnoreStack::forDirectory(root.parent_path(), m_ignoreFiles);
   }
 
-  dirStack.push(root);
+  return work;
+}
+
+void FileSystemWalker::walkSequential(const fs::path &root, const WalkCallback &callback, WalkStats &stats) {
+  std::stack<DirectoryWork> dirStack;
+  auto descend = [&](DirectoryWork work) { dirStack.emplace(std::move(work)); };
+
+  dirStack.emplace(rootWork(root));
 
   while (!dirStack.empty()) {
     if (!m_alive) break;
 
-    auto path = dirStack.top();
+    auto work = std::move(dirStack.top());
 
     dirStack.pop();
+    visitDirectory(work, callback, descend, stats);
+  }
+}
 
-    for (const auto &entry : fs::directory_iterator(path, ec)) {
-      if (ec) {
-        qWarning() << "walk error" << ec.message().c_str();
-        continue;
+void FileSystemWalker::walkParallel(const fs::path &root, const WalkCallback &callback, WalkStats &stats) {
+  struct WorkQueue {
+    std::mutex mtx;
+    std::deque<DirectoryWork> dirs;
+  };
+
+  std::vector<WorkQueue> queues(m_threadCount);
+  // directories queued or being visited, the walk is over when it drops to zero
+  std::atomic<size_t> pending = 1;
+  // directories sitting in one of the queues, idle workers sleep until there is one
+  std::atomic<size_t> queued = 1;
+
+  queues[0].dirs.emplace_back(rootWork(root));
+
+  auto worker = [&](size_t self) {
+    auto &own = queues[self];
+    auto descend = [&](DirectoryWork work) {
+      ++pending;
+      {
+        // updated under the idle lock so that a worker about to sleep can't miss it, and before the
+        // push so that a thief taking the directory right away can't decrement it below zero
+        std::lock_guard lock(m_idleMutex);
+        ++queued;
+      }
+      {
+        std::lock_guard lock(own.mtx);
+        own.dirs.emplace_back(std::move(work));
+      }
+      m_idleSignal.notify_one();
+    };
+
+    // own work is taken from the back (depth first, cache friendly), stolen work from the front
+    // (closer to the root, so likely to be a bigger subtree)
+    auto next = [&]() -> std::optional<DirectoryWork> {
+      {
+        std::lock_guard lock(own.mtx);
+        if (!own.dirs.empty()) {
+          auto work = std::move(own.dirs.back());
+          own.dirs.pop_back();
+          --queued;
+          return work;
+        }
       }
-      if (entry.is_symlink(ec)) { continue; }
 
-      auto path = entry.path();
+      for (size_t i = 1; i != queues.size(); ++i) {
+        auto &victim = queues[(self + i) % queues.size()];
+        std::lock_guard lock(victim.mtx);
 
-      if (m_ignoreHiddenFiles && isHiddenPath(path)) {
-        if (m_verbose) { qInfo() << "FileSystemWalker: ignoring hidden path" << path.c_str(); }
-        continue;
+        if (!victim.dirs.empty()) {
+          auto work = std::move(victim.dirs.front());
+          victim.dirs.pop_front();
+          --queued;
+          return work;
+        }
       }
 
-      if (std::ranges::find(EXCLUDED_PATHS, path) != EXCLUDED_PATHS.end()) { continue; }
-      if (std::ranges::find(EXCLUDED_FILENAMES, path.filename()) != EXCLUDED_FILENAMES.end()) { continue; }
-      if (isIgnored(path)) {
-        if (m_verbose) { qInfo() << "Indexing: ignoring git-ignored path" << path.c_str(); }
-        continue;
-      }
+      return std::nullopt;
+    };
 
-      if (isExcludedPath(path)) {
-        if (m_verbose) { qInfo() << "FileSystemWalker: excluding path" << path.c_str(); }
+    while (m_alive && pending > 0) {
+      auto work = next();
+
+      if (!work) {
+        // another worker may have taken the directory we were woken up for, in which case we wait again
+        std::unique_lock lock(m_idleMutex);
+        m_idleSignal.wait(lock, [&]() { return queued > 0 || pending == 0 || !m_alive; });
         continue;
       }
 
-      bool isDir = entry.is_directory(ec);
+      visitDirectory(*work, callback, descend, stats);
 
-      if (isDir) {
-        ++dirCount;
-      } else {
-        ++fileCount;
+      bool done = false;
+      {
+        std::lock_guard lock(m_idleMutex);
+        done = --pending == 0;
       }
+      if (done) m_idleSignal.notify_all();
+    }
+  };
 
-      if (m_recursive && isDir) {
-        size_t depth = std::distance(path.begin(), path.end()) - rootDepth;
-        bool shouldDescend = !m_maxDepth || depth <= *m_maxDepth;
-        if (shouldDescend) dirStack.push(entry);
-      }
+  std::vector<std::thread> threads;
 
-      callback(entry);
-    }
+  threads.reserve(m_threadCount - 1);
+
+  for (size_t i = 1; i != m_threadCount; ++i) {
+    threads.emplace_back(worker, i);
+  }
+
+  worker(0);
+
+  for (auto &thread : threads) {
+    thread.join();
+  }
+}
+
+void FileSystemWalker::walk(const fs::path &root, const WalkCallback &callback) {
+  using namespace std::chrono;
+
+  auto start = high_resolution_clock::now();
+  WalkStats stats;
+  std::error_code ec;
+
+  if (!fs::is_directory(root, ec)) {
+    qWarning() << "FileSystemWalker needs to be passed a readable directory as its root entrypoint"
+               << (ec ? ec.message().c_str() : "");
+    return;
+  }
+
+  if (m_threadCount > 1) {
+    walkParallel(root, callback, stats);
+  } else {
+    walkSequential(root, callback, stats);
   }
 
   double duration = duration_cast<seconds>(high_resolution_clock::now() - start).count();
 
   qInfo().noquote()
-      << QString("Done walking file tree at %1. Processed %2 directories and %3 files in %4 seconds.")
+      << QString("Done walking file tree at %1. Processed %2 directories and %3 files in %4 seconds "
+                 "(%5 threads).")
              .arg(root.c_str())
-             .arg(dirCount)
-             .arg(fileCount)
-             .arg(duration);
+             .arg(stats.dirCount.load())
+             .arg(stats.fileCount.load())
+             .arg(duration)
+             .arg(m_threadCount);
 }
 
-void FileSystemWalker::stop() { m_alive = false; }
+void FileSystemWalker::stop() {
+  {
+    std::lock_guard lock(m_idleMutex);
+    m_alive = false;
+  }
+  m_idleSignal.notify_all();
+}
@@ -1,20 +1,12 @@
 #pragma once
+#include "services/files-service/file-indexer/gitignore.hpp"
 #include <optional>
 #include <filesystem>
 #include <functional>
 #include <vector>
 #include <atomic>
-
-class GitIgnoreReader {
-  std::vector<std::string> m_patterns;
-  std::filesystem::path m_path;
-
-public:
-  bool matches(const std::filesystem::path &path) const;
-
-  const std::vector<std::string> &patterns() const;
-  GitIgnoreReader(const std::filesystem::path &path);
-};
+#include <condition_variable>
+#include <mutex>
 
 class FileSystemWalker {
 public:
@@ -28,12 +20,10 @@ public:
    * of the patterns present in these files.
    *
    * Similary to git, all ignore files located above the path that is being scrutinized are considered.
-   * Relative patterns (without leading '/') are considered with respect to the path location.
+   * Anchored patterns (containing a '/') are considered with respect to the ignore file location.
+   * See GitIgnorePattern for the supported syntax.
    *
-   * Patterns are interpreted using `fnmatch` which is not exactly conform to the logic git uses
-   * internally. For that reason, very complex patterns may not be interpreted correctly.
-   *
-   * // TODO: consider implementing a gitignore parsing C++ library (I haven't found any).
+   * Each ignore file is read and compiled once, when the walker enters its directory.
    *
    * By default, we only honor `.gitignore` files.
    */
@@ -47,6 +37,17 @@ public:
   void setVerbose(bool value = true);
   void setRecursive(bool value);
 
+  /**
+   * Number of threads used to walk the tree. Defaults to 1, in which case the walk is a plain
+   * depth-first traversal on the calling thread.
+   *
+   * With more than one thread, each worker owns a deque of directories to visit and steals
+   * from the others when it runs out of work. Exclusion, hidden path and depth semantics are the same,
+   * but the callback is called concurrently from the worker threads, in no particular order:
+   * it is the caller's responsibility to synchronize.
+   */
+  void setThreadCount(size_t count);
+
   void setExcludedPaths(const std::vector<std::filesystem::path> &paths);
   void walk(const std::filesystem::path &path, const WalkCallback &fn);
   void stop();
@@ -58,9 +59,40 @@ private:
   bool m_ignoreHiddenFiles = false;
   std::optional<size_t> m_maxDepth;
   bool m_verbose = false;
+  size_t m_threadCount = 1;
   std::atomic<bool> m_alive = true;
+  // idle workers of a parallel walk wait on this for more work, the end of the walk or a stop request
+  std::mutex m_idleMutex;
+  std::condition_variable m_idleSignal;
   std::vector<std::filesystem::path> m_excludedPaths = {};
 
-  bool isIgnored(const std::filesystem::path &path) const;
+  struct WalkStats {
+    std::atomic<size_t> dirCount = 0;
+    std::atomic<size_t> fileCount = 0;
+  };
+
+  struct DirectoryWork {
+    std::filesystem::path path;
+    size_t depth = 0;
+    // ignore files applying to `path`, excluding the ones located in `path` itself
+    GitIgnoreStack::Ptr ignoreStack;
+  };
+
   bool isExcludedPath(const std::filesystem::path &path) const;
+
+  /**
+   * Whether the entry should be skipped entirely (not reported nor descended into).
+   */
+  bool shouldSkip(const std::filesystem::directory_entry &entry, const GitIgnoreStack::Ptr &ignoreStack) const;
+
+  /**
+   * Reports every entry of `dir` to `callback` and calls `descend` for each subdirectory
+   * that should be walked next.
+   */
+  void visitDirectory(const DirectoryWork &dir, const WalkCallback &callback,
+                      const std::function<void(DirectoryWork)> &descend, WalkStats &stats) const;
+  DirectoryWork rootWork(const std::filesystem::path &root) const;
+
+  void walkSequential(const std::filesystem::path &root, const WalkCallback &callback, WalkStats &stats);
+  void walkParallel(const std::filesystem::path &root, const WalkCallback &callback, WalkStats &stats);
 };
@@ -0,0 +1,253 @@
+#include "services/files-service/file-indexer/gitignore.hpp"
+#include <fstream>
+#include <sstream>
+
+namespace fs = std::filesystem;
+
+/**
+ * Matches `str` against the glob `pat`. Only '**' can match across directory separators.
+ */
+static bool globMatch(std::string_view pat, std::string_view str) {
+  while (!pat.empty()) {
+    char c = pat.front();
+
+    if (c == '*') {
+      if (pat.size() > 1 && pat[1] == '*') {
+        pat.remove_prefix(2);
+        if (pat.empty()) return true;
+
+        // '**/' matches zero or more leading directories
+        if (pat.front() == '/') {
+          pat.remove_prefix(1);
+
+          for (size_t i = 0;;) {
+            if (globMatch(pat, str.substr(i))) return true;
+            auto next = str.find('/', i);
+            if (next == std::string_view::npos) return false;
+            i = next + 1;
+          }
+        }
+
+        for (size_t i = 0; i <= str.size(); ++i) {
+          if (globMatch(pat, str.substr(i))) return true;
+        }
+
+        return false;
+      }
+
+      pat.remove_prefix(1);
+
+      for (size_t i = 0; i <= str.size(); ++i) {
+        if (globMatch(pat, str.substr(i))) return true;
+        if (i < str.size() && str[i] == '/') break;
+      }
+
+      return false;
+    }
+
+    if (str.empty()) return false;
+
+    if (c == '?') {
+      if (str.front() == '/') return false;
+      pat.remove_prefix(1);
+      str.remove_prefix(1);
+      continue;
+    }
+
+    if (c == '[') {
+      size_t end = pat.find(']', pat.size() > 2 && (pat[1] == '!' || pat[1] == '^') ? 3 : 2);
+
+      // unterminated class, '[' is treated literally
+      if (end != std::string_view::npos) {
+        std::string_view cls = pat.substr(1, end - 1);
+        bool negated = cls.front() == '!' || cls.front() == '^';
+        bool matched = false;
+        char ch = str.front();
+
+        if (negated) cls.remove_prefix(1);
+
+        for (size_t i = 0; i < cls.size(); ++i) {
+          if (i + 2 < cls.size() && cls[i + 1] == '-') {
+            matched |= ch >= cls[i] && ch <= cls[i + 2];
+            i += 2;
+          } else {
+            matched |= ch == cls[i];
+          }
+        }
+
+        if (matched == negated || ch == '/') return false;
+
+        pat.remove_prefix(end + 1);
+        str.remove_prefix(1);
+        continue;
+      }
+    }
+
+    if (c == '\\' && pat.size() > 1) {
+      pat.remove_prefix(1);
+      c = pat.front();
+    }
+
+    if (c != str.front()) return false;
+
+    pat.remove_prefix(1);
+    str.remove_prefix(1);
+  }
+
+  return str.empty();
+}
+
+std::optional<GitIgnorePattern> GitIgnorePattern::parse(std::string_view line) {
+  if (!line.empty() && line.back() == '\r') line.remove_suffix(1);
+
+  // trailing spaces are ignored unless escaped
+  while (!line.empty() && line.back() == ' ' && !(line.size() > 1 && line[line.size() - 2] == '\\')) {
+    line.remove_suffix(1);
+  }
+
+  if (line.empty() || line.front() == '#') return std::nullopt;
+
+  GitIgnorePattern pattern;
+
+  if (line.front() == '!') {
+    pattern.m_negated = true;
+    line.remove_prefix(1);
+  } else if (line.starts_with("\\!") || line.starts_with("\\#")) {
+    line.remove_prefix(1);
+  }
+
+  if (line.ends_with('/')) {
+    pattern.m_directoryOnly = true;
+    line.remove_suffix(1);
+  }
+
+  if (line.empty()) return std::nullopt;
+
+  pattern.m_anchored = line.find('/') != std::string_view::npos;
+  if (line.front() == '/') line.remove_prefix(1);
+
+  pattern.m_pattern = line;
+
+  bool hasMeta = line.find_first_of("*?[\\") != std::string_view::npos;
+
+  if (!hasMeta) {
+    pattern.m_kind = Kind::Literal;
+  } else if (!pattern.m_anchored && line.starts_with('*') &&
+             line.find_first_of("*?[\\", 1) == std::string_view::npos) {
+    pattern.m_kind = Kind::Suffix;
+    pattern.m_pattern = line.substr(1);
+  } else {
+    pattern.m_kind = Kind::Glob;
+  }
+
+  return pattern;
+}
+
+bool GitIgnorePattern::matches(std::string_view relativePath, std::string_view name, bool isDirectory) const {
+  if (m_directoryOnly && !isDirectory) return false;
+
+  std::string_view subject = m_anchored ? relativePath : name;
+
+  switch (m_kind) {
+  case Kind::Literal:
+    return subject == m_pattern;
+  case Kind::Suffix:
+    return subject.ends_with(m_pattern);
+  case Kind::Glob:
+    return globMatch(m_pattern, subject);
+  }
+
+  return false;
+}
+
+std::optional<bool> GitIgnoreReader::evaluate(std::string_view relativePath, std::string_view name,
+                                              bool isDirectory) const {
+  for (auto it = m_patterns.rbegin(); it != m_patterns.rend(); ++it) {
+    if (it->matches(relativePath, name, isDirectory)) { return !it->isNegated(); }
+  }
+
+  return std::nullopt;
+}
+
+GitIgnoreReader::GitIgnoreReader(std::string_view content) {
+  while (!content.empty()) {
+    auto eol = content.find('\n');
+    auto line = content.substr(0, eol);
+
+    if (auto pattern = GitIgnorePattern::parse(line)) { m_patterns.emplace_back(std::move(*pattern)); }
+    if (eol == std::string_view::npos) break;
+
+    content.remove_prefix(eol + 1);
+  }
+}
+
+std::optional<GitIgnoreReader> GitIgnoreReader::fromFile(const fs::path &path) {
+  std::ifstream ifs(path);
+
+  if (!ifs) return std::nullopt;
+
+  std::stringstream ss;
+
+  ss << ifs.rdbuf();
+
+  return GitIgnoreReader(ss.str());
+}
+
+GitIgnoreStack::Ptr GitIgnoreStack::push(const Ptr &parent, const fs::path &directory,
+                                         const std::vector<std::string> &ignoreFiles) {
+  std::vector<GitIgnoreReader> readers;
+
+  for (const auto &name : ignoreFiles) {
+    // a failed open is as cheap as a stat, no need to check for existence first
+    if (auto reader = GitIgnoreReader::fromFile(directory / name); reader && !reader->empty()) {
+      readers.emplace_back(std::move(*reader));
+    }
+  }
+
+  if (readers.empty()) return parent;
+
+  auto node = std::make_shared<GitIgnoreStack>();
+
+  node->m_parent = parent;
+  node->m_directory = directory;
+  node->m_readers = std::move(readers);
+
+  return node;
+}
+
+GitIgnoreStack::Ptr GitIgnoreStack::forDirectory(const fs::path &directory,
+                                                 const std::vector<std::string> &ignoreFiles) {
+  Ptr stack;
+  fs::path current;
+
+  for (const auto &component : directory) {
+    current /= component;
+    if (current == current.root_path()) continue;
+    stack = push(stack, current, ignoreFiles);
+  }
+
+  return stack;
+}
+
+bool GitIgnoreStack::isIgnored(const Ptr &stack, const fs::path &path, bool isDirectory) {
+  const std::string &native = path.native();
+  auto slash = native.find_last_of('/');
+  std::string_view name = slash == std::string::npos ? native : std::string_view(native).substr(slash + 1);
+
+  // deeper ignore files take precedence over the ones closer to the root
+  for (auto node = stack.get(); node; node = node->m_parent.get()) {
+    const std::string &dir = node->m_directory.native();
+
+    if (!native.starts_with(dir)) continue;
+
+    std::string_view relative = std::string_view(native).substr(dir.size());
+
+    if (relative.starts_with('/')) relative.remove_prefix(1);
+
+    for (auto it = node->m_readers.rbegin(); it != node->m_readers.rend(); ++it) {
+      if (auto result = it->evaluate(relative, name, isDirectory)) { return *result; }
+    }
+  }
+
+  return false;
+}
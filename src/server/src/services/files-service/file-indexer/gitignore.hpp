@@ -0,0 +1,94 @@
+#pragma once
+#include <filesystem>
+#include <memory>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <vector>
+
+/**
+ * A single gitignore rule, compiled once when the ignore file is read.
+ *
+ * Follows gitignore(5) semantics:
+ * - a leading '!' negates the rule (re-includes a previously ignored path)
+ * - a trailing '/' restricts the rule to directories
+ * - a rule containing a '/' anywhere but at its end is anchored to the directory
+ * of the ignore file, otherwise it matches the entry name at any depth
+ * - '*' and '?' don't match '/', '**' does, and '[...]' character classes are supported
+ */
+class GitIgnorePattern {
+public:
+  /**
+   * Parses a single line of an ignore file. Returns nullopt for blank lines and comments.
+   */
+  static std::optional<GitIgnorePattern> parse(std::string_view line);
+
+  /**
+   * `relativePath` is relative to the directory containing the ignore file.
+   */
+  bool matches(std::string_view relativePath, std::string_view name, bool isDirectory) const;
+  bool isNegated() const { return m_negated; }
+
+private:
+  // most patterns are either plain names or '*.ext', which don't need a full glob match
+  enum class Kind { Literal, Suffix, Glob };
+
+  std::string m_pattern;
+  Kind m_kind = Kind::Glob;
+  bool m_negated = false;
+  bool m_directoryOnly = false;
+  bool m_anchored = false;
+};
+
+/**
+ * All the rules of a single ignore file.
+ */
+class GitIgnoreReader {
+  std::vector<GitIgnorePattern> m_patterns;
+
+public:
+  /**
+   * Whether this file has an opinion on the path: true if it is ignored, false if it is explicitly
+   * re-included, nullopt if no rule matches. As in git, the last matching rule wins.
+   */
+  std::optional<bool> evaluate(std::string_view relativePath, std::string_view name, bool isDirectory) const;
+
+  bool empty() const { return m_patterns.empty(); }
+  const std::vector<GitIgnorePattern> &patterns() const { return m_patterns; }
+
+  GitIgnoreReader(std::string_view content);
+  static std::optional<GitIgnoreReader> fromFile(const std::filesystem::path &path);
+};
+
+/**
+ * Immutable stack of the ignore files that apply to a directory, from the closest to the farthest.
+ *
+ * A walker pushes a new node when it enters a directory that has ignore files of its own and simply
+ * shares its parent's node otherwise, so each ignore file is read exactly once per walk no matter how
+ * many entries it applies to. Nodes are reference counted and never mutated, which makes it safe to hand
+ * them over to other walker threads.
+ */
+class GitIgnoreStack {
+public:
+  using Ptr = std::shared_ptr<const GitIgnoreStack>;
+
+  /**
+   * Returns the stack to use for entries of `directory`: a new node if `directory` contains any of the
+   * `ignoreFiles`, `parent` otherwise.
+   */
+  static Ptr push(const Ptr &parent, const std::filesystem::path &directory,
+                  const std::vector<std::string> &ignoreFiles);
+
+  /**
+   * Builds the stack for `directory` out of the ignore files found in all of its ancestors
+   * (excluding the filesystem root) and in the directory itself.
+   */
+  static Ptr forDirectory(const std::filesystem::path &directory, const std::vector<std::string> &ignoreFiles);
+
+  static bool isIgnored(const Ptr &stack, const std::filesystem::path &path, bool isDirectory);
+
+private:
+  Ptr m_parent;
+  std::filesystem::path m_directory;
+  std::vector<GitIgnoreReader> m_readers;
+};
@@ -2,6 +2,8 @@
 #include "abstract-scanner.hpp"
 #include "services/files-service/file-indexer/filesystem-walker.hpp"
 #include <QDebug>
+#include <mutex>
+#include <thread>
 
 namespace fs = std::filesystem;
 
@@ -30,19 +32,27 @@ void IndexerScanner::enqueueBatch(const std::vector<FileEvent> &paths) {
 
 void IndexerScanner::scan(const Scan &scan) {
   std::vector<FileEvent> batchedIndex;
+  std::mutex batchedIndexMtx;
   FileSystemWalker walker;
 
   walker.setVerbose();
   walker.setExcludedPaths(scan.excludedPaths);
+  walker.setThreadCount(std::max(1u, std::thread::hardware_concurrency()));
   walker.walk(scan.path, [&](const fs::directory_entry &entry) {
     std::error_code ec;
     // In case of error, returns file_time_time::min() - erroring entries deserve a bad relevance score anyway
-    batchedIndex.emplace_back(FileEventType::Modify, entry.path(), entry.last_write_time(ec));
+    // The stat is done outside the lock, as the callback is called from all walker threads.
+    auto lastModified = entry.last_write_time(ec);
+    std::vector<FileEvent> fullBatch;
 
-    if (batchedIndex.size() > INDEX_BATCH_SIZE) {
-      enqueueBatch(batchedIndex);
-      batchedIndex.clear();
+    {
+      std::lock_guard lock(batchedIndexMtx);
+      batchedIndex.emplace_back(FileEventType::Modify, entry.path(), lastModified);
+
+      if (batchedIndex.size() > INDEX_BATCH_SIZE) { fullBatch = std::exchange(batchedIndex, {}); }
     }
+
+    if (!fullBatch.empty()) { enqueueBatch(fullBatch); }
   });
 
   enqueueBatch(batchedIndex);
@@ -56,23 +66,44 @@ IndexerScanner::IndexerScanner(std::shared_ptr<DbWriter> writer, const Scan &sc,
   m_scanThread = std::thread([this, sc]() {
     start(sc);
 
+    m_writer->beginBulkLoad();
+    m_writerWorker->setBulkLoad(recordId());
+
     try {
       scan(sc);
-      m_writerWorker->stop();
+      stopWriter();
+      leaveBulkLoad();
       finish();
     } catch (const std::exception &error) {
       qCritical() << "Caught exception during fullscan" << error.what();
+      stopWriter();
+      leaveBulkLoad();
       fail();
     }
   });
 }
 
+void IndexerScanner::stopWriter() {
+  // all batches need to be handed to the db writer before leaving bulk load mode
+  m_writerWorker->stop();
+  if (m_writerThread.joinable()) { m_writerThread.join(); }
+}
+
+void IndexerScanner::leaveBulkLoad() {
+  // rebuilding the indexes would only hold up the shutdown or the new scan that interrupted us
+  if (isInterrupted()) {
+    m_writer->abandonBulkLoad();
+  } else {
+    m_writer->endBulkLoad();
+  }
+}
+
 void IndexerScanner::interrupt() {
   setInterruptFlag();
   m_writerWorker->stop();
 }
 
 void IndexerScanner::join() {
-  m_writerThread.join();
   m_scanThread.join();
+  if (m_writerThread.joinable()) { m_writerThread.join(); }
 }
@@ -20,6 +20,8 @@ private:
 
   void scan(const Scan &scan);
   void enqueueBatch(const std::vector<FileEvent> &paths);
+  void stopWriter();
+  void leaveBulkLoad();
 
 public:
   IndexerScanner(std::shared_ptr<DbWriter> writer, const Scan &scan, FinishCallback callback);
@@ -0,0 +1,71 @@
+#pragma once
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <bit>
+#include <chrono>
+#include <cstdint>
+#include <QString>
+
+/**
+ * Lock-free latency histogram using power-of-two microsecond buckets.
+ * Bucket N counts samples in [2^(N-1), 2^N) µs, the last bucket catching everything above.
+ * Cheap enough to be recorded from every query worker without any synchronization.
+ */
+class QueryLatencyHistogram {
+public:
+  static constexpr size_t BUCKET_COUNT = 24; // last regular bucket is ~4s
+
+  /**
+   * Returns the number of samples recorded so far, this one included.
+   */
+  uint64_t record(std::chrono::microseconds duration) {
+    auto us = static_cast<uint64_t>(std::max<int64_t>(duration.count(), 0));
+    size_t bucket = std::min<size_t>(std::bit_width(us), BUCKET_COUNT - 1);
+
+    m_buckets[bucket].fetch_add(1, std::memory_order_relaxed);
+    m_totalUs.fetch_add(us, std::memory_order_relaxed);
+
+    return m_count.fetch_add(1, std::memory_order_relaxed) + 1;
+  }
+
+  uint64_t count() const { return m_count.load(std::memory_order_relaxed); }
+
+  std::chrono::microseconds mean() const {
+    auto n = count();
+    if (n == 0) return {};
+    return std::chrono::microseconds(m_totalUs.load(std::memory_order_relaxed) / n);
+  }
+
+  /**
+   * Upper bound of the bucket containing the requested percentile (0-100).
+   */
+  std::chrono::microseconds percentile(double p) const {
+    uint64_t total = count();
+    if (total == 0) return {};
+
+    uint64_t target = std::max<uint64_t>(1, static_cast<uint64_t>(total * (p / 100.0)));
+    uint64_t seen = 0;
+
+    for (size_t i = 0; i != BUCKET_COUNT; ++i) {
+      seen += m_buckets[i].load(std::memory_order_relaxed);
+      if (seen >= target) return std::chrono::microseconds(uint64_t(1) << i);
+    }
+
+    return std::chrono::microseconds(uint64_t(1) << (BUCKET_COUNT - 1));
+  }
+
+  QString summary() const {
+    return QString("n=%1 mean=%2us p50<=%3us p90<=%4us p99<=%5us")
+        .arg(count())
+        .arg(mean().count())
+        .arg(percentile(50).count())
+        .arg(percentile(90).count())
+        .arg(percentile(99).count());
+  }
+
+private:
+  std::array<std::atomic<uint64_t>, BUCKET_COUNT> m_buckets{};
+  std::atomic<uint64_t> m_count = 0;
+  std::atomic<uint64_t> m_totalUs = 0;
+};
@@ -2,7 +2,6 @@
 #include <filesystem>
 #include <qlocale.h>
 #include <unordered_map>
-#include <optional>
 #include "relevancy-scorer.hpp"
 
 // clang-format off
@@ -44,6 +43,23 @@ static const std::unordered_map<std::string, double> FILE_TYPE_WEIGHTS = {
 };
 // clang-format on
 
+struct RecencyBucket {
+  int maxDays;
+  double multiplier;
+};
+
+// files modified longer than the last bucket ago get OLD_FILE_MULTIPLIER
+static constexpr RecencyBucket RECENCY_BUCKETS[] = {{7, 1.3}, {30, 1.1}, {90, 1.0}, {365, 0.9}};
+static constexpr double OLD_FILE_MULTIPLIER = 0.8;
+
+// opened files get up to (1 + ACCESS_WEIGHT) times the score, half of it after ACCESS_HALF_SATURATION opens
+static constexpr double ACCESS_WEIGHT = 1.0;
+static constexpr double ACCESS_HALF_SATURATION = 2.0;
+// the access boost is halved for files that were not opened for that long
+static constexpr int ACCESS_STALE_DAYS = 90;
+
+static constexpr int SECONDS_PER_DAY = 86400;
+
 double RelevancyScorer::computeLocationMultiplier(const std::filesystem::path &path) {
   if (isInHomeDirectory(path)) { return 2.0; }
 
@@ -77,21 +93,30 @@ double RelevancyScorer::computePathDepthMultiplier(const std::filesystem::path &
   return 0.7;
 }
 
-double RelevancyScorer::computeRecencyMultiplier(std::filesystem::file_time_type lastModified) {
-  auto now = std::filesystem::file_time_type::clock::now();
-  auto duration = now - lastModified;
-  auto days = std::chrono::duration_cast<std::chrono::days>(duration).count();
+QString RelevancyScorer::queryTimeMultiplierSql(const QString &file) {
+  QString recency = QString("CASE WHEN %1.last_modified_at IS NULL THEN 1.0").arg(file);
+
+  for (const auto &bucket : RECENCY_BUCKETS) {
+    recency += QString(" WHEN :now - %1.last_modified_at <= %2 THEN %3")
+                   .arg(file)
+                   .arg(bucket.maxDays * SECONDS_PER_DAY)
+                   .arg(bucket.multiplier);
+  }
+
+  recency += QString(" ELSE %1 END").arg(OLD_FILE_MULTIPLIER);
 
-  if (days <= 7) return 1.3;
-  if (days <= 30) return 1.1;
-  if (days <= 90) return 1.0;
-  if (days <= 365) return 0.9;
+  // saturating, so that a file opened a hundred times doesn't bury everything else
+  QString accessBoost = QString("(1.0 + %1 * %2.access_count / (%2.access_count + %3)"
+                                " * CASE WHEN :now - %2.last_accessed_at > %4 THEN 0.5 ELSE 1.0 END)")
+                            .arg(ACCESS_WEIGHT)
+                            .arg(file)
+                            .arg(ACCESS_HALF_SATURATION, 0, 'f', 1)
+                            .arg(ACCESS_STALE_DAYS * SECONDS_PER_DAY);
 
-  return 0.8;
+  return QString("(%1) * %2").arg(recency).arg(accessBoost);
 }
 
-double RelevancyScorer::computeScore(const std::filesystem::path &path,
-                                     std::optional<std::filesystem::file_time_type> lastModified) {
+double RelevancyScorer::computeScore(const std::filesystem::path &path) {
   double score = 1.0;
 
   // 1. Location-based scoring
@@ -106,8 +131,7 @@ double RelevancyScorer::computeScore(const std::filesystem::path &path,
   // 4. Path depth penalty
   score *= computePathDepthMultiplier(path);
 
-  // 5. Recency bonus (if modification time available)
-  if (lastModified.has_value()) { score *= computeRecencyMultiplier(lastModified.value()); }
+  // Recency and access frequency are applied at query time, see queryTimeMultiplierSql
 
   return std::max(0.1, score); // Minimum score of 0.1
 }
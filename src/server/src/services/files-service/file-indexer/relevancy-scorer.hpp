@@ -1,15 +1,26 @@
 #pragma once
+#include <QString>
 #include <filesystem>
-#include <optional>
 
+/**
+ * File relevancy is split in two parts:
+ * - a static part that only depends on the path (location, type, hidden, depth), computed once at
+ * index time and stored in `indexed_file.relevancy_score`
+ * - a time dependent part (modification recency, how often and how recently the file was opened)
+ * that would go stale if it were stored, and is therefore evaluated by the search query itself.
+ */
 class RelevancyScorer {
   double computeLocationMultiplier(const std::filesystem::path &path);
   double computeFileTypeMultiplier(const std::filesystem::path &path);
   double computeHiddenFileMultiplier(const std::filesystem::path &path);
   double computePathDepthMultiplier(const std::filesystem::path &path);
-  double computeRecencyMultiplier(const std::filesystem::file_time_type lastModified);
 
 public:
-  double computeScore(const std::filesystem::path &path,
-                      std::optional<std::filesystem::file_time_type> lastModified);
+  double computeScore(const std::filesystem::path &path);
+
+  /**
+   * SQL expression for the time dependent multiplier, `file` being the alias of the `indexed_file` table.
+   * The current time is expected to be bound as `:now`, in seconds since epoch.
+   */
+  static QString queryTimeMultiplierSql(const QString &file);
 };
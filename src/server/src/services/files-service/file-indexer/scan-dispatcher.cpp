@@ -2,6 +2,7 @@
 #include "services/files-service/file-indexer/indexer-scanner.hpp"
 #include "services/files-service/file-indexer/incremental-scanner.hpp"
 #include "services/files-service/file-indexer/watcher-scanner.hpp"
+#include "services/files-service/file-indexer/fanotify-watcher-scanner.hpp"
 #include <map>
 #include <memory>
 #include <mutex>
@@ -35,7 +36,12 @@ int ScanDispatcher::enqueue(const Scan &scan) {
       m_scannerMap[scanId] = {scan, std::make_unique<IncrementalScanner>(m_writer, scan, handler)};
       break;
     case ScanType::Watcher:
-      m_scannerMap[scanId] = {scan, std::make_unique<WatcherScanner>(m_writer, scan, handler)};
+      // a single fanotify mark covers the whole filesystem, but requires privileges we usually don't have
+      if (FanotifyWatcherScanner::isSupported(scan.path)) {
+        m_scannerMap[scanId] = {scan, std::make_unique<FanotifyWatcherScanner>(m_writer, scan, handler)};
+      } else {
+        m_scannerMap[scanId] = {scan, std::make_unique<WatcherScanner>(m_writer, scan, handler)};
+      }
       break;
     }
   }
@@ -0,0 +1,494 @@
+#include "trigram-index.hpp"
+#include <algorithm>
+#include <cctype>
+#include <cmath>
+#include <cstring>
+#include <mutex>
+
+namespace fs = std::filesystem;
+
+namespace {
+
+constexpr size_t ARENA_BLOCK_SIZE = 1 << 20;
+
+// compact once tombstones make up for more than half of the entries (and there are enough of them)
+constexpr size_t MIN_TOMBSTONES_FOR_COMPACTION = 4096;
+
+// fraction of the query trigrams a name must contain to be returned as a fuzzy match
+constexpr double FUZZY_MIN_TRIGRAM_RATIO = 0.6;
+
+constexpr size_t CANCELLATION_CHECK_INTERVAL = 4096;
+
+char foldCase(char c) { return (c >= 'A' && c <= 'Z') ? c + ('a' - 'A') : c; }
+
+uint32_t trigramKey(const char *s) {
+  return static_cast<uint8_t>(foldCase(s[0])) << 16 | static_cast<uint8_t>(foldCase(s[1])) << 8 |
+         static_cast<uint8_t>(foldCase(s[2]));
+}
+
+bool isWordBoundary(std::string_view name, size_t pos) {
+  if (pos == 0) return true;
+
+  char prev = name[pos - 1];
+  char cur = name[pos];
+
+  if (!std::isalnum(static_cast<unsigned char>(prev))) return true;
+
+  // camelCase and digit/letter transitions: `Q3financialReport`
+  return (std::islower(static_cast<unsigned char>(prev)) && std::isupper(static_cast<unsigned char>(cur))) ||
+         (std::isdigit(static_cast<unsigned char>(prev)) != std::isdigit(static_cast<unsigned char>(cur)));
+}
+
+/**
+ * Sorted docids, delta encoded as LEB128 varints.
+ */
+struct PostingList {
+  std::vector<uint8_t> bytes;
+  uint32_t last = 0;
+  uint32_t count = 0;
+
+  void append(uint32_t docid) {
+    // docids are only appended in increasing order, this also dedupes repeated trigrams in a name
+    if (count > 0 && docid <= last) return;
+
+    uint32_t delta = docid - (count > 0 ? last : 0);
+
+    while (delta >= 0x80) {
+      bytes.push_back(static_cast<uint8_t>(delta) | 0x80);
+      delta >>= 7;
+    }
+
+    bytes.push_back(static_cast<uint8_t>(delta));
+    last = docid;
+    ++count;
+  }
+
+  template <typename F> void forEach(F &&fn) const {
+    uint32_t current = 0;
+    size_t i = 0;
+
+    while (i < bytes.size()) {
+      uint32_t delta = 0;
+      int shift = 0;
+
+      while (bytes[i] & 0x80) {
+        delta |= static_cast<uint32_t>(bytes[i++] & 0x7f) << shift;
+        shift += 7;
+      }
+
+      delta |= static_cast<uint32_t>(bytes[i++]) << shift;
+      current += delta;
+      fn(current);
+    }
+  }
+
+  std::vector<uint32_t> decode() const {
+    std::vector<uint32_t> docids;
+
+    docids.reserve(count);
+    forEach([&](uint32_t docid) { docids.push_back(docid); });
+
+    return docids;
+  }
+
+  /**
+   * Keeps the docids of `docids` (sorted) that are also in this list.
+   */
+  void intersect(std::vector<uint32_t> &docids) const {
+    size_t kept = 0;
+    size_t i = 0;
+
+    forEach([&](uint32_t docid) {
+      while (i < docids.size() && docids[i] < docid) {
+        ++i;
+      }
+      if (i < docids.size() && docids[i] == docid) { docids[kept++] = docids[i++]; }
+    });
+
+    docids.resize(kept);
+  }
+};
+
+struct Entry {
+  const char *path;
+  uint32_t length;
+  uint32_t nameOffset;
+  float score;
+  bool alive;
+
+  std::string_view pathView() const { return {path, length}; }
+  std::string_view name() const { return {path + nameOffset, length - nameOffset}; }
+};
+
+struct Candidate {
+  uint32_t docid;
+  // exact matches: how good the match is (see matchQuality), fuzzy matches: number of matching trigrams
+  int quality;
+};
+
+} // namespace
+
+struct TrigramIndex::Data {
+  std::vector<std::unique_ptr<char[]>> blocks;
+  size_t blockUsed = ARENA_BLOCK_SIZE;
+  size_t arenaBytes = 0;
+
+  std::vector<Entry> entries;
+  // keys point into the arena
+  std::unordered_map<std::string_view, uint32_t> docids;
+  std::unordered_map<uint32_t, PostingList> postings;
+  size_t tombstones = 0;
+
+  std::string_view store(std::string_view str) {
+    char *dst;
+
+    if (str.size() > ARENA_BLOCK_SIZE) {
+      // oversized path, give it a block of its own
+      dst = blocks.emplace_back(std::make_unique<char[]>(str.size())).get();
+      blockUsed = ARENA_BLOCK_SIZE;
+    } else {
+      if (blockUsed + str.size() > ARENA_BLOCK_SIZE) {
+        blocks.emplace_back(std::make_unique<char[]>(ARENA_BLOCK_SIZE));
+        blockUsed = 0;
+      }
+
+      dst = blocks.back().get() + blockUsed;
+      blockUsed += str.size();
+    }
+
+    std::memcpy(dst, str.data(), str.size());
+    arenaBytes += str.size();
+
+    return {dst, str.size()};
+  }
+
+  void insert(std::string_view path, float score) {
+    auto stored = store(path);
+    auto slash = stored.rfind('/');
+    uint32_t docid = entries.size();
+    Entry entry{.path = stored.data(),
+                .length = static_cast<uint32_t>(stored.size()),
+                .nameOffset = static_cast<uint32_t>(slash == std::string_view::npos ? 0 : slash + 1),
+                .score = score,
+                .alive = true};
+    auto name = entry.name();
+
+    entries.emplace_back(entry);
+    docids.emplace(stored, docid);
+
+    for (size_t i = 0; i + 3 <= name.size(); ++i) {
+      postings[trigramKey(name.data() + i)].append(docid);
+    }
+  }
+
+  bool shouldCompact() const {
+    return tombstones >= MIN_TOMBSTONES_FOR_COMPACTION && tombstones * 2 > entries.size();
+  }
+
+  std::unique_ptr<Data> compacted() const {
+    auto data = std::make_unique<Data>();
+
+    data->entries.reserve(entries.size() - tombstones);
+    data->docids.reserve(entries.size() - tombstones);
+
+    for (const auto &entry : entries) {
+      if (entry.alive) { data->insert(entry.pathView(), entry.score); }
+    }
+
+    return data;
+  }
+};
+
+/**
+ * Position of `term` (already case folded) in `name`, ignoring ASCII case.
+ */
+static size_t findFolded(std::string_view name, std::string_view term) {
+  if (term.size() > name.size()) return std::string_view::npos;
+
+  char first = term.front();
+  size_t last = name.size() - term.size();
+
+  for (size_t i = 0; i <= last; ++i) {
+    if (foldCase(name[i]) != first) continue;
+
+    size_t j = 1;
+
+    while (j < term.size() && foldCase(name[i + j]) == term[j]) {
+      ++j;
+    }
+
+    if (j == term.size()) return i;
+  }
+
+  return std::string_view::npos;
+}
+
+/**
+ * Returns -1 if one of the terms is not in `name`, otherwise how good the match is:
+ * 3 for an exact name match, 2 for a name prefix, 1 for a word boundary and 0 for anything else.
+ */
+static int matchQuality(std::string_view name, const std::vector<std::string> &terms) {
+  size_t firstPos = std::string_view::npos;
+
+  for (const auto &term : terms) {
+    auto pos = findFolded(name, term);
+
+    if (pos == std::string_view::npos) return -1;
+    if (firstPos == std::string_view::npos) { firstPos = pos; }
+  }
+
+  if (terms.size() == 1 && name.size() == terms.front().size()) return 3;
+  if (firstPos == 0) return 2;
+  if (isWordBoundary(name, firstPos)) return 1;
+
+  return 0;
+}
+
+std::vector<fs::path> TrigramIndex::search(std::string_view query, size_t offset, size_t limit,
+                                           const std::function<bool()> &isCancelled) const {
+  std::vector<std::string> terms;
+
+  for (size_t i = 0; i < query.size();) {
+    while (i < query.size() && std::isspace(static_cast<unsigned char>(query[i]))) {
+      ++i;
+    }
+
+    size_t start = i;
+
+    while (i < query.size() && !std::isspace(static_cast<unsigned char>(query[i]))) {
+      ++i;
+    }
+
+    if (i > start) {
+      std::string term(query.substr(start, i - start));
+      std::ranges::transform(term, term.begin(), foldCase);
+      terms.emplace_back(std::move(term));
+    }
+  }
+
+  if (terms.empty() || limit == 0) return {};
+
+  std::shared_lock lock(m_mtx);
+  const Data &data = *m_data;
+  size_t wanted = offset + limit;
+  std::vector<uint32_t> queryTrigrams;
+
+  for (const auto &term : terms) {
+    for (size_t i = 0; i + 3 <= term.size(); ++i) {
+      queryTrigrams.emplace_back(trigramKey(term.data() + i));
+    }
+  }
+
+  std::ranges::sort(queryTrigrams);
+  queryTrigrams.erase(std::unique(queryTrigrams.begin(), queryTrigrams.end()), queryTrigrams.end());
+
+  std::vector<const PostingList *> lists;
+  bool hasMissingTrigram = false;
+
+  for (uint32_t trigram : queryTrigrams) {
+    if (auto it = data.postings.find(trigram); it != data.postings.end()) {
+      lists.emplace_back(&it->second);
+    } else {
+      hasMissingTrigram = true;
+    }
+  }
+
+  std::vector<Candidate> exact;
+  size_t checked = 0;
+
+  auto consider = [&](uint32_t docid) {
+    if (isCancelled && ++checked % CANCELLATION_CHECK_INTERVAL == 0 && isCancelled()) return false;
+
+    const auto &entry = data.entries[docid];
+
+    if (!entry.alive) return true;
+
+    int quality = matchQuality(entry.name(), terms);
+
+    if (quality >= 0) { exact.emplace_back(Candidate{.docid = docid, .quality = quality}); }
+
+    return true;
+  };
+
+  if (queryTrigrams.empty()) {
+    // only terms shorter than a trigram: nothing to look up, check every name
+    for (uint32_t docid = 0; docid < data.entries.size(); ++docid) {
+      if (!consider(docid)) return {};
+    }
+  } else if (!hasMissingTrigram) {
+    // start from the rarest trigram, so that the candidate set is as small as possible from the start
+    std::ranges::sort(lists, [](auto *a, auto *b) { return a->count < b->count; });
+
+    auto candidates = lists.front()->decode();
+
+    for (size_t i = 1; i < lists.size() && !candidates.empty(); ++i) {
+      lists[i]->intersect(candidates);
+    }
+
+    // trigrams can match across term boundaries or out of order, names still need to be checked
+    for (uint32_t docid : candidates) {
+      if (!consider(docid)) return {};
+    }
+  }
+
+  auto byScore = [&](const Candidate &a, const Candidate &b) {
+    if (a.quality != b.quality) return a.quality > b.quality;
+
+    const auto &ea = data.entries[a.docid];
+    const auto &eb = data.entries[b.docid];
+
+    if (ea.score != eb.score) return ea.score > eb.score;
+
+    return ea.length - ea.nameOffset < eb.length - eb.nameOffset;
+  };
+
+  auto sortTop = [&](std::vector<Candidate> &candidates) {
+    auto middle = candidates.begin() + std::min(wanted, candidates.size());
+    std::partial_sort(candidates.begin(), middle, candidates.end(), byScore);
+  };
+
+  sortTop(exact);
+
+  std::vector<Candidate> fuzzy;
+
+  if (exact.size() < wanted && queryTrigrams.size() >= 2) {
+    size_t minHits = std::max<size_t>(2, std::ceil(queryTrigrams.size() * FUZZY_MIN_TRIGRAM_RATIO));
+    std::vector<uint8_t> hits(data.entries.size(), 0);
+
+    for (const auto *list : lists) {
+      list->forEach([&](uint32_t docid) {
+        if (hits[docid] < UINT8_MAX) { ++hits[docid]; }
+      });
+    }
+
+    for (const auto &candidate : exact) {
+      hits[candidate.docid] = 0;
+    }
+
+    for (uint32_t docid = 0; docid < hits.size(); ++docid) {
+      if (hits[docid] >= minHits && data.entries[docid].alive) {
+        fuzzy.emplace_back(Candidate{.docid = docid, .quality = hits[docid]});
+      }
+    }
+
+    sortTop(fuzzy);
+  }
+
+  if (isCancelled && isCancelled()) return {};
+
+  std::vector<fs::path> results;
+  size_t skipped = 0;
+
+  results.reserve(std::min(limit, exact.size() + fuzzy.size()));
+
+  for (const auto *candidates : {&exact, &fuzzy}) {
+    for (const auto &candidate : *candidates) {
+      if (results.size() >= limit) break;
+      if (skipped < offset) {
+        ++skipped;
+        continue;
+      }
+
+      results.emplace_back(data.entries[candidate.docid].pathView());
+    }
+  }
+
+  return results;
+}
+
+void TrigramIndex::upsert(std::string_view path, double score) {
+  std::scoped_lock writeLock(m_writeMtx);
+  std::unique_lock lock(m_mtx);
+  Data &data = *m_data;
+
+  if (auto it = data.docids.find(path); it != data.docids.end()) {
+    auto &entry = data.entries[it->second];
+
+    entry.score = score;
+
+    if (!entry.alive) {
+      entry.alive = true;
+      --data.tombstones;
+    }
+
+    return;
+  }
+
+  data.insert(path, score);
+}
+
+void TrigramIndex::remove(std::string_view path) {
+  std::scoped_lock writeLock(m_writeMtx);
+  std::unique_lock lock(m_mtx);
+  Data &data = *m_data;
+  auto it = data.docids.find(path);
+
+  if (it == data.docids.end()) return;
+
+  auto &entry = data.entries[it->second];
+
+  if (!entry.alive) return;
+
+  entry.alive = false;
+  ++data.tombstones;
+}
+
+void TrigramIndex::compactIfNeeded() {
+  std::scoped_lock writeLock(m_writeMtx);
+  std::unique_ptr<Data> compacted;
+
+  {
+    // no writer can get in until the new index is swapped in, readers can
+    std::shared_lock lock(m_mtx);
+    if (!m_data->shouldCompact()) return;
+    compacted = m_data->compacted();
+  }
+
+  std::unique_lock lock(m_mtx);
+  m_data = std::move(compacted);
+}
+
+void TrigramIndex::clear() {
+  std::scoped_lock writeLock(m_writeMtx);
+  std::unique_lock lock(m_mtx);
+  m_data = std::make_unique<Data>();
+}
+
+void TrigramIndex::swap(TrigramIndex &other) {
+  std::scoped_lock lock(m_writeMtx, other.m_writeMtx, m_mtx, other.m_mtx);
+  std::swap(m_data, other.m_data);
+  other.m_data = std::make_unique<Data>();
+}
+
+bool TrigramIndex::isReady() const {
+  std::shared_lock lock(m_mtx);
+  return m_ready;
+}
+
+void TrigramIndex::setReady(bool ready) {
+  std::unique_lock lock(m_mtx);
+  m_ready = ready;
+}
+
+size_t TrigramIndex::size() const {
+  std::shared_lock lock(m_mtx);
+  return m_data->entries.size() - m_data->tombstones;
+}
+
+TrigramIndex::Stats TrigramIndex::stats() const {
+  std::shared_lock lock(m_mtx);
+  Stats stats{.entries = m_data->entries.size() - m_data->tombstones,
+              .tombstones = m_data->tombstones,
+              .trigrams = m_data->postings.size(),
+              .arenaBytes = m_data->arenaBytes};
+
+  for (const auto &[trigram, list] : m_data->postings) {
+    stats.postingBytes += list.bytes.size();
+  }
+
+  return stats;
+}
+
+TrigramIndex::TrigramIndex() : m_data(std::make_unique<Data>()) {}
+
+TrigramIndex::~TrigramIndex() = default;
@@ -0,0 +1,92 @@
+#pragma once
+#include <cstdint>
+#include <filesystem>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <shared_mutex>
+#include <string_view>
+#include <unordered_map>
+#include <vector>
+
+/**
+ * In-memory filename index, used as an alternative to the FTS5 index for file search.
+ *
+ * FTS5 only matches at token starts (`report` can't find `Q3financialreport.pdf`) and its prefix
+ * indexes take a lot of space. This index instead maps every (case folded) trigram of every file name
+ * to a posting list of the files containing it, so that any substring of three characters or more can
+ * be looked up by intersecting a few lists. Queries with no exact match fall back to fuzzy matching,
+ * ranking files by the number of query trigrams their name contains.
+ *
+ * Memory layout:
+ * - paths are stored back to back in a string arena made of large blocks that never move
+ * - a file is identified by its position in the entry table (docid), docids are only ever appended
+ * - posting lists are delta encoded varints, which is what keeps millions of entries in a few hundred MB
+ *
+ * Deleted files are tombstoned, which keeps removals cheap. They are compacted away in one go by
+ * `compactIfNeeded`, once they make up for a large part of the index.
+ * A file that comes back (e.g. a file that is rewritten through a rename) reuses its docid.
+ *
+ * The index mirrors the `indexed_file` table: it is rebuilt from it and then kept in sync by the
+ * DbWriter applying the same changes to both. All methods are thread safe; writers are serialized
+ * against readers using a shared mutex.
+ */
+class TrigramIndex {
+public:
+  struct Stats {
+    size_t entries = 0;
+    size_t tombstones = 0;
+    size_t trigrams = 0;
+    size_t postingBytes = 0;
+    size_t arenaBytes = 0;
+  };
+
+  /**
+   * Files whose name contains every whitespace separated term of `query`, ignoring ASCII case.
+   * If there are not enough of them, files sharing most of the query trigrams are appended.
+   *
+   * Results are ordered by match quality (exact name, name prefix, word boundary, anywhere), then by
+   * relevancy score.
+   */
+  std::vector<std::filesystem::path> search(std::string_view query, size_t offset, size_t limit,
+                                            const std::function<bool()> &isCancelled = nullptr) const;
+
+  void upsert(std::string_view path, double score);
+  void remove(std::string_view path);
+  void clear();
+
+  /**
+   * Rebuilds the index without its tombstones if there are enough of them, which is meant to be called
+   * after a batch of changes. Searches keep going while the new index is built, they are only blocked
+   * for the time it takes to swap it in.
+   */
+  void compactIfNeeded();
+
+  /**
+   * Replaces the content of this index with the one of `other`, which is left empty.
+   * Used to build a new index off-lock and publish it at once.
+   */
+  void swap(TrigramIndex &other);
+
+  /**
+   * Whether the index reflects the database, i.e. a rebuild completed. Queries should go to the
+   * database until then.
+   */
+  bool isReady() const;
+  void setReady(bool ready);
+
+  size_t size() const;
+  Stats stats() const;
+
+  TrigramIndex();
+  ~TrigramIndex();
+
+private:
+  struct Data;
+
+  mutable std::shared_mutex m_mtx;
+  // serializes writers, so that a compaction can be built under a shared lock without missing a change
+  std::mutex m_writeMtx;
+  std::unique_ptr<Data> m_data;
+  bool m_ready = false;
+};
@@ -65,19 +65,23 @@ void WatcherScanner::handleEvent(const wtr::event &ev) {
 
   switch (ev.effect_type) {
   case wtr::event::effect_type::create:
+    m_coalescer.push(FileEvent(FileEventType::Modify, ev.path_name, toFileTimeType(ev.effect_time)), true);
+    break;
+
   case wtr::event::effect_type::modify:
-    m_writer->indexEvents({FileEvent(FileEventType::Modify, ev.path_name, toFileTimeType(ev.effect_time))});
+    m_coalescer.push(FileEvent(FileEventType::Modify, ev.path_name, toFileTimeType(ev.effect_time)));
     break;
 
   case wtr::event::effect_type::destroy:
-    m_writer->indexEvents({FileEvent(FileEventType::Delete, ev.path_name, toFileTimeType(ev.effect_time))});
+    m_coalescer.push(FileEvent(FileEventType::Delete, ev.path_name, toFileTimeType(ev.effect_time)));
     break;
 
   case wtr::event::effect_type::rename:
-    m_writer->indexEvents({FileEvent(FileEventType::Delete, ev.path_name, toFileTimeType(ev.effect_time))});
+    m_coalescer.push(FileEvent(FileEventType::Delete, ev.path_name, toFileTimeType(ev.effect_time)));
     if (ev.associated) { // Sometimes we don't get the associated event, looking more into it
-      m_writer->indexEvents({FileEvent(FileEventType::Modify, ev.associated->path_name,
-                                       toFileTimeType(ev.associated->effect_time))});
+      // the destination may have existed before (overwrite), so this is not a creation
+      m_coalescer.push(FileEvent(FileEventType::Modify, ev.associated->path_name,
+                                 toFileTimeType(ev.associated->effect_time)));
     } else {
       qWarning() << "Got rename event for" << ev.path_name.c_str() << ", but didn't get any associated event";
     }
@@ -90,7 +94,7 @@ void WatcherScanner::handleEvent(const wtr::event &ev) {
 }
 
 WatcherScanner::WatcherScanner(std::shared_ptr<DbWriter> writer, const Scan &scan, FinishCallback callback)
-    : AbstractScanner(writer, scan, callback), scan(scan) {
+    : AbstractScanner(writer, scan, callback), m_coalescer(writer->eventSink()), scan(scan) {
   m_watch = std::make_unique<wtr::watch>(scan.path, [this](const wtr::event &ev) { handleEvent(ev); });
 }
 
@@ -100,4 +104,7 @@ void WatcherScanner::interrupt() {
   finish();
 }
 
-void WatcherScanner::join() { m_watch->close(); }
+void WatcherScanner::join() {
+  m_watch->close();
+  m_coalescer.stop();
+}
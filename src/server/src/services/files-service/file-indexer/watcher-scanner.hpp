@@ -1,10 +1,12 @@
 #pragma once
 #include "services/files-service/file-indexer/abstract-scanner.hpp"
+#include "services/files-service/file-indexer/event-coalescer.hpp"
 #include "watcher.hpp"
 
 class WatcherScanner : public AbstractScanner {
 private:
   std::unique_ptr<wtr::watch> m_watch;
+  EventCoalescer m_coalescer;
   Scan scan;
 
   void handleMessage(const wtr::event &ev);
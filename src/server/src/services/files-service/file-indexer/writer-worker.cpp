@@ -3,18 +3,25 @@
 namespace fs = std::filesystem;
 
 void WriterWorker::stop() {
-  m_alive = false;
+  {
+    std::lock_guard lock(batchMutex);
+    m_alive = false;
+  }
   m_batchCv.notify_one();
 }
 
 void WriterWorker::run() {
-  while (m_alive) {
+  while (true) {
     std::deque<std::vector<FileEvent>> batch;
 
     {
       std::unique_lock<std::mutex> lock(batchMutex);
 
-      m_batchCv.wait(lock, [&]() { return !batchQueue.empty(); });
+      m_batchCv.wait(lock, [&]() { return !batchQueue.empty() || !m_alive; });
+
+      // batches queued before stop() are still written, so that the tail of a scan isn't lost
+      if (batchQueue.empty()) break;
+
       batch = std::move(batchQueue);
       batchQueue.clear();
     }
@@ -29,6 +36,11 @@ void WriterWorker::run() {
 
 void WriterWorker::batchWrite(std::vector<FileEvent> paths) {
   // Writing is happening in the writerThread
+  if (m_bulkScanId) {
+    m_writer->bulkIndexEvents(*m_bulkScanId, std::move(paths));
+    return;
+  }
+
   m_writer->indexEvents(std::move(paths));
 }
 
@@ -1,5 +1,6 @@
 #include <atomic>
 #include <deque>
+#include <optional>
 #include "common/types.hpp"
 #include "services/files-service/file-indexer/db-writer.hpp"
 
@@ -11,6 +12,8 @@ class WriterWorker : NonCopyable {
   std::condition_variable &m_batchCv;
   std::atomic<bool> m_alive = true;
   std::atomic<bool> m_isWorking = false;
+  // when set, batches are written through the bulk load path and accounted to this scan
+  std::optional<int> m_bulkScanId;
 
   void batchWrite(std::vector<FileEvent> paths);
 
@@ -19,6 +22,9 @@ public:
   void stop();
   bool isWorking() const { return m_isWorking; }
 
+  // Must be called before the first batch is queued
+  void setBulkLoad(int scanId) { m_bulkScanId = scanId; }
+
   WriterWorker(std::shared_ptr<DbWriter> writer, std::mutex &batchMutex,
                std::deque<std::vector<FileEvent>> &batchQueue, std::condition_variable &batchCv);
 };
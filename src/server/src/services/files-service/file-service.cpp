@@ -13,6 +13,11 @@ FileService::queryAsync(std::string_view query, const AbstractFileIndexer::Query
   return m_indexer->queryAsync(query, params);
 }
 
+QFuture<std::vector<IndexerFileResult>>
+FileService::queryStreamAsync(std::string_view query, const AbstractFileIndexer::QueryParams &params) {
+  return m_indexer->queryStreamAsync(query, params);
+}
+
 void FileService::rebuildIndex() { m_indexer->rebuildIndex(); }
 
 void FileService::saveAccess(const fs::path &path) {
@@ -27,7 +32,12 @@ void FileService::saveAccess(const fs::path &path) {
   )");
   query.bindValue(":path", path.c_str());
 
-  if (!query.exec()) { qWarning() << "Failed to save access for file" << path.c_str(); }
+  if (!query.exec()) {
+    qWarning() << "Failed to save access for file" << path.c_str();
+    return;
+  }
+
+  m_indexer->recordAccess(path);
 }
 
 bool FileService::clearRecentlyAccessed() {
@@ -38,6 +48,8 @@ bool FileService::clearRecentlyAccessed() {
     return false;
   }
 
+  m_indexer->setAccessHistory({});
+
   return true;
 }
 
@@ -64,8 +76,33 @@ std::vector<FileService::RecentFile> FileService::getRecentlyAccessed() const {
   return files;
 }
 
+std::vector<IndexerFileAccess> FileService::loadAccessHistory() const {
+  auto query = m_db.createQuery();
+
+  if (!query.exec("SELECT path, access_count, last_accessed_at FROM recent_files")) {
+    qWarning() << "Failed to load file access history";
+    return {};
+  }
+
+  std::vector<IndexerFileAccess> history;
+
+  while (query.next()) {
+    history.emplace_back(IndexerFileAccess{
+        .path = query.value(0).toString().toStdString(),
+        .accessCount = query.value(1).toInt(),
+        .lastAccessedAt = QDateTime::fromSecsSinceEpoch(query.value(2).toULongLong()),
+    });
+  }
+
+  return history;
+}
+
 void FileService::preferenceValuesChanged(const QJsonObject &preferences) {
   m_indexer->preferenceValuesChanged(preferences);
 }
 
-FileService::FileService(OmniDatabase &db) : m_db(db) { m_indexer = std::make_unique<FileIndexer>(); }
+FileService::FileService(OmniDatabase &db) : m_db(db) {
+  m_indexer = std::make_unique<FileIndexer>();
+  // recent_files is the source of truth, the indexer only keeps a copy it can rank with
+  m_indexer->setAccessHistory(loadAccessHistory());
+}
@@ -19,6 +19,8 @@ public:
 
   QFuture<std::vector<IndexerFileResult>> queryAsync(std::string_view query,
                                                      const AbstractFileIndexer::QueryParams &params = {});
+  QFuture<std::vector<IndexerFileResult>>
+  queryStreamAsync(std::string_view query, const AbstractFileIndexer::QueryParams &params = {});
 
   std::vector<RecentFile> getRecentlyAccessed() const;
   void saveAccess(const std::filesystem::path &path);
@@ -29,6 +31,8 @@ public:
   FileService(OmniDatabase &db);
 
 private:
+  std::vector<IndexerFileAccess> loadAccessHistory() const;
+
   OmniDatabase &m_db;
   std::unique_ptr<AbstractFileIndexer> m_indexer;
 };
@@ -0,0 +1,326 @@
+#include "services/root-item-manager/frecency-tracker.hpp"
+#include <QtConcurrent/QtConcurrent>
+#include <algorithm>
+#include <cctype>
+#include <charconv>
+#include <chrono>
+#include <cmath>
+#include <format>
+#include <fstream>
+#include <glaze/json/read.hpp>
+#include <glaze/util/key_transformers.hpp>
+#include <optional>
+#include <qlogging.h>
+#include <ranges>
+
+namespace fs = std::filesystem;
+
+/*
+ * The journal is made of tab separated lines, the last field being free text:
+ *
+ *   v <time> <id> <query>          a visit, at <time> (unix seconds), with an optional query
+ *   f <id>                         the ranking of <id> was reset
+ *   s <time> <score> <count> <id>  state of an item: its score decayed to <time> and its visit count
+ *   a <time> <score> <id> <query>  state of a query association, decayed to <time>
+ *
+ * Compaction rewrites the journal as state lines only.
+ */
+
+static constexpr const double HALF_LIFE_SECONDS = FrecencyTracker::HALF_LIFE_DAYS * 24 * 3600;
+
+namespace {
+struct LegacyVisit {
+  std::optional<std::uint64_t> lastVisitedAt;
+  int visitCount = 0;
+};
+
+struct LegacyData {
+  std::unordered_map<std::string, LegacyVisit> visited;
+};
+
+// splits off the next tab separated field, `rest` being empty once all of them were consumed
+std::string_view nextField(std::string_view &rest) {
+  size_t pos = rest.find('\t');
+  std::string_view field = rest.substr(0, pos);
+
+  rest = pos == std::string_view::npos ? std::string_view{} : rest.substr(pos + 1);
+
+  return field;
+}
+
+template <typename T> std::optional<T> parseNumber(std::string_view str) {
+  T value{};
+  auto [ptr, ec] = std::from_chars(str.data(), str.data() + str.size(), value);
+
+  if (ec != std::errc{} || ptr != str.data() + str.size()) return std::nullopt;
+
+  return value;
+}
+} // namespace
+
+template <> struct glz::meta<LegacyVisit> : glz::snake_case {};
+
+FrecencyTracker::FrecencyTracker(const fs::path &path, const fs::path &legacyPath)
+    : m_path(path), m_epoch(now()) {
+  m_ioPool.setMaxThreadCount(1);
+
+  std::error_code ec;
+
+  if (fs::exists(m_path, ec)) {
+    load();
+    if (needsCompaction()) { compact(); }
+  } else if (!legacyPath.empty() && fs::exists(legacyPath, ec)) {
+    // a failed import is tried again next time, rather than writing an empty journal over it
+    if (importLegacy(legacyPath)) { compact(); }
+  }
+}
+
+FrecencyTracker::~FrecencyTracker() { m_ioPool.waitForDone(); }
+
+int64_t FrecencyTracker::now() {
+  auto now = std::chrono::system_clock::now().time_since_epoch();
+  return std::chrono::duration_cast<std::chrono::seconds>(now).count();
+}
+
+std::string FrecencyTracker::normalizeQuery(std::string_view query) {
+  std::string normalized;
+
+  while (!query.empty() && std::isspace(static_cast<unsigned char>(query.front()))) {
+    query.remove_prefix(1);
+  }
+  while (!query.empty() && std::isspace(static_cast<unsigned char>(query.back()))) {
+    query.remove_suffix(1);
+  }
+
+  if (query.size() > MAX_QUERY_LENGTH) return {};
+
+  normalized.reserve(query.size());
+
+  for (char c : query) {
+    // the journal is line and tab separated
+    if (c == '\n' || c == '\t') c = ' ';
+    normalized.push_back(std::tolower(static_cast<unsigned char>(c)));
+  }
+
+  return normalized;
+}
+
+double FrecencyTracker::weightAt(int64_t time) const {
+  return std::exp2(static_cast<double>(time - m_epoch) / HALF_LIFE_SECONDS);
+}
+
+double FrecencyTracker::decayFactor() const { return 1 / weightAt(now()); }
+
+void FrecencyTracker::registerVisit(const EntrypointId &id, std::string_view query) {
+  int64_t time = now();
+  double weight = weightAt(time);
+  std::string key = id;
+  std::string normalized = normalizeQuery(query);
+  Entry &entry = m_items[key];
+
+  entry.score += weight;
+  ++entry.visitCount;
+
+  if (!normalized.empty()) { m_queries[normalized][key] += weight; }
+
+  append(std::format("v\t{}\t{}\t{}\n", time, key, normalized));
+
+  if (needsCompaction()) { compact(); }
+}
+
+void FrecencyTracker::forget(const EntrypointId &id) {
+  std::string key = id;
+
+  m_items.erase(key);
+
+  for (auto it = m_queries.begin(); it != m_queries.end();) {
+    it->second.erase(key);
+    it = it->second.empty() ? m_queries.erase(it) : std::next(it);
+  }
+
+  append(std::format("f\t{}\n", key));
+}
+
+double FrecencyTracker::score(const EntrypointId &id) const {
+  if (auto it = m_items.find(id); it != m_items.end()) { return it->second.score; }
+  return 0;
+}
+
+int FrecencyTracker::visitCount(const EntrypointId &id) const {
+  if (auto it = m_items.find(id); it != m_items.end()) { return it->second.visitCount; }
+  return 0;
+}
+
+std::vector<FrecencyTracker::Association> FrecencyTracker::associations(std::string_view query) const {
+  std::string normalized = normalizeQuery(query);
+  std::unordered_map<std::string_view, double> scores;
+
+  if (normalized.empty()) return {};
+
+  double decay = decayFactor();
+
+  for (auto it = m_queries.lower_bound(normalized); it != m_queries.end(); ++it) {
+    const auto &[learned, items] = *it;
+
+    if (!learned.starts_with(normalized)) break;
+
+    double ratio = static_cast<double>(normalized.size()) / learned.size();
+
+    for (const auto &[id, score] : items) {
+      scores[id] += score * decay * ratio;
+    }
+  }
+
+  return scores | std::views::transform([](const auto &pair) {
+           return Association{.id = std::string{pair.first}, .score = pair.second};
+         }) |
+         std::ranges::to<std::vector>();
+}
+
+void FrecencyTracker::replay(std::string_view line) {
+  std::string_view rest = line;
+  std::string_view type = nextField(rest);
+
+  if (type == "v") {
+    auto time = parseNumber<int64_t>(nextField(rest));
+    std::string id{nextField(rest)};
+
+    if (!time || id.empty()) return;
+
+    double weight = weightAt(*time);
+    Entry &entry = m_items[id];
+
+    entry.score += weight;
+    ++entry.visitCount;
+
+    if (!rest.empty()) { m_queries[std::string{rest}][id] += weight; }
+  } else if (type == "f") {
+    std::string id{nextField(rest)};
+
+    m_items.erase(id);
+
+    for (auto it = m_queries.begin(); it != m_queries.end();) {
+      it->second.erase(id);
+      it = it->second.empty() ? m_queries.erase(it) : std::next(it);
+    }
+  } else if (type == "s") {
+    auto time = parseNumber<int64_t>(nextField(rest));
+    auto score = parseNumber<double>(nextField(rest));
+    auto count = parseNumber<int>(nextField(rest));
+
+    if (!time || !score || !count || rest.empty()) return;
+
+    Entry &entry = m_items[std::string{rest}];
+
+    entry.score += *score * weightAt(*time);
+    entry.visitCount += *count;
+  } else if (type == "a") {
+    auto time = parseNumber<int64_t>(nextField(rest));
+    auto score = parseNumber<double>(nextField(rest));
+    std::string id{nextField(rest)};
+
+    if (!time || !score || id.empty() || rest.empty()) return;
+
+    m_queries[std::string{rest}][id] += *score * weightAt(*time);
+  }
+}
+
+void FrecencyTracker::load() {
+  std::ifstream ifs(m_path);
+  std::string line;
+
+  if (!ifs) {
+    qWarning() << "Failed to open frecency journal" << m_path.c_str();
+    return;
+  }
+
+  while (std::getline(ifs, line)) {
+    replay(line);
+    ++m_journalLines;
+  }
+}
+
+bool FrecencyTracker::importLegacy(const fs::path &path) {
+  LegacyData data;
+  std::string buf;
+
+  if (auto error = glz::read_file_jsonc(data, path.c_str(), buf)) {
+    qWarning() << "Failed to import visits from" << path.c_str() << glz::format_error(error);
+    return false;
+  }
+
+  // only the last visit time was kept, count them all as happening then
+  for (const auto &[id, visit] : data.visited) {
+    Entry &entry = m_items[id];
+
+    entry.score = visit.visitCount * weightAt(visit.lastVisitedAt.value_or(m_epoch));
+    entry.visitCount = visit.visitCount;
+  }
+
+  return true;
+}
+
+void FrecencyTracker::append(std::string line) {
+  ++m_journalLines;
+
+  QtConcurrent::run(&m_ioPool, [path = m_path, line = std::move(line)]() {
+    std::ofstream ofs(path, std::ios::app);
+
+    if (!ofs.write(line.data(), line.size())) {
+      qWarning() << "Failed to append visit to" << path.c_str();
+    }
+  });
+}
+
+bool FrecencyTracker::needsCompaction() const {
+  return m_journalLines > std::max(COMPACTION_THRESHOLD, 2 * m_compactedLines);
+}
+
+void FrecencyTracker::compact() {
+  int64_t time = now();
+  double decay = decayFactor();
+  std::string journal;
+
+  std::erase_if(m_items, [&](const auto &pair) { return pair.second.score * decay < MIN_SCORE; });
+
+  for (auto it = m_queries.begin(); it != m_queries.end();) {
+    std::erase_if(it->second, [&](const auto &pair) { return pair.second * decay < MIN_SCORE; });
+    it = it->second.empty() ? m_queries.erase(it) : std::next(it);
+  }
+
+  m_journalLines = 0;
+
+  for (const auto &[id, entry] : m_items) {
+    journal += std::format("s\t{}\t{}\t{}\t{}\n", time, entry.score * decay, entry.visitCount, id);
+    ++m_journalLines;
+  }
+
+  for (const auto &[query, items] : m_queries) {
+    for (const auto &[id, score] : items) {
+      journal += std::format("a\t{}\t{}\t{}\t{}\n", time, score * decay, id, query);
+      ++m_journalLines;
+    }
+  }
+
+  m_compactedLines = m_journalLines;
+
+  QtConcurrent::run(&m_ioPool, [path = m_path, journal = std::move(journal)]() {
+    fs::path tmpPath = path;
+    std::error_code ec;
+
+    tmpPath += ".tmp";
+
+    {
+      std::ofstream ofs(tmpPath, std::ios::trunc);
+
+      if (!ofs.write(journal.data(), journal.size()) || !ofs.flush()) {
+        qWarning() << "Failed to compact frecency journal to" << tmpPath.c_str();
+        return;
+      }
+    }
+
+    fs::rename(tmpPath, path, ec);
+
+    if (ec) { qWarning() << "Failed to replace frecency journal" << path.c_str() << ec.message(); }
+  });
+}
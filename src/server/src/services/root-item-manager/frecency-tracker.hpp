@@ -0,0 +1,97 @@
+#pragma once
+#include "common/entrypoint.hpp"
+#include <QThreadPool>
+#include <cstdint>
+#include <filesystem>
+#include <map>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <vector>
+
+/**
+ * Tracks how often and how recently root items are launched, and which queries they are launched from.
+ *
+ * Every visit weighs 1 when it happens and loses half of its weight every HALF_LIFE_DAYS; the frecency
+ * of an item is the sum of the decayed weights of its visits. Sums are kept relative to the time the
+ * tracker was loaded (its epoch) so that a visit is a single addition, and all of them decay together:
+ * what a score is worth now is `score * decayFactor()`, with the factor computed once per search.
+ *
+ * Visits are appended to a journal, one line each, from a background thread. Once the journal grows
+ * large it is compacted into one line per item and query association (dropping whatever decayed to
+ * nothing), and atomically replaced.
+ */
+class FrecencyTracker {
+public:
+  struct Association {
+    std::string id;
+    double score = 0;
+  };
+
+  static constexpr const double HALF_LIFE_DAYS = 30;
+
+  /**
+   * @param legacyPath visits file of the former tracker, imported when there is no journal yet
+   */
+  FrecencyTracker(const std::filesystem::path &path, const std::filesystem::path &legacyPath = {});
+  ~FrecencyTracker();
+
+  /**
+   * Record a launch of `id`. `query` is the search text it was picked from, if any.
+   */
+  void registerVisit(const EntrypointId &id, std::string_view query = {});
+  void forget(const EntrypointId &id);
+
+  /**
+   * Decayed visit weight of `id`, relative to the tracker epoch.
+   */
+  double score(const EntrypointId &id) const;
+  int visitCount(const EntrypointId &id) const;
+
+  /**
+   * What a score relative to the tracker epoch is worth now.
+   */
+  double decayFactor() const;
+
+  /**
+   * Items that were launched after typing a query starting with `query`, with the current weight of
+   * the association. Typing part of a query counts proportionally less than typing all of it.
+   */
+  std::vector<Association> associations(std::string_view query) const;
+
+private:
+  struct Entry {
+    double score = 0;
+    int visitCount = 0;
+  };
+
+  // queries longer than this are not learned, they are unlikely to be typed again
+  static constexpr const size_t MAX_QUERY_LENGTH = 64;
+  // the journal is compacted once it has this many lines, and twice as many as after the last compaction
+  static constexpr const size_t COMPACTION_THRESHOLD = 2048;
+  // current weight under which items and associations are dropped by compaction
+  static constexpr const double MIN_SCORE = 0.01;
+
+  static int64_t now();
+  static std::string normalizeQuery(std::string_view query);
+
+  // weight, relative to the epoch, of a visit that happened at `time`
+  double weightAt(int64_t time) const;
+
+  void load();
+  bool importLegacy(const std::filesystem::path &path);
+  void replay(std::string_view line);
+  void append(std::string line);
+  bool needsCompaction() const;
+  void compact();
+
+  std::filesystem::path m_path;
+  int64_t m_epoch = 0;
+  std::unordered_map<std::string, Entry> m_items;
+  // normalized query -> item id -> score, ordered for prefix lookups
+  std::map<std::string, std::unordered_map<std::string, double>, std::less<>> m_queries;
+  size_t m_journalLines = 0;
+  size_t m_compactedLines = 0;
+  // single thread, so that appends and compactions hit the disk in order
+  QThreadPool m_ioPool;
+};
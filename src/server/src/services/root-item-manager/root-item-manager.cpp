@@ -5,13 +5,14 @@
 #include "root-item-manager.hpp"
 #include "common.hpp"
 #include "root-search/extensions/extension-root-provider.hpp"
-#include "lib/fzf.hpp"
+#include "lib/fzf-unicode.hpp"
 #include "config/config.hpp"
 #include "services/local-storage/local-storage-service.hpp"
 #include "vicinae.hpp"
 
 RootItemManager::RootItemManager(config::Manager &cfg, LocalStorageService &storage)
-    : m_cfg(cfg), m_storage(storage), m_visitTracker(Omnicast::dataDir() / "metadata.json") {
+    : m_cfg(cfg), m_storage(storage),
+      m_frecency(Omnicast::dataDir() / "frecency.journal", Omnicast::dataDir() / "metadata.json") {
   connect(&cfg, &config::Manager::configChanged, this, [this](const config::ConfigValue &next) {
     mergeConfigWithMetadata(next);
     qDebug() << "configuration changed";
@@ -73,10 +74,7 @@ bool RootItemManager::disableFallback(const EntrypointId &id) {
 }
 
 RootItem *RootItemManager::findItemById(const EntrypointId &id) const {
-  for (const auto &item : m_items) {
-    if (item.item->uniqueId() == id) { return item.item.get(); }
-  }
-
+  if (auto it = m_itemIndexes.find(id); it != m_itemIndexes.end()) { return m_items[it->second].get(); }
   return nullptr;
 }
 
@@ -97,66 +95,156 @@ void RootItemManager::updateIndex() {
   }
 
   isReloading = true;
-  m_items.clear();
-  m_metadata.clear();
 
-  auto &cfg = m_cfg.value();
+  // items of providers that were unloaded since
+  auto unloaded = m_providerSlots | std::views::keys |
+                  std::views::filter([this](const std::string &id) { return !provider(id); }) |
+                  std::ranges::to<std::vector>();
+
+  for (const auto &providerId : unloaded) {
+    removeProviderItems(providerId);
+  }
 
   for (const auto &provider : m_providers) {
-    auto items = provider->loadItems();
-    const config::ProviderData *providerConfig = nullptr;
+    updateProviderItems(*provider);
+  }
 
-    if (auto it = cfg.providers.find(provider->uniqueId().toStdString()); it != cfg.providers.end()) {
-      providerConfig = &it->second;
-    }
+  // metadata created for ids that no item has, e.g. by registerVisit
+  std::erase_if(m_metadata, [this](const auto &pair) { return !m_itemIndexes.contains(pair.first); });
+  mergeConfigWithMetadata(m_cfg.value());
+  isReloading = false;
+  emit itemsChanged();
+}
 
-    for (const auto &item : items) {
-      const config::ProviderItemData *itemConfig = nullptr;
+void RootItemManager::updateProviderIndex(const RootProvider &provider) {
+  updateProviderItems(provider);
+  emit itemsChanged();
+}
 
-      if (providerConfig) {
-        if (auto it = providerConfig->entrypoints.find(item->uniqueId().entrypoint);
-            it != providerConfig->entrypoints.end()) {
-          itemConfig = &it->second;
-        }
-      }
+void RootItemManager::updateProviderItems(const RootProvider &provider) {
+  auto &cfg = m_cfg.value();
+  auto favorites = cfg.favorites | std::ranges::to<std::unordered_set>();
+  auto fallbacks = cfg.fallbacks | std::ranges::to<std::unordered_set>();
+  auto &slots = m_providerSlots[provider.uniqueId().toStdString()];
+  std::unordered_map<EntrypointId, uint32_t> previous;
+  std::vector<uint32_t> next;
+
+  for (uint32_t slot : slots) {
+    previous.try_emplace(m_items[slot]->uniqueId(), slot);
+  }
 
-      SearchableRootItem sitem;
-      auto id = item->uniqueId();
+  for (const auto &item : provider.loadItems()) {
+    auto id = item->uniqueId();
 
-      sitem.item = item;
-      sitem.title = item->displayName().toStdString();
-      sitem.subtitle = item->subtitle().toStdString();
-      sitem.keywords = item->keywords() | std::views::transform([](auto &&s) { return s.toStdString(); }) |
-                       std::ranges::to<std::vector>();
+    if (auto it = previous.find(id); it != previous.end()) {
+      uint32_t slot = it->second;
 
-      sitem.meta = &m_metadata[id];
-      sitem.meta->item = item;
+      previous.erase(it);
+      next.emplace_back(slot);
 
-      auto visitInfo = m_visitTracker.getVisit(id);
+      if (m_items[slot] == item) continue;
 
-      sitem.meta->visitCount = visitInfo.visitCount;
-      m_items.emplace_back(sitem);
+      indexItem(*item, slot);
+      m_items[slot] = item;
+      m_itemMetadata[slot]->item = item;
+      mergeItemConfig(cfg, favorites, fallbacks, item);
+      continue;
     }
+
+    // duplicate id, the first item wins
+    if (m_itemIndexes.contains(id)) continue;
+
+    uint32_t slot = indexItem(*item);
+    auto &meta = m_metadata[id];
+
+    meta.item = item;
+    meta.visitCount = m_frecency.visitCount(id);
+    meta.frecency = m_frecency.score(id);
+    m_items[slot] = item;
+    m_itemMetadata[slot] = &meta;
+    m_itemIndexes.try_emplace(id, slot);
+    next.emplace_back(slot);
+    mergeItemConfig(cfg, favorites, fallbacks, item);
   }
 
-  mergeConfigWithMetadata(m_cfg.value());
-  isReloading = false;
-  emit itemsChanged();
+  for (const auto &[id, slot] : previous) {
+    releaseSlot(slot);
+  }
+
+  slots = std::move(next);
 }
 
-float RootItemManager::SearchableRootItem::fuzzyScore(std::string_view pattern) const {
-  using WS = fzf::WeightedString;
-  std::string alias = meta->alias.value_or("");
-  std::initializer_list<WS> ss = {{title, 1.0f}, {subtitle, 0.6f}, {alias, 1.0f}};
-  auto kws = keywords | std::views::transform([](auto &&kw) { return WS{kw, 0.3f}; });
-  auto strs = std::views::concat(ss, kws);
-  float score = pattern.empty() ? 1 : fzf::defaultMatcher.fuzzy_match_v2_score_query(strs, pattern, false);
-  double frequencyScore = std::log(1 + meta->visitCount * 0.1);
-  float frequencyWeight = 0.2;
+void RootItemManager::removeProviderItems(const std::string &providerId) {
+  auto it = m_providerSlots.find(providerId);
+
+  if (it == m_providerSlots.end()) return;
 
-  // TODO: add recency support
+  for (uint32_t slot : it->second) {
+    releaseSlot(slot);
+  }
 
-  return score * (1 + frequencyScore * frequencyWeight);
+  m_providerSlots.erase(it);
+}
+
+uint32_t RootItemManager::indexItem(const RootItem &item, std::optional<uint32_t> slot) {
+  QString title = item.displayName();
+  QString subtitle = item.subtitle();
+  std::vector<QString> keywords = item.keywords();
+  size_t hash = qHashRange(keywords.begin(), keywords.end(), qHashMulti(0, title, subtitle));
+
+  if (slot && m_itemTextHashes[*slot] == hash) return *slot;
+
+  std::string titleText = title.toStdString();
+  std::string subtitleText = subtitle.toStdString();
+  auto keywordTexts = keywords | std::views::transform([](auto &&s) { return s.toStdString(); }) |
+                      std::ranges::to<std::vector>();
+  std::vector<RootSearchIndex::Field> fields = {{titleText, 1.0f}, {subtitleText, 0.6f}};
+
+  for (const auto &keyword : keywordTexts) {
+    fields.push_back({keyword, 0.3f});
+  }
+
+  if (!slot && !m_freeSlots.empty()) {
+    slot = m_freeSlots.back();
+    m_freeSlots.pop_back();
+  }
+
+  if (slot) {
+    m_searchIndex.replace(*slot, fields);
+  } else {
+    slot = m_searchIndex.add(fields);
+    m_items.emplace_back();
+    m_itemMetadata.emplace_back();
+    m_itemTextHashes.emplace_back();
+  }
+
+  m_itemTextHashes[*slot] = hash;
+
+  return *slot;
+}
+
+void RootItemManager::releaseSlot(uint32_t slot) {
+  auto id = m_items[slot]->uniqueId();
+
+  m_itemIndexes.erase(id);
+  m_metadata.erase(id);
+  m_searchIndex.remove(slot);
+  m_items[slot] = nullptr;
+  m_itemMetadata[slot] = nullptr;
+  m_freeSlots.emplace_back(slot);
+}
+
+float RootItemManager::fuzzyScore(uint32_t index, std::u32string_view pattern, double decay,
+                                  double association) const {
+  const RootItemMetadata *meta = m_itemMetadata[index];
+  fzf::WeightedFoldedText alias = {.text = meta->foldedAlias.view(), .weight = 1.0f};
+  float score = pattern.empty() ? 1 : m_searchIndex.score(index, pattern, {&alias, 1});
+  double frecencyScore = std::log(1 + meta->frecency * decay * 0.1);
+  double associationScore = std::log(1 + association);
+  float frecencyWeight = 0.2;
+  float associationWeight = 0.5;
+
+  return score * (1 + frecencyScore * frecencyWeight + associationScore * associationWeight);
 }
 
 std::vector<RootItemManager::ScoredItem> RootItemManager::search(const QString &query,
@@ -168,34 +256,69 @@ std::vector<RootItemManager::ScoredItem> RootItemManager::search(const QString &
 
 void RootItemManager::search(const QString &query, std::vector<ScoredItem> &results,
                              const RootItemPrefixSearchOptions &opts) {
+  struct Candidate {
+    uint32_t index;
+    bool aliasMatch;
+    double score;
+  };
+
   std::string pattern = query.toStdString();
-  std::string_view patternView = pattern;
+  std::u32string foldedPattern = fzf::foldQuery(pattern);
+  fzf::CharMask patternMask = fzf::queryCharMask(foldedPattern);
+  std::vector<Candidate> candidates;
+  // indexed like m_items, only allocated if the query was learned
+  std::vector<double> associations;
+  double decay = m_frecency.decayFactor();
 
-  results.clear();
-  results.reserve(m_items.size());
+  for (const auto &association : m_frecency.associations(pattern)) {
+    auto it = m_itemIndexes.find(EntrypointId::fromSerialized(association.id));
+
+    if (it == m_itemIndexes.end()) continue;
+    if (associations.empty()) { associations.resize(m_items.size()); }
+
+    associations[it->second] = association.score;
+  }
+
+  candidates.reserve(m_items.size());
 
-  for (auto &item : m_items) {
-    if (!item.meta->enabled && !opts.includeDisabled) continue;
-    if (opts.providerId && opts.providerId != item.meta->providerId) continue;
-    if (item.meta->favorite && !opts.includeFavorites) continue;
-    double fuzzyScore = item.fuzzyScore(patternView);
+  for (uint32_t i = 0; i < m_items.size(); ++i) {
+    const RootItemMetadata *meta = m_itemMetadata[i];
 
-    if (!fuzzyScore) { continue; }
+    if (!meta) continue;
+    if (!meta->enabled && !opts.includeDisabled) continue;
+    if (opts.providerId && opts.providerId != meta->providerId) continue;
+    if (meta->favorite && !opts.includeFavorites) continue;
 
-    results.emplace_back(ScoredItem{.meta = item.meta, .score = fuzzyScore, .item = item.item});
+    // aliases can change at any time, they are not part of the index
+    if (!fzf::mayMatch(m_searchIndex.mask(i) | meta->foldedAlias.mask, patternMask)) continue;
+    double score = fuzzyScore(i, foldedPattern, decay, associations.empty() ? 0 : associations[i]);
+
+    if (!score) { continue; }
+
+    bool aliasMatch = opts.prioritizeAliased && meta->alias && !meta->alias->empty() &&
+                      meta->alias->starts_with(pattern);
+
+    candidates.emplace_back(Candidate{.index = i, .aliasMatch = aliasMatch, .score = score});
   }
 
-  // we need stable sort to avoid flickering when updating quickly
-  std::ranges::stable_sort(results, [&](const auto &a, const auto &b) {
-    if (opts.prioritizeAliased) {
-      bool aa = !a.meta->alias.value_or("").empty() && a.meta->alias->starts_with(pattern);
-      bool ab = !b.meta->alias.value_or("").empty() && b.meta->alias->starts_with(pattern);
-      // always prioritize matching aliases over score
-      if (aa - ab) { return aa > ab; }
-    }
+  // always prioritize matching aliases over score, and keep the index order for ties so that results
+  // don't flicker when updating quickly
+  auto isBetter = [](const Candidate &a, const Candidate &b) {
+    if (a.aliasMatch != b.aliasMatch) return a.aliasMatch;
+    if (a.score != b.score) return a.score > b.score;
+    return a.index < b.index;
+  };
+  size_t count = std::min(candidates.size(), opts.limit.value_or(candidates.size()));
 
-    return a.score > b.score;
-  });
+  std::ranges::partial_sort(candidates, candidates.begin() + count, isBetter);
+  results.clear();
+  results.reserve(count);
+
+  for (const auto &candidate : candidates | std::views::take(count)) {
+    results.emplace_back(ScoredItem{.meta = m_itemMetadata[candidate.index],
+                                    .score = candidate.score,
+                                    .item = m_items[candidate.index]});
+  }
 }
 
 bool RootItemManager::setItemEnabled(const EntrypointId &id, bool value) {
@@ -353,6 +476,7 @@ bool RootItemManager::setAlias(const EntrypointId &id, std::string_view alias) {
   auto &meta = m_metadata[id];
 
   m_metadata[id].alias = alias;
+  m_metadata[id].foldedAlias = fzf::foldText(alias);
   m_cfg.mergeEntrypointWithUser(id, {.alias = std::string{alias}});
 
   return true;
@@ -454,56 +578,49 @@ bool RootItemManager::setItemAsFavorite(const EntrypointId &itemId, bool value)
   return true;
 }
 
-double RootItemManager::computeRecencyScore(const RootItemMetadata &meta) const {
-  if (!meta.lastVisitedAt) return 0.1;
-
-  auto now = std::chrono::high_resolution_clock::now();
-  auto duration = std::chrono::duration_cast<std::chrono::days>(now - *meta.lastVisitedAt).count();
-  auto hoursSince = std::chrono::duration_cast<std::chrono::hours>(now - *meta.lastVisitedAt).count() / 24.0;
-
-  if (hoursSince < 1) return 2.0;
-  if (hoursSince < 6) return 1.5;
-
-  return std::exp(-hoursSince / 30.0);
-}
-
 double RootItemManager::computeScore(const RootItemMetadata &meta, int weight) const {
-  double frequencyScore = std::log(meta.visitCount + 1);
-  double recencyScore = computeRecencyScore(meta);
-
-  return (frequencyScore + recencyScore) * weight;
+  return meta.frecency * m_frecency.decayFactor() * weight;
 }
 
 std::vector<std::shared_ptr<RootItem>> RootItemManager::queryFavorites(std::optional<int> limit) {
   return getFromSerializedEntrypointIds(m_cfg.value().favorites);
 }
 
-std::vector<RootItemManager::SearchableRootItem> RootItemManager::querySuggestions(int limit) {
-  auto isSuggestable = [](auto &&item) {
-    return item.meta->enabled && item.meta->visitCount > 0 && !item.meta->favorite;
+RootItemManager::ItemList RootItemManager::querySuggestions(int limit) {
+  auto isSuggestable = [](const RootItemMetadata *meta) {
+    return meta && meta->enabled && meta->visitCount > 0 && !meta->favorite;
   };
-  auto suggestions = m_items | std::views::filter(isSuggestable) | std::ranges::to<std::vector>();
+  auto suggestions = m_itemMetadata | std::views::filter(isSuggestable) | std::ranges::to<std::vector>();
 
   std::ranges::sort(suggestions, [this](const auto &a, const auto &b) {
-    auto ascore = computeScore(*a.meta, a.item->baseScoreWeight());
-    auto bscore = computeScore(*b.meta, b.item->baseScoreWeight());
+    auto ascore = computeScore(*a, a->item->baseScoreWeight());
+    auto bscore = computeScore(*b, b->item->baseScoreWeight());
     return ascore > bscore;
   });
 
   if (suggestions.size() > limit) { suggestions.resize(limit); }
 
-  return suggestions;
+  return suggestions | std::views::transform([](const RootItemMetadata *meta) { return meta->item; }) |
+         std::ranges::to<std::vector>();
 }
 
 bool RootItemManager::resetRanking(const EntrypointId &id) {
-  m_metadata[id].visitCount = 0;
-  m_visitTracker.forget(id);
+  auto &meta = m_metadata[id];
+
+  m_frecency.forget(id);
+  meta.visitCount = 0;
+  meta.frecency = 0;
+
   return true;
 }
 
-bool RootItemManager::registerVisit(const EntrypointId &id) {
-  ++m_metadata[id].visitCount;
-  m_visitTracker.registerVisit(id);
+bool RootItemManager::registerVisit(const EntrypointId &id, std::string_view query) {
+  auto &meta = m_metadata[id];
+
+  m_frecency.registerVisit(id, query);
+  meta.visitCount = m_frecency.visitCount(id);
+  meta.frecency = m_frecency.score(id);
+
   return true;
 }
 
@@ -545,6 +662,7 @@ void RootItemManager::unloadProvider(const QString &id) {
 
   if (it == m_providers.end()) return;
 
+  removeProviderItems(id.toStdString());
   m_providers.erase(it);
 }
 
@@ -564,7 +682,7 @@ void RootItemManager::loadProvider(std::unique_ptr<RootProvider> provider) {
 
   ptr->preferencesChanged(preferenceValues);
   ptr->initialized(preferenceValues);
-  connect(ptr, &RootProvider::itemsChanged, this, [this]() { updateIndex(); });
+  connect(ptr, &RootProvider::itemsChanged, this, [this, ptr]() { updateProviderIndex(*ptr); });
 }
 
 RootProvider *RootItemManager::provider(std::string_view id) const {
@@ -610,7 +728,7 @@ RootItemManager::getFromSerializedEntrypointIds(std::span<const std::string> ids
   for (const auto &id : ids) {
     auto entrypointId = EntrypointId::fromSerialized(id);
 
-    if (auto it = m_metadata.find(entrypointId); it != m_metadata.end()) {
+    if (auto it = m_metadata.find(entrypointId); it != m_metadata.end() && it->second.item) {
       entrypoints.push_back(it->second.item);
     }
   }
@@ -622,44 +740,53 @@ void RootItemManager::mergeConfigWithMetadata(const config::ConfigValue &cfg) {
   auto favoriteSet = cfg.favorites | std::ranges::to<std::unordered_set>();
   auto fallbackSet = cfg.fallbacks | std::ranges::to<std::unordered_set>();
 
-  for (const SearchableRootItem &item : m_items) {
-    auto entrypointId = item.item->uniqueId();
-    const config::ProviderData *providerConfig = nullptr;
-    const config::ProviderItemData *itemConfig = nullptr;
-
-    if (auto it = cfg.providers.find(entrypointId.provider); it != cfg.providers.end()) {
-      providerConfig = &it->second;
-    }
+  for (const ItemPtr &item : m_items) {
+    if (item) mergeItemConfig(cfg, favoriteSet, fallbackSet, item);
+  }
 
-    if (providerConfig) {
-      if (auto it = providerConfig->entrypoints.find(entrypointId.entrypoint);
-          it != providerConfig->entrypoints.end()) {
-        itemConfig = &it->second;
-      }
-    }
+  // update provider preferences to make sure they are in sync
+  for (const auto &provider : m_providers) {
+    provider->preferencesChanged(getProviderPreferenceValues(provider->uniqueId()));
+  }
+}
 
-    auto &meta = m_metadata[entrypointId];
+void RootItemManager::mergeItemConfig(const config::ConfigValue &cfg,
+                                      const std::unordered_set<std::string> &favorites,
+                                      const std::unordered_set<std::string> &fallbacks, const ItemPtr &item) {
+  auto entrypointId = item->uniqueId();
+  const config::ProviderData *providerConfig = nullptr;
+  const config::ProviderItemData *itemConfig = nullptr;
 
-    meta.providerId = entrypointId.provider;
-    meta.enabled = !item.item->isDefaultDisabled();
-    meta.favorite = favoriteSet.contains(entrypointId);
-    meta.fallback = fallbackSet.contains(entrypointId);
+  if (auto it = cfg.providers.find(entrypointId.provider); it != cfg.providers.end()) {
+    providerConfig = &it->second;
+  }
 
-    if (itemConfig) {
-      item.item->preferenceValuesChanged(getItemPreferenceValues(entrypointId));
-      if (auto enabled = itemConfig->enabled) { meta.enabled = enabled.value(); }
-      if (auto alias = itemConfig->alias) { meta.alias = alias.value(); }
+  if (providerConfig) {
+    if (auto it = providerConfig->entrypoints.find(entrypointId.entrypoint);
+        it != providerConfig->entrypoints.end()) {
+      itemConfig = &it->second;
     }
+  }
 
-    if (providerConfig) {
-      if (auto enabled = providerConfig->enabled; enabled.has_value() && !enabled.value()) {
-        meta.enabled = false;
-      }
+  auto &meta = m_metadata[entrypointId];
+
+  meta.providerId = entrypointId.provider;
+  meta.enabled = !item->isDefaultDisabled();
+  meta.favorite = favorites.contains(entrypointId);
+  meta.fallback = fallbacks.contains(entrypointId);
+
+  if (itemConfig) {
+    item->preferenceValuesChanged(getItemPreferenceValues(entrypointId));
+    if (auto enabled = itemConfig->enabled) { meta.enabled = enabled.value(); }
+    if (auto alias = itemConfig->alias) {
+      meta.alias = alias.value();
+      meta.foldedAlias = fzf::foldText(*meta.alias);
     }
   }
 
-  // update provider preferences to make sure they are in sync
-  for (const auto &provider : m_providers) {
-    provider->preferencesChanged(getProviderPreferenceValues(provider->uniqueId()));
+  if (providerConfig) {
+    if (auto enabled = providerConfig->enabled; enabled.has_value() && !enabled.value()) {
+      meta.enabled = false;
+    }
   }
 }
@@ -3,14 +3,17 @@
 #include "common.hpp"
 #include "config/config.hpp"
 #include "common/entrypoint.hpp"
+#include "lib/fzf.hpp"
 #include "navigation-controller.hpp"
 #include "services/local-storage/local-storage-service.hpp"
 #include "services/local-storage/scoped-local-storage.hpp"
-#include "services/root-item-manager/visit-tracker.hpp"
+#include "services/root-item-manager/frecency-tracker.hpp"
+#include "services/root-item-manager/root-search-index.hpp"
 #include "ui/image/url.hpp"
 #include "preference.hpp"
 #include "settings/provider-settings-detail.hpp"
 #include <cstdint>
+#include <unordered_set>
 #include <qdnslookup.h>
 #include <qjsonobject.h>
 #include <qjsonvalue.h>
@@ -32,6 +35,8 @@ struct RootItemPrefixSearchOptions {
   bool includeFavorites = true;
   bool prioritizeAliased = true;
   std::optional<std::string> providerId;
+  // only keep the best results, which saves sorting all the others
+  std::optional<size_t> limit;
 };
 
 class RootItem {
@@ -211,8 +216,11 @@ struct RootItemMetadata {
   bool enabled = true;
   bool favorite = false;
   bool fallback = false;
-  std::optional<std::chrono::time_point<std::chrono::high_resolution_clock>> lastVisitedAt;
+  // decayed visit weight, relative to the frecency tracker epoch (see FrecencyTracker)
+  double frecency = 0;
   std::optional<std::string> alias;
+  // search form of the alias, kept in sync with it
+  fzf::FoldedText foldedAlias;
   std::string providerId;
   std::shared_ptr<RootItem> item;
 };
@@ -241,16 +249,6 @@ public:
   using ItemPtr = std::shared_ptr<RootItem>;
   using ItemList = std::vector<ItemPtr>;
 
-  struct SearchableRootItem {
-    std::shared_ptr<RootItem> item;
-    std::string title;
-    std::string subtitle;
-    std::vector<std::string> keywords;
-    RootItemMetadata *meta = nullptr;
-
-    float fuzzyScore(std::string_view pattern = "") const;
-  };
-
   struct ScoredItem {
     RootItemMetadata *meta = nullptr;
     double score = 0;
@@ -289,11 +287,15 @@ public:
   bool moveFallbackUp(const EntrypointId &id);
   bool enableFallback(const EntrypointId &id);
   double computeScore(const RootItemMetadata &meta, int weight) const;
-  double computeRecencyScore(const RootItemMetadata &meta) const;
   std::vector<std::shared_ptr<RootItem>> queryFavorites(std::optional<int> limit = {});
-  std::vector<SearchableRootItem> querySuggestions(int limit = 5);
+  ItemList querySuggestions(int limit = 5);
   bool resetRanking(const EntrypointId &id);
-  bool registerVisit(const EntrypointId &id);
+
+  /**
+   * @param query search text the item was picked from, learned as a hint for the next searches
+   */
+  bool registerVisit(const EntrypointId &id, std::string_view query = {});
+
   bool setItemAsFavorite(const EntrypointId &item, bool value = true);
   bool setProviderEnabled(const QString &providerId, bool value);
   bool disableItem(const EntrypointId &id);
@@ -303,6 +305,10 @@ public:
   std::vector<RootProvider *> providers() const;
   std::vector<ExtensionRootProvider *> extensions() const;
 
+  /**
+   * Reload the items of every provider. Providers that report changes through `itemsChanged` are
+   * reloaded on their own, without touching the items of the others.
+   */
   void updateIndex();
 
   /**
@@ -321,7 +327,6 @@ public:
   void loadProvider(std::unique_ptr<RootProvider> provider);
 
   RootProvider *provider(std::string_view id) const;
-  std::vector<SearchableRootItem> allItems() const { return m_items; }
   std::vector<std::shared_ptr<RootItem>> fallbackItems() const;
 
   /**
@@ -346,14 +351,53 @@ private:
   ScopedLocalStorage getProviderSecretStorage(const QString &providerId) const;
 
   void mergeConfigWithMetadata(const config::ConfigValue &cfg);
+  void mergeItemConfig(const config::ConfigValue &cfg, const std::unordered_set<std::string> &favorites,
+                       const std::unordered_set<std::string> &fallbacks, const ItemPtr &item);
+
+  /**
+   * Diff the items `provider` currently has against the ones it had at the last update: new items get a
+   * slot, removed ones release theirs, and items that are still there keep their slot and metadata. Only
+   * items whose text changed are re-indexed.
+   */
+  void updateProviderItems(const RootProvider &provider);
+  void updateProviderIndex(const RootProvider &provider);
+  void removeProviderItems(const std::string &providerId);
+
+  /**
+   * Index the text of `item` at `slot`, or at a new slot if not set, and return the slot. Nothing is
+   * re-indexed if the text is the same as the one already at `slot`.
+   */
+  uint32_t indexItem(const RootItem &item, std::optional<uint32_t> slot = {});
+  void releaseSlot(uint32_t slot);
 
   std::vector<std::shared_ptr<RootItem>>
   getFromSerializedEntrypointIds(std::span<const std::string> ids) const;
 
+  /**
+   * Fuzzy score of the item at `index`, boosted by its frecency and by how often it was picked for
+   * similar queries.
+   *
+   * @param pattern query folded with fzf::foldQuery
+   * @param decay FrecencyTracker::decayFactor, computed once per search
+   * @param association current weight of the association between the query and the item
+   */
+  float fuzzyScore(uint32_t index, std::u32string_view pattern, double decay, double association = 0) const;
+
   std::unordered_map<EntrypointId, RootItemMetadata> m_metadata;
   std::vector<std::unique_ptr<RootProvider>> m_providers;
   config::Manager &m_cfg;
   LocalStorageService &m_storage;
-  std::vector<SearchableRootItem> m_items;
-  VisitTracker m_visitTracker;
+
+  // all the items by slot, the arrays below are indexed the same way. Slots of removed items are
+  // null until they are reused.
+  ItemList m_items;
+  std::vector<RootItemMetadata *> m_itemMetadata;
+  // hash of the indexed text, to know when an item needs to be re-indexed
+  std::vector<size_t> m_itemTextHashes;
+  RootSearchIndex m_searchIndex;
+  std::vector<uint32_t> m_freeSlots;
+  std::unordered_map<EntrypointId, uint32_t> m_itemIndexes;
+  // slots of the items of each provider
+  std::unordered_map<std::string, std::vector<uint32_t>> m_providerSlots;
+  FrecencyTracker m_frecency;
 };
@@ -0,0 +1,136 @@
+#include "root-search-index.hpp"
+#include "lib/fzf-unicode.hpp"
+#include <ranges>
+
+uint32_t RootSearchIndex::add(std::span<const Field> fields) {
+  uint32_t item = m_itemMasks.size();
+
+  m_fieldStarts.emplace_back(0);
+  m_fieldCounts.emplace_back(0);
+  m_itemMasks.emplace_back(0);
+  assignFields(item, fields);
+
+  return item;
+}
+
+void RootSearchIndex::replace(uint32_t item, std::span<const Field> fields) {
+  releaseFields(item);
+  assignFields(item, fields);
+  if (m_unusedFields > m_fieldOffsets.size() / 2) compact();
+}
+
+void RootSearchIndex::remove(uint32_t item) {
+  releaseFields(item);
+  m_fieldCounts[item] = 0;
+  m_itemMasks[item] = 0;
+  if (m_unusedFields > m_fieldOffsets.size() / 2) compact();
+}
+
+void RootSearchIndex::assignFields(uint32_t item, std::span<const Field> fields) {
+  fzf::CharMask itemMask = 0;
+
+  m_fieldStarts[item] = m_fieldOffsets.size();
+  m_fieldCounts[item] = fields.size();
+
+  for (const auto &field : fields) {
+    fzf::FoldedText folded = fzf::foldText(field.text);
+
+    m_fieldOffsets.emplace_back(m_text.size());
+    m_fieldLengths.emplace_back(folded.text.size());
+    m_fieldWeights.emplace_back(field.weight);
+    m_fieldMasks.emplace_back(folded.mask);
+    m_text.append(folded.text);
+    m_upper.insert(m_upper.end(), folded.upper.begin(), folded.upper.end());
+    itemMask |= folded.mask;
+  }
+
+  m_itemMasks[item] = itemMask;
+}
+
+void RootSearchIndex::releaseFields(uint32_t item) {
+  for (uint32_t field = m_fieldStarts[item]; field != m_fieldStarts[item] + m_fieldCounts[item]; ++field) {
+    m_unusedText += m_fieldLengths[field];
+  }
+
+  m_unusedFields += m_fieldCounts[item];
+}
+
+void RootSearchIndex::compact() {
+  std::u32string text;
+  std::vector<uint8_t> upper;
+  std::vector<uint32_t> offsets;
+  std::vector<uint32_t> lengths;
+  std::vector<float> weights;
+  std::vector<fzf::CharMask> masks;
+
+  text.reserve(m_text.size() - m_unusedText);
+  upper.reserve(m_text.size() - m_unusedText);
+
+  for (uint32_t item = 0; item != m_itemMasks.size(); ++item) {
+    uint32_t start = offsets.size();
+
+    for (uint32_t field = m_fieldStarts[item]; field != m_fieldStarts[item] + m_fieldCounts[item]; ++field) {
+      uint32_t offset = m_fieldOffsets[field];
+      uint32_t length = m_fieldLengths[field];
+
+      offsets.emplace_back(text.size());
+      lengths.emplace_back(length);
+      weights.emplace_back(m_fieldWeights[field]);
+      masks.emplace_back(m_fieldMasks[field]);
+      text.append(m_text, offset, length);
+      upper.insert(upper.end(), m_upper.begin() + offset, m_upper.begin() + offset + length);
+    }
+
+    m_fieldStarts[item] = start;
+  }
+
+  m_text = std::move(text);
+  m_upper = std::move(upper);
+  m_fieldOffsets = std::move(offsets);
+  m_fieldLengths = std::move(lengths);
+  m_fieldWeights = std::move(weights);
+  m_fieldMasks = std::move(masks);
+  m_unusedText = 0;
+  m_unusedFields = 0;
+}
+
+void RootSearchIndex::reserve(size_t items) {
+  m_fieldStarts.reserve(items);
+  m_fieldCounts.reserve(items);
+  m_itemMasks.reserve(items);
+}
+
+void RootSearchIndex::clear() {
+  m_text.clear();
+  m_upper.clear();
+  m_fieldOffsets.clear();
+  m_fieldLengths.clear();
+  m_fieldWeights.clear();
+  m_fieldMasks.clear();
+  m_fieldStarts.clear();
+  m_fieldCounts.clear();
+  m_itemMasks.clear();
+  m_unusedText = 0;
+  m_unusedFields = 0;
+}
+
+fzf::FoldedView RootSearchIndex::fieldView(uint32_t field) const {
+  uint32_t offset = m_fieldOffsets[field];
+
+  return {.text = std::u32string_view(m_text).substr(offset, m_fieldLengths[field]),
+          .upper = m_upper.data() + offset,
+          .mask = m_fieldMasks[field]};
+}
+
+int RootSearchIndex::score(uint32_t item, std::u32string_view query,
+                           std::span<const fzf::WeightedFoldedText> extra) const {
+  // removed items have nothing to match
+  if (m_fieldCounts[item] == 0 && extra.empty()) return 0;
+
+  auto fields = std::views::iota(m_fieldStarts[item], m_fieldStarts[item] + m_fieldCounts[item]) |
+                std::views::transform([this](uint32_t field) {
+                  return fzf::WeightedFoldedText{.text = fieldView(field), .weight = m_fieldWeights[field]};
+                });
+
+  return fzf::defaultMatcher.fuzzy_match_v2_score_query(std::views::concat(extra, fields), query);
+}
@@ -0,0 +1,83 @@
+#pragma once
+#include "lib/fzf.hpp"
+#include <cstdint>
+#include <span>
+#include <string>
+#include <string_view>
+#include <vector>
+
+/**
+ * Search data of the root items, laid out for scanning them all on every keystroke.
+ *
+ * Titles, subtitles and keywords are folded once (see fzf::foldText) and packed back to back in a single
+ * codepoint arena. Fields are columns of offsets, lengths, weights and character masks, and an item is
+ * a range of fields. Items are identified by their insertion order: the caller keeps whatever else it
+ * needs about them in parallel arrays.
+ *
+ * Items can be replaced or removed in place, which keeps the indexes of all the others stable. Their new
+ * fields are appended and the old ones left unused until they outweigh the live ones, at which point the
+ * arena is compacted.
+ */
+class RootSearchIndex {
+public:
+  struct Field {
+    std::string_view text;
+    float weight;
+  };
+
+  /**
+   * Index an item made of `fields`, and return its index.
+   */
+  uint32_t add(std::span<const Field> fields);
+
+  void replace(uint32_t item, std::span<const Field> fields);
+
+  /**
+   * Leave `item` without any field, so that it matches nothing until it is replaced.
+   */
+  void remove(uint32_t item);
+
+  void reserve(size_t items);
+  void clear();
+  size_t size() const { return m_itemMasks.size(); }
+
+  /**
+   * Characters of all the fields of `item`, used to skip items that can't match a query.
+   */
+  fzf::CharMask mask(uint32_t item) const { return m_itemMasks[item]; }
+
+  /**
+   * Fuzzy score of `item` for a folded query, as fzf::Matcher::fuzzy_match_v2_score_query computes it
+   * over its fields and `extra` ones that are not indexed (e.g. aliases, which can change at any time).
+   */
+  int score(uint32_t item, std::u32string_view query,
+            std::span<const fzf::WeightedFoldedText> extra = {}) const;
+
+private:
+  fzf::FoldedView fieldView(uint32_t field) const;
+
+  /**
+   * Append `fields` and make them the fields of `item`.
+   */
+  void assignFields(uint32_t item, std::span<const Field> fields);
+  void releaseFields(uint32_t item);
+  void compact();
+
+  std::u32string m_text;
+  std::vector<uint8_t> m_upper;
+
+  // per field
+  std::vector<uint32_t> m_fieldOffsets;
+  std::vector<uint32_t> m_fieldLengths;
+  std::vector<float> m_fieldWeights;
+  std::vector<fzf::CharMask> m_fieldMasks;
+
+  // per item, fields of item i are [m_fieldStarts[i], m_fieldStarts[i] + m_fieldCounts[i])
+  std::vector<uint32_t> m_fieldStarts;
+  std::vector<uint32_t> m_fieldCounts;
+  std::vector<fzf::CharMask> m_itemMasks;
+
+  // fields, and their codepoints, no longer used by any item
+  size_t m_unusedFields = 0;
+  size_t m_unusedText = 0;
+};
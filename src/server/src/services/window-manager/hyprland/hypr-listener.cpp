@@ -52,25 +52,56 @@ bool EventListener::start() {
 }
 
 void EventListener::processEvent(const std::string &event) {
-  auto ss = ranges_to<std::vector>(std::views::split(event, std::string_view(">>")));
+  // only split on the first separator, titles can contain anything
+  auto pos = event.find(">>");
 
-  if (ss.size() != 2) {
+  if (pos == std::string::npos) {
     qWarning() << "Hyprland event socket sent a malformed invalid event" << event.c_str();
     return;
   }
 
-  auto name = std::string_view(ss[0].begin(), ss[0].end());
-  auto value = std::string_view(ss[1].begin(), ss[1].end());
+  auto name = std::string_view(event).substr(0, pos);
+  auto value = std::string_view(event).substr(pos + 2);
+  auto str = [](std::string_view view) { return QString::fromUtf8(view.data(), view.size()); };
 
-  // TODO: parse real arguments if we really need them
-  // for now we only use these to know windows have changed
   if (name == "openwindow") {
-    emit openwindow("", "", "", "");
+    if (auto args = splitArgs(value, 4); !args.empty()) {
+      emit openwindow(address(args[0]), str(args[1]), str(args[2]), str(args[3]));
+    }
   } else if (name == "closewindow") {
-    emit closewindow("");
+    emit closewindow(address(value));
+  } else if (name == "windowtitlev2") {
+    if (auto args = splitArgs(value, 2); !args.empty()) { emit windowtitle(address(args[0]), str(args[1])); }
+  } else if (name == "movewindowv2") {
+    if (auto args = splitArgs(value, 3); !args.empty()) {
+      emit movewindow(address(args[0]), str(args[1]).toInt(), str(args[2]));
+    }
+  } else if (name == "activewindowv2") {
+    emit activewindow(value.empty() ? WindowAddress() : address(value));
   }
 }
 
+std::vector<std::string_view> EventListener::splitArgs(std::string_view value, size_t count) {
+  std::vector<std::string_view> args;
+
+  args.reserve(count);
+
+  while (args.size() + 1 < count) {
+    auto pos = value.find(',');
+    if (pos == std::string_view::npos) return {};
+    args.emplace_back(value.substr(0, pos));
+    value = value.substr(pos + 1);
+  }
+
+  args.emplace_back(value);
+
+  return args;
+}
+
+WindowAddress EventListener::address(std::string_view addr) {
+  return QStringLiteral("0x") + QString::fromUtf8(addr.data(), addr.size());
+}
+
 void EventListener::handleRead() {
   int fd = m_notifier->socket();
   int rc = 0;
@@ -4,6 +4,7 @@
 #include <qstringview.h>
 #include <qtmetamacros.h>
 namespace Hyprland {
+// in the same 0x prefixed form as the `address` field hyprctl returns
 using WindowAddress = QString;
 
 /**
@@ -15,6 +16,10 @@ signals:
   void openwindow(const WindowAddress &addr, const QString &workspaceName, const QString &wmClass,
                   const QString &title) const;
   void closewindow(const WindowAddress &addr) const;
+  void windowtitle(const WindowAddress &addr, const QString &title) const;
+  void movewindow(const WindowAddress &addr, int workspaceId, const QString &workspaceName) const;
+  // address is empty if no window is focused anymore
+  void activewindow(const WindowAddress &addr) const;
 
 public:
   EventListener();
@@ -25,6 +30,13 @@ private:
   void handleRead();
   void processEvent(const std::string &event);
 
+  /**
+   * Split the arguments of an event on their first `count - 1` commas, as the last one (usually a title)
+   * may contain commas itself. Returns an empty list if there are not enough arguments.
+   */
+  static std::vector<std::string_view> splitArgs(std::string_view value, size_t count);
+  static WindowAddress address(std::string_view addr);
+
   QSocketNotifier *m_notifier = new QSocketNotifier(QSocketNotifier::Type::Read, this);
   std::array<char, 1 << 16> m_buf;
   std::string m_message;
@@ -6,11 +6,19 @@ HyprlandWindow::HyprlandWindow(const QJsonObject &json) {
   m_wmClass = json.value("class").toString();
   m_workspaceId = json.value("workspace").toObject().value("id").toInt();
 
+  if (auto pid = json.value("pid"); pid.isDouble()) { m_pid = pid.toInt(); }
+
   auto at = json.value("at").toArray();
   auto size = json.value("size").toArray();
 
-  m_bounds.x = at.at(0).toInt();
-  m_bounds.y = at.at(1).toInt();
-  m_bounds.width = size.at(0).toInt();
-  m_bounds.height = size.at(1).toInt();
+  m_bounds = AbstractWindowManager::WindowBounds{
+      .x = static_cast<uint32_t>(at.at(0).toInt()),
+      .y = static_cast<uint32_t>(at.at(1).toInt()),
+      .width = static_cast<uint32_t>(size.at(0).toInt()),
+      .height = static_cast<uint32_t>(size.at(1).toInt()),
+  };
 }
+
+HyprlandWindow::HyprlandWindow(const QString &address, int workspaceId, const QString &wmClass,
+                               const QString &title)
+    : m_id(address), m_title(title), m_wmClass(wmClass), m_workspaceId(workspaceId) {}
@@ -1,20 +1,75 @@
 #include "hyprctl.hpp"
+#include <qpromise.h>
 
 QByteArray Hyprland::Controller::oneshot(std::string_view command) {
   return Controller().start(std::string(command));
 }
 
-QByteArray Hyprland::Controller::start(const std::string &command) {
-  char _buf[1 << 8];
+std::optional<std::filesystem::path> Hyprland::Controller::socketPath() {
   auto his = getenv("HYPRLAND_INSTANCE_SIGNATURE");
 
-  if (!his) { qWarning() << "Hyprctl::execute() failed: HYPRLAND_INSTANCE_SIGNATURE is not set"; }
+  if (!his) {
+    qWarning() << "Hyprctl::execute() failed: HYPRLAND_INSTANCE_SIGNATURE is not set";
+    return std::nullopt;
+  }
 
   std::filesystem::path rundir = "/tmp";
 
   if (auto p = getenv("XDG_RUNTIME_DIR")) rundir = p;
 
-  std::filesystem::path sockPath = rundir / "hypr" / his / ".socket.sock";
+  return rundir / "hypr" / his / ".socket.sock";
+}
+
+QFuture<QByteArray> Hyprland::Controller::request(std::string_view command) {
+  auto promise = std::make_shared<QPromise<QByteArray>>();
+  QFuture<QByteArray> future = promise->future();
+  auto path = socketPath();
+
+  promise->start();
+
+  if (!path) {
+    promise->addResult({});
+    promise->finish();
+    return future;
+  }
+
+  auto socket = new QLocalSocket;
+  auto response = std::make_shared<QByteArray>();
+  auto finish = [socket, promise](const QByteArray &data) {
+    if (promise->future().isFinished()) return;
+    promise->addResult(data);
+    promise->finish();
+    socket->deleteLater();
+  };
+
+  connect(socket, &QLocalSocket::connected, socket,
+          [socket, command = std::string(command)]() { socket->write(command.data(), command.size()); });
+  connect(socket, &QLocalSocket::readyRead, socket, [socket, response]() { *response += socket->readAll(); });
+  // hyprland closes the connection once the whole response is sent
+  connect(socket, &QLocalSocket::disconnected, socket,
+          [socket, response, finish]() { finish(*response + socket->readAll()); });
+  connect(socket, &QLocalSocket::errorOccurred, socket,
+          [socket, finish](QLocalSocket::LocalSocketError error) {
+            if (error == QLocalSocket::PeerClosedError) return;
+            qWarning() << "Hyprctl::request() failed:" << socket->errorString();
+            finish({});
+          });
+  QTimer::singleShot(REQUEST_TIMEOUT_MS, socket, [command = std::string(command), finish]() {
+    qWarning() << "Hyprctl::request() timed out for command" << command.c_str();
+    finish({});
+  });
+
+  socket->connectToServer(QString::fromStdString(path->string()));
+
+  return future;
+}
+
+QByteArray Hyprland::Controller::start(const std::string &command) {
+  char _buf[1 << 8];
+  auto sockPath = socketPath();
+
+  if (!sockPath) return {};
+
   int sock = socket(AF_UNIX, SOCK_STREAM, 0);
 
   if (sock < 0) {
@@ -26,7 +81,7 @@ QByteArray Hyprland::Controller::start(const std::string &command) {
 
   memset(&serverAddr, 0, sizeof(serverAddr));
   serverAddr.sun_family = AF_UNIX;
-  strncpy(serverAddr.sun_path, sockPath.c_str(), sizeof(serverAddr.sun_path) - 1);
+  strncpy(serverAddr.sun_path, sockPath->c_str(), sizeof(serverAddr.sun_path) - 1);
 
   if (::connect(sock, reinterpret_cast<sockaddr *>(&serverAddr), sizeof(serverAddr)) < 0) {
     qWarning() << "Hyprctl::execute() failed: connect() =>" << strerror(errno);
@@ -18,11 +18,24 @@
 #include <qdebug.h>
 #include <unistd.h>
 #include <expected>
+#include <qfuture.h>
 
 namespace Hyprland {
 class Controller : public QObject {
 public:
+  static constexpr const int REQUEST_TIMEOUT_MS = 2000;
+
   static QByteArray oneshot(std::string_view command);
+
+  /**
+   * Send `command` without blocking the calling thread, which needs to run an event loop.
+   * The returned future resolves with the response, or with an empty array if the request failed.
+   */
+  static QFuture<QByteArray> request(std::string_view command);
+
   QByteArray start(const std::string &command);
+
+private:
+  static std::optional<std::filesystem::path> socketPath();
 };
 }; // namespace Hyprland
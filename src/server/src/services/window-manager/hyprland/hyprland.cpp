@@ -10,27 +10,165 @@
 using Hyprctl = Hyprland::Controller;
 
 HyprlandWindowManager::HyprlandWindowManager() {
-  connect(&m_ev, &Hyprland::EventListener::openwindow, this, [this]() { emit windowsChanged(); });
-  connect(&m_ev, &Hyprland::EventListener::closewindow, this, [this]() { emit windowsChanged(); });
+  m_debounceTimer.setSingleShot(true);
+  m_debounceTimer.setInterval(50);
+  m_openedWindowTimer.setSingleShot(true);
+  m_openedWindowTimer.setInterval(OPENED_WINDOW_RECONCILE_DELAY_MS);
+  m_reconcileTimer.setInterval(RECONCILE_INTERVAL_MS);
+
+  connect(&m_debounceTimer, &QTimer::timeout, this, [this]() { emit windowsChanged(); });
+  connect(&m_openedWindowTimer, &QTimer::timeout, this, &HyprlandWindowManager::reconcile);
+  connect(&m_reconcileTimer, &QTimer::timeout, this, &HyprlandWindowManager::reconcile);
+
+  connect(&m_ev, &Hyprland::EventListener::openwindow, this, &HyprlandWindowManager::handleOpenWindow);
+  connect(&m_ev, &Hyprland::EventListener::closewindow, this, &HyprlandWindowManager::handleCloseWindow);
+  connect(&m_ev, &Hyprland::EventListener::windowtitle, this, &HyprlandWindowManager::handleWindowTitle);
+  connect(&m_ev, &Hyprland::EventListener::movewindow, this, &HyprlandWindowManager::handleMoveWindow);
+  connect(&m_ev, &Hyprland::EventListener::activewindow, this,
+          [this](const Hyprland::WindowAddress &addr) { m_activeWindow = addr; });
 }
 
 QString HyprlandWindowManager::id() const { return "hyprland"; }
 QString HyprlandWindowManager::displayName() const { return "Hyprland"; }
 
 AbstractWindowManager::WindowList HyprlandWindowManager::listWindowsSync() const {
-  auto response = Hyprctl::oneshot("-j/clients");
+  return {m_windows.begin(), m_windows.end()};
+}
+
+void HyprlandWindowManager::handleOpenWindow(const QString &address, const QString &workspaceName,
+                                             const QString &wmClass, const QString &title) {
+  applyEvent(
+      [=, this]() {
+        int workspaceId = workspaceIdForName(workspaceName);
+
+        if (auto window = findWindow(address)) {
+          window->setTitle(title);
+          window->setWorkspaceId(workspaceId);
+          return;
+        }
+
+        m_windows.emplace_back(std::make_shared<HyprlandWindow>(address, workspaceId, wmClass, title));
+      },
+      true);
+  m_openedWindowTimer.start();
+}
+
+void HyprlandWindowManager::handleCloseWindow(const QString &address) {
+  applyEvent([=, this]() { std::erase_if(m_windows, [&](auto &&win) { return win->id() == address; }); },
+             true);
+}
+
+void HyprlandWindowManager::handleWindowTitle(const QString &address, const QString &title) {
+  // the window list itself does not change, views hold the same windows and see the new title
+  applyEvent(
+      [=, this]() {
+        if (auto window = findWindow(address)) window->setTitle(title);
+      },
+      false);
+}
+
+void HyprlandWindowManager::handleMoveWindow(const QString &address, int workspaceId,
+                                             const QString &workspaceName) {
+  m_workspaceIds[workspaceName] = workspaceId;
+  applyEvent(
+      [=, this]() {
+        if (auto window = findWindow(address)) window->setWorkspaceId(workspaceId);
+      },
+      true);
+}
+
+void HyprlandWindowManager::applyEvent(const std::function<void()> &event, bool changesWindowList) {
+  event();
+  if (m_replayedEvents) m_replayedEvents->emplace_back(event);
+  if (changesWindowList) scheduleWindowsChanged();
+}
+
+void HyprlandWindowManager::reconcile() {
+  // the events received until the running one completes will be replayed on top of it
+  if (m_replayedEvents) return;
+
+  m_replayedEvents.emplace();
+  Hyprctl::request("-j/clients")
+      .then(QtFuture::Launch::Async, [](const QByteArray &response) { return parseClients(response); })
+      .then(this, [this](std::optional<ClientsSnapshot> snapshot) {
+        auto events = std::move(*m_replayedEvents);
+
+        m_replayedEvents.reset();
+
+        if (!snapshot) {
+          qWarning() << "Failed to list Hyprland clients, keeping the current window list";
+          return;
+        }
+
+        bool changed = applySnapshot(std::move(*snapshot));
+
+        for (const auto &event : events) {
+          event();
+        }
+
+        if (changed) scheduleWindowsChanged();
+      });
+}
+
+bool HyprlandWindowManager::applySnapshot(ClientsSnapshot snapshot) {
+  bool changed = snapshot.windows.size() != m_windows.size();
+
+  // windows that are still there are updated in place, as they are shared with the window manager's cache
+  for (auto &window : snapshot.windows) {
+    if (auto existing = findWindow(window->id())) {
+      changed = changed || existing->workspaceId() != window->workspaceId();
+      *existing = std::move(*window);
+      window = existing;
+    } else {
+      changed = true;
+    }
+  }
+
+  m_windows = std::move(snapshot.windows);
+  m_workspaceIds.insert(snapshot.workspaceIds.begin(), snapshot.workspaceIds.end());
+
+  return changed;
+}
+
+std::optional<HyprlandWindowManager::ClientsSnapshot>
+HyprlandWindowManager::parseClients(const QByteArray &response) {
   auto json = QJsonDocument::fromJson(response);
-  WindowList windows;
+
+  if (!json.isArray()) return std::nullopt;
+
+  ClientsSnapshot snapshot;
 
   for (const auto &item : json.array()) {
-    windows.emplace_back(std::make_shared<HyprlandWindow>(item.toObject()));
+    auto obj = item.toObject();
+    auto workspace = obj.value("workspace").toObject();
+
+    snapshot.workspaceIds[workspace.value("name").toString()] = workspace.value("id").toInt();
+    snapshot.windows.emplace_back(std::make_shared<HyprlandWindow>(obj));
   }
 
-  return windows;
+  return snapshot;
 }
 
+std::shared_ptr<HyprlandWindow> HyprlandWindowManager::findWindow(const QString &address) const {
+  if (auto it = std::ranges::find_if(m_windows, [&](auto &&win) { return win->id() == address; });
+      it != m_windows.end()) {
+    return *it;
+  }
+
+  return nullptr;
+}
+
+int HyprlandWindowManager::workspaceIdForName(const QString &name) const {
+  if (auto it = m_workspaceIds.find(name); it != m_workspaceIds.end()) return it->second;
+
+  // regular workspaces are named after their id, the next reconciliation fixes the others
+  return name.toInt();
+}
+
+void HyprlandWindowManager::scheduleWindowsChanged() { m_debounceTimer.start(); }
+
 void HyprlandWindowManager::applyLayerRule(std::string_view rule) {
-  Hyprctl::oneshot(std::format("keyword layerrule {}, {}", rule, Omnicast::LAYER_SCOPE));
+  Hyprctl::request(std::format("keyword layerrule {}, {}", rule, Omnicast::LAYER_SCOPE));
 }
 
 void HyprlandWindowManager::applyLayerRules() {
@@ -57,6 +195,11 @@ bool HyprlandWindowManager::pasteToWindow(const AbstractWindow *window, const Ab
 }
 
 AbstractWindowManager::WindowPtr HyprlandWindowManager::getFocusedWindowSync() const {
+  if (m_activeWindow) {
+    if (m_activeWindow->isEmpty()) return nullptr;
+    if (auto window = findWindow(*m_activeWindow)) return window;
+  }
+
   auto response = Hyprctl::oneshot("-j/activewindow");
   auto json = QJsonDocument::fromJson(response);
 
@@ -72,8 +215,8 @@ void HyprlandWindowManager::focusWindowSync(const AbstractWindow &window) const
 }
 
 bool HyprlandWindowManager::closeWindow(const AbstractWindow &window) const {
-  Hyprctl::oneshot(std::format("dispatch closewindow address:{}", window.id().toStdString()));
-  emit windowsChanged();
+  // the window is removed from the list once hyprland sends the closewindow event
+  Hyprctl::request(std::format("dispatch closewindow address:{}", window.id().toStdString()));
 
   return true;
 }
@@ -112,4 +255,11 @@ AbstractWindowManager::WorkspaceList HyprlandWindowManager::listWorkspaces() con
   return workspaces;
 }
 
-void HyprlandWindowManager::start() { m_ev.start(); }
+void HyprlandWindowManager::start() {
+  m_ev.start();
+
+  // the events the listener gets from now on are only processed after this first list is in place
+  if (auto snapshot = parseClients(Hyprctl::oneshot("-j/clients"))) { applySnapshot(std::move(*snapshot)); }
+
+  m_reconcileTimer.start();
+}
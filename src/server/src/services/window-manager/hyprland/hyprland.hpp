@@ -15,7 +15,10 @@
 #include <QJsonObject>
 #include <qpromise.h>
 #include <qstringview.h>
+#include <qtimer.h>
+#include <functional>
 #include <string_view>
+#include <unordered_map>
 
 class HyprlandWindow : public AbstractWindowManager::AbstractWindow {
 public:
@@ -27,15 +30,21 @@ public:
   std::optional<QString> workspace() const override { return QString::number(m_workspaceId); }
   bool canClose() const override { return true; }
 
+  int workspaceId() const { return m_workspaceId; }
+  void setTitle(const QString &title) { m_title = title; }
+  void setWorkspaceId(int id) { m_workspaceId = id; }
+
   HyprlandWindow(const QJsonObject &json);
+  // from an openwindow event, which carries neither the pid nor the geometry of the window
+  HyprlandWindow(const QString &address, int workspaceId, const QString &wmClass, const QString &title);
 
 private:
   QString m_id;
   QString m_title;
   QString m_wmClass;
-  int m_workspaceId;
-  int m_pid;
-  AbstractWindowManager::WindowBounds m_bounds;
+  int m_workspaceId = -1;
+  std::optional<int> m_pid;
+  std::optional<AbstractWindowManager::WindowBounds> m_bounds;
 };
 
 class HyprlandWindowManager : public AbstractWindowManager {
@@ -61,11 +70,56 @@ public:
   void start() override;
 
 private:
+  using WindowTable = std::vector<std::shared_ptr<HyprlandWindow>>;
+
+  struct ClientsSnapshot {
+    WindowTable windows;
+    std::unordered_map<QString, int> workspaceIds;
+  };
+
+  // the window table is kept up to date from events, this only catches what they may have missed
+  static constexpr const int RECONCILE_INTERVAL_MS = 30'000;
+  // events don't tell the pid and geometry of new windows, they are fetched shortly after they open
+  static constexpr const int OPENED_WINDOW_RECONCILE_DELAY_MS = 500;
+
   void applyLayerRule(std::string_view rule);
   void applyLayerRules();
   QString id() const override;
   QString displayName() const override;
 
+  void handleOpenWindow(const QString &address, const QString &workspaceName, const QString &wmClass,
+                        const QString &title);
+  void handleCloseWindow(const QString &address);
+  void handleWindowTitle(const QString &address, const QString &title);
+  void handleMoveWindow(const QString &address, int workspaceId, const QString &workspaceName);
+
+  /**
+   * Apply a change to the window table. If a reconciliation is in flight, the change is applied again on top
+   * of its result, which may have been taken before the change happened.
+   */
+  void applyEvent(const std::function<void()> &event, bool changesWindowList);
+
+  /**
+   * Fetch the full list of clients without blocking and replace the window table with it.
+   */
+  void reconcile();
+  bool applySnapshot(ClientsSnapshot snapshot);
+  static std::optional<ClientsSnapshot> parseClients(const QByteArray &response);
+
+  std::shared_ptr<HyprlandWindow> findWindow(const QString &address) const;
+  int workspaceIdForName(const QString &name) const;
+  void scheduleWindowsChanged();
+
   bool m_dimAround = false;
   Hyprland::EventListener m_ev;
+
+  WindowTable m_windows;
+  std::unordered_map<QString, int> m_workspaceIds;
+  // unknown until the first activewindowv2 event, empty if no window is focused
+  std::optional<QString> m_activeWindow;
+  std::optional<std::vector<std::function<void()>>> m_replayedEvents;
+
+  QTimer m_reconcileTimer;
+  QTimer m_openedWindowTimer;
+  QTimer m_debounceTimer;
 };
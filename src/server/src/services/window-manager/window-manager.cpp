@@ -45,8 +45,7 @@ AbstractWindowManager::WindowPtr WindowManager::getFocusedWindow() {
 }
 
 const AbstractWindowManager::AbstractWindow *WindowManager::findWindowById(const QString &id) {
-  auto pred = [&](auto &&win) { return win->id() == id; };
-  if (auto it = std::ranges::find_if(m_windows, pred); it != m_windows.end()) { return it->get(); }
+  if (auto it = m_windowsById.find(id); it != m_windowsById.end()) { return m_windows[it->second].get(); }
   return nullptr;
 }
 
@@ -62,14 +61,50 @@ bool WindowManager::focusApp(const AbstractApplication &app) const {
 }
 
 AbstractWindowManager::WindowList WindowManager::findAppWindows(const AbstractApplication &app) const {
-  return m_windows | std::views::filter([&](auto &&win) {
-           return app.matchesWindowClass(win->wmClass()) ||
-                  app.displayName().compare(win->title(), Qt::CaseInsensitive) == 0;
-         }) |
+  std::vector<size_t> positions;
+
+  for (const auto &cl : app.windowClasses()) {
+    if (auto it = m_windowsByClass.find(cl); it != m_windowsByClass.end()) {
+      positions.insert(positions.end(), it->second.begin(), it->second.end());
+    }
+  }
+
+  QString name = app.displayName();
+
+  // titles can change without the window list changing, so the indexed one may be outdated
+  if (auto it = m_windowsByTitle.find(name.toCaseFolded()); it != m_windowsByTitle.end()) {
+    for (size_t pos : it->second) {
+      if (name.compare(m_windows[pos]->title(), Qt::CaseInsensitive) == 0) { positions.emplace_back(pos); }
+    }
+  }
+
+  // keep the order of the window list, a window can match both on its class and its title
+  std::ranges::sort(positions);
+  auto duplicates = std::ranges::unique(positions);
+  positions.erase(duplicates.begin(), duplicates.end());
+
+  return positions | std::views::transform([&](size_t pos) { return m_windows[pos]; }) |
          std::ranges::to<std::vector>();
 }
 
-void WindowManager::updateWindowCache() { m_windows = m_provider->listWindowsSync(); }
+void WindowManager::updateWindowCache() {
+  m_windows = m_provider->listWindowsSync();
+  indexWindows();
+}
+
+void WindowManager::indexWindows() {
+  m_windowsByClass.clear();
+  m_windowsByTitle.clear();
+  m_windowsById.clear();
+
+  for (size_t i = 0; i != m_windows.size(); ++i) {
+    const auto &win = m_windows[i];
+
+    m_windowsByClass[AbstractApplication::normalizeWindowClass(win->wmClass())].emplace_back(i);
+    m_windowsByTitle[win->title().toCaseFolded()].emplace_back(i);
+    m_windowsById.try_emplace(win->id(), i);
+  }
+}
 
 bool WindowManager::canPaste() const { return m_provider->supportsPaste(); }
 
@@ -1,6 +1,8 @@
 #pragma once
 #include "abstract-window-manager.hpp"
 #include "services/app-service/abstract-app-db.hpp"
+#include <unordered_map>
+#include <vector>
 
 class WindowManager : public QObject {
   Q_OBJECT
@@ -25,9 +27,17 @@ private:
   static std::vector<std::unique_ptr<AbstractWindowManager>> createCandidates();
   static std::unique_ptr<AbstractWindowManager> createProvider();
   void updateWindowCache();
+  void indexWindows();
 
   // we maintain our own window cache so that wm implementations are not required to cache themselves.
   AbstractWindowManager::WindowList m_windows;
 
+  // positions in m_windows, rebuilt every time the window list changes.
+  // Listing the windows of an app is done on every render of app items, it should not depend on the number
+  // of windows.
+  std::unordered_map<QString, std::vector<size_t>> m_windowsByClass;
+  std::unordered_map<QString, std::vector<size_t>> m_windowsByTitle;
+  std::unordered_map<QString, size_t> m_windowsById;
+
   std::unique_ptr<AbstractWindowManager> m_provider;
 };
@@ -4,15 +4,74 @@
 #include "ui/file-detail/file-detail.hpp"
 #include "ui/views/typed-list-view.hpp"
 #include "lib/fzf.hpp"
+#include <QtConcurrent/QtConcurrent>
 #include <filesystem>
+#include <numeric>
 #include <qwidget.h>
 #include <ranges>
 
+namespace {
+using DMenu::ScoredLine;
+
+struct ChunkResult {
+  std::vector<uint32_t> matches;
+  std::vector<ScoredLine> best;
+};
+
+constexpr size_t FILTER_CHUNK_SIZE = 16384;
+constexpr size_t CANCELLATION_CHECK_INTERVAL = 1024;
+
+// best score first, input order among equal scores (same order a stable sort gives)
+bool isBetter(const ScoredLine &a, const ScoredLine &b) {
+  if (a.score != b.score) return a.score > b.score;
+  return a.index < b.index;
+}
+
+void keepBest(std::vector<ScoredLine> &scored, size_t count) {
+  if (scored.size() <= count) return;
+  std::ranges::nth_element(scored, scored.begin() + count, isBetter);
+  scored.resize(count);
+}
+
+void appendIndices(std::vector<uint32_t> &indices, size_t from, size_t to) {
+  size_t offset = indices.size();
+
+  indices.resize(offset + to - from);
+  std::iota(indices.begin() + offset, indices.end(), from);
+}
+} // namespace
+
 namespace DMenu {
-View::View(ipc::DMenu::Request data) : m_data(data), m_model(new DMenuModel(this)) {
-  m_entries = std::views::split(m_data.rawContent, std::string_view("\n")) |
-              std::views::transform([](auto &&s) { return std::string_view(s); }) |
-              std::views::filter([](auto &&s) { return !s.empty(); }) | std::ranges::to<std::vector>();
+View::View(ipc::DMenu::Request data) : m_data(std::move(data)), m_model(new DMenuModel(this)) {
+  m_lines.append(m_data.rawContent);
+  if (!m_data.stream) m_lines.finish();
+  // lines were copied to the store
+  m_data.rawContent = {};
+
+  // one pass at a time: a stale pass only holds the thread until it notices it was cancelled
+  m_filterPool.setMaxThreadCount(1);
+
+  connect(&m_filterWatcher, &QFutureWatcher<FilterResult>::finished, this, [this]() {
+    if (m_filterWatcher.isCanceled() || m_filterWatcher.future().resultCount() == 0) return;
+
+    auto result = m_filterWatcher.future().takeResult();
+    if (result.generation == m_filterGeneration) applyFilterResult(std::move(result));
+  });
+}
+
+View::~View() {
+  m_filterWatcher.cancel();
+  m_filterWatcher.waitForFinished();
+}
+
+void View::appendContent(std::string_view data, bool eof) {
+  m_lines.append(data);
+  if (eof) m_lines.finish();
+
+  // a running pass picks up the new lines once it is applied
+  if (m_filterWatcher.isRunning() && !m_filterWatcher.isCanceled()) return;
+
+  filterNewLines();
 }
 
 QWidget *View::generateDetail(const std::string_view &text) const {
@@ -64,27 +123,167 @@ void View::initialize() {
   }
 }
 
-void View::textChanged(const QString &text) {
-  setFilter(text.toStdString());
-  m_list->selectFirst();
+void View::textChanged(const QString &text) { setFilter(text.toStdString()); }
+
+View::FilterResult View::filterEntries(const LineStore::Snapshot &entries,
+                                       std::span<const uint32_t> candidates, std::string query,
+                                       const std::function<bool()> &isCancelled, bool parallel) {
+  FilterResult result{.scoredCount = entries.size()};
+
+  if (query.empty()) {
+    result.matches.assign(candidates.begin(), candidates.end());
+    return result;
+  }
+
+  const fzf::CharMask queryMask = fzf::queryCharMask(query);
+
+  auto scoreChunk = [&](std::span<const uint32_t> chunk) {
+    ChunkResult scored;
+
+    for (size_t i = 0; i != chunk.size(); ++i) {
+      if (i % CANCELLATION_CHECK_INTERVAL == 0 && isCancelled && isCancelled()) return ChunkResult{};
+
+      uint32_t idx = chunk[i];
+
+      if (!fzf::mayMatch(entries.mask(idx), queryMask)) continue;
+
+      int score = fzf::defaultMatcher.fuzzy_match_v2_score_query(entries[idx], query);
+
+      if (score <= 0) continue;
+
+      scored.matches.emplace_back(idx);
+      scored.best.emplace_back(ScoredLine{.index = idx, .score = score});
+
+      if (scored.best.size() >= 2 * MAX_RANKED_ENTRIES) { keepBest(scored.best, MAX_RANKED_ENTRIES); }
+    }
+
+    keepBest(scored.best, MAX_RANKED_ENTRIES);
+    return scored;
+  };
+
+  std::vector<ChunkResult> chunks;
+
+  if (parallel) {
+    std::vector<std::span<const uint32_t>> slices;
+
+    for (size_t i = 0; i < candidates.size(); i += FILTER_CHUNK_SIZE) {
+      slices.emplace_back(candidates.subspan(i, std::min(FILTER_CHUNK_SIZE, candidates.size() - i)));
+    }
+
+    // matching is thread safe, every worker uses its own scratch space
+    chunks = QtConcurrent::blockingMapped<std::vector<ChunkResult>>(QThreadPool::globalInstance(), slices,
+                                                                    scoreChunk);
+  } else {
+    chunks.emplace_back(scoreChunk(candidates));
+  }
+
+  result.query = std::move(query);
+
+  if (isCancelled && isCancelled()) return result;
+
+  // chunks are in input order, so are their matches
+  for (auto &chunk : chunks) {
+    result.matches.insert(result.matches.end(), chunk.matches.begin(), chunk.matches.end());
+    result.best.insert(result.best.end(), chunk.best.begin(), chunk.best.end());
+  }
+
+  keepBest(result.best, MAX_RANKED_ENTRIES);
+  std::ranges::sort(result.best, isBetter);
+
+  return result;
 }
 
 void View::setFilter(std::string_view query) {
-  auto toScore = [&](std::string_view s) {
-    int score = fzf::defaultMatcher.fuzzy_match_v2_score_query(s, query);
-    return Scored<std::string_view>{.data = s, .score = score};
+  std::vector<uint32_t> candidates;
+
+  // a longer query can only match a subset of what the previous one matched. m_matches covers every line
+  // up to m_scoredCount, the ones past it are scored below either way.
+  if (fzf::narrowsQuery(m_lastQuery, query)) {
+    candidates = m_matches;
+  } else {
+    appendIndices(candidates, 0, m_scoredCount);
+  }
+
+  appendIndices(candidates, m_scoredCount, m_lines.size());
+  startFilter(std::string(query), std::move(candidates), false);
+}
+
+void View::filterNewLines() {
+  if (m_scoredCount == m_lines.size()) return;
+
+  std::vector<uint32_t> candidates;
+
+  appendIndices(candidates, m_scoredCount, m_lines.size());
+  startFilter(m_lastQuery, std::move(candidates), true);
+}
+
+void View::startFilter(std::string query, std::vector<uint32_t> candidates, bool incremental) {
+  uint64_t generation = ++m_filterGeneration;
+
+  m_filterWatcher.cancel();
+
+  if (query.empty() || candidates.size() < ASYNC_FILTER_THRESHOLD) {
+    auto result = filterEntries(m_lines.snapshot(), candidates, std::move(query), nullptr, false);
+    result.incremental = incremental;
+    result.generation = generation;
+    applyFilterResult(std::move(result));
+    return;
+  }
+
+  auto task = [entries = m_lines.snapshot(), candidates = std::move(candidates), query = std::move(query),
+               incremental, generation](QPromise<FilterResult> &promise) {
+    auto result = filterEntries(entries, candidates, query, [&]() { return promise.isCanceled(); }, true);
+    result.incremental = incremental;
+    result.generation = generation;
+    if (!promise.isCanceled()) promise.addResult(std::move(result));
   };
 
-  auto filtered = m_entries | std::views::transform(toScore) |
-                  std::views::filter([&](auto &&s) { return query.empty() || s.score > 0; });
+  m_filterWatcher.setFuture(QtConcurrent::run(&m_filterPool, std::move(task)));
+}
+
+void View::applyFilterResult(FilterResult result) {
+  bool wasEmpty = m_filteredEntries.empty();
+
+  if (result.incremental) {
+    m_matches.insert(m_matches.end(), result.matches.begin(), result.matches.end());
+    m_best.insert(m_best.end(), result.best.begin(), result.best.end());
+    keepBest(m_best, MAX_RANKED_ENTRIES);
+    std::ranges::sort(m_best, isBetter);
+  } else {
+    m_lastQuery = std::move(result.query);
+    m_matches = std::move(result.matches);
+    m_best = std::move(result.best);
+  }
+
+  m_scoredCount = result.scoredCount;
+
+  if (m_lastQuery.empty()) {
+    // nothing to rank, everything is listed in input order
+    size_t from = result.incremental ? m_filteredEntries.size() : 0;
 
-  m_filteredEntries.clear();
-  std::ranges::copy(filtered, std::back_inserter(m_filteredEntries));
-  std::ranges::stable_sort(m_filteredEntries, std::greater{});
+    m_filteredEntries.resize(m_matches.size());
+
+    for (size_t i = from; i != m_matches.size(); ++i) {
+      m_filteredEntries[i] = Scored<std::string_view>{.data = m_lines[m_matches[i]], .score = 0};
+    }
+  } else {
+    m_filteredEntries.clear();
+
+    for (const auto &scored : m_best) {
+      m_filteredEntries.emplace_back(
+          Scored<std::string_view>{.data = m_lines[scored.index], .score = scored.score});
+    }
+  }
 
   if (!m_data.noSection) { updateSectionName(m_data.sectionTitle.value_or("Entries ({count})")); }
 
   m_model->setEntries(m_filteredEntries);
+
+  // don't move the selection around while content streams in
+  if (!result.incremental || wasEmpty) m_list->selectFirst();
+
+  // lines that came in while the pass was running
+  filterNewLines();
 }
 
 std::string View::expandSection(std::string_view name, size_t count) {
@@ -94,7 +293,7 @@ std::string View::expandSection(std::string_view name, size_t count) {
 }
 
 void View::updateSectionName(std::string_view name) {
-  m_sectionName = expandSection(name, m_filteredEntries.size());
+  m_sectionName = expandSection(name, m_matches.size());
   m_model->setSectionName(m_sectionName);
 }
 
@@ -1,9 +1,17 @@
 #pragma once
 #include "ui/dmenu-view/dmenu-model.hpp"
+#include "ui/dmenu-view/line-store.hpp"
 #include "ui/views/typed-list-view.hpp"
 #include "vicinae-ipc/ipc.hpp"
+#include <QFutureWatcher>
+#include <QThreadPool>
 
 namespace DMenu {
+struct ScoredLine {
+  uint32_t index;
+  int score;
+};
+
 class View : public TypedListView<DMenuModel> {
   Q_OBJECT
 
@@ -13,13 +21,56 @@ signals:
 
 public:
   View(ipc::DMenu::Request data);
+  ~View() override;
+
+  /**
+   * Add streamed content (see ipc::DMenuAppend). New lines are filtered against the current query
+   * and merged into the results as they come in.
+   */
+  void appendContent(std::string_view data, bool eof);
 
 protected:
   void hideEvent(QHideEvent *event) override;
   QWidget *generateDetail(const ItemType &item) const override;
 
 private:
+  /**
+   * Outcome of a filter pass.
+   */
+  struct FilterResult {
+    std::string query;
+    // indices of every entry matching `query`, in input order
+    std::vector<uint32_t> matches;
+    // the best matches (at most MAX_RANKED_ENTRIES), best first. Empty for an empty query.
+    std::vector<ScoredLine> best;
+    // number of lines the pass covers, every line was scored when this is the size of the store
+    size_t scoredCount = 0;
+    // only newly appended lines were filtered, the result completes the current one
+    bool incremental = false;
+    // results of a pass started before the last one are stale and dropped
+    uint64_t generation = 0;
+  };
+
+  /**
+   * Only the best matches are ranked and listed. Sorting every match of a short query over a large
+   * input is most of the cost of a pass and nobody scrolls through hundreds of thousands of entries.
+   */
+  static constexpr size_t MAX_RANKED_ENTRIES = 2000;
+
+  /**
+   * Inputs with fewer candidates than this are filtered synchronously: a background pass would cost
+   * more than it saves and would make the list flicker.
+   */
+  static constexpr size_t ASYNC_FILTER_THRESHOLD = 20000;
+
+  static FilterResult filterEntries(const LineStore::Snapshot &entries, std::span<const uint32_t> candidates,
+                                    std::string query, const std::function<bool()> &isCancelled,
+                                    bool parallel);
+
   void setFilter(std::string_view query);
+  void filterNewLines();
+  void startFilter(std::string query, std::vector<uint32_t> candidates, bool incremental);
+  void applyFilterResult(FilterResult result);
   void updateSectionName(std::string_view name);
   std::string expandSection(std::string_view name, size_t count);
   void itemSelected(const ItemType &item) override;
@@ -34,8 +85,18 @@ private:
   void selectEntry(const QString &text);
   void initialize() override;
 
-  std::vector<std::string_view> m_entries;
+  LineStore m_lines;
   std::vector<Scored<std::string_view>> m_filteredEntries;
+  // query of the last applied pass and the entries it matched, next pass only rescores these if
+  // its query extends this one
+  std::string m_lastQuery;
+  std::vector<uint32_t> m_matches;
+  std::vector<ScoredLine> m_best;
+  // lines past this one came in after the last applied pass started
+  size_t m_scoredCount = 0;
+  uint64_t m_filterGeneration = 0;
+  QThreadPool m_filterPool;
+  QFutureWatcher<FilterResult> m_filterWatcher;
   std::string_view m_sectionNameTemplate;
   std::string m_sectionName;
   bool m_selected = false;
@@ -0,0 +1,92 @@
+#include "ui/dmenu-view/line-store.hpp"
+#include <cstring>
+
+namespace DMenu {
+
+std::string_view LineStore::copyText(std::string_view text) {
+  if (text.size() > TEXT_BLOCK_SIZE / 4) {
+    // very long lines get a block of their own, the current block stays last as it may still have room
+    auto block = std::make_unique_for_overwrite<char[]>(text.size());
+    std::string_view copy(block.get(), text.size());
+
+    std::memcpy(block.get(), text.data(), text.size());
+    m_textBlocks.insert(m_textBlocks.empty() ? m_textBlocks.end() : m_textBlocks.end() - 1, std::move(block));
+
+    return copy;
+  }
+
+  if (TEXT_BLOCK_SIZE - m_textBlockUsed < text.size()) {
+    m_textBlocks.emplace_back(std::make_unique_for_overwrite<char[]>(TEXT_BLOCK_SIZE));
+    m_textBlockUsed = 0;
+  }
+
+  char *dst = m_textBlocks.back().get() + m_textBlockUsed;
+
+  std::memcpy(dst, text.data(), text.size());
+  m_textBlockUsed += text.size();
+
+  return {dst, text.size()};
+}
+
+void LineStore::addLine(std::string_view line) {
+  if (line.empty()) return;
+
+  if (m_size % LINES_PER_BLOCK == 0) {
+    m_lineBlocks.emplace_back(std::make_unique<std::string_view[]>(LINES_PER_BLOCK));
+    m_maskBlocks.emplace_back(std::make_unique_for_overwrite<fzf::CharMask[]>(LINES_PER_BLOCK));
+  }
+
+  m_lineBlocks.back()[m_size % LINES_PER_BLOCK] = copyText(line);
+  m_maskBlocks.back()[m_size % LINES_PER_BLOCK] = fzf::charMask(line);
+  ++m_size;
+}
+
+void LineStore::append(std::string_view data) {
+  size_t start = 0;
+
+  while (start < data.size()) {
+    size_t end = data.find('\n', start);
+
+    if (end == std::string_view::npos) {
+      m_partialLine.append(data.substr(start));
+      return;
+    }
+
+    if (m_partialLine.empty()) {
+      addLine(data.substr(start, end - start));
+    } else {
+      m_partialLine.append(data.substr(start, end - start));
+      addLine(m_partialLine);
+      m_partialLine.clear();
+    }
+
+    start = end + 1;
+  }
+}
+
+void LineStore::finish() {
+  addLine(m_partialLine);
+  m_partialLine.clear();
+  m_partialLine.shrink_to_fit();
+  m_finished = true;
+}
+
+LineStore::Snapshot LineStore::snapshot() const {
+  Snapshot snapshot;
+
+  snapshot.m_size = m_size;
+  snapshot.m_blocks.reserve(m_lineBlocks.size());
+  snapshot.m_maskBlocks.reserve(m_maskBlocks.size());
+
+  for (const auto &block : m_lineBlocks) {
+    snapshot.m_blocks.emplace_back(block.get());
+  }
+
+  for (const auto &block : m_maskBlocks) {
+    snapshot.m_maskBlocks.emplace_back(block.get());
+  }
+
+  return snapshot;
+}
+
+}; // namespace DMenu
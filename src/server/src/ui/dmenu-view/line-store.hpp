@@ -0,0 +1,78 @@
+#pragma once
+#include "lib/fzf.hpp"
+#include <cstddef>
+#include <memory>
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace DMenu {
+
+/**
+ * Append-only storage for the lines of a dmenu, fed with arbitrary chunks of input as they come in.
+ *
+ * Text is copied into large blocks and lines are indexed in fixed-size blocks of views, along with
+ * their fzf::CharMask so that filtering can skip most lines without looking at them. No block ever
+ * moves, so a Snapshot taken on the UI thread can be read from worker threads while more lines are
+ * appended to the store.
+ */
+class LineStore {
+  static constexpr size_t TEXT_BLOCK_SIZE = 1 << 20;
+  static constexpr size_t LINES_PER_BLOCK = 1 << 14;
+
+public:
+  /**
+   * The lines a store held at a given point in time. Valid as long as the store is.
+   */
+  class Snapshot {
+  public:
+    std::string_view operator[](size_t idx) const {
+      return m_blocks[idx / LINES_PER_BLOCK][idx % LINES_PER_BLOCK];
+    }
+    fzf::CharMask mask(size_t idx) const {
+      return m_maskBlocks[idx / LINES_PER_BLOCK][idx % LINES_PER_BLOCK];
+    }
+    size_t size() const { return m_size; }
+
+  private:
+    std::vector<const std::string_view *> m_blocks;
+    std::vector<const fzf::CharMask *> m_maskBlocks;
+    size_t m_size = 0;
+
+    friend class LineStore;
+  };
+
+  /**
+   * Add `data` to the store. Empty lines are skipped and a trailing incomplete line is kept aside
+   * until the rest of it is appended or `finish` is called.
+   */
+  void append(std::string_view data);
+
+  /**
+   * Signal the end of the input, flushing the pending incomplete line if any.
+   */
+  void finish();
+
+  bool isFinished() const { return m_finished; }
+
+  std::string_view operator[](size_t idx) const {
+    return m_lineBlocks[idx / LINES_PER_BLOCK][idx % LINES_PER_BLOCK];
+  }
+  size_t size() const { return m_size; }
+
+  Snapshot snapshot() const;
+
+private:
+  void addLine(std::string_view line);
+  std::string_view copyText(std::string_view text);
+
+  std::vector<std::unique_ptr<char[]>> m_textBlocks;
+  size_t m_textBlockUsed = TEXT_BLOCK_SIZE;
+  std::vector<std::unique_ptr<std::string_view[]>> m_lineBlocks;
+  std::vector<std::unique_ptr<fzf::CharMask[]>> m_maskBlocks;
+  size_t m_size = 0;
+  std::string m_partialLine;
+  bool m_finished = false;
+};
+
+}; // namespace DMenu
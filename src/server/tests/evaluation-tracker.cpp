@@ -0,0 +1,97 @@
+#include "services/calculator-service/qalculate/evaluation-tracker.hpp"
+#include <catch2/catch_test_macros.hpp>
+#include <atomic>
+#include <thread>
+
+TEST_CASE("asking aborts the asynchronous evaluation in progress, once", "[evaluation-tracker]") {
+  int aborts = 0;
+  EvaluationTracker tracker([&]() { ++aborts; });
+
+  uint64_t first = tracker.ask();
+
+  REQUIRE(tracker.begin(first));
+
+  uint64_t second = tracker.ask();
+  tracker.ask();
+
+  REQUIRE(aborts == 1);
+  REQUIRE_FALSE(tracker.isCurrent(first));
+  REQUIRE_FALSE(tracker.isCurrent(second));
+  REQUIRE(tracker.end());
+}
+
+TEST_CASE("asking while idle aborts nothing", "[evaluation-tracker]") {
+  int aborts = 0;
+  EvaluationTracker tracker([&]() { ++aborts; });
+
+  uint64_t first = tracker.ask();
+
+  REQUIRE(tracker.begin(first));
+  REQUIRE_FALSE(tracker.end());
+
+  tracker.ask();
+  tracker.ask();
+
+  REQUIRE(aborts == 0);
+}
+
+TEST_CASE("synchronous evaluations are never aborted", "[evaluation-tracker]") {
+  int aborts = 0;
+  EvaluationTracker tracker([&]() { ++aborts; });
+
+  tracker.ask();
+
+  REQUIRE(tracker.begin(0));
+
+  tracker.ask();
+
+  REQUIRE(aborts == 0);
+  REQUIRE(tracker.isCurrent(0));
+  REQUIRE_FALSE(tracker.end());
+}
+
+TEST_CASE("superseded questions are not evaluated", "[evaluation-tracker]") {
+  int aborts = 0;
+  EvaluationTracker tracker([&]() { ++aborts; });
+
+  uint64_t first = tracker.ask();
+  uint64_t second = tracker.ask();
+
+  REQUIRE_FALSE(tracker.begin(first));
+  REQUIRE(tracker.begin(second));
+  REQUIRE_FALSE(tracker.end());
+  REQUIRE(aborts == 0);
+}
+
+TEST_CASE("an abort only ever hits the evaluation it was meant for", "[evaluation-tracker]") {
+  std::atomic<uint64_t> running = 0;
+  std::atomic<bool> syncAborted = false;
+  std::atomic<bool> done = false;
+  EvaluationTracker tracker([&]() {
+    if (running == 0) syncAborted = true;
+  });
+
+  std::thread asker([&]() {
+    while (!done) {
+      tracker.ask();
+    }
+  });
+
+  // the worker alternates between questions asked asynchronously and synchronous ones
+  for (int i = 0; i != 20000; ++i) {
+    uint64_t generation = i % 2 ? tracker.ask() : 0;
+
+    running = generation;
+
+    if (!tracker.begin(generation)) continue;
+
+    bool aborted = tracker.end();
+
+    if (generation == 0) REQUIRE_FALSE(aborted);
+  }
+
+  done = true;
+  asker.join();
+
+  REQUIRE_FALSE(syncAborted);
+}
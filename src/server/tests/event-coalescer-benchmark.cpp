@@ -0,0 +1,119 @@
+#include "services/files-service/file-indexer/event-coalescer.hpp"
+#include <catch2/catch_test_macros.hpp>
+#include <atomic>
+#include <format>
+#include <random>
+
+using namespace std::chrono_literals;
+namespace fs = std::filesystem;
+
+static constexpr size_t STORM_SIZE = 300'000;
+
+/**
+ * Only counts what it is handed, optionally taking `writeTime` per batch like a database would.
+ */
+class CountingSink {
+  std::atomic<size_t> m_events = 0;
+  std::atomic<size_t> m_batches = 0;
+  std::atomic<size_t> m_queued = 0;
+  std::chrono::microseconds m_writeTime;
+
+public:
+  size_t events() const { return m_events; }
+  size_t batches() const { return m_batches; }
+
+  EventCoalescer::Sink sink() {
+    return {.write =
+                [this](std::vector<FileEvent> events) {
+                  ++m_queued;
+                  if (m_writeTime.count() > 0) std::this_thread::sleep_for(m_writeTime);
+                  m_events += events.size();
+                  ++m_batches;
+                  --m_queued;
+                },
+            .queueSize = [this]() { return m_queued.load(); }};
+  }
+
+  CountingSink(std::chrono::microseconds writeTime = 0us) : m_writeTime(writeTime) {}
+};
+
+struct StormEvent {
+  FileEvent event;
+  bool isCreation;
+};
+
+/**
+ * What a watcher reports during an `npm install` followed by a build: a lot of new files, most of them
+ * modified again shortly after, and temporary files created and deleted right away.
+ */
+static std::vector<StormEvent> makeStorm() {
+  std::mt19937 rng(31);
+  std::vector<StormEvent> storm;
+  auto now = fs::file_time_type::clock::now();
+  auto path = [](std::string_view kind, size_t n) {
+    return fs::path(std::format("/home/user/project/node_modules/pkg-{}/{}-{}.js", n % 3000, kind, n));
+  };
+
+  storm.reserve(STORM_SIZE);
+
+  for (size_t i = 0; storm.size() < STORM_SIZE; ++i) {
+    switch (rng() % 4) {
+    case 0:
+    case 1:
+      storm.push_back({{FileEventType::Modify, path("file", i), now}, true});
+      break;
+    case 2:
+      // modifying one of the files created so far
+      storm.push_back({{FileEventType::Modify, path("file", rng() % (i + 1)), now}, false});
+      break;
+    case 3:
+      storm.push_back({{FileEventType::Modify, path("tmp", i), now}, true});
+      storm.push_back({{FileEventType::Delete, path("tmp", i), now}, false});
+      break;
+    }
+  }
+
+  return storm;
+}
+
+static void runStorm(std::string_view label, const std::vector<StormEvent> &storm, CountingSink &counter,
+                     EventCoalescer::Options options = {}) {
+  auto start = std::chrono::steady_clock::now();
+  EventCoalescer coalescer(counter.sink(), options);
+
+  for (const auto &[event, isCreation] : storm) {
+    coalescer.push(event, isCreation);
+  }
+
+  coalescer.stop();
+
+  std::chrono::duration<double> elapsed = std::chrono::steady_clock::now() - start;
+  auto stats = coalescer.stats();
+
+  REQUIRE(stats.received == storm.size());
+  REQUIRE(stats.written == counter.events());
+  REQUIRE(stats.batches == counter.batches());
+
+  WARN(std::format("{}: {} events in {:.1f}ms: {:.0f} events/s, {} written in {} batches", label,
+                   storm.size(), elapsed.count() * 1000, storm.size() / elapsed.count(), counter.events(),
+                   counter.batches()));
+}
+
+TEST_CASE("event storm benchmark", "[benchmark]") {
+  auto storm = makeStorm();
+
+  SECTION("instant writer") {
+    CountingSink counter;
+    runStorm("instant writer", storm, counter);
+  }
+
+  SECTION("writer taking 2ms per batch") {
+    CountingSink counter(2ms);
+    runStorm("slow writer", storm, counter);
+  }
+
+  SECTION("writer taking 2ms per batch, small pending limit") {
+    CountingSink counter(2ms);
+    runStorm("slow writer, back-pressure", storm, counter, {.maxPendingEvents = 5000});
+  }
+}
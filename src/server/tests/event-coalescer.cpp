@@ -0,0 +1,184 @@
+#include "services/files-service/file-indexer/event-coalescer.hpp"
+#include <catch2/catch_test_macros.hpp>
+#include <atomic>
+#include <future>
+#include <mutex>
+
+using namespace std::chrono_literals;
+namespace fs = std::filesystem;
+
+/**
+ * Records the batches handed over by a coalescer, with a queue size the test controls.
+ */
+class RecordingSink {
+  mutable std::mutex m_mtx;
+  std::condition_variable m_cv;
+  std::vector<std::vector<FileEvent>> m_batches;
+
+public:
+  std::atomic<size_t> queueSize = 0;
+
+  EventCoalescer::Sink sink() {
+    return {.write =
+                [this](std::vector<FileEvent> events) {
+                  {
+                    std::scoped_lock lock(m_mtx);
+                    m_batches.emplace_back(std::move(events));
+                  }
+                  m_cv.notify_all();
+                },
+            .queueSize = [this]() { return queueSize.load(); }};
+  }
+
+  bool waitForBatches(size_t count, std::chrono::milliseconds timeout = 5s) {
+    std::unique_lock lock(m_mtx);
+    return m_cv.wait_for(lock, timeout, [&]() { return m_batches.size() >= count; });
+  }
+
+  std::vector<std::vector<FileEvent>> batches() const {
+    std::scoped_lock lock(m_mtx);
+    return m_batches;
+  }
+
+  std::vector<FileEvent> events() const {
+    std::vector<FileEvent> all;
+
+    for (const auto &batch : batches()) {
+      all.insert(all.end(), batch.begin(), batch.end());
+    }
+
+    return all;
+  }
+};
+
+static FileEvent modified(const fs::path &path) {
+  return FileEvent(FileEventType::Modify, path, fs::file_time_type::clock::now());
+}
+
+static FileEvent deleted(const fs::path &path) {
+  return FileEvent(FileEventType::Delete, path, fs::file_time_type::clock::now());
+}
+
+// batches only go out on stop() unless a test says otherwise
+static const EventCoalescer::Options MANUAL_FLUSH = {.maxBatchSize = 1000, .flushInterval = 1h};
+
+TEST_CASE("the last event for a path wins", "[event-coalescer]") {
+  RecordingSink sink;
+  EventCoalescer coalescer(sink.sink(), MANUAL_FLUSH);
+
+  coalescer.push(modified("/a"));
+  coalescer.push(modified("/b"));
+  coalescer.push(deleted("/a"));
+  coalescer.stop();
+
+  auto events = sink.events();
+
+  REQUIRE(sink.batches().size() == 1);
+  REQUIRE(events.size() == 2);
+
+  for (const auto &event : events) {
+    REQUIRE(event.type == (event.path == "/a" ? FileEventType::Delete : FileEventType::Modify));
+  }
+}
+
+TEST_CASE("a file created and deleted within the same window is never written", "[event-coalescer]") {
+  RecordingSink sink;
+  EventCoalescer coalescer(sink.sink(), MANUAL_FLUSH);
+
+  coalescer.push(modified("/tmp.swp"), true);
+  coalescer.push(modified("/tmp.swp"));
+  coalescer.push(deleted("/tmp.swp"));
+  // not known to be created in this window, the index may have it
+  coalescer.push(modified("/existing"));
+  coalescer.push(deleted("/existing"));
+  coalescer.stop();
+
+  auto events = sink.events();
+
+  REQUIRE(events.size() == 1);
+  REQUIRE(events[0].path == "/existing");
+  REQUIRE(events[0].type == FileEventType::Delete);
+
+  auto stats = coalescer.stats();
+
+  REQUIRE(stats.received == 5);
+  REQUIRE(stats.written == 1);
+}
+
+TEST_CASE("a batch is flushed once enough distinct paths are pending", "[event-coalescer]") {
+  RecordingSink sink;
+  EventCoalescer coalescer(sink.sink(), {.maxBatchSize = 10, .flushInterval = 1h});
+
+  for (int i = 0; i != 25; ++i) {
+    coalescer.push(modified("/file" + std::to_string(i)));
+  }
+
+  // the flushing thread takes whatever is pending when it wakes up, which can be more than a batch
+  REQUIRE(sink.waitForBatches(1));
+  REQUIRE(sink.batches().front().size() >= 10);
+
+  coalescer.stop();
+
+  auto batches = sink.batches();
+  size_t total = 0;
+
+  for (const auto &batch : batches) {
+    total += batch.size();
+  }
+
+  REQUIRE(total == 25);
+}
+
+TEST_CASE("a batch is flushed after the flush interval", "[event-coalescer]") {
+  RecordingSink sink;
+  EventCoalescer coalescer(sink.sink(), {.maxBatchSize = 1000, .flushInterval = 20ms});
+
+  coalescer.push(modified("/a"));
+  coalescer.push(modified("/b"));
+
+  REQUIRE(sink.waitForBatches(1));
+  REQUIRE(sink.batches().front().size() == 2);
+}
+
+TEST_CASE("push blocks while the writer lags and too many paths are pending", "[event-coalescer]") {
+  RecordingSink sink;
+  EventCoalescer coalescer(
+      sink.sink(), {.maxBatchSize = 1, .flushInterval = 1ms, .maxPendingEvents = 3, .maxWriterQueueSize = 0});
+
+  sink.queueSize = 1;
+
+  // taken by the flushing thread, which then waits for the writer to catch up
+  coalescer.push(modified("/first"));
+
+  while (coalescer.stats().batches == 0) {
+    std::this_thread::sleep_for(1ms);
+  }
+
+  for (int i = 0; i != 3; ++i) {
+    coalescer.push(modified("/pending" + std::to_string(i)));
+  }
+
+  auto blocked = std::async(std::launch::async, [&]() { coalescer.push(modified("/blocked")); });
+
+  REQUIRE(blocked.wait_for(50ms) == std::future_status::timeout);
+
+  sink.queueSize = 0;
+
+  REQUIRE(blocked.wait_for(5s) == std::future_status::ready);
+
+  coalescer.stop();
+
+  REQUIRE(sink.events().size() == 5);
+}
+
+TEST_CASE("events pushed after stop are ignored", "[event-coalescer]") {
+  RecordingSink sink;
+  EventCoalescer coalescer(sink.sink(), MANUAL_FLUSH);
+
+  coalescer.push(modified("/a"));
+  coalescer.stop();
+  coalescer.push(modified("/b"));
+
+  REQUIRE(sink.events().size() == 1);
+  REQUIRE(coalescer.stats().received == 1);
+}
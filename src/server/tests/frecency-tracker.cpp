@@ -0,0 +1,248 @@
+#include "services/root-item-manager/frecency-tracker.hpp"
+#include <catch2/catch_test_macros.hpp>
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <format>
+#include <fstream>
+#include <random>
+
+namespace fs = std::filesystem;
+
+static constexpr int64_t DAY = 24 * 3600;
+
+/**
+ * Temporary directory, removed when going out of scope.
+ */
+class TempDir {
+  fs::path m_root;
+
+public:
+  fs::path operator/(std::string_view name) const { return m_root / name; }
+
+  TempDir() {
+    std::random_device rd;
+    m_root = fs::temp_directory_path() / ("vicinae-frecency-test-" + std::to_string(rd()));
+    fs::create_directories(m_root);
+  }
+
+  ~TempDir() {
+    std::error_code ec;
+    fs::remove_all(m_root, ec);
+  }
+};
+
+static int64_t now() {
+  auto now = std::chrono::system_clock::now().time_since_epoch();
+  return std::chrono::duration_cast<std::chrono::seconds>(now).count();
+}
+
+static void write(const fs::path &path, std::string_view content) { std::ofstream(path) << content; }
+
+static std::vector<std::string> lines(const fs::path &path) {
+  std::ifstream ifs(path);
+  std::vector<std::string> lines;
+
+  for (std::string line; std::getline(ifs, line);) {
+    lines.emplace_back(std::move(line));
+  }
+
+  return lines;
+}
+
+// what the score of `id` is worth now
+static double currentScore(const FrecencyTracker &tracker, const EntrypointId &id) {
+  return tracker.score(id) * tracker.decayFactor();
+}
+
+static bool approx(double value, double expected) {
+  return std::abs(value - expected) < 1e-3 * std::max(1.0, expected);
+}
+
+static const EntrypointId FIREFOX{"apps", "firefox"};
+static const EntrypointId TERMINAL{"apps", "terminal"};
+
+TEST_CASE("visits decay with a half life of HALF_LIFE_DAYS", "[frecency-tracker]") {
+  TempDir dir;
+  int64_t halfLife = FrecencyTracker::HALF_LIFE_DAYS * DAY;
+
+  write(dir / "journal", std::format("v\t{}\tapps:firefox\t\n"
+                                     "v\t{}\tapps:terminal\t\n"
+                                     "v\t{}\tapps:terminal\t\n",
+                                     now(), now() - halfLife, now() - 2 * halfLife));
+
+  FrecencyTracker tracker(dir / "journal");
+
+  REQUIRE(approx(currentScore(tracker, FIREFOX), 1));
+  REQUIRE(approx(currentScore(tracker, TERMINAL), 0.5 + 0.25));
+  REQUIRE(tracker.visitCount(TERMINAL) == 2);
+}
+
+TEST_CASE("every kind of journal line is replayed", "[frecency-tracker]") {
+  TempDir dir;
+  int64_t time = now();
+
+  write(dir / "journal", std::format("s\t{}\t2.5\t7\tapps:firefox\n"
+                                     "a\t{}\t1.5\tapps:firefox\tfire\n"
+                                     "v\t{}\tapps:firefox\tfire fox\n"
+                                     "v\t{}\tapps:terminal\tterm\n"
+                                     "v\t{}\tapps:calculator\t\n"
+                                     "f\tapps:calculator\n",
+                                     time, time, time, time, time));
+
+  FrecencyTracker tracker(dir / "journal");
+
+  REQUIRE(approx(currentScore(tracker, FIREFOX), 3.5));
+  REQUIRE(tracker.visitCount(FIREFOX) == 8);
+  REQUIRE(tracker.visitCount(TERMINAL) == 1);
+  REQUIRE(tracker.visitCount({"apps", "calculator"}) == 0);
+  REQUIRE(tracker.score({"apps", "calculator"}) == 0);
+
+  auto associations = tracker.associations("fire");
+
+  REQUIRE(associations.size() == 1);
+  REQUIRE(associations[0].id == "apps:firefox");
+  // the whole of "fire", and half of "fire fox"
+  REQUIRE(approx(associations[0].score, 1.5 + 0.5));
+  REQUIRE(tracker.associations("term").size() == 1);
+  REQUIRE(tracker.associations("x").empty());
+}
+
+TEST_CASE("malformed journal lines are skipped", "[frecency-tracker]") {
+  TempDir dir;
+
+  write(dir / "journal", std::format("v\tnot-a-time\tapps:terminal\t\n"
+                                     "s\t{}\tnan?\t1\tapps:terminal\n"
+                                     "a\t{}\t1\tapps:terminal\n"
+                                     "x\twhatever\n"
+                                     "\n"
+                                     "v\t{}\tapps:firefox\t\n",
+                                     now(), now(), now()));
+
+  FrecencyTracker tracker(dir / "journal");
+
+  REQUIRE(tracker.visitCount(TERMINAL) == 0);
+  REQUIRE(tracker.score(TERMINAL) == 0);
+  REQUIRE(tracker.visitCount(FIREFOX) == 1);
+}
+
+TEST_CASE("visits survive a restart", "[frecency-tracker]") {
+  TempDir dir;
+
+  {
+    FrecencyTracker tracker(dir / "journal");
+
+    tracker.registerVisit(FIREFOX, "  Fire\t");
+    tracker.registerVisit(TERMINAL);
+    tracker.registerVisit(TERMINAL);
+    tracker.forget(TERMINAL);
+    tracker.registerVisit(TERMINAL);
+  }
+
+  FrecencyTracker tracker(dir / "journal");
+
+  REQUIRE(tracker.visitCount(FIREFOX) == 1);
+  REQUIRE(tracker.visitCount(TERMINAL) == 1);
+  REQUIRE(tracker.associations("fire").size() == 1);
+  REQUIRE(tracker.associations("FIRE").size() == 1);
+}
+
+TEST_CASE("the journal is compacted into state lines once it grows large", "[frecency-tracker]") {
+  TempDir dir;
+
+  {
+    FrecencyTracker tracker(dir / "journal");
+
+    // a handful of visits doesn't trigger a compaction
+    tracker.registerVisit(FIREFOX, "fire");
+  }
+
+  REQUIRE(lines(dir / "journal").size() == 1);
+
+  {
+    FrecencyTracker tracker(dir / "journal");
+
+    for (int i = 0; i != 3000; ++i) {
+      tracker.registerVisit(i % 3 ? FIREFOX : TERMINAL, i % 3 ? "fire" : "term");
+    }
+  }
+
+  auto journal = lines(dir / "journal");
+
+  // one compaction wrote 2 items and 2 associations, the visits after it are appended
+  REQUIRE(journal.size() < 1000);
+  REQUIRE(journal[0].starts_with("s\t"));
+  REQUIRE(journal.back().starts_with("v\t"));
+  // the compacted journal replaced the former one, and nothing was left behind
+  REQUIRE_FALSE(fs::exists(dir / "journal.tmp"));
+
+  FrecencyTracker tracker(dir / "journal");
+
+  REQUIRE(tracker.visitCount(FIREFOX) == 2001);
+  REQUIRE(tracker.visitCount(TERMINAL) == 1000);
+  REQUIRE(approx(currentScore(tracker, FIREFOX), 2001));
+  REQUIRE(approx(tracker.associations("fire").at(0).score, 2001));
+  REQUIRE(approx(tracker.associations("term").at(0).score, 1000));
+}
+
+TEST_CASE("compaction drops what decayed to nothing", "[frecency-tracker]") {
+  TempDir dir;
+  std::string journal;
+  int64_t longAgo = now() - 3650 * DAY;
+
+  // enough lines to be compacted when loaded
+  for (int i = 0; i != 3000; ++i) {
+    journal += std::format("v\t{}\tapps:terminal\tterm\n", longAgo);
+  }
+
+  journal += std::format("v\t{}\tapps:firefox\t\n", now());
+  write(dir / "journal", journal);
+
+  {
+    FrecencyTracker tracker(dir / "journal");
+
+    REQUIRE(tracker.visitCount(TERMINAL) == 0);
+    REQUIRE(tracker.associations("term").empty());
+    REQUIRE(tracker.visitCount(FIREFOX) == 1);
+  }
+
+  REQUIRE(lines(dir / "journal").size() == 1);
+}
+
+TEST_CASE("visits of the former tracker are imported once", "[frecency-tracker]") {
+  TempDir dir;
+
+  write(dir / "legacy.json", std::format(R"({{"visited": {{"apps:firefox": )"
+                                         R"({{"last_visited_at": {}, "visit_count": 4}}}}}})",
+                                         now()));
+
+  {
+    FrecencyTracker tracker(dir / "journal", dir / "legacy.json");
+
+    REQUIRE(tracker.visitCount(FIREFOX) == 4);
+    REQUIRE(approx(currentScore(tracker, FIREFOX), 4));
+  }
+
+  REQUIRE(lines(dir / "journal").size() == 1);
+
+  // the journal exists now, the legacy file is not looked at anymore
+  write(dir / "legacy.json", "{}");
+
+  FrecencyTracker tracker(dir / "journal", dir / "legacy.json");
+
+  REQUIRE(tracker.visitCount(FIREFOX) == 4);
+}
+
+TEST_CASE("a failed import writes no journal", "[frecency-tracker]") {
+  TempDir dir;
+
+  write(dir / "legacy.json", "{ not json");
+
+  {
+    FrecencyTracker tracker(dir / "journal", dir / "legacy.json");
+
+    REQUIRE(tracker.visitCount(FIREFOX) == 0);
+  }
+
+  REQUIRE_FALSE(fs::exists(dir / "journal"));
+}
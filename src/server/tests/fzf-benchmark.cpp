@@ -0,0 +1,169 @@
+#include "lib/fzf.hpp"
+#include <catch2/benchmark/catch_benchmark.hpp>
+#include <catch2/catch_test_macros.hpp>
+#include <chrono>
+#include <format>
+#include <random>
+#include <string>
+#include <vector>
+
+static constexpr size_t PATH_COUNT = 100000;
+static constexpr size_t NAME_COUNT = 2000;
+
+/**
+ * File paths as found in a home directory: mostly lowercase, a few levels deep, with the usual suspects
+ * (dotfiles, source trees, dated photos).
+ */
+static std::vector<std::string> makePaths() {
+  std::mt19937 rng(13);
+  std::vector<std::string> roots = {"/home/user/Documents", "/home/user/Pictures/2024",
+                                    "/home/user/.config",   "/home/user/code/vicinae/src/server",
+                                    "/home/user/Downloads", "/home/user/code/linux/drivers/gpu/drm"};
+  std::vector<std::string> dirs = {"reports", "src",   "include", "assets", "Holidays", "node_modules",
+                                   "tests",   "build", "amdgpu",  "themes", "invoices", "lib"};
+  std::vector<std::string> stems = {"main",         "README",     "config",         "IMG_2024",
+                                    "index",        "settings",   "utils",          "notes",
+                                    "file-indexer", "CMakeLists", "amdgpu_display", "invoice",
+                                    "screenshot",   "package",    "Q3FinancialReport"};
+  std::vector<std::string> extensions = {".cpp", ".hpp", ".md", ".json", ".jpg", ".pdf", ".txt", ".c", ".ts"};
+  std::vector<std::string> paths;
+
+  paths.reserve(PATH_COUNT);
+
+  for (size_t i = 0; i != PATH_COUNT; ++i) {
+    std::string path = roots[rng() % roots.size()];
+
+    for (size_t depth = rng() % 4; depth != 0; --depth) {
+      path += "/" + dirs[rng() % dirs.size()];
+    }
+
+    path += std::format("/{}-{}{}", stems[rng() % stems.size()], i, extensions[rng() % extensions.size()]);
+    paths.emplace_back(std::move(path));
+  }
+
+  return paths;
+}
+
+/**
+ * Root search candidates: application and command titles, short and capitalized.
+ */
+static std::vector<std::string> makeNames() {
+  std::mt19937 rng(17);
+  std::vector<std::string> words = {"Firefox",  "Visual", "Studio",    "Code",    "Terminal", "Files",
+                                    "Settings", "System", "Monitor",   "Text",    "Editor",   "Calculator",
+                                    "Search",   "Emoji",  "Clipboard", "History", "Web",      "Browser",
+                                    "Disk",     "Usage",  "Analyzer",  "Color",   "Picker",   "Manager"};
+  std::vector<std::string> names;
+
+  for (size_t i = 0; i != NAME_COUNT; ++i) {
+    std::string name = words[rng() % words.size()];
+
+    for (size_t count = rng() % 3; count != 0; --count) {
+      name += " " + words[rng() % words.size()];
+    }
+
+    names.emplace_back(std::move(name));
+  }
+
+  return names;
+}
+
+static size_t matchAll(const std::vector<std::string> &candidates, std::string_view query) {
+  size_t matched = 0;
+
+  for (const auto &candidate : candidates) {
+    matched += fzf::defaultMatcher.fuzzy_match_v2_score_query(candidate, query) > 0;
+  }
+
+  return matched;
+}
+
+/**
+ * Same as matchAll, skipping the candidates whose mask rules them out like root search does.
+ */
+static size_t matchAllMasked(const std::vector<std::string> &candidates,
+                             const std::vector<fzf::CharMask> &masks, std::string_view query) {
+  auto queryMask = fzf::queryCharMask(query);
+  size_t matched = 0;
+
+  for (size_t i = 0; i != candidates.size(); ++i) {
+    if (!fzf::mayMatch(masks[i], queryMask)) continue;
+    matched += fzf::defaultMatcher.fuzzy_match_v2_score_query(candidates[i], query) > 0;
+  }
+
+  return matched;
+}
+
+template <typename Find> static size_t findAll(const std::vector<std::string> &candidates, Find find) {
+  size_t found = 0;
+
+  for (const auto &candidate : candidates) {
+    // characters most paths lack, so that they are scanned whole
+    found += find(candidate, 0, 'x') != std::string_view::npos;
+    found += find(candidate, 0, 'J') != std::string_view::npos;
+  }
+
+  return found;
+}
+
+static void reportThroughput(std::string_view label, const std::vector<std::string> &candidates, auto &&fn) {
+  auto start = std::chrono::steady_clock::now();
+  size_t result = fn();
+  std::chrono::duration<double> elapsed = std::chrono::steady_clock::now() - start;
+
+  WARN(std::format("{}: {} candidates ({} matched) in {:.1f}ms: {:.0f} candidates/s", label,
+                   candidates.size(), result, elapsed.count() * 1000, candidates.size() / elapsed.count()));
+}
+
+TEST_CASE("fuzzy matching benchmark", "[benchmark]") {
+  auto paths = makePaths();
+  auto names = makeNames();
+  std::vector<fzf::CharMask> pathMasks;
+
+  for (const auto &path : paths) {
+    pathMasks.emplace_back(fzf::charMask(path));
+  }
+
+  REQUIRE(matchAll(paths, "reprt") == matchAllMasked(paths, pathMasks, "reprt"));
+
+  BENCHMARK("paths: short query") { return matchAll(paths, "cfg"); };
+  BENCHMARK("paths: long query") { return matchAll(paths, "financial report"); };
+  BENCHMARK("paths: rare characters") { return matchAll(paths, "qzx"); };
+  BENCHMARK("paths: rare characters, masked") { return matchAllMasked(paths, pathMasks, "qzx"); };
+  BENCHMARK("names: every keystroke of a query") {
+    size_t matched = 0;
+    for (std::string_view query = "visual studio"; !query.empty(); query.remove_suffix(1)) {
+      matched += matchAll(names, query);
+    }
+    return matched;
+  };
+
+  BENCHMARK("findByte over paths") {
+    return findAll(paths, [](std::string_view text, size_t from, char c) {
+      return fzf::findByte(text, from, c, false);
+    });
+  };
+
+  BENCHMARK("findByteScalar over paths") {
+    return findAll(paths, [](std::string_view text, size_t from, char c) {
+      return fzf::findByteScalar(text, from, c, false);
+    });
+  };
+
+  BENCHMARK("rfindByte over paths") {
+    return findAll(paths, [](std::string_view text, size_t, char c) {
+      return fzf::rfindByte(text, 0, c, false);
+    });
+  };
+
+  BENCHMARK("rfindByteScalar over paths") {
+    return findAll(paths, [](std::string_view text, size_t, char c) {
+      return fzf::rfindByteScalar(text, 0, c, false);
+    });
+  };
+
+  reportThroughput("paths, 'main'", paths, [&]() { return matchAll(paths, "main"); });
+  reportThroughput("paths, 'Q3 report'", paths, [&]() { return matchAll(paths, "Q3 report"); });
+  reportThroughput("paths, 'qzx' masked", paths, [&]() { return matchAllMasked(paths, pathMasks, "qzx"); });
+  reportThroughput("names, 'vsc'", names, [&]() { return matchAll(names, "vsc"); });
+}
@@ -0,0 +1,95 @@
+#include "lib/fzf-unicode.hpp"
+#include <catch2/catch_test_macros.hpp>
+#include <random>
+
+static std::u32string fold(std::string_view utf8) { return fzf::foldText(utf8).text; }
+
+static int scoreFolded(std::string_view text, std::string_view query) {
+  auto folded = fzf::foldText(text);
+  return fzf::defaultMatcher.fuzzy_match_v2(folded.view(), fzf::foldQuery(query)).score;
+}
+
+TEST_CASE("diacritics are stripped and case is folded", "[fzf-unicode]") {
+  REQUIRE(fold("Éditeur de texte") == U"editeur de texte");
+  REQUIRE(fold("Ångström") == U"angstrom");
+  REQUIRE(fold("ÇA VA") == U"ca va");
+  REQUIRE(fold("Hello World") == U"hello world");
+  REQUIRE(fold("") == U"");
+}
+
+TEST_CASE("compatibility forms decompose to their plain counterpart", "[fzf-unicode]") {
+  REQUIRE(fold("ﬁle") == U"file");
+  REQUIRE(fold("Ｆｉｒｅｆｏｘ") == U"firefox");
+  REQUIRE(fold("①") == U"1");
+}
+
+TEST_CASE("other scripts are folded the same way", "[fzf-unicode]") {
+  REQUIRE(fold("日本語") == U"日本語");
+  REQUIRE(fold("Ελληνικά") == U"ελληνικα");
+}
+
+TEST_CASE("invalid UTF-8 decodes to replacement characters", "[fzf-unicode]") {
+  REQUIRE(fold("a\x80z") == U"a\uFFFDz");
+  REQUIRE(fold("a\xC3") == U"a\uFFFD");
+}
+
+TEST_CASE("each codepoint keeps the byte offset of the character it comes from", "[fzf-unicode]") {
+  auto ligature = fzf::foldText("ﬁle");
+
+  REQUIRE(ligature.offsets == std::vector<uint32_t>{0, 0, 3, 4});
+  // both halves of the ligature are highlighted as one character
+  REQUIRE(ligature.sourcePositions({0, 1, 2}) == std::vector<int>{0, 3});
+
+  auto accented = fzf::foldText("Éd");
+
+  REQUIRE(accented.offsets == std::vector<uint32_t>{0, 2});
+}
+
+TEST_CASE("case is remembered for camelCase bonuses", "[fzf-unicode]") {
+  auto folded = fzf::foldText("ÉditeurDeTexte");
+
+  REQUIRE(folded.upper == std::vector<uint8_t>{1, 0, 0, 0, 0, 0, 0, 1, 0, 1, 0, 0, 0, 0});
+  REQUIRE(scoreFolded("ÉditeurDeTexte", "dt") > scoreFolded("Éditeurdetexte", "dt"));
+}
+
+TEST_CASE("the mask covers the folded text", "[fzf-unicode]") {
+  auto folded = fzf::foldText("Éditeur");
+
+  REQUIRE(folded.mask == fzf::charMask(std::u32string_view(U"editeur")));
+  REQUIRE(fzf::mayMatch(folded.mask, fzf::queryCharMask(fzf::foldQuery("EDIT"))));
+}
+
+TEST_CASE("queries are folded like candidates", "[fzf-unicode]") {
+  REQUIRE(fzf::foldQuery("Édit Texte") == U"edit texte");
+  REQUIRE(scoreFolded("Éditeur de texte", "editeur") > 0);
+  REQUIRE(scoreFolded("Editeur de texte", "éditeur") > 0);
+  REQUIRE(scoreFolded("Ｆｉｒｅｆｏｘ", "firefox") > 0);
+  REQUIRE(scoreFolded("Firefox", "chrome") == 0);
+}
+
+TEST_CASE("folded matching scores ASCII text like byte matching", "[fzf-unicode]") {
+  std::mt19937 rng(5);
+  std::string_view alphabet = "abcdABCD019 -_/.:";
+
+  auto randomString = [&](size_t maxLength) {
+    std::string str(rng() % (maxLength + 1), ' ');
+    for (char &c : str) {
+      c = alphabet[rng() % alphabet.size()];
+    }
+    return str;
+  };
+
+  for (int i = 0; i != 20000; ++i) {
+    std::string text = randomString(40);
+    std::string pattern = randomString(4);
+    auto folded = fzf::foldText(text);
+    auto bytes = fzf::defaultMatcher.fuzzy_match_v2(text, pattern, false, true);
+    auto codepoints = fzf::defaultMatcher.fuzzy_match_v2(folded.view(), fzf::foldQuery(pattern), true);
+
+    INFO("text: '" << text << "', pattern: '" << pattern << "'");
+    REQUIRE(codepoints.start == bytes.start);
+    REQUIRE(codepoints.end == bytes.end);
+    REQUIRE(codepoints.score == bytes.score);
+    REQUIRE(codepoints.positions == bytes.positions);
+  }
+}
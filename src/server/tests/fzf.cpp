@@ -0,0 +1,146 @@
+#include "lib/fzf.hpp"
+#include <catch2/catch_test_macros.hpp>
+#include <algorithm>
+#include <cctype>
+#include <random>
+#include <string>
+#include <vector>
+
+static std::string randomString(std::mt19937 &rng, std::string_view alphabet, size_t maxLength) {
+  std::string str(rng() % (maxLength + 1), ' ');
+
+  for (char &c : str) {
+    c = alphabet[rng() % alphabet.size()];
+  }
+
+  return str;
+}
+
+static char foldCase(char c) { return std::tolower(static_cast<unsigned char>(c)); }
+
+// whether `pattern` is a subsequence of `text`, the reference of what the matcher is expected to match
+static bool isSubsequence(std::string_view text, std::string_view pattern, bool caseSensitive) {
+  size_t i = 0;
+
+  for (char c : text) {
+    if (i == pattern.size()) break;
+    if (caseSensitive ? c == pattern[i] : foldCase(c) == foldCase(pattern[i])) ++i;
+  }
+
+  return i == pattern.size();
+}
+
+static int scoreQuery(std::string_view text, std::string_view query) {
+  return fzf::defaultMatcher.fuzzy_match_v2_score_query(text, query);
+}
+
+TEST_CASE("a query extending a previous one narrows it", "[fzf]") {
+  REQUIRE(fzf::narrowsQuery("a", "ab"));
+  REQUIRE(fzf::narrowsQuery("ab", "ab"));
+  REQUIRE(fzf::narrowsQuery("ab", "ab c"));
+  REQUIRE(fzf::narrowsQuery(" a", " a "));
+  REQUIRE_FALSE(fzf::narrowsQuery("ab", "a"));
+  REQUIRE_FALSE(fzf::narrowsQuery("ab", "ac"));
+}
+
+TEST_CASE("a query without words does not narrow the queries extending it", "[fzf]") {
+  std::vector<std::string> lines = {"x", "xylophone", "box", "abc"};
+
+  for (const auto &line : lines) {
+    REQUIRE(scoreQuery(line, " ") == 0);
+  }
+
+  REQUIRE(scoreQuery("xylophone", " x") > 0);
+  REQUIRE_FALSE(fzf::narrowsQuery("", "x"));
+  REQUIRE_FALSE(fzf::narrowsQuery(" ", " x"));
+  REQUIRE_FALSE(fzf::narrowsQuery("   ", "   x"));
+}
+
+TEST_CASE("matches of a narrowing query are matches of the previous one", "[fzf]") {
+  std::mt19937 rng(42);
+
+  for (int i = 0; i != 20000; ++i) {
+    std::string text = randomString(rng, "abcABC xy/_-.0", 30);
+    std::string previous = randomString(rng, "abcx ", 3);
+    std::string query = previous + randomString(rng, "abcx ", 3);
+
+    if (!fzf::narrowsQuery(previous, query) || scoreQuery(text, query) <= 0) continue;
+
+    INFO("text: '" << text << "', previous: '" << previous << "', query: '" << query << "'");
+    REQUIRE(scoreQuery(text, previous) > 0);
+  }
+}
+
+// letters, characters one bit away from a letter's other case and non-ASCII bytes
+static constexpr std::string_view SCAN_ALPHABET = "aAzZbB@`[{^~_ 0/\x80\xc1\xe1\xff";
+
+TEST_CASE("byte scans match the scalar implementation", "[fzf]") {
+  std::mt19937 rng(7);
+
+  for (int i = 0; i != 50000; ++i) {
+    std::string text = randomString(rng, SCAN_ALPHABET, 70);
+    char c = SCAN_ALPHABET[rng() % SCAN_ALPHABET.size()];
+    size_t from = rng() % (text.size() + 2);
+    bool caseSensitive = rng() % 2;
+
+    size_t expected = fzf::findByteScalar(text, from, c, caseSensitive);
+    size_t expectedReverse = fzf::rfindByteScalar(text, from, c, caseSensitive);
+
+    INFO("text: '" << text << "', char: '" << c << "', from: " << from << ", case sensitive: "
+                   << caseSensitive);
+    REQUIRE(fzf::findByte(text, from, c, caseSensitive) == expected);
+    REQUIRE(fzf::rfindByte(text, from, c, caseSensitive) == expectedReverse);
+  }
+}
+
+TEST_CASE("scalar byte scans find the expected positions", "[fzf]") {
+  REQUIRE(fzf::findByteScalar("Hello", 0, 'h', false) == 0);
+  REQUIRE(fzf::findByteScalar("Hello", 0, 'h', true) == std::string_view::npos);
+  REQUIRE(fzf::findByteScalar("hello", 3, 'l', false) == 3);
+  REQUIRE(fzf::findByteScalar("hello", 4, 'l', false) == std::string_view::npos);
+  REQUIRE(fzf::findByteScalar("@`", 0, '`', false) == 1);
+  REQUIRE(fzf::findByteScalar("[{", 0, '{', false) == 1);
+  REQUIRE(fzf::rfindByteScalar("abcabc", 0, 'A', false) == 3);
+  REQUIRE(fzf::rfindByteScalar("abcabc", 3, 'a', false) == std::string_view::npos);
+  REQUIRE(fzf::rfindByteScalar("abcabc", 2, 'a', false) == 3);
+}
+
+TEST_CASE("char masks never reject a text the matcher would match", "[fzf]") {
+  std::mt19937 rng(13);
+
+  for (int i = 0; i != 20000; ++i) {
+    std::string text = randomString(rng, "abcxyzABCXYZ019 -_/.@`[{\x80\xe9", 24);
+    std::string pattern = randomString(rng, "abcxyzABCXYZ019-_/.@`[{\x80\xe9", 4);
+    bool matched = fzf::defaultMatcher.fuzzy_match_v2(text, pattern).matched();
+
+    INFO("text: '" << text << "', pattern: '" << pattern << "'");
+    if (matched) { REQUIRE(fzf::mayMatch(fzf::charMask(text), fzf::queryCharMask(pattern))); }
+    if (!fzf::mayMatch(fzf::charMask(text), fzf::queryCharMask(pattern))) { REQUIRE_FALSE(matched); }
+  }
+}
+
+TEST_CASE("the matcher matches exactly the texts containing the pattern as a subsequence", "[fzf]") {
+  std::mt19937 rng(21);
+
+  for (int i = 0; i != 20000; ++i) {
+    // long enough texts to go through the SIMD scans
+    std::string text = randomString(rng, "abcdAB _/.\xe9", 48);
+    std::string pattern = randomString(rng, "abcdAB_\xe9", 4);
+    bool caseSensitive = rng() % 2;
+    auto result = fzf::defaultMatcher.fuzzy_match_v2(text, pattern, caseSensitive, true);
+
+    INFO("text: '" << text << "', pattern: '" << pattern << "', case sensitive: " << caseSensitive);
+    REQUIRE(result.matched() == isSubsequence(text, pattern, caseSensitive));
+
+    if (!result.matched() || pattern.empty()) continue;
+
+    REQUIRE(result.positions.size() == pattern.size());
+
+    REQUIRE(std::ranges::adjacent_find(result.positions, std::greater_equal{}) == result.positions.end());
+
+    for (size_t j = 0; j != pattern.size(); ++j) {
+      char c = text[result.positions[j]];
+      REQUIRE((caseSensitive ? c == pattern[j] : foldCase(c) == foldCase(pattern[j])));
+    }
+  }
+}
@@ -0,0 +1,147 @@
+#include "services/files-service/file-indexer/gitignore.hpp"
+#include <catch2/benchmark/catch_benchmark.hpp>
+#include <catch2/catch_test_macros.hpp>
+#include <chrono>
+#include <format>
+#include <fstream>
+#include <random>
+
+namespace fs = std::filesystem;
+
+static constexpr size_t PACKAGE_COUNT = 40;
+static constexpr size_t FILES_PER_DIRECTORY = 50;
+
+static constexpr const char *ROOT_IGNORE = R"(# dependencies
+node_modules/
+/vendor
+.pnp.*
+
+# build output
+build/
+dist/
+out/
+*.o
+*.a
+*.so
+*.py[cod]
+__pycache__/
+target/
+
+# logs and caches
+*.log
+!release.log
+.cache/
+coverage/
+**/tmp/**
+*.swp
+*~
+.DS_Store
+
+# generated sources
+src/**/generated/
+*.pb.cc
+*.pb.h
+)";
+
+static constexpr const char *PACKAGE_IGNORE = R"(# package local
+*.tgz
+.env
+.env.*
+!.env.example
+docs/_build/
+snapshots/*.snap
+)";
+
+/**
+ * Entries a walker would visit in a monorepo: packages with their own ignore file, each holding sources,
+ * tests, docs and build output.
+ */
+struct Corpus {
+  fs::path root;
+  // directory of each entry, with the ignore stack that applies to it
+  std::vector<std::pair<fs::path, GitIgnoreStack::Ptr>> directories;
+  std::vector<std::pair<fs::path, size_t>> files;
+
+  Corpus() {
+    std::random_device rd;
+    std::vector<std::string> ignoreFiles = {".gitignore", ".ignore"};
+    std::vector<std::string> subdirs = {"src",       "src/components", "src/generated", "test",
+                                        "docs",      "build",          "node_modules",  "tmp",
+                                        "src/utils", "docs/_build"};
+    std::vector<std::string> extensions = {".ts", ".cpp", ".o",    ".log", ".md",
+                                           ".py", ".pyc", ".json", ".snap"};
+
+    root = fs::temp_directory_path() / ("vicinae-gitignore-benchmark-" + std::to_string(rd()));
+    fs::create_directories(root);
+    std::ofstream(root / ".gitignore") << ROOT_IGNORE;
+
+    auto rootStack = GitIgnoreStack::forDirectory(root, ignoreFiles);
+
+    for (size_t i = 0; i != PACKAGE_COUNT; ++i) {
+      fs::path package = root / "packages" / std::format("package-{}", i);
+      fs::create_directories(package);
+      if (i % 2 == 0) std::ofstream(package / ".gitignore") << PACKAGE_IGNORE;
+
+      auto packageStack = GitIgnoreStack::push(rootStack, package, ignoreFiles);
+
+      for (const auto &subdir : subdirs) {
+        directories.emplace_back(package / subdir, packageStack);
+      }
+    }
+
+    for (size_t i = 0; i != directories.size(); ++i) {
+      for (size_t j = 0; j != FILES_PER_DIRECTORY; ++j) {
+        auto name = std::format("file-{}{}", j, extensions[(i + j) % extensions.size()]);
+        files.emplace_back(directories[i].first / name, i);
+      }
+    }
+  }
+
+  ~Corpus() {
+    std::error_code ec;
+    fs::remove_all(root, ec);
+  }
+};
+
+static size_t countIgnored(const Corpus &corpus) {
+  size_t ignored = 0;
+
+  for (const auto &[path, directory] : corpus.files) {
+    ignored += GitIgnoreStack::isIgnored(corpus.directories[directory].second, path, false);
+  }
+
+  return ignored;
+}
+
+TEST_CASE("gitignore matching benchmark", "[benchmark]") {
+  Corpus corpus;
+  size_t ignored = countIgnored(corpus);
+
+  REQUIRE(ignored > 0);
+  REQUIRE(ignored < corpus.files.size());
+
+  BENCHMARK("isIgnored over the whole corpus") { return countIgnored(corpus); };
+
+  BENCHMARK("building the stack of every package") {
+    std::vector<std::string> ignoreFiles = {".gitignore", ".ignore"};
+    auto stack = GitIgnoreStack::forDirectory(corpus.root, ignoreFiles);
+    size_t nodes = 0;
+
+    for (size_t i = 0; i != PACKAGE_COUNT; ++i) {
+      auto package = corpus.root / "packages" / std::format("package-{}", i);
+      nodes += GitIgnoreStack::push(stack, package, ignoreFiles) != stack;
+    }
+
+    return nodes;
+  };
+
+  {
+    auto start = std::chrono::steady_clock::now();
+    size_t count = countIgnored(corpus);
+    std::chrono::duration<double> elapsed = std::chrono::steady_clock::now() - start;
+
+    REQUIRE(count == ignored);
+    WARN(std::format("{} files ({} ignored) in {:.1f}ms: {:.0f} files/s", corpus.files.size(), ignored,
+                     elapsed.count() * 1000, corpus.files.size() / elapsed.count()));
+  }
+}
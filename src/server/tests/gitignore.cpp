@@ -0,0 +1,156 @@
+#include "services/files-service/file-indexer/gitignore.hpp"
+#include <catch2/catch_test_macros.hpp>
+#include <fstream>
+#include <random>
+
+namespace fs = std::filesystem;
+
+static bool matches(std::string_view rule, std::string_view relativePath, bool isDirectory = false) {
+  auto pattern = GitIgnorePattern::parse(rule);
+  auto slash = relativePath.find_last_of('/');
+  auto name = slash == std::string_view::npos ? relativePath : relativePath.substr(slash + 1);
+
+  REQUIRE(pattern.has_value());
+
+  return pattern->matches(relativePath, name, isDirectory);
+}
+
+/**
+ * Temporary directory tree, removed when going out of scope.
+ */
+class TempTree {
+  fs::path m_root;
+
+public:
+  void write(const fs::path &relative, std::string_view content) const {
+    fs::create_directories((m_root / relative).parent_path());
+    std::ofstream(m_root / relative) << content;
+  }
+
+  const fs::path &root() const { return m_root; }
+
+  TempTree() {
+    std::random_device rd;
+    m_root = fs::temp_directory_path() / ("vicinae-gitignore-test-" + std::to_string(rd()));
+    fs::create_directories(m_root);
+  }
+
+  ~TempTree() {
+    std::error_code ec;
+    fs::remove_all(m_root, ec);
+  }
+};
+
+TEST_CASE("blank lines and comments are not rules", "[gitignore]") {
+  REQUIRE_FALSE(GitIgnorePattern::parse(""));
+  REQUIRE_FALSE(GitIgnorePattern::parse("   "));
+  REQUIRE_FALSE(GitIgnorePattern::parse("# comment"));
+  REQUIRE_FALSE(GitIgnorePattern::parse("\r"));
+  REQUIRE_FALSE(GitIgnorePattern::parse("/"));
+  REQUIRE(matches("\\#file", "#file"));
+}
+
+TEST_CASE("plain names match at any depth", "[gitignore]") {
+  REQUIRE(matches("node_modules", "node_modules", true));
+  REQUIRE(matches("node_modules", "a/b/node_modules", true));
+  REQUIRE(matches("build", "build"));
+  REQUIRE_FALSE(matches("build", "builds"));
+  REQUIRE_FALSE(matches("build", "rebuild"));
+  REQUIRE(matches("build   ", "build"));
+  REQUIRE(matches("build\r", "build"));
+}
+
+TEST_CASE("extension rules match the end of the name", "[gitignore]") {
+  REQUIRE(matches("*.o", "main.o"));
+  REQUIRE(matches("*.o", "src/lib/main.o"));
+  REQUIRE(matches("*.o", ".o"));
+  REQUIRE_FALSE(matches("*.o", "main.c"));
+  REQUIRE_FALSE(matches("*.o", "main.ol"));
+}
+
+TEST_CASE("glob rules", "[gitignore]") {
+  REQUIRE(matches("*.py[co]", "a.pyc"));
+  REQUIRE(matches("*.py[co]", "a.pyo"));
+  REQUIRE_FALSE(matches("*.py[co]", "a.py"));
+  REQUIRE(matches("file?.txt", "file1.txt"));
+  REQUIRE_FALSE(matches("file?.txt", "file10.txt"));
+  REQUIRE(matches("[!a]*", "bcd"));
+  REQUIRE_FALSE(matches("[!a]*", "abc"));
+  REQUIRE(matches("[a-c]x", "bx"));
+  REQUIRE_FALSE(matches("[a-c]x", "dx"));
+  REQUIRE(matches("tmp*", "tmpfile"));
+}
+
+TEST_CASE("rules with a slash are anchored to the ignore file directory", "[gitignore]") {
+  REQUIRE(matches("/build", "build", true));
+  REQUIRE_FALSE(matches("/build", "sub/build", true));
+  REQUIRE(matches("doc/*.txt", "doc/notes.txt"));
+  REQUIRE_FALSE(matches("doc/*.txt", "sub/doc/notes.txt"));
+  REQUIRE_FALSE(matches("doc/*.txt", "doc/sub/notes.txt"));
+  REQUIRE(matches("/gen/", "gen", true));
+}
+
+TEST_CASE("double star matches across directories", "[gitignore]") {
+  REQUIRE(matches("**/logs", "logs", true));
+  REQUIRE(matches("**/logs", "a/b/logs", true));
+  REQUIRE(matches("a/**/b", "a/b"));
+  REQUIRE(matches("a/**/b", "a/x/b"));
+  REQUIRE(matches("a/**/b", "a/x/y/b"));
+  REQUIRE_FALSE(matches("a/**/b", "a/x/c"));
+  REQUIRE(matches("abc/**", "abc/x/y"));
+  REQUIRE_FALSE(matches("abc/**", "abd/x"));
+}
+
+TEST_CASE("a trailing slash restricts the rule to directories", "[gitignore]") {
+  REQUIRE(matches("out/", "out", true));
+  REQUIRE_FALSE(matches("out/", "out", false));
+  REQUIRE(matches("out/", "a/out", true));
+}
+
+TEST_CASE("the last matching rule of a file wins", "[gitignore]") {
+  GitIgnoreReader reader("*.log\n!important.log\n");
+
+  REQUIRE(reader.evaluate("debug.log", "debug.log", false) == true);
+  REQUIRE(reader.evaluate("important.log", "important.log", false) == false);
+  REQUIRE_FALSE(reader.evaluate("main.c", "main.c", false).has_value());
+
+  GitIgnoreReader reversed("!important.log\n*.log\n");
+
+  REQUIRE(reversed.evaluate("important.log", "important.log", false) == true);
+}
+
+TEST_CASE("deeper ignore files take precedence", "[gitignore]") {
+  TempTree tree;
+  std::vector<std::string> ignoreFiles = {".gitignore"};
+
+  tree.write(".gitignore", "*.log\n/dist\n");
+  tree.write("pkg/.gitignore", "!keep.log\ndist\n");
+
+  auto rootStack = GitIgnoreStack::forDirectory(tree.root(), ignoreFiles);
+  auto pkgStack = GitIgnoreStack::push(rootStack, tree.root() / "pkg", ignoreFiles);
+
+  REQUIRE(GitIgnoreStack::isIgnored(rootStack, tree.root() / "a.log", false));
+  REQUIRE(GitIgnoreStack::isIgnored(rootStack, tree.root() / "dist", true));
+  REQUIRE_FALSE(GitIgnoreStack::isIgnored(rootStack, tree.root() / "main.c", false));
+
+  REQUIRE(GitIgnoreStack::isIgnored(pkgStack, tree.root() / "pkg/a.log", false));
+  REQUIRE_FALSE(GitIgnoreStack::isIgnored(pkgStack, tree.root() / "pkg/keep.log", false));
+  // anchored to the root ignore file, only the nested one applies
+  REQUIRE(GitIgnoreStack::isIgnored(pkgStack, tree.root() / "pkg/dist", true));
+  REQUIRE(GitIgnoreStack::isIgnored(rootStack, tree.root() / "keep.log", false));
+}
+
+TEST_CASE("directories without ignore files share their parent's stack", "[gitignore]") {
+  TempTree tree;
+  std::vector<std::string> ignoreFiles = {".gitignore"};
+
+  tree.write(".gitignore", "*.tmp\n");
+  fs::create_directories(tree.root() / "empty");
+
+  auto rootStack = GitIgnoreStack::forDirectory(tree.root(), ignoreFiles);
+
+  REQUIRE(rootStack);
+  REQUIRE(GitIgnoreStack::push(rootStack, tree.root() / "empty", ignoreFiles) == rootStack);
+  REQUIRE(GitIgnoreStack::isIgnored(rootStack, tree.root() / "empty/x.tmp", false));
+  REQUIRE_FALSE(GitIgnoreStack::isIgnored(nullptr, tree.root() / "x.tmp", false));
+}
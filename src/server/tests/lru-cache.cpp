@@ -0,0 +1,82 @@
+#include "common/lru-cache.hpp"
+#include <catch2/catch_test_macros.hpp>
+#include <string>
+
+TEST_CASE("the least recently added entry is evicted first", "[lru-cache]") {
+  LruCache<std::string, int> cache(3);
+
+  cache.put("a", 1);
+  cache.put("b", 2);
+  cache.put("c", 3);
+  cache.put("d", 4);
+
+  REQUIRE(cache.size() == 3);
+  REQUIRE_FALSE(cache.get("a"));
+  REQUIRE(cache.get("b") == 2);
+  REQUIRE(cache.get("c") == 3);
+  REQUIRE(cache.get("d") == 4);
+
+  // b, c and d were all looked up in that order, b is the oldest again
+  cache.put("e", 5);
+
+  REQUIRE_FALSE(cache.get("b"));
+  REQUIRE(cache.get("c") == 3);
+}
+
+TEST_CASE("looking an entry up keeps it from being evicted", "[lru-cache]") {
+  LruCache<std::string, int> cache(2);
+
+  cache.put("a", 1);
+  cache.put("b", 2);
+
+  REQUIRE(cache.get("a") == 1);
+
+  cache.put("c", 3);
+
+  REQUIRE(cache.get("a") == 1);
+  REQUIRE_FALSE(cache.get("b"));
+  REQUIRE(cache.get("c") == 3);
+}
+
+TEST_CASE("putting an existing key updates it and keeps it from being evicted", "[lru-cache]") {
+  LruCache<std::string, int> cache(2);
+
+  cache.put("a", 1);
+  cache.put("b", 2);
+  cache.put("a", 10);
+
+  REQUIRE(cache.size() == 2);
+
+  cache.put("c", 3);
+
+  REQUIRE(cache.get("a") == 10);
+  REQUIRE_FALSE(cache.get("b"));
+  REQUIRE(cache.get("c") == 3);
+}
+
+TEST_CASE("a cache of capacity 0 holds nothing", "[lru-cache]") {
+  LruCache<std::string, int> cache(0);
+
+  cache.put("a", 1);
+  cache.put("a", 2);
+
+  REQUIRE(cache.size() == 0);
+  REQUIRE_FALSE(cache.get("a"));
+}
+
+TEST_CASE("a cleared cache is empty and can be filled again", "[lru-cache]") {
+  LruCache<std::string, int> cache(2);
+
+  cache.put("a", 1);
+  cache.put("b", 2);
+  cache.clear();
+
+  REQUIRE(cache.size() == 0);
+  REQUIRE_FALSE(cache.get("a"));
+
+  cache.put("c", 3);
+  cache.put("d", 4);
+
+  REQUIRE(cache.get("c") == 3);
+  REQUIRE(cache.get("d") == 4);
+}
@@ -0,0 +1,145 @@
+#include "services/root-item-manager/root-search-index.hpp"
+#include "lib/fzf-unicode.hpp"
+#include <catch2/benchmark/catch_benchmark.hpp>
+#include <catch2/catch_test_macros.hpp>
+#include <chrono>
+#include <format>
+#include <random>
+
+using Field = RootSearchIndex::Field;
+
+static constexpr size_t ITEM_COUNT = 12000;
+
+/**
+ * Root items as a heavily customized setup would have them: applications, extension commands and
+ * quicklinks, with a title, a subtitle and a few keywords, some of them localized.
+ */
+static std::vector<std::vector<std::string>> makeItems() {
+  std::mt19937 rng(23);
+  std::vector<std::string> titles = {"Firefox",       "Visual Studio Code", "Terminal",   "Files",
+                                     "Système",       "Settings",           "Calendar",   "Clipboard",
+                                     "Weather",       "Spotify",            "Calculator", "Obsidian",
+                                     "Search Emojis", "Éditeur de texte",   "Ｍｕｓｉｃ"};
+  std::vector<std::string> subtitles = {"Application", "Web Browser", "GNOME", "Extension", "Développement"};
+  std::vector<std::string> keywords = {"internet", "code", "editor", "shell", "notes", "music", "math"};
+  std::vector<std::vector<std::string>> items;
+
+  for (size_t i = 0; i != ITEM_COUNT; ++i) {
+    std::vector<std::string> fields;
+
+    fields.emplace_back(std::format("{} {}", titles[rng() % titles.size()], i));
+    fields.emplace_back(subtitles[rng() % subtitles.size()]);
+
+    for (size_t count = rng() % 3; count != 0; --count) {
+      fields.emplace_back(keywords[rng() % keywords.size()]);
+    }
+
+    items.emplace_back(std::move(fields));
+  }
+
+  return items;
+}
+
+static std::vector<Field> asFields(const std::vector<std::string> &texts) {
+  std::vector<Field> fields;
+
+  for (size_t i = 0; i != texts.size(); ++i) {
+    fields.push_back({texts[i], i == 0 ? 1.0f : 0.5f});
+  }
+
+  return fields;
+}
+
+/**
+ * Scoring through the index, skipping the items whose mask rules them out.
+ */
+static size_t matchIndex(const RootSearchIndex &index, std::string_view query) {
+  auto folded = fzf::foldQuery(query);
+  auto queryMask = fzf::queryCharMask(folded);
+  size_t matched = 0;
+
+  for (uint32_t item = 0; item != index.size(); ++item) {
+    if (!fzf::mayMatch(index.mask(item), queryMask)) continue;
+    matched += index.score(item, folded) > 0;
+  }
+
+  return matched;
+}
+
+/**
+ * Scoring each item out of its own folded fields, as items laid out one after the other would.
+ */
+static size_t matchItems(const std::vector<std::vector<fzf::FoldedText>> &items, std::string_view query) {
+  auto folded = fzf::foldQuery(query);
+  std::vector<fzf::WeightedFoldedText> texts;
+  size_t matched = 0;
+
+  for (const auto &fields : items) {
+    texts.clear();
+
+    for (size_t i = 0; i != fields.size(); ++i) {
+      texts.push_back({.text = fields[i].view(), .weight = i == 0 ? 1.0f : 0.5f});
+    }
+
+    matched += fzf::defaultMatcher.fuzzy_match_v2_score_query(texts, folded) > 0;
+  }
+
+  return matched;
+}
+
+TEST_CASE("root search benchmark", "[benchmark]") {
+  auto items = makeItems();
+  RootSearchIndex index;
+  std::vector<std::vector<fzf::FoldedText>> folded;
+
+  index.reserve(items.size());
+
+  for (const auto &texts : items) {
+    index.add(asFields(texts));
+    auto &fields = folded.emplace_back();
+    for (const auto &text : texts) {
+      fields.emplace_back(fzf::foldText(text));
+    }
+  }
+
+  for (std::string_view query : {"code", "editeur", "fire web", "zzz"}) {
+    REQUIRE(matchIndex(index, query) == matchItems(folded, query));
+  }
+
+  BENCHMARK("building the index") {
+    RootSearchIndex fresh;
+    fresh.reserve(items.size());
+    for (const auto &texts : items) {
+      fresh.add(asFields(texts));
+    }
+    return fresh.size();
+  };
+
+  // what root search does as a query is typed
+  for (std::string_view query : {"visual studio", "editeur", "qx"}) {
+    BENCHMARK(std::format("index: every keystroke of '{}'", query)) {
+      size_t matched = 0;
+      for (auto prefix = query; !prefix.empty(); prefix.remove_suffix(1)) {
+        matched += matchIndex(index, prefix);
+      }
+      return matched;
+    };
+
+    BENCHMARK(std::format("items: every keystroke of '{}'", query)) {
+      size_t matched = 0;
+      for (auto prefix = query; !prefix.empty(); prefix.remove_suffix(1)) {
+        matched += matchItems(folded, prefix);
+      }
+      return matched;
+    };
+  }
+
+  for (std::string_view query : {"code", "qx"}) {
+    auto start = std::chrono::steady_clock::now();
+    size_t matched = matchIndex(index, query);
+    std::chrono::duration<double> elapsed = std::chrono::steady_clock::now() - start;
+
+    WARN(std::format("'{}': {} items ({} matched) in {:.2f}ms: {:.0f} items/s", query, index.size(), matched,
+                     elapsed.count() * 1000, index.size() / elapsed.count()));
+  }
+}
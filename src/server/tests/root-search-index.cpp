@@ -0,0 +1,164 @@
+#include "services/root-item-manager/root-search-index.hpp"
+#include "lib/fzf-unicode.hpp"
+#include <catch2/catch_test_macros.hpp>
+#include <random>
+
+using Field = RootSearchIndex::Field;
+
+/**
+ * Score of an item made of `fields`, matched directly instead of through the index.
+ */
+static int referenceScore(const std::vector<Field> &fields, std::string_view query) {
+  std::vector<fzf::FoldedText> folded;
+  std::vector<fzf::WeightedFoldedText> texts;
+
+  if (fields.empty()) return 0;
+
+  for (const auto &field : fields) {
+    folded.emplace_back(fzf::foldText(field.text));
+  }
+
+  for (size_t i = 0; i != fields.size(); ++i) {
+    texts.push_back({.text = folded[i].view(), .weight = fields[i].weight});
+  }
+
+  return fzf::defaultMatcher.fuzzy_match_v2_score_query(texts, fzf::foldQuery(query));
+}
+
+static int score(const RootSearchIndex &index, uint32_t item, std::string_view query) {
+  return index.score(item, fzf::foldQuery(query));
+}
+
+TEST_CASE("items score like their fields matched one by one", "[root-search-index]") {
+  RootSearchIndex index;
+  std::vector<std::vector<Field>> items = {
+      {{"Firefox", 1.0f}, {"Web Browser", 0.6f}, {"internet", 0.3f}},
+      {{"Éditeur de texte", 1.0f}, {"GNOME", 0.6f}},
+      {{"Terminal", 1.0f}},
+      {},
+  };
+
+  for (const auto &fields : items) {
+    index.add(fields);
+  }
+
+  REQUIRE(index.size() == items.size());
+
+  for (std::string_view query : {"fire", "browser", "net", "editeur", "édit", "term", "x", "fire web", ""}) {
+    for (uint32_t item = 0; item != items.size(); ++item) {
+      INFO("item: " << item << ", query: '" << query << "'");
+      REQUIRE(score(index, item, query) == referenceScore(items[item], query));
+    }
+  }
+
+  REQUIRE(score(index, 0, "fire") > 0);
+  REQUIRE(score(index, 1, "editeur") > 0);
+  REQUIRE(score(index, 2, "fire") == 0);
+}
+
+TEST_CASE("item masks cover all of their fields", "[root-search-index]") {
+  RootSearchIndex index;
+  std::vector<Field> fields = {{"Ab", 1.0f}, {"Ç9", 1.0f}};
+  uint32_t item = index.add(fields);
+
+  REQUIRE(index.mask(item) == fzf::charMask(std::u32string_view(U"abc9")));
+  REQUIRE(fzf::mayMatch(index.mask(item), fzf::queryCharMask(fzf::foldQuery("c9"))));
+  REQUIRE_FALSE(fzf::mayMatch(index.mask(item), fzf::queryCharMask(fzf::foldQuery("z"))));
+}
+
+TEST_CASE("extra fields are scored with the indexed ones", "[root-search-index]") {
+  RootSearchIndex index;
+  std::vector<Field> fields = {{"Visual Studio Code", 1.0f}};
+  uint32_t item = index.add(fields);
+  uint32_t removed = index.add(fields);
+  auto alias = fzf::foldText("vsc");
+  std::vector<fzf::WeightedFoldedText> extra = {{.text = alias.view(), .weight = 1.0f}};
+
+  index.remove(removed);
+
+  REQUIRE(index.score(item, U"vsc", extra) >= index.score(item, U"vsc"));
+  REQUIRE(index.score(item, U"vsc", extra) ==
+          referenceScore({{"vsc", 1.0f}, {"Visual Studio Code", 1.0f}}, "vsc"));
+  REQUIRE(index.score(removed, U"visual") == 0);
+  REQUIRE(index.score(removed, U"vsc", extra) > 0);
+}
+
+TEST_CASE("removed items match nothing and keep the other indexes stable", "[root-search-index]") {
+  RootSearchIndex index;
+
+  uint32_t first = index.add(std::vector<Field>{{"Calculator", 1.0f}});
+  uint32_t second = index.add(std::vector<Field>{{"Calendar", 1.0f}});
+  uint32_t third = index.add(std::vector<Field>{{"Camera", 1.0f}});
+
+  index.remove(second);
+
+  REQUIRE(index.size() == 3);
+  REQUIRE(index.mask(second) == 0);
+  REQUIRE(score(index, second, "cal") == 0);
+  REQUIRE(score(index, first, "calc") > 0);
+  REQUIRE(score(index, third, "cam") > 0);
+
+  index.replace(second, std::vector<Field>{{"Clock", 1.0f}});
+
+  REQUIRE(score(index, second, "clock") > 0);
+  REQUIRE(score(index, second, "calendar") == 0);
+}
+
+TEST_CASE("replacing items over and over keeps every item intact", "[root-search-index]") {
+  RootSearchIndex index;
+  std::mt19937 rng(11);
+  std::vector<std::string> names = {"Files", "Settings", "Text Editor", "Système", "Ｍｕｓｉｃ", "Weather"};
+  std::vector<std::vector<std::string>> texts;
+
+  auto randomFields = [&]() {
+    std::vector<std::string> fields;
+    for (size_t i = 0, count = rng() % 3; i != count; ++i) {
+      fields.emplace_back(names[rng() % names.size()] + " " + std::to_string(rng() % 100));
+    }
+    return fields;
+  };
+
+  auto asFields = [](const std::vector<std::string> &strs) {
+    std::vector<Field> fields;
+    for (const auto &str : strs) {
+      fields.push_back({str, 0.5f});
+    }
+    return fields;
+  };
+
+  for (int i = 0; i != 50; ++i) {
+    texts.emplace_back(randomFields());
+    index.add(asFields(texts.back()));
+  }
+
+  // enough replacements and removals to go through several compactions
+  for (int i = 0; i != 2000; ++i) {
+    uint32_t item = rng() % texts.size();
+
+    if (rng() % 4 == 0) {
+      texts[item].clear();
+      index.remove(item);
+    } else {
+      texts[item] = randomFields();
+      index.replace(item, asFields(texts[item]));
+    }
+  }
+
+  for (std::string_view query : {"files", "sys", "music", "1", "tex edit"}) {
+    for (uint32_t item = 0; item != texts.size(); ++item) {
+      INFO("item: " << item << ", query: '" << query << "'");
+      REQUIRE(score(index, item, query) == referenceScore(asFields(texts[item]), query));
+    }
+  }
+}
+
+TEST_CASE("a cleared index is empty", "[root-search-index]") {
+  RootSearchIndex index;
+
+  index.add(std::vector<Field>{{"Firefox", 1.0f}});
+  index.clear();
+
+  REQUIRE(index.size() == 0);
+  REQUIRE(index.add(std::vector<Field>{{"Chromium", 1.0f}}) == 0);
+  REQUIRE(score(index, 0, "chrom") > 0);
+}
@@ -0,0 +1,133 @@
+#include "services/files-service/file-indexer/file-indexer-db.hpp"
+#include "services/files-service/file-indexer/file-indexer-query-engine.hpp"
+#include "services/files-service/file-indexer/trigram-index.hpp"
+#include <QCoreApplication>
+#include <algorithm>
+#include <catch2/benchmark/catch_benchmark.hpp>
+#include <catch2/catch_test_macros.hpp>
+#include <chrono>
+#include <cstdlib>
+#include <format>
+#include <fstream>
+#include <random>
+
+namespace fs = std::filesystem;
+
+static constexpr size_t FILE_COUNT = 50000;
+static constexpr size_t BULK_BATCH_SIZE = 1000;
+
+/**
+ * Temporary data home holding the indexer database and the files it indexes, which must exist as search
+ * results are checked for existence. Removed when going out of scope.
+ */
+class TempDataHome {
+  fs::path m_root;
+
+public:
+  fs::path files() const { return m_root / "files"; }
+
+  TempDataHome() {
+    std::random_device rd;
+    m_root = fs::temp_directory_path() / ("vicinae-file-search-benchmark-" + std::to_string(rd()));
+    fs::create_directories(m_root / "vicinae");
+    setenv("XDG_DATA_HOME", m_root.c_str(), 1);
+  }
+
+  ~TempDataHome() {
+    std::error_code ec;
+    fs::remove_all(m_root, ec);
+  }
+};
+
+static std::vector<FileEvent> makeFiles(const fs::path &root) {
+  std::mt19937 rng(29);
+  std::vector<std::string> dirs = {"Documents", "Pictures/2024", "code/vicinae/src", "Downloads", "Music"};
+  std::vector<std::string> stems = {"Q3financialreport", "main",   "invoice", "IMG_2024", "notes",
+                                    "setup",             "README", "budget",  "track",    "config"};
+  std::vector<std::string> extensions = {".pdf", ".cpp", ".jpg", ".md", ".ods", ".flac", ".json"};
+  std::vector<FileEvent> events;
+
+  for (size_t i = 0; i != FILE_COUNT; ++i) {
+    fs::path dir = root / dirs[rng() % dirs.size()] / std::format("folder-{}", i % 200);
+    auto stem = stems[rng() % stems.size()];
+    fs::path path = dir / std::format("{}-{}{}", stem, i, extensions[rng() % extensions.size()]);
+
+    fs::create_directories(dir);
+    std::ofstream{path};
+    events.push_back({.type = FileEventType::Modify, .path = path, .eventTime = fs::file_time_type::min()});
+  }
+
+  return events;
+}
+
+/**
+ * Seeds the database the way a full scan does, and builds the memory index out of it the way the writer
+ * does once the scan is over.
+ */
+static std::shared_ptr<TrigramIndex> seed(const TempDataHome &home) {
+  FileIndexerDatabase db;
+  auto events = makeFiles(home.files());
+  auto index = std::make_shared<TrigramIndex>();
+
+  db.runMigrations();
+
+  auto scan = db.createScan(home.files(), ScanType::Full);
+
+  REQUIRE(scan.has_value());
+
+  db.beginBulkLoad();
+
+  for (size_t i = 0; i < events.size(); i += BULK_BATCH_SIZE) {
+    auto end = events.begin() + std::min(i + BULK_BATCH_SIZE, events.size());
+    db.bulkIndexEvents(scan->id, std::vector<FileEvent>(events.begin() + i, end));
+  }
+
+  db.endBulkLoad();
+  db.forEachIndexedFile([&](std::string_view path, double score) { index->upsert(path, score); });
+  index->setReady(true);
+
+  return index;
+}
+
+static size_t query(FileIndexerQueryEngine &engine, std::string_view q) {
+  return engine.query(q, {}).result().size();
+}
+
+TEST_CASE("file search benchmark: trigram index against FTS", "[benchmark]") {
+  int argc = 0;
+  QCoreApplication app(argc, nullptr);
+  TempDataHome home;
+  auto index = seed(home);
+  FileIndexerQueryEngine fts;
+  FileIndexerQueryEngine trigram;
+
+  REQUIRE(index->size() == FILE_COUNT);
+
+  trigram.setMemoryIndex(index);
+
+  // prefixes both engines find, the benchmarks below add a substring and a typo only the trigram index does
+  for (std::string_view q : {"invoice", "main 42"}) {
+    INFO(q);
+    REQUIRE(query(fts, q) > 0);
+    REQUIRE(query(trigram, q) > 0);
+  }
+
+  for (std::string_view q : {"invoice", "main 42", "report", "finacial"}) {
+    BENCHMARK(std::format("fts: '{}'", q)) { return query(fts, q); };
+    BENCHMARK(std::format("trigram: '{}'", q)) { return query(trigram, q); };
+  }
+
+  for (auto [name, engine] : {std::pair{"fts", &fts}, std::pair{"trigram", &trigram}}) {
+    constexpr int QUERY_COUNT = 200;
+    auto start = std::chrono::steady_clock::now();
+
+    for (int i = 0; i != QUERY_COUNT; ++i) {
+      query(*engine, "invoice");
+    }
+
+    std::chrono::duration<double> elapsed = std::chrono::steady_clock::now() - start;
+
+    WARN(std::format("{}: {} queries over {} files in {:.1f}ms: {:.0f} queries/s", name, QUERY_COUNT,
+                     FILE_COUNT, elapsed.count() * 1000, QUERY_COUNT / elapsed.count()));
+  }
+}
@@ -0,0 +1,170 @@
+#include "services/files-service/file-indexer/trigram-index.hpp"
+#include <catch2/catch_test_macros.hpp>
+#include <algorithm>
+#include <string>
+
+static std::vector<std::string> search(const TrigramIndex &index, std::string_view query, size_t limit = 50) {
+  std::vector<std::string> paths;
+
+  for (const auto &path : index.search(query, 0, limit)) {
+    paths.emplace_back(path.string());
+  }
+
+  return paths;
+}
+
+static bool contains(const std::vector<std::string> &paths, std::string_view path) {
+  return std::ranges::find(paths, path) != paths.end();
+}
+
+TEST_CASE("finds substrings anywhere in the file name", "[trigram-index]") {
+  TrigramIndex index;
+
+  index.upsert("/home/user/Documents/Q3financialreport.pdf", 0);
+  index.upsert("/home/user/report/notes.txt", 0);
+  index.upsert("/home/user/Documents/budget.ods", 0);
+
+  auto results = search(index, "report");
+
+  // only names are indexed, not the directories above them
+  REQUIRE(results == std::vector<std::string>{"/home/user/Documents/Q3financialreport.pdf"});
+  REQUIRE(search(index, "REPORT") == results);
+  REQUIRE(search(index, "financial report") == results);
+  REQUIRE(search(index, "report budget").empty());
+}
+
+TEST_CASE("terms shorter than a trigram are still matched", "[trigram-index]") {
+  TrigramIndex index;
+
+  index.upsert("/a/go.mod", 0);
+  index.upsert("/a/main.go", 0);
+  index.upsert("/a/readme.md", 0);
+
+  auto results = search(index, "go");
+
+  REQUIRE(results.size() == 2);
+  REQUIRE(contains(results, "/a/go.mod"));
+  REQUIRE(contains(results, "/a/main.go"));
+}
+
+TEST_CASE("results are ordered by match quality, then score", "[trigram-index]") {
+  TrigramIndex index;
+
+  index.upsert("/x/mysetup.py", 10);
+  index.upsert("/x/setup_tools.py", 0);
+  index.upsert("/x/my-setup.cfg", 0);
+  index.upsert("/x/setup", 0);
+  index.upsert("/x/old-setup.cfg", 5);
+
+  auto results = search(index, "setup");
+
+  REQUIRE(results == std::vector<std::string>{"/x/setup", "/x/setup_tools.py", "/x/old-setup.cfg",
+                                              "/x/my-setup.cfg", "/x/mysetup.py"});
+}
+
+TEST_CASE("names sharing most of the query trigrams are returned as fuzzy matches", "[trigram-index]") {
+  TrigramIndex index;
+
+  index.upsert("/docs/Q3financialreport.pdf", 0);
+  index.upsert("/docs/unrelated.txt", 0);
+
+  auto results = search(index, "finacial");
+
+  REQUIRE(results == std::vector<std::string>{"/docs/Q3financialreport.pdf"});
+}
+
+TEST_CASE("offset and limit page through the results", "[trigram-index]") {
+  TrigramIndex index;
+
+  for (int i = 0; i != 10; ++i) {
+    index.upsert("/logs/server-" + std::to_string(i) + ".log", i);
+  }
+
+  auto all = search(index, "server", 10);
+  auto page = index.search("server", 3, 4);
+
+  REQUIRE(all.size() == 10);
+  REQUIRE(page.size() == 4);
+
+  for (size_t i = 0; i != page.size(); ++i) {
+    REQUIRE(page[i].string() == all[i + 3]);
+  }
+}
+
+TEST_CASE("removed files are not returned, and come back once upserted again", "[trigram-index]") {
+  TrigramIndex index;
+
+  index.upsert("/a/config.json", 0);
+  index.upsert("/b/config.json", 0);
+  index.remove("/a/config.json");
+  index.remove("/does/not/exist");
+
+  REQUIRE(search(index, "config") == std::vector<std::string>{"/b/config.json"});
+  REQUIRE(index.size() == 1);
+  REQUIRE(index.stats().tombstones == 1);
+
+  index.upsert("/a/config.json", 0);
+
+  REQUIRE(search(index, "config").size() == 2);
+  REQUIRE(index.stats().tombstones == 0);
+}
+
+TEST_CASE("removals are only compacted on request", "[trigram-index]") {
+  TrigramIndex index;
+  constexpr int FILE_COUNT = 12000;
+
+  for (int i = 0; i != FILE_COUNT; ++i) {
+    index.upsert("/data/file-" + std::to_string(i) + ".bin", 0);
+  }
+
+  for (int i = 0; i != FILE_COUNT; ++i) {
+    if (i % 4 != 0) index.remove("/data/file-" + std::to_string(i) + ".bin");
+  }
+
+  REQUIRE(index.stats().tombstones == FILE_COUNT / 4 * 3);
+
+  index.compactIfNeeded();
+
+  auto stats = index.stats();
+
+  REQUIRE(stats.tombstones == 0);
+  REQUIRE(stats.entries == FILE_COUNT / 4);
+
+  auto results = search(index, "file-8.bin");
+
+  REQUIRE(results.front() == "/data/file-8.bin");
+
+  for (const auto &path : results) {
+    auto number = std::stoi(path.substr(path.find('-') + 1));
+    INFO(path);
+    REQUIRE(number % 4 == 0);
+  }
+
+  // compacting again without new tombstones does nothing
+  index.compactIfNeeded();
+  REQUIRE(index.size() == FILE_COUNT / 4);
+}
+
+TEST_CASE("a few removals don't trigger a compaction", "[trigram-index]") {
+  TrigramIndex index;
+
+  index.upsert("/a/one.txt", 0);
+  index.upsert("/a/two.txt", 0);
+  index.remove("/a/one.txt");
+  index.compactIfNeeded();
+
+  REQUIRE(index.stats().tombstones == 1);
+}
+
+TEST_CASE("swap publishes an index built elsewhere", "[trigram-index]") {
+  TrigramIndex index;
+  TrigramIndex fresh;
+
+  index.upsert("/old/stale.txt", 0);
+  fresh.upsert("/new/fresh.txt", 0);
+  index.swap(fresh);
+
+  REQUIRE(search(index, "fresh") == std::vector<std::string>{"/new/fresh.txt"});
+  REQUIRE(search(index, "stale").empty());
+  REQUIRE(fresh.size() == 0);
+}